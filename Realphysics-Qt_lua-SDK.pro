@@ -113,7 +113,6 @@ SOURCES += main.cpp\
     engine/physics-engine/Collision/rpRaycastInfo.cpp \
     engine/physics-engine/Dynamics/Joint/JointAngle/rpAngleJoint.cpp \
     engine/physics-engine/Dynamics/Joint/rpBallAndSocketJoint.cpp \
-    engine/physics-engine/Dynamics/Joint/rpDistanceJoint.cpp \
     engine/physics-engine/Dynamics/Joint/rpFixedJoint.cpp \
     engine/physics-engine/Dynamics/Joint/rpHingeJoint.cpp \
     engine/physics-engine/Dynamics/Joint/rpJoint.cpp \
@@ -212,7 +211,26 @@ SOURCES += main.cpp\
     engine/physics-engine/Memory/SmartAllocator.cpp \
     engine/physics-engine/Collision/rpCollisionManager.cpp \
     engine/physics-engine/Collision/Manifold/rpContactGeneration.cpp \
-    engine/physics-engine/Dynamics/Joint/JointAngle/rpAngleAxisJoint.cpp
+    engine/physics-engine/Dynamics/Joint/JointAngle/rpAngleAxisJoint.cpp \
+    engine/physics-engine/Serialization/rpSceneFile.cpp \
+    engine/physics-engine/Serialization/rpSceneWriter.cpp \
+    engine/physics-engine/Collision/NarrowPhase/rpTimeOfImpact.cpp \
+    engine/physics-engine/Dynamics/Solver/rpContactSolverWide.cpp \
+    engine/physics-engine/Dynamics/Joint/rpJointStore.cpp \
+    engine/physics-engine/Dynamics/Joint/rpArticulation.cpp \
+    engine/physics-engine/Collision/BroadPhase/rpStaticAABBTree.cpp \
+    engine/physics-engine/Collision/Shapes/rpConcaveShape.cpp \
+    engine/physics-engine/Collision/Shapes/rpConcaveMeshShape.cpp \
+    engine/physics-engine/Collision/Shapes/rpHeightFieldShape.cpp \
+    engine/physics-engine/Collision/Shapes/rpCapsuleShape.cpp \
+    engine/physics-engine/Collision/Shapes/rpCylinderShape.cpp \
+    engine/physics-engine/Collision/Shapes/rpConeShape.cpp \
+    engine/physics-engine/Collision/NarrowPhase/rpNarrowPhaseCapsuleAlgorithm.cpp \
+    engine/physics-engine/Collision/Shapes/rpConvexHullCache.cpp \
+    engine/physics-engine/Geometry/HullSimplification/rpConvexHullSimplifier.cpp \
+    engine/physics-engine/Geometry/ConvexDecomposition/rpConvexDecomposition.cpp \
+    engine/physics-engine/Parallel/rpThreadPool.cpp \
+    engine/physics-engine/Geometry/QuickHull/rpQuickHullBatch.cpp
 
 HEADERS  += widget.h \
     glwidget.h \
@@ -471,7 +489,33 @@ HEADERS  += widget.h \
     engine/physics-engine/Collision/rpCollisionManager.h \
     engine/physics-engine/Dynamics/Solver/rpContactSolverSequentialImpulseObject.h \
     engine/physics-engine/Collision/Manifold/rpContactGeneration.h \
-    engine/physics-engine/Dynamics/Joint/JointAngle/rpAngleAxisJoint.h
+    engine/physics-engine/Dynamics/Joint/JointAngle/rpAngleAxisJoint.h \
+    engine/physics-engine/Serialization/rpSceneFormat.h \
+    engine/physics-engine/Serialization/rpSceneFile.h \
+    engine/physics-engine/Serialization/rpSceneWriter.h \
+    engine/physics-engine/Serialization/serialization.h \
+    engine/physics-engine/Collision/NarrowPhase/rpTimeOfImpact.h \
+    engine/physics-engine/Body/rpIntegrationPolicy.h \
+    engine/physics-engine/LinearMaths/rpSimd.h \
+    engine/physics-engine/Dynamics/Solver/rpContactSolverWide.h \
+    engine/physics-engine/Dynamics/Solver/rpSolverBody.h \
+    engine/physics-engine/Dynamics/Joint/rpJointStore.h \
+    engine/physics-engine/Dynamics/Joint/rpArticulation.h \
+    engine/physics-engine/Collision/BroadPhase/rpStaticAABBTree.h \
+    engine/physics-engine/Collision/Shapes/rpConcaveShape.h \
+    engine/physics-engine/Collision/Shapes/rpConcaveMeshShape.h \
+    engine/physics-engine/Collision/Shapes/rpHeightFieldShape.h \
+    engine/physics-engine/Collision/Shapes/rpCapsuleShape.h \
+    engine/physics-engine/Collision/Shapes/rpCylinderShape.h \
+    engine/physics-engine/Collision/Shapes/rpConeShape.h \
+    engine/physics-engine/Collision/NarrowPhase/rpNarrowPhaseCapsuleAlgorithm.h \
+    engine/physics-engine/Collision/Shapes/rpConvexHullCache.h \
+    engine/physics-engine/Geometry/HullSimplification/rpConvexHullSimplifier.h \
+    engine/physics-engine/Geometry/ConvexDecomposition/rpConvexDecomposition.h \
+    engine/physics-engine/Geometry/rpVertexHash.h \
+    engine/physics-engine/Parallel/parallel.h \
+    engine/physics-engine/Parallel/rpThreadPool.h \
+    engine/physics-engine/Geometry/QuickHull/rpQuickHullBatch.h
 
 FORMS    += widget.ui \
     formrunscript.ui
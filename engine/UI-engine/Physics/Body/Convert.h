@@ -40,6 +40,18 @@ namespace utility_engine
     }
 
 
+    static std::vector<unsigned int> MeshConvertToIndexes( const Mesh *mesh )
+    {
+          std::vector<unsigned int> indexes;
+          for (unsigned int part = 0; part < mesh->getNbParts(); ++part)
+          {
+              const std::vector<uint>& partIndexes = mesh->getIndices()[part];
+              indexes.insert(indexes.end(), partIndexes.begin(), partIndexes.end());
+          }
+          return indexes;
+    }
+
+
 
 }
 
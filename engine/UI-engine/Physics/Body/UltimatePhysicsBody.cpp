@@ -28,6 +28,77 @@ UltimatePhysicsBody::~UltimatePhysicsBody()
 
 //------------------------------ Method ------------------------------------//
 
+/// Hulls of the meshes shared by all the bodies
+real_physics::rpConvexHullCache& UltimatePhysicsBody::getConvexHullCache()
+{
+    static real_physics::rpConvexHullCache convexHullCache;
+    return convexHullCache;
+}
+
+
+/// Threads cooking the hulls of the meshes
+real_physics::rpThreadPool& UltimatePhysicsBody::getThreadPool()
+{
+    static real_physics::rpThreadPool threadPool;
+    return threadPool;
+}
+
+
+/// Cook the hulls of the meshes on the threads before the bodies of the scene are built
+unsigned int UltimatePhysicsBody::cookConvexHulls( const std::vector<Mesh*>& meshes )
+{
+    std::vector< std::vector<real_physics::Vector3> > pointClouds;
+    for( unsigned int i = 0; i < meshes.size(); ++i )
+    {
+        if( meshes[i] != NULL ) pointClouds.push_back( MeshConvertToVertexes(meshes[i]) );
+    }
+
+    return getConvexHullCache().cookHulls( pointClouds , getThreadPool() );
+}
+
+
+/// Convex pieces of a concave mesh for a dynamic body , the mass is shared by the volume of the pieces
+void UltimatePhysicsBody::addCollisionGeometry_ConvexDecomposition( Mesh *mesh , const Matrix4& transform , float massa ,
+                                                                    const real_physics::rpConvexDecompositionParameters& parameters ,
+                                                                    const char* cacheFileName )
+{
+    const std::vector<real_physics::Vector3> vertices = MeshConvertToVertexes(mesh);
+    const std::vector<unsigned int> indexes = MeshConvertToIndexes(mesh);
+    if( vertices.empty() || indexes.empty() ) return;
+
+    real_physics::rpConvexDecomposition decomposition(parameters);
+    decomposition.compute( &vertices[0] , vertices.size() , &indexes[0] , indexes.size() , cacheFileName );
+
+    real_physics::scalar totalVolume = 0;
+    for( unsigned int i = 0; i < decomposition.getNbPieces(); ++i )
+    {
+        totalVolume += decomposition.getPieceVolume(i);
+    }
+
+    assert( massa >= 1.0 );
+    const real_physics::Transform shapeTransform = Matrix4ConvertToTransform(transform);
+    for( unsigned int i = 0; i < decomposition.getNbPieces() && totalVolume > 0; ++i )
+    {
+        // The piece is centred on its centroid , the body takes the position of the
+        // shape as the centre of mass of the piece
+        std::vector<real_physics::Vector3> pieceVertices = decomposition.getPieceVertices(i);
+        if( pieceVertices.empty() ) continue;
+
+        real_physics::Vector3 centroid(0,0,0);
+        for( unsigned int v = 0; v < pieceVertices.size(); ++v ) centroid += pieceVertices[v];
+        centroid /= real_physics::scalar(pieceVertices.size());
+        for( unsigned int v = 0; v < pieceVertices.size(); ++v ) pieceVertices[v] -= centroid;
+
+        // The bodies built from the same mesh share the hulls of its pieces
+        real_physics::rpConvexHullShape* piece = getConvexHullCache().createShape(pieceVertices);
+        mPhysicsBody->addCollisionShape( piece , massa * decomposition.getPieceVolume(i) / totalVolume ,
+                                         shapeTransform * real_physics::Transform(centroid , real_physics::Quaternion::identity()) );
+    }
+
+    mGroupMesh.addInitMesh( mesh , transform );
+}
+
+
 /// Initilization  body type : ( DYNAMIC , STATIC , KINEMATIC )
 void UltimatePhysicsBody::setType(real_physics::BodyType type)
 {
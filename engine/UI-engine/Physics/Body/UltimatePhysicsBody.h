@@ -47,8 +47,8 @@ namespace utility_engine
 
             void addCollisionGeometry_ConvexHull( Mesh *mesh , float massa )
             {
-                real_physics::rpModelConvexHull*   initHull = new real_physics::rpModelConvexHull(MeshConvertToVertexes(mesh));
-                real_physics::rpConvexHullShape* convexHull = new real_physics::rpConvexHullShape(initHull);
+                // The bodies built from the same mesh share its hull
+                real_physics::rpConvexHullShape* convexHull = getConvexHullCache().createShape(MeshConvertToVertexes(mesh));
 
                 addCollisionGeometry( convexHull , mesh->getTransformMatrix() , massa , mesh );
             }
@@ -56,12 +56,48 @@ namespace utility_engine
 
             void addCollisionGeometry_ConvexHull( Mesh *mesh , const Matrix4& transform , float massa )
             {
-                real_physics::rpModelConvexHull*   initHull = new real_physics::rpModelConvexHull(MeshConvertToVertexes(mesh));
-                real_physics::rpConvexHullShape* convexHull = new real_physics::rpConvexHullShape(initHull);
+                // The bodies built from the same mesh share its hull
+                real_physics::rpConvexHullShape* convexHull = getConvexHullCache().createShape(MeshConvertToVertexes(mesh));
 
                 addCollisionGeometry( convexHull , transform , massa , mesh );
             }
 
+            //--------------------------------- Add collisoon geometry shape concave-mesh ------------------------------------------------//
+
+
+            void addCollisionGeometry_ConcaveMesh( Mesh *mesh , float massa )
+            {
+                real_physics::rpConcaveMeshShape* concaveMesh = new real_physics::rpConcaveMeshShape(MeshConvertToVertexes(mesh) ,
+                                                                                                       MeshConvertToIndexes(mesh));
+
+                addCollisionGeometry( concaveMesh , mesh->getTransformMatrix() , massa , mesh );
+            }
+
+
+            void addCollisionGeometry_ConcaveMesh( Mesh *mesh , const Matrix4& transform , float massa )
+            {
+                real_physics::rpConcaveMeshShape* concaveMesh = new real_physics::rpConcaveMeshShape(MeshConvertToVertexes(mesh) ,
+                                                                                                       MeshConvertToIndexes(mesh));
+
+                addCollisionGeometry( concaveMesh , transform , massa , mesh );
+            }
+
+            //--------------------------------- Add collision geometry shape convex-decomposition ----------------------------------------//
+
+            /// Convex pieces of a concave mesh for a dynamic body , the mass is shared by the volume of the pieces.
+            /// With a cache file the pieces are read from it instead of decomposing the mesh at every level load
+            void addCollisionGeometry_ConvexDecomposition( Mesh *mesh , float massa ,
+                                                          const real_physics::rpConvexDecompositionParameters& parameters = real_physics::rpConvexDecompositionParameters() ,
+                                                          const char* cacheFileName = NULL )
+            {
+                addCollisionGeometry_ConvexDecomposition( mesh , mesh->getTransformMatrix() , massa , parameters , cacheFileName );
+            }
+
+
+            void addCollisionGeometry_ConvexDecomposition( Mesh *mesh , const Matrix4& transform , float massa ,
+                                                          const real_physics::rpConvexDecompositionParameters& parameters = real_physics::rpConvexDecompositionParameters() ,
+                                                          const char* cacheFileName = NULL );
+
             //---------------------------------- Add collision geometry shape shpere  ----------------------------------------------------//
 
             void addCollisionGeometry_Sphere( Mesh *mesh , float radius , float massa )
@@ -77,6 +113,51 @@ namespace utility_engine
                 addCollisionGeometry( shape  , transform , massa , mesh );
             }
 
+            //---------------------------------- Add collision geometry shape capsule  ----------------------------------------------------//
+
+            void addCollisionGeometry_Capsule( Mesh *mesh , float radius , float height , float massa )
+            {
+                real_physics::rpCollisionShape *shape = new real_physics::rpCapsuleShape(radius , height);
+                addCollisionGeometry( shape  , mesh->getTransformMatrix() , massa , mesh );
+            }
+
+
+            void addCollisionGeometry_Capsule( Mesh *mesh , const Matrix4& transform  , float radius , float height , float massa )
+            {
+                real_physics::rpCollisionShape *shape = new real_physics::rpCapsuleShape(radius , height);
+                addCollisionGeometry( shape  , transform , massa , mesh );
+            }
+
+            //---------------------------------- Add collision geometry shape cylinder  ----------------------------------------------------//
+
+            void addCollisionGeometry_Cylinder( Mesh *mesh , float radius , float height , float massa )
+            {
+                real_physics::rpCollisionShape *shape = new real_physics::rpCylinderShape(radius , height);
+                addCollisionGeometry( shape  , mesh->getTransformMatrix() , massa , mesh );
+            }
+
+
+            void addCollisionGeometry_Cylinder( Mesh *mesh , const Matrix4& transform  , float radius , float height , float massa )
+            {
+                real_physics::rpCollisionShape *shape = new real_physics::rpCylinderShape(radius , height);
+                addCollisionGeometry( shape  , transform , massa , mesh );
+            }
+
+            //---------------------------------- Add collision geometry shape cone  ----------------------------------------------------//
+
+            void addCollisionGeometry_Cone( Mesh *mesh , float radius , float height , float massa )
+            {
+                real_physics::rpCollisionShape *shape = new real_physics::rpConeShape(radius , height);
+                addCollisionGeometry( shape  , mesh->getTransformMatrix() , massa , mesh );
+            }
+
+
+            void addCollisionGeometry_Cone( Mesh *mesh , const Matrix4& transform  , float radius , float height , float massa )
+            {
+                real_physics::rpCollisionShape *shape = new real_physics::rpConeShape(radius , height);
+                addCollisionGeometry( shape  , transform , massa , mesh );
+            }
+
              //--------------------------------- Add collision geometry shape Box halfSize ----------------------------------//
 
 
@@ -106,6 +187,16 @@ namespace utility_engine
                 if(  mesh != NULL )  mGroupMesh.addInitMesh( mesh , transform );
             }
 
+            /// Hulls of the meshes shared by all the bodies
+            static real_physics::rpConvexHullCache& getConvexHullCache();
+
+            /// Threads cooking the hulls of the meshes
+            static real_physics::rpThreadPool& getThreadPool();
+
+            /// Cook the hulls of the meshes on the threads before the bodies of the scene are built ,
+            /// the hull shapes of these meshes are then found in the cache (return the number of the hulls computed)
+            static unsigned int cookConvexHulls( const std::vector<Mesh*>& meshes );
+
             /// Initilization  body type : ( DYNAMIC , STATIC , KINEMATIC )
             void setType( real_physics::BodyType type );
 
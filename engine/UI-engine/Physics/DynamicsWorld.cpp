@@ -51,6 +51,7 @@ namespace utility_engine
     {
          UltimateJoint *joint =  new UltimateJoint(mDynamicsWorld->createJoint(jointInfo));
          mJoints.insert(joint);
+         mJointRecords[joint] = real_physics::rpSceneWriter::recordJoint(jointInfo);
          return joint;
     }
 
@@ -60,6 +61,7 @@ namespace utility_engine
     {
         mDynamicsWorld->destroyJoint(joint->getJoint());
         mJoints.erase(joint);
+        mJointRecords.erase(joint);
         delete joint;
     }
 
@@ -107,9 +109,84 @@ namespace utility_engine
 
         mBodies.clear();
         mJoints.clear();
+        mJointRecords.clear();
 
         mDynamicsWorld->destroy();
 
+        for(auto it = mSceneFiles.begin(); it != mSceneFiles.end(); ++it )
+        {
+            delete (*it);
+        }
+
+        mSceneFiles.clear();
+    }
+
+
+    /// Cook the convex hulls of the meshes of the group on all the cores
+    int DynamicsWorld::cookConvexHulls( GroupMesh* meshes )
+    {
+        assert( meshes != NULL );
+
+        std::vector<Mesh*> elementMeshes;
+        for( unsigned int i = 0; i < meshes->getElements().size(); ++i )
+        {
+            elementMeshes.push_back( meshes->getElements()[i].mMesh );
+        }
+
+        return int( UltimatePhysicsBody::cookConvexHulls( elementMeshes ) );
+    }
+
+
+    /// Write the bodies and the joints of the world to the binary scene file (*.rps)
+    bool DynamicsWorld::exportScene(const char *fileName)
+    {
+        real_physics::rpSceneWriter writer;
+
+        for(auto it = mBodies.begin(); it != mBodies.end(); ++it )
+        {
+            real_physics::rpRigidPhysicsBody* body = dynamic_cast<real_physics::rpRigidPhysicsBody*>((*it)->getPhysicsBody());
+            if( body != NULL && writer.addBody(body) == real_physics::SCENE_NULL_INDEX ) return false;
+        }
+
+        for(auto it = mJointRecords.begin(); it != mJointRecords.end(); ++it )
+        {
+            writer.addJoint(it->second);
+        }
+
+        return writer.write(fileName);
+    }
+
+
+    /// Load the binary scene file (*.rps) into the world , return the number of the bodies
+    int DynamicsWorld::importScene(const char *fileName)
+    {
+        real_physics::rpSceneFile* file = new real_physics::rpSceneFile();
+        if( !file->open(fileName) )
+        {
+            delete file;
+            return -1;
+        }
+
+        std::vector<real_physics::rpRigidPhysicsBody*> bodies;
+        std::vector<real_physics::rpJoint*>            joints;
+        std::vector<real_physics::rpSceneJointRecord>  jointRecords;
+        file->instantiate( mDynamicsWorld , &bodies , &joints , &jointRecords );
+
+        for(auto it = bodies.begin(); it != bodies.end(); ++it )
+        {
+            mBodies.insert( new UltimatePhysicsBody(*it) );
+        }
+
+        /// The imported joints are recorded like the created ones to be exported again
+        for( size_t i = 0; i < joints.size(); ++i )
+        {
+            UltimateJoint* joint = new UltimateJoint(joints[i]);
+            mJoints.insert(joint);
+            mJointRecords[joint] = jointRecords[i];
+        }
+
+        mSceneFiles.push_back(file);
+        return int(bodies.size());
 
     }
 
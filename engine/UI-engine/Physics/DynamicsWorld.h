@@ -29,6 +29,12 @@ namespace utility_engine
             std::set<UltimatePhysicsBody*>    mBodies;
             std::set<UltimateJoint*>          mJoints;
 
+            /// Construction info of the joints (for the export of the scene)
+            std::map<UltimateJoint* , real_physics::rpSceneJointRecord> mJointRecords;
+
+            /// Imported scene files , must outlive the bodies of the scene
+            std::vector<real_physics::rpSceneFile*>  mSceneFiles;
+
 
             //---------------------- Constructor ------------------------//
             /// Private copy-constructor
@@ -75,6 +81,18 @@ namespace utility_engine
             /// Realase and a delete memory
             void destroy();
 
+            /// Cook the convex hulls of the meshes of the group on all the cores before the bodies
+            /// of the scene are built , return the number of the hulls computed
+            int cookConvexHulls( GroupMesh* meshes );
+
+
+            /// Write the bodies and the joints of the world to the binary scene file (*.rps) ,
+            /// return false without writing the file if a body has a shape the format does not support
+            bool exportScene( const char* fileName );
+
+            /// Load the binary scene file (*.rps) into the world , return the number of the bodies
+            int importScene( const char* fileName );
+
 
             //------------------- value -------------------//
             real_physics::rpDynamicsWorld *getDynamicsWorld() const;
@@ -185,6 +185,35 @@ void LoadLibaryLuaPhysicsEngine::LoadLibary()
                          ]);
 
 
+    /// Collsion shape capsule
+    importToScope( luabind::namespace_("physics")
+                         [
+                            luabind::class_< real_physics::rpCapsuleShape ,  luabind::bases<real_physics::rpCollisionShape> >("shape_capsule")
+                            // constructor
+                            .def(luabind::constructor<real_physics::scalar , real_physics::scalar>())
+                         ]);
+
+
+    /// Collsion shape cylinder
+    importToScope( luabind::namespace_("physics")
+                         [
+                            luabind::class_< real_physics::rpCylinderShape ,  luabind::bases<real_physics::rpCollisionShape> >("shape_cylinder")
+                            // constructor
+                            .def(luabind::constructor<real_physics::scalar , real_physics::scalar>())
+                            .def(luabind::constructor<real_physics::scalar , real_physics::scalar , real_physics::scalar>())
+                         ]);
+
+
+    /// Collsion shape cone
+    importToScope( luabind::namespace_("physics")
+                         [
+                            luabind::class_< real_physics::rpConeShape ,  luabind::bases<real_physics::rpCollisionShape> >("shape_cone")
+                            // constructor
+                            .def(luabind::constructor<real_physics::scalar , real_physics::scalar>())
+                            .def(luabind::constructor<real_physics::scalar , real_physics::scalar , real_physics::scalar>())
+                         ]);
+
+
     /// Convex-Hull Geometry
     importToScope( luabind::namespace_("physics")
                          [
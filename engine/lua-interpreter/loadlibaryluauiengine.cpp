@@ -178,6 +178,9 @@ void LoadLibaryLuaUIEngine::LoadLibary()
                            .def( "destroy"          , &utility_engine::DynamicsWorld::destroyJoint )
                            .def( "destroy"          , &utility_engine::DynamicsWorld::destroy )
                            .def( "updateFixedStep"  , &utility_engine::DynamicsWorld::updateFixedStep )
+                           .def( "cookHulls"        , &utility_engine::DynamicsWorld::cookConvexHulls )
+                           .def( "exportScene"      , &utility_engine::DynamicsWorld::exportScene )
+                           .def( "importScene"      , &utility_engine::DynamicsWorld::importScene )
                            .def( "update"           , &utility_engine::DynamicsWorld::update ));
 
 
@@ -195,10 +198,18 @@ void LoadLibaryLuaUIEngine::LoadLibary()
                           .def("addCollide"  ,   &utility_engine::UltimatePhysicsBody::addCollisionGeometry)
                           .def("addHull"     ,   (void(utility_engine::UltimatePhysicsBody::*)(utility_engine::Mesh* , float)) &utility_engine::UltimatePhysicsBody::addCollisionGeometry_ConvexHull)
                           .def("addHull"     ,   (void(utility_engine::UltimatePhysicsBody::*)(utility_engine::Mesh* , const utility_engine::Matrix4& , float)) &utility_engine::UltimatePhysicsBody::addCollisionGeometry_ConvexHull)
+                          .def("addConcaveMesh" ,   (void(utility_engine::UltimatePhysicsBody::*)(utility_engine::Mesh* , float)) &utility_engine::UltimatePhysicsBody::addCollisionGeometry_ConcaveMesh)
+                          .def("addConcaveMesh" ,   (void(utility_engine::UltimatePhysicsBody::*)(utility_engine::Mesh* , const utility_engine::Matrix4& , float)) &utility_engine::UltimatePhysicsBody::addCollisionGeometry_ConcaveMesh)
                           .def("addSphere"   ,   (void(utility_engine::UltimatePhysicsBody::*)(utility_engine::Mesh* , float , float )) &utility_engine::UltimatePhysicsBody::addCollisionGeometry_Sphere)
                           .def("addSphere"   ,   (void(utility_engine::UltimatePhysicsBody::*)(utility_engine::Mesh* , const utility_engine::Matrix4& , float , float )) &utility_engine::UltimatePhysicsBody::addCollisionGeometry_Sphere)
                           .def("addBox"      ,   (void(utility_engine::UltimatePhysicsBody::*)(utility_engine::Mesh* , const utility_engine::Vector3& , float )) &utility_engine::UltimatePhysicsBody::addCollisionGeometry_Box)
                           .def("addBox"      ,   (void(utility_engine::UltimatePhysicsBody::*)(utility_engine::Mesh* , const utility_engine::Matrix4& , const utility_engine::Vector3& , float )) &utility_engine::UltimatePhysicsBody::addCollisionGeometry_Box)
+                          .def("addCapsule"  ,   (void(utility_engine::UltimatePhysicsBody::*)(utility_engine::Mesh* , float , float , float )) &utility_engine::UltimatePhysicsBody::addCollisionGeometry_Capsule)
+                          .def("addCapsule"  ,   (void(utility_engine::UltimatePhysicsBody::*)(utility_engine::Mesh* , const utility_engine::Matrix4& , float , float , float )) &utility_engine::UltimatePhysicsBody::addCollisionGeometry_Capsule)
+                          .def("addCylinder" ,   (void(utility_engine::UltimatePhysicsBody::*)(utility_engine::Mesh* , float , float , float )) &utility_engine::UltimatePhysicsBody::addCollisionGeometry_Cylinder)
+                          .def("addCylinder" ,   (void(utility_engine::UltimatePhysicsBody::*)(utility_engine::Mesh* , const utility_engine::Matrix4& , float , float , float )) &utility_engine::UltimatePhysicsBody::addCollisionGeometry_Cylinder)
+                          .def("addCone"     ,   (void(utility_engine::UltimatePhysicsBody::*)(utility_engine::Mesh* , float , float , float )) &utility_engine::UltimatePhysicsBody::addCollisionGeometry_Cone)
+                          .def("addCone"     ,   (void(utility_engine::UltimatePhysicsBody::*)(utility_engine::Mesh* , const utility_engine::Matrix4& , float , float , float )) &utility_engine::UltimatePhysicsBody::addCollisionGeometry_Cone)
 
                           .def("applyImpuls"        ,   &utility_engine::UltimatePhysicsBody::applyImpulse)
                           .def("applyImpulsAngular" ,   &utility_engine::UltimatePhysicsBody::applyImpulseAngular)
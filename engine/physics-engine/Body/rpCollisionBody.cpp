@@ -12,6 +12,8 @@
 #include "../Collision/Shapes/rpAABB.h"
 #include "../Collision/Shapes/rpCollisionShape.h"
 #include "../Collision/rpCollisionManager.h"
+#include "../Collision/BroadPhase/rbBroadPhaseAlgorithm.h"
+#include "../Collision/BroadPhase/rpDynamicAABBTree.h"
 #include "../Geometry/QuickHull/Structs/Ray.hpp"
 #include "rpBody.h"
 
@@ -32,6 +34,9 @@ rpCollisionBody::rpCollisionBody(const Transform& transform, rpCollisionManager*
       mProxyCollisionShapes(NULL),
       mNbCollisionShapes(0) ,
       mCollisionDetection(collideWorld) ,
+      mIsCompound(false),
+      mCompoundTree(NULL),
+      mCompoundProxy(NULL),
       mContactManifoldsList(NULL)  //, mWorld(world)
 {
 
@@ -43,6 +48,61 @@ rpCollisionBody::~rpCollisionBody()
     assert(mContactManifoldsList == NULL);
     // Remove all the proxy collision shapes of the body
     removeAllCollisionShapes();
+
+    delete mCompoundTree;
+    delete mCompoundProxy;
+}
+
+
+
+// Set whether or not the body is a compound body
+/// The proxy shapes of a compound body are not inserted separately into the
+/// broad-phase. The body has a single broad-phase entry with the AABB of all its
+/// shapes , and its shapes are in a local AABB tree (in local-space of the body)
+/// used as a midphase when the broad-phase entry of the body overlaps another
+/// shape. A body with many shapes (a vehicle made of many convex hulls for
+/// instance) then only refits one AABB in the broad-phase when it moves.
+/**
+ * @param isCompound True if the body has to be a compound body
+ */
+void rpCollisionBody::setIsCompound(bool isCompound)
+{
+    if (mIsCompound == isCompound) return;
+
+    // The shapes leave the broad-phase (or the local tree) before the change
+    if (mIsActive)
+    {
+        for (rpProxyShape* shape = mProxyCollisionShapes; shape != NULL; shape = shape->mNext)
+        {
+            mCollisionDetection->removeProxyCollisionShape(shape);
+        }
+    }
+
+    mIsCompound = isCompound;
+
+    if (mIsCompound)
+    {
+        mCompoundTree  = new rpDynamicAABBTree();
+        mCompoundProxy = new rpProxyShape(this, NULL, Transform::identity());
+    }
+    else
+    {
+        delete mCompoundTree;
+        delete mCompoundProxy;
+        mCompoundTree  = NULL;
+        mCompoundProxy = NULL;
+    }
+
+    // The shapes come back in the local tree (or in the broad-phase)
+    if (mIsActive)
+    {
+        for (rpProxyShape* shape = mProxyCollisionShapes; shape != NULL; shape = shape->mNext)
+        {
+            rpAABB aabb;
+            shape->getCollisionShape()->computeAABB(aabb, mTransform , shape->mLocalToBodyTransform , mRelativityMotion);
+            mCollisionDetection->addProxyCollisionShape(shape, aabb);
+        }
+    }
 }
 
 
@@ -211,11 +271,17 @@ void rpCollisionBody::resetContactManifoldsList()
 // Update the broad-phase state for this body (because it has moved for instance)
 void rpCollisionBody::updateBroadPhaseState() const
 {
+    if (mIsCompound)
+    {
+        updateCompoundInBroadPhase(getStepDisplacement());
+        return;
+    }
+
     // For all the proxy collision shapes of the body
     for (rpProxyShape* shape = mProxyCollisionShapes; shape != NULL; shape = shape->mNext)
     {
         // Update the proxy
-        updateProxyShapeInBroadPhase(shape , Vector3::ZERO);
+        updateProxyShapeInBroadPhase(shape , getStepDisplacement());
     }
 }
 
@@ -225,9 +291,16 @@ void rpCollisionBody::updateBroadPhaseState() const
 void rpCollisionBody::updateProxyShapeInBroadPhase(rpProxyShape* proxyShape, const Vector3& displacement, bool forceReinsert) const
 {
 
-	// Recompute the world-space AABB of the collision shape
+	// Update the cached local-to-world matrices used by the support queries
+	proxyShape->updateCachedWorldTransform();
+
+	// Recompute the world-space AABB of the collision shape swept over the motion
+	// of the step , contracted by the Lorentz boost at the start and at the end
+	Transform endTransform(mTransform.getPosition() + displacement , mTransform.getOrientation());
+
 	rpAABB aabb;
-	proxyShape->getCollisionShape()->computeAABB(aabb, mTransform , proxyShape->getLocalToBodyTransform() , mRelativityMotion.getLorentzMatrix());
+	proxyShape->getCollisionShape()->computeSweptAABB(aabb, mTransform , endTransform , proxyShape->getLocalToBodyTransform() ,
+	                                                  mRelativityMotion , getStepRelativityMotion());
 
 
 	// Update the broad-phase state for the proxy collision shape
@@ -237,10 +310,167 @@ void rpCollisionBody::updateProxyShapeInBroadPhase(rpProxyShape* proxyShape, con
 
 
 
+// Update the broad-phase state of a compound body with the AABB of its local tree
+/// The local AABBs of the shapes do not change when the body moves , so only the
+/// AABB of the root of the local tree is transformed into world-space
+void rpCollisionBody::updateCompoundInBroadPhase(const Vector3& displacement) const
+{
+    // The narrow-phase still uses the cached local-to-world matrices of each shape
+    for (rpProxyShape* shape = mProxyCollisionShapes; shape != NULL; shape = shape->mNext)
+    {
+        shape->updateCachedWorldTransform();
+    }
+
+    // The body has no shape in the broad-phase (no shape or inactive body)
+    if (mCompoundProxy->mBroadPhaseID == -1) return;
+
+    mCompoundProxy->updateCachedWorldTransform();
+
+    // AABB of the body swept over the motion of the step
+    Transform endTransform(mTransform.getPosition() + displacement , mTransform.getOrientation());
+
+    rpAABB aabb = computeCompoundAABB(mTransform , mRelativityMotion);
+    aabb.mergeWithAABB(computeCompoundAABB(endTransform , getStepRelativityMotion()));
+
+    mCollisionDetection->updateProxyCollisionShape(mCompoundProxy, aabb , displacement);
+}
+
+
+
+// Compute the world-space AABB of all the shapes of the compound body
+/**
+ * @param transform Transform of the body
+ * @param relativityMotion Lorentz contraction of the body
+ * @return The AABB of the root of the local tree in world-space
+ */
+rpAABB rpCollisionBody::computeCompoundAABB(const Transform& transform, const LorentzContraction& relativityMotion) const
+{
+    const rpAABB localAABB = mCompoundTree->getRootAABB();
+    const Vector3 localCenter = localAABB.getCenter();
+    const Vector3 halfExtents = localAABB.getExtent() * scalar(0.5);
+
+    Matrix3x3 worldMatrix = transform.getBasis();
+    if (!relativityMotion.isIdentityBoost())
+    {
+        worldMatrix = relativityMotion.getLorentzMatrix() * worldMatrix;
+    }
+
+    const Matrix3x3 worldAxis = worldMatrix.getAbsoluteMatrix();
+    const Vector3 worldHalfExtents(worldAxis.getRow(0).dot(halfExtents),
+                                   worldAxis.getRow(1).dot(halfExtents),
+                                   worldAxis.getRow(2).dot(halfExtents));
+
+    const Vector3 position = transform.getPosition() + worldMatrix * localCenter;
+
+    return rpAABB(position - worldHalfExtents , position + worldHalfExtents);
+}
+
+
+
+// Compute the world-space AABB of a proxy shape of the compound body swept over the step
+/// The AABB is inflated like the fat AABBs of the broad-phase , so the pairs of the
+/// shapes of the compound bodies are kept and removed like the other pairs
+rpAABB rpCollisionBody::computeCompoundShapeAABB(const rpProxyShape* proxyShape) const
+{
+    Transform endTransform(mTransform.getPosition() + getStepDisplacement() , mTransform.getOrientation());
+
+    rpAABB aabb;
+    proxyShape->getCollisionShape()->computeSweptAABB(aabb, mTransform , endTransform , proxyShape->getLocalToBodyTransform() ,
+                                                      mRelativityMotion , getStepRelativityMotion());
+    aabb.inflate(DYNAMIC_TREE_AABB_GAP, DYNAMIC_TREE_AABB_GAP, DYNAMIC_TREE_AABB_GAP);
+
+    return aabb;
+}
+
+
+
+// Add a proxy shape into the local AABB tree of the compound body
+void rpCollisionBody::addCompoundShape(rpProxyShape* proxyShape)
+{
+    assert(mIsCompound && proxyShape->mCompoundNodeID == -1);
+
+    rpAABB localAABB;
+    proxyShape->getCollisionShape()->computeAABB(localAABB, Transform::identity() , proxyShape->getLocalToBodyTransform());
+
+    proxyShape->mCompoundNodeID = mCompoundTree->addObject(localAABB, proxyShape);
+}
+
+
+
+// Remove a proxy shape from the local AABB tree of the compound body
+void rpCollisionBody::removeCompoundShape(rpProxyShape* proxyShape)
+{
+    assert(mIsCompound && proxyShape->mCompoundNodeID != -1);
+
+    mCompoundTree->removeObject(proxyShape->mCompoundNodeID);
+    proxyShape->mCompoundNodeID = -1;
+}
+
+
+
+// Update the local AABB of a proxy shape that has changed in the compound body
+/// The broad-phase entry of the body is refitted at the next update of the body
+void rpCollisionBody::updateCompoundShapeAABB(rpProxyShape* proxyShape)
+{
+    rpAABB localAABB;
+    proxyShape->getCollisionShape()->computeAABB(localAABB, Transform::identity() , proxyShape->getLocalToBodyTransform());
+
+    mCompoundTree->updateObject(proxyShape->mCompoundNodeID, localAABB, Vector3::ZERO, true);
+}
+
+
+
+// Report the proxy shapes of the compound body overlapping with a world-space AABB
+/// The AABB is mapped into the local-space of the body (without the Lorentz
+/// contraction of the body) and swept back over the displacement of the step ,
+/// since the local AABBs of the shapes stand for the whole step of the body
+/**
+ * @param aabb The AABB in world-space coordinates
+ * @param[out] overlappingShapes The proxy shapes overlapping with the AABB are added to this array
+ */
+void rpCollisionBody::reportCompoundShapesOverlappingWithAABB(const rpAABB& aabb,
+                                                              std::vector<rpProxyShape*>& overlappingShapes) const
+{
+    Matrix3x3 worldMatrix = mTransform.getBasis();
+    if (!mRelativityMotion.isIdentityBoost())
+    {
+        worldMatrix = mRelativityMotion.getLorentzMatrix() * worldMatrix;
+    }
+
+    const Matrix3x3 inverseMatrix = worldMatrix.getInverse();
+    const Matrix3x3 localAxis = inverseMatrix.getAbsoluteMatrix();
+
+    const Vector3 halfExtents = aabb.getExtent() * scalar(0.5);
+    const Vector3 localHalfExtents(localAxis.getRow(0).dot(halfExtents),
+                                   localAxis.getRow(1).dot(halfExtents),
+                                   localAxis.getRow(2).dot(halfExtents));
+
+    const Vector3 localCenter0 = inverseMatrix * (aabb.getCenter() - mTransform.getPosition());
+    const Vector3 localCenter1 = localCenter0 - inverseMatrix * getStepDisplacement();
+
+    rpAABB localAABB(localCenter0 - localHalfExtents , localCenter0 + localHalfExtents);
+    localAABB.mergeWithAABB(rpAABB(localCenter1 - localHalfExtents , localCenter1 + localHalfExtents));
+
+    rpAABBShapesCollectorCallback callback(*mCompoundTree, overlappingShapes);
+    mCompoundTree->reportAllShapesOverlappingWithAABB(localAABB, callback);
+}
+
+
+
 // Ask the broad-phase to test again the collision shapes of the body for collision
 // (as if the body has moved).
 void rpCollisionBody::askForBroadPhaseCollisionCheck() const
 {
+    // The compound body has a single entry in the broad-phase
+    if (mIsCompound)
+    {
+        if (mCompoundProxy->mBroadPhaseID != -1)
+        {
+            mCollisionDetection->askForBroadPhaseCollisionCheck(mCompoundProxy);
+        }
+        return;
+    }
+
     // For all the proxy collision shapes of the body
     for (rpProxyShape* shape = mProxyCollisionShapes; shape != NULL; shape = shape->mNext)
     {
@@ -250,6 +480,24 @@ void rpCollisionBody::askForBroadPhaseCollisionCheck() const
 
 
 
+// Set the variable to know whether or not the body is sleeping
+/// The collision detection is notified , so the world can move the body
+/// between the partitions of the awake and the sleeping bodies
+/**
+ * @param isSleeping True if the body is put to sleep
+ */
+void rpCollisionBody::setIsSleeping(bool isSleeping)
+{
+    if (mIsSleeping != isSleeping && mCollisionDetection != NULL)
+    {
+        mCollisionDetection->notifySleepingStateChanged(this);
+    }
+
+    rpBody::setIsSleeping(isSleeping);
+}
+
+
+
 // Set whether or not the body is active
 /**
  * @param isActive True if you want to activate the body
@@ -272,7 +520,7 @@ void rpCollisionBody::setIsActive(bool isActive)
 
             // Compute the world-space AABB of the new collision shape
             rpAABB aabb;
-            shape->getCollisionShape()->computeAABB(aabb, mTransform , shape->mLocalToBodyTransform , mRelativityMotion.getLorentzMatrix());
+            shape->getCollisionShape()->computeAABB(aabb, mTransform , shape->mLocalToBodyTransform , mRelativityMotion);
 
             // Add the proxy shape to the collision detection
              mCollisionDetection->addProxyCollisionShape(shape, aabb);
@@ -384,14 +632,14 @@ rpAABB rpCollisionBody::getAABB() const
 
     if (mProxyCollisionShapes == NULL) return bodyAABB;
 
-    mProxyCollisionShapes->getCollisionShape()->computeAABB(bodyAABB, mTransform , mProxyCollisionShapes->getLocalToBodyTransform() , mRelativityMotion.getLorentzMatrix());
+    mProxyCollisionShapes->getCollisionShape()->computeAABB(bodyAABB, mTransform , mProxyCollisionShapes->getLocalToBodyTransform() , mRelativityMotion);
 
     // For each proxy shape of the body
     for (rpProxyShape* shape = mProxyCollisionShapes->mNext; shape != NULL; shape = shape->mNext)
     {
         // Compute the world-space AABB of the collision shape
         rpAABB aabb;
-        shape->getCollisionShape()->computeAABB(aabb, mTransform , shape->getLocalToBodyTransform() , mRelativityMotion.getLorentzMatrix());
+        shape->getCollisionShape()->computeAABB(aabb, mTransform , shape->getLocalToBodyTransform() , mRelativityMotion);
 
         // Merge the proxy shape AABB with the current body AABB
         bodyAABB.mergeWithAABB(aabb);
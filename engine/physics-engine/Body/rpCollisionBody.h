@@ -13,6 +13,8 @@
 #include "../Memory/memory.h"
 #include "rpBody.h"
 
+#include <vector>
+
 
 
 namespace real_physics
@@ -27,6 +29,7 @@ namespace real_physics
 
 // Class declarations
 class   rpProxyShape;
+class   rpDynamicAABBTree;
 class   rpCollisionWorld;
 class   rpCollisionManager;
 class   rpContactManifold;
@@ -76,6 +79,16 @@ class rpCollisionBody : public rpBody
         /// Collision detection object
         rpCollisionManager     *mCollisionDetection;
 
+        /// True if the proxy shapes of the body are in the local AABB tree of the
+        /// body instead of the broad-phase (see setIsCompound())
+        bool                    mIsCompound;
+
+        /// Local AABB tree of the proxy shapes of a compound body (in local-space of the body)
+        rpDynamicAABBTree*      mCompoundTree;
+
+        /// Proxy shape of the whole compound body in the broad-phase
+        rpProxyShape*           mCompoundProxy;
+
 
         /// First element of the linked list of contact manifolds involving this body
         ContactManifoldListElement* mContactManifoldsList = NULL;
@@ -103,6 +116,28 @@ class rpCollisionBody : public rpBody
         void updateProxyShapeInBroadPhase(rpProxyShape* proxyShape, const Vector3& displacement , bool forceReinsert = false) const;
 
 
+        /// Update the broad-phase state of a compound body with the AABB of its local tree
+        void updateCompoundInBroadPhase(const Vector3& displacement) const;
+
+        /// Add a proxy shape into the local AABB tree of the compound body
+        void addCompoundShape(rpProxyShape* proxyShape);
+
+        /// Remove a proxy shape from the local AABB tree of the compound body
+        void removeCompoundShape(rpProxyShape* proxyShape);
+
+        /// Update the local AABB of a proxy shape that has changed in the compound body
+        void updateCompoundShapeAABB(rpProxyShape* proxyShape);
+
+        /// Compute the world-space AABB of all the shapes of the compound body
+        rpAABB computeCompoundAABB(const Transform& transform, const LorentzContraction& relativityMotion) const;
+
+        /// Compute the world-space AABB of a proxy shape of the compound body swept over the step
+        rpAABB computeCompoundShapeAABB(const rpProxyShape* proxyShape) const;
+
+        /// Report the proxy shapes of the compound body overlapping with a world-space AABB
+        void reportCompoundShapesOverlappingWithAABB(const rpAABB& aabb,
+                                                     std::vector<rpProxyShape*>& overlappingShapes) const;
+
         /// Ask the broad-phase to test again the collision shapes of the body for collision
         /// (as if the body has moved).
         void askForBroadPhaseCollisionCheck() const;
@@ -137,6 +172,15 @@ class rpCollisionBody : public rpBody
         /// Set whether or not the body is active
         virtual void setIsActive(bool isActive);
 
+        /// Return true if the body is a compound body
+        bool isCompound() const;
+
+        /// Set whether or not the body is a compound body
+        void setIsCompound(bool isCompound);
+
+        /// Set the variable to know whether or not the body is sleeping
+        virtual void setIsSleeping(bool isSleeping);
+
         /// Return the current position and orientation
         const Transform& getTransform() const;
 
@@ -183,12 +227,19 @@ class rpCollisionBody : public rpBody
         /// Return the relativity body world space
 		LorentzContraction getRelativityMotion() const;
 
+        /// Return the predicted displacement of the body during the step
+        virtual Vector3 getStepDisplacement() const;
+
+        /// Return the predicted Lorentz contraction of the body at the end of the step
+        virtual LorentzContraction getStepRelativityMotion() const;
+
 
         //-------------------- Friendship --------------------//
         friend class rpCollisionWorld;
         friend class rpDynamicsWorld;
         friend class rpCollisionManager;
         friend class rpBroadPhaseAlgorithm;
+        friend class rpBroadPhaseRaycastCallback;
         friend class rpConvexMeshShape;
         friend class rpProxyShape;
         friend class rpPhysicsBody;
@@ -229,6 +280,15 @@ SIMD_INLINE void rpCollisionBody::setType(BodyType type)
     }
 }
 
+// Return true if the body is a compound body
+/**
+ * @return True if the proxy shapes of the body are in its local AABB tree
+ */
+SIMD_INLINE bool rpCollisionBody::isCompound() const
+{
+    return mIsCompound;
+}
+
 // Return the current position and orientation
 /**
  * @return The current transformation of the body that transforms the local-space
@@ -253,6 +313,24 @@ SIMD_INLINE void rpCollisionBody::setTransform(const Transform& transform)
     updateBroadPhaseState();
 }
 
+// Return the predicted displacement of the body during the step
+/**
+ * @return The displacement (zero for a body that is not moved by the physics engine)
+ */
+SIMD_INLINE Vector3 rpCollisionBody::getStepDisplacement() const
+{
+    return Vector3::ZERO;
+}
+
+// Return the predicted Lorentz contraction of the body at the end of the step
+/**
+ * @return The Lorentz contraction (the current one for a body that is not moved by the physics engine)
+ */
+SIMD_INLINE LorentzContraction rpCollisionBody::getStepRelativityMotion() const
+{
+    return mRelativityMotion;
+}
+
 // Return the first element of the linked list of contact manifolds involving this body
 /**
  * @return A pointer to the first element of the linked-list with the contact
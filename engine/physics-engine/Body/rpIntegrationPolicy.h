@@ -0,0 +1,83 @@
+/*
+ * rpIntegrationPolicy.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SOURCE_ENGIE_BODY_RPINTEGRATIONPOLICY_H_
+#define SOURCE_ENGIE_BODY_RPINTEGRATIONPOLICY_H_
+
+#include "../LinearMaths/mathematics.h"
+#include "../LinearMaths/rpRelativityFunction.h"
+#include "../config.h"
+
+namespace real_physics
+{
+
+
+/**********************************************
+ *  Integration policies of the motion of a rigid body.
+ *  The policy is a template parameter of the integration , so the
+ *  Newtonian one is folded by the compiler into the plain Euler step
+ **********************************************/
+
+
+/// Relativistic integration : the Lorentz factors , the local time and
+/// the Lorentz boost of the body are computed from its velocities
+struct rpRelativisticIntegration
+{
+    static scalar gamma(const Vector3& velocity)
+    {
+        return gammaFunction(velocity);
+    }
+
+    static scalar gammaInvert(const Vector3& velocity)
+    {
+        return gammaInvertFunction(velocity);
+    }
+
+    /// Time invert interval local-frame
+    static scalar localTimeInterval(const Vector3& linearVelocity , const Vector3& angularVelocity)
+    {
+        scalar t = (sqrt(1.0 + ( linearVelocity.length() / LIGHT_MAX_VELOCITY_C)) / (1.0 - ( linearVelocity.length() / LIGHT_MAX_VELOCITY_C)) *
+                    sqrt(1.0 + (angularVelocity.length() / LIGHT_MAX_VELOCITY_C)) / (1.0 - (angularVelocity.length() / LIGHT_MAX_VELOCITY_C)));
+        return scalar(1.0) / t;
+    }
+
+    static void updateBoost(LorentzContraction& relativityMotion , const Vector3& linearVelocity)
+    {
+        relativityMotion.updateDisplacementBoost(linearVelocity);
+    }
+};
+
+
+/// Newtonian integration of the bodies much slower than the light :
+/// every Lorentz factor is one and the boost stays the identity
+struct rpNewtonianIntegration
+{
+    static scalar gamma(const Vector3& /*velocity*/)
+    {
+        return scalar(1.0);
+    }
+
+    static scalar gammaInvert(const Vector3& /*velocity*/)
+    {
+        return scalar(1.0);
+    }
+
+    static scalar localTimeInterval(const Vector3& /*linearVelocity*/ , const Vector3& /*angularVelocity*/)
+    {
+        return scalar(1.0);
+    }
+
+    static void updateBoost(LorentzContraction& relativityMotion , const Vector3& /*linearVelocity*/)
+    {
+        relativityMotion.setIdentityBoost();
+    }
+};
+
+
+} /* namespace real_physics */
+
+#endif /* SOURCE_ENGIE_BODY_RPINTEGRATIONPOLICY_H_ */
@@ -45,7 +45,7 @@ void rpPhysicsBody::removeJointFromJointsList(const rpJoint *joint)
             if (currentElement->getNext()->getPointer() == joint)
             {
                 JointListElement* elementToRemove = currentElement->getNext();
-                currentElement/*->next */ = elementToRemove->getNext();
+                currentElement->setNext(elementToRemove->getNext());
                 delete elementToRemove;
                 break;
             }
@@ -90,16 +90,18 @@ SIMD_INLINE void rpPhysicsObject::updateBroadPhaseStatee( const Vector3& _displa
 	    //DynamicsWorld& world = static_cast<DynamicsWorld&>(mWorld);
     const Vector3 displacement =  _displacement;
 
+    // A compound body refits its single broad-phase entry
+    if (mIsCompound)
+    {
+        updateCompoundInBroadPhase(displacement);
+        return;
+    }
+
     // For all the proxy collision shapes of the body
     for (rpProxyShape* shape = mProxyCollisionShapes; shape != NULL; shape = shape->mNext)
     {
-        // Recompute the world-space AABB of the collision shape
-        rpAABB aabb;
-        shape->getCollisionShape()->computeAABB(aabb, mTransform , shape->getLocalToBodyTransform() , mRelativityMotion.getLorentzMatrix());
-
-
-        // Update the broad-phase state for the proxy collision shape
-        mCollisionDetection->updateProxyCollisionShape(shape, aabb, displacement);
+        // Update the broad-phase state for the proxy collision shape (swept AABB)
+        updateProxyShapeInBroadPhase(shape, displacement);
     }
 
 }
@@ -7,6 +7,7 @@
 
 #include "rpRigidPhysicsBody.h"
 #include "rpPhysicsObject.h"
+#include "rpIntegrationPolicy.h"
 
 #include <stddef.h>
 #include <cassert>
@@ -35,22 +36,27 @@ namespace real_physics
 
 rpRigidPhysicsBody::rpRigidPhysicsBody(const Transform& transform, rpCollisionManager *CollideWorld, bodyindex id)
 :rpPhysicsBody(transform, CollideWorld, id),
+ mStepTime(0.0),
  mInitMass(scalar(1.0)),
- mCenterOfMassLocal(0, 0, 0),
- mCenterOfMassWorld(transform.getPosition()),
- mIsGravityEnabled(true),
+ mLinearFourVelocity4(0,0,0,0),
+ mAngularFourVelocity4(0,0,0,0),
+ mFourForce4(0,0,0,0),
+ mFourTorque4(0,0,0,0),
+ mFourPosition4(transform.getPosition(),0) ,
  mLinearDamping(scalar(0.004)),
  mAngularDamping(scalar(0.004)),
  mLinearVelocity(Vector3::ZERO),
  mAngularVelocity(Vector3::ZERO),
  mSplitLinearVelocity(Vector3::ZERO),
  mSplitAngularVelocity(Vector3::ZERO),
- mLinearFourVelocity4(0,0,0,0),
- mAngularFourVelocity4(0,0,0,0),
- mFourForce4(0,0,0,0),
- mFourTorque4(0,0,0,0),
- mFourPosition4(transform.getPosition(),0) ,
- mStepTime(0.0)
+ mCenterOfMassLocal(0, 0, 0),
+ mCenterOfMassWorld(transform.getPosition()),
+ mIsGravityEnabled(true),
+ mIsCCDEnabled(false),
+ mNewtonianVelocityThreshold(NEWTONIAN_VELOCITY_THRESHOLD),
+ mNbMinSolverIterations(0),
+ mSolverResidualTolerance(DECIMAL_LARGEST),
+ mSolverBodyIndex(0)
 {
 	/// body To type
 	mTypePhysics = PhysicsBodyType::RIGID_BODY;
@@ -97,9 +103,26 @@ SIMD_INLINE void rpRigidPhysicsBody::Integrate(scalar _dt)
 		}
 
 
+		// The bodies much slower than the light skip the Lorentz evolution
+		if (isNewtonianMotion(mLinearVelocity  + mExternalForce  * _dt ,
+		                      mAngularVelocity + mExternalTorque * _dt))
+		{
+			integrateMotion<rpNewtonianIntegration>(_dt);
+		}
+		else
+		{
+			integrateMotion<rpRelativisticIntegration>(_dt);
+		}
+}
+
 
-	    scalar gamma       =       gammaFunction(mLinearVelocity) * gammaFunction(mAngularVelocity);
-	    scalar gammaInvert = gammaInvertFunction(mLinearVelocity) * gammaInvertFunction(mAngularVelocity);
+
+// Integrate the velocities and the transform of the body with the given integration policy
+template<class IntegrationPolicy>
+void rpRigidPhysicsBody::integrateMotion(scalar _dt)
+{
+	    scalar gamma       =       IntegrationPolicy::gamma(mLinearVelocity) * IntegrationPolicy::gamma(mAngularVelocity);
+	    scalar gammaInvert = IntegrationPolicy::gammaInvert(mLinearVelocity) * IntegrationPolicy::gammaInvert(mAngularVelocity);
 
 
         mTotalEnergy  = Pow(mInitMass * LIGHT_MAX_VELOCITY_C , scalar(2.0)) / gamma;
@@ -162,9 +185,7 @@ SIMD_INLINE void rpRigidPhysicsBody::Integrate(scalar _dt)
          **********************************************/
 
         /// Time invert interval local-frame
-        mFourPosition4.t =  (sqrt(1.0 + ( mLinearVelocity.length() / LIGHT_MAX_VELOCITY_C)) / (1.0 - ( mLinearVelocity.length() / LIGHT_MAX_VELOCITY_C)) *
-                             sqrt(1.0 + (mAngularVelocity.length() / LIGHT_MAX_VELOCITY_C)) / (1.0 - (mAngularVelocity.length() / LIGHT_MAX_VELOCITY_C)));
-        mFourPosition4.t = scalar(1.0) / mFourPosition4.t;
+        mFourPosition4.t = IntegrationPolicy::localTimeInterval(mLinearVelocity , mAngularVelocity);
 
 
 
@@ -187,7 +208,7 @@ SIMD_INLINE void rpRigidPhysicsBody::Integrate(scalar _dt)
 
 
 	    /// Lorentz boost matrix for linear velocity
-	    mRelativityMotion.updateDisplacementBoost(mLinearVelocity);
+	    IntegrationPolicy::updateBoost(mRelativityMotion , mLinearVelocity);
 
 
         ///Translation move Objects
@@ -292,7 +313,7 @@ SIMD_INLINE void real_physics::rpRigidPhysicsBody::applyGravity(const Vector3& g
 
 SIMD_INLINE void rpRigidPhysicsBody::updateBroadPhaseState() const
 {
-    rpPhysicsObject::updateBroadPhaseStatee( mStepTime * mLinearVelocity );
+    rpPhysicsObject::updateBroadPhaseStatee( getStepDisplacement() );
 }
 
 
@@ -364,10 +385,10 @@ SIMD_INLINE void rpRigidPhysicsBody::setIsSleeping(bool isSleeping)
         mExternalForce.setToZero();
         mExternalTorque.setToZero();
         mSplitLinearVelocity.setToZero();
-        mSplitLinearVelocity.setToZero();
+        mSplitAngularVelocity.setToZero();
     }
 
-    rpBody::setIsSleeping(isSleeping);
+    rpPhysicsBody::setIsSleeping(isSleeping);
 }
 
 
@@ -524,7 +545,7 @@ SIMD_INLINE void rpRigidPhysicsBody::applyImpulse(const Vector3& impuls , const
 	// Awake the body if it was sleeping
 	if (mIsSleeping)
 	{
-        /*setIsSleeping(false);*/ return;
+        setIsSleeping(false);
 	}
 
 	applyImpulseLinear(impuls);
@@ -542,7 +563,7 @@ SIMD_INLINE void rpRigidPhysicsBody::applyImpulseAngular(const Vector3&  impuls
 	// Awake the body if it was sleeping
 	if (mIsSleeping)
 	{
-        /*setIsSleeping(false);*/ return;
+        setIsSleeping(false);
 	}
 
 	mAngularVelocity += getInertiaTensorInverseWorld() * (impuls);// * gammaInvertFunction(mAngularVelocity);
@@ -560,7 +581,7 @@ SIMD_INLINE  void rpRigidPhysicsBody::applyImpulseLinear( const Vector3& impuls
 	// Awake the body if it was sleeping
 	if (mIsSleeping)
 	{
-        /*setIsSleeping(false);*/ return;
+        setIsSleeping(false);
 	}
 
 	mLinearVelocity += getInverseMass() * (impuls);// * gammaInvertFunction(mLinearVelocity);
@@ -576,7 +597,7 @@ SIMD_INLINE void rpRigidPhysicsBody::applyForce(const Vector3& force, const Vect
 	// Awake the body if it was sleeping
 	if (mIsSleeping)
 	{
-        /*setIsSleeping(false);*/ return;
+        setIsSleeping(false);
 	}
 
 	// Add the force and torque
@@ -594,7 +615,7 @@ SIMD_INLINE void rpRigidPhysicsBody::applyTorque(const Vector3& torque)
 	// Awake the body if it was sleeping
 	if (mIsSleeping)
 	{
-        /*setIsSleeping(false);*/ return;
+        setIsSleeping(false);
 	}
 
 	// Add the torque
@@ -610,7 +631,7 @@ SIMD_INLINE void rpRigidPhysicsBody::applyForceToCenterOfMass(const Vector3& for
 	// Awake the body if it was sleeping
 	if (mIsSleeping)
 	{
-        /*setIsSleeping(false);*/ return;
+        setIsSleeping(false);
 	}
 
 	// Add the force
@@ -620,11 +641,23 @@ SIMD_INLINE void rpRigidPhysicsBody::applyForceToCenterOfMass(const Vector3& for
 void rpRigidPhysicsBody::setLinearVelocity(const Vector3 &linearVelocity)
 {
     mLinearVelocity = linearVelocity;
+
+    // Awake the body if it was sleeping
+    if (mLinearVelocity.lengthSquare() > scalar(0.0))
+    {
+        setIsSleeping(false);
+    }
 }
 
 void rpRigidPhysicsBody::setAngularVelocity(const Vector3 &angularVelocity)
 {
     mAngularVelocity = angularVelocity;
+
+    // Awake the body if it was sleeping
+    if (mAngularVelocity.lengthSquare() > scalar(0.0))
+    {
+        setIsSleeping(false);
+    }
 }
 
 
@@ -125,6 +125,24 @@ class rpRigidPhysicsBody: public rpPhysicsBody , public BlockAlloc<rpRigidPhysic
 		/// True if the gravity needs to be applied to this rigid body
 		bool mIsGravityEnabled;
 
+		/// True if the continuous collision detection is done for this body
+		bool mIsCCDEnabled;
+
+		/// Fraction of the light velocity under which the body is integrated
+		/// as in Newtonian mechanics (zero : always relativistic)
+		scalar mNewtonianVelocityThreshold;
+
+		/// Number of iterations the island of the body runs before it can stop on
+		/// convergence (zero : the value of the world)
+		uint mNbMinSolverIterations;
+
+		/// Residual under which the island of the body stops iterating (the island
+		/// takes the smallest one of its bodies and of the world)
+		scalar mSolverResidualTolerance;
+
+		/// Index of the body in the solver-body array of its island
+		uint mSolverBodyIndex;
+
 
 
 
@@ -134,6 +152,13 @@ class rpRigidPhysicsBody: public rpPhysicsBody , public BlockAlloc<rpRigidPhysic
 		virtual void applySplitImpulseLinear(const Vector3&  impuls );
 
 
+		/// Integrate the velocities and the transform with an integration policy
+		template<class IntegrationPolicy> void integrateMotion(scalar _dt);
+
+		/// Return true if the velocities are small enough for the Newtonian integration
+		bool isNewtonianMotion(const Vector3& linearVelocity , const Vector3& angularVelocity) const;
+
+
 	public:
 
 
@@ -208,6 +233,41 @@ class rpRigidPhysicsBody: public rpPhysicsBody , public BlockAlloc<rpRigidPhysic
 	    void setMaterial(const rpPhysicsMaterial& material);
 
 
+	    /// Return true if the continuous collision detection is enabled for the body
+	    bool isCCDEnabled() const;
+
+	    /// Enable/disable the continuous collision detection for the body (fast moving bodies)
+	    void setIsCCDEnabled(bool isCCDEnabled);
+
+
+	    /// Return the fraction of the light velocity under which the body is Newtonian
+	    scalar getNewtonianVelocityThreshold() const;
+
+	    /// Set the fraction of the light velocity under which the body skips the Lorentz evolution
+	    void setNewtonianVelocityThreshold(scalar beta);
+
+
+	    /// Return the number of iterations the island of the body runs before it can stop on convergence
+	    uint getNbMinSolverIterations() const;
+
+	    /// Set the number of iterations the island of the body runs at least (an island takes the
+	    /// largest number of its bodies and of the world)
+	    void setNbMinSolverIterations(uint nbIterations);
+
+	    /// Return the residual under which the island of the body stops iterating
+	    scalar getSolverResidualTolerance() const;
+
+	    /// Set the residual under which the island of the body stops iterating (an island
+	    /// takes the smallest tolerance of its bodies and of the world)
+	    void setSolverResidualTolerance(scalar tolerance);
+
+	    /// Return the predicted displacement of the body during the step
+	    virtual Vector3 getStepDisplacement() const;
+
+	    /// Return the predicted Lorentz contraction of the body at the end of the step
+	    virtual LorentzContraction getStepRelativityMotion() const;
+
+
 		/// Inertia to of mass
 	    scalar getMass() const;
 	    scalar getInverseMass() const;
@@ -244,6 +304,9 @@ class rpRigidPhysicsBody: public rpPhysicsBody , public BlockAlloc<rpRigidPhysic
 		// -------------------- Friendships -------------------- //
 		friend class rpDynamicsWorld;
         friend class rpContactSolverSequentialImpulseObject;
+        friend class rpContactSolverWide;
+        friend struct rpSolverBody;
+        friend class rpIsland;
 
 
 		friend class rpDistanceJoint;
@@ -252,6 +315,8 @@ class rpRigidPhysicsBody: public rpPhysicsBody , public BlockAlloc<rpRigidPhysic
 		friend class rpHingeJoint;
 		friend class rpSliderJoint;
         friend class rpAngleAxisJoint;
+        friend class rpJointStore;
+        friend class rpArticulation;
 
 
 };
@@ -270,6 +335,72 @@ SIMD_INLINE void rpRigidPhysicsBody::setMaterial(const rpPhysicsMaterial& materi
 }
 
 
+SIMD_INLINE bool rpRigidPhysicsBody::isCCDEnabled() const
+{
+	return mIsCCDEnabled;
+}
+
+SIMD_INLINE void rpRigidPhysicsBody::setIsCCDEnabled(bool isCCDEnabled)
+{
+	mIsCCDEnabled = isCCDEnabled;
+}
+
+
+SIMD_INLINE scalar rpRigidPhysicsBody::getNewtonianVelocityThreshold() const
+{
+	return mNewtonianVelocityThreshold;
+}
+
+SIMD_INLINE void rpRigidPhysicsBody::setNewtonianVelocityThreshold(scalar beta)
+{
+	mNewtonianVelocityThreshold = beta;
+}
+
+SIMD_INLINE uint rpRigidPhysicsBody::getNbMinSolverIterations() const
+{
+	return mNbMinSolverIterations;
+}
+
+SIMD_INLINE void rpRigidPhysicsBody::setNbMinSolverIterations(uint nbIterations)
+{
+	mNbMinSolverIterations = nbIterations;
+}
+
+SIMD_INLINE scalar rpRigidPhysicsBody::getSolverResidualTolerance() const
+{
+	return mSolverResidualTolerance;
+}
+
+SIMD_INLINE void rpRigidPhysicsBody::setSolverResidualTolerance(scalar tolerance)
+{
+	mSolverResidualTolerance = tolerance;
+}
+
+SIMD_INLINE bool rpRigidPhysicsBody::isNewtonianMotion(const Vector3& linearVelocity , const Vector3& angularVelocity) const
+{
+	const scalar maxVelocity = mNewtonianVelocityThreshold * LIGHT_MAX_VELOCITY_C;
+	const scalar maxVelocity2 = maxVelocity * maxVelocity;
+	return linearVelocity.length2()  < maxVelocity2 &&
+		   angularVelocity.length2() < maxVelocity2;
+}
+
+
+SIMD_INLINE Vector3 rpRigidPhysicsBody::getStepDisplacement() const
+{
+	return mLinearVelocity * mStepTime;
+}
+
+SIMD_INLINE LorentzContraction rpRigidPhysicsBody::getStepRelativityMotion() const
+{
+	LorentzContraction relativityMotion;
+	if (!isNewtonianMotion(mLinearVelocity , mAngularVelocity))
+	{
+		relativityMotion.updateDisplacementBoost(mLinearVelocity);
+	}
+	return relativityMotion;
+}
+
+
 SIMD_INLINE scalar rpRigidPhysicsBody::getMass() const
 {
 	return mInitMass;
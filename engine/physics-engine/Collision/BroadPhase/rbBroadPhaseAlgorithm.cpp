@@ -25,7 +25,7 @@ namespace real_physics
 rpBroadPhaseAlgorithm::rpBroadPhaseAlgorithm(rpCollisionManager* collisionDetection)
     :mDynamicAABBTree(DYNAMIC_TREE_AABB_GAP), mNbMovedShapes(0), mNbAllocatedMovedShapes(8),
      mNbNonUsedMovedShapes(0), mNbPotentialPairs(0), mNbAllocatedPotentialPairs(8),
-     mCollisionDetection(collisionDetection)
+     mCollisionDetection(collisionDetection), mNbCompoundShapeIDs(0)
 {
 
     // Allocate memory for the array of non-static proxy shapes IDs
@@ -146,6 +146,33 @@ void rpBroadPhaseAlgorithm::removeProxyCollisionShape(rpProxyShape* proxyShape)
     removeMovedCollisionShape(broadPhaseID);
 }
 
+// Give a broad-phase ID to a collision shape of a compound body
+/// The collision shapes of a compound body are not in the dynamic AABB tree , but
+/// they need a unique broad-phase ID for the keys of their overlapping pairs. The
+/// IDs are taken above COMPOUND_SHAPE_ID_OFFSET and reused after the removal of a shape.
+void rpBroadPhaseAlgorithm::addCompoundShapeID(rpProxyShape* proxyShape)
+{
+    if (!mFreeCompoundShapeIDs.empty())
+    {
+        proxyShape->mBroadPhaseID = mFreeCompoundShapeIDs.back();
+        mFreeCompoundShapeIDs.pop_back();
+    }
+    else
+    {
+        proxyShape->mBroadPhaseID = COMPOUND_SHAPE_ID_OFFSET + mNbCompoundShapeIDs;
+        mNbCompoundShapeIDs++;
+    }
+}
+
+// Release the broad-phase ID of a collision shape of a compound body
+void rpBroadPhaseAlgorithm::removeCompoundShapeID(rpProxyShape* proxyShape)
+{
+    assert(proxyShape->mBroadPhaseID >= COMPOUND_SHAPE_ID_OFFSET);
+
+    mFreeCompoundShapeIDs.push_back(proxyShape->mBroadPhaseID);
+    proxyShape->mBroadPhaseID = -1;
+}
+
 // Notify the broad-phase that a collision shape has moved and need to be updated
 void rpBroadPhaseAlgorithm::updateProxyCollisionShape(rpProxyShape* proxyShape, const rpAABB& aabb,
                                                     const Vector3& displacement, bool forceReinsert)
@@ -197,6 +224,7 @@ void rpBroadPhaseAlgorithm::computeOverlappingPairs()
     // Reset the array of collision shapes that have move (or have been created) during the
     // last simulation step
     mNbMovedShapes = 0;
+    mNbNonUsedMovedShapes = 0;
 
     // Sort the array of potential overlapping pairs in order to remove duplicate pairs
     std::sort(mPotentialPairs, mPotentialPairs + mNbPotentialPairs, rpBroadPhasePair::smallerThan);
@@ -283,6 +311,13 @@ void rpAABBOverlapCallback::notifyOverlappingNode(int nodeId)
     mBroadPhaseAlgorithm.notifyOverlappingNodes(mReferenceNodeId, nodeId);
 }
 
+// Called when a overlapping node has been found during the call to
+// DynamicAABBTree:reportAllShapesOverlappingWithAABB()
+void rpAABBShapesCollectorCallback::notifyOverlappingNode(int nodeId)
+{
+    mOverlappingShapes.push_back(static_cast<rpProxyShape*>(mDynamicAABBTree.getNodeDataPointer(nodeId)));
+}
+
 // Called for a broad-phase shape that has to be tested for raycast
 scalar rpBroadPhaseRaycastCallback::raycastBroadPhaseShape(int32 nodeId, const Ray& ray)
 {
@@ -292,6 +327,20 @@ scalar rpBroadPhaseRaycastCallback::raycastBroadPhaseShape(int32 nodeId, const R
     // Get the proxy shape from the node
     rpProxyShape* proxyShape = static_cast<rpProxyShape*>(mDynamicAABBTree.getNodeDataPointer(nodeId));
 
+    // The node of a compound body stands for all its proxy shapes , the local
+    // AABB tree of the body gives the ones that can be hit by the ray
+    if (proxyShape->isCompoundProxy())
+    {
+        const rpCollisionBody* body = proxyShape->getBody();
+        Ray localRay(body->getLocalPoint(ray.point1), body->getLocalPoint(ray.point2), ray.maxFraction);
+
+        rpCompoundRaycastCallback compoundRaycastCallback(*body->mCompoundTree, mRaycastWithCategoryMaskBits,
+                                                          mRaycastTest, ray);
+        body->mCompoundTree->raycast(localRay, compoundRaycastCallback);
+
+        return compoundRaycastCallback.getHitFraction();
+    }
+
     // Check if the raycast filtering mask allows raycast against this shape
     if ((mRaycastWithCategoryMaskBits & proxyShape->getCollisionCategoryBits()) != 0)
     {
@@ -305,6 +354,32 @@ scalar rpBroadPhaseRaycastCallback::raycastBroadPhaseShape(int32 nodeId, const R
     return hitFraction;
 }
 
+// Called for a proxy shape of the compound body that has to be tested for raycast
+scalar rpCompoundRaycastCallback::raycastBroadPhaseShape(int32 nodeId, const Ray& ray)
+{
+
+    scalar hitFraction = scalar(-1.0);
+
+    // Get the proxy shape from the node
+    rpProxyShape* proxyShape = static_cast<rpProxyShape*>(mCompoundTree.getNodeDataPointer(nodeId));
+
+    // Check if the raycast filtering mask allows raycast against this shape
+    if ((mRaycastWithCategoryMaskBits & proxyShape->getCollisionCategoryBits()) != 0)
+    {
+
+        // The local ray has the same fractions as the world-space ray
+        Ray worldRay(mWorldRay.point1, mWorldRay.point2, ray.maxFraction);
+        hitFraction = mRaycastTest.raycastAgainstShape(proxyShape, worldRay);
+
+        if (hitFraction >= scalar(0.0) && (mHitFraction < scalar(0.0) || hitFraction < mHitFraction))
+        {
+            mHitFraction = hitFraction;
+        }
+    }
+
+    return hitFraction;
+}
+
 
 
 
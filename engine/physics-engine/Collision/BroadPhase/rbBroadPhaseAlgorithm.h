@@ -86,6 +86,37 @@ class rpAABBOverlapCallback : public rpDynamicAABBTreeOverlapCallback
 
 
 
+// Class rpAABBShapesCollectorCallback
+/**
+ * Callback collecting the proxy shapes of the leaf nodes overlapping
+ * with an AABB (the swept AABB of a body for instance).
+ */
+class rpAABBShapesCollectorCallback : public rpDynamicAABBTreeOverlapCallback
+{
+
+    private:
+
+        const rpDynamicAABBTree& mDynamicAABBTree;
+
+        std::vector<rpProxyShape*>& mOverlappingShapes;
+
+    public:
+
+        // Constructor
+        rpAABBShapesCollectorCallback(const rpDynamicAABBTree& dynamicAABBTree,
+                                      std::vector<rpProxyShape*>& overlappingShapes)
+         : mDynamicAABBTree(dynamicAABBTree),
+           mOverlappingShapes(overlappingShapes)
+        {
+
+        }
+
+        // Called when a overlapping node has been found during the call to
+        // DynamicAABBTree:reportAllShapesOverlappingWithAABB()
+        virtual void notifyOverlappingNode(int nodeId);
+};
+
+
 // Class BroadPhaseRaycastCallback
 /**
  * Callback called when the AABB of a leaf node is hit by a ray the
@@ -122,6 +153,55 @@ class rpBroadPhaseRaycastCallback : public rpDynamicAABBTreeRaycastCallback
 
 
 
+// Class rpCompoundRaycastCallback
+/**
+ * Callback called when the AABB of a leaf node of the local AABB tree of a
+ * compound body is hit by a ray. The tree is traversed with the ray in
+ * local-space of the body , the proxy shapes are raycast with the world-space ray.
+ */
+class rpCompoundRaycastCallback : public rpDynamicAABBTreeRaycastCallback
+{
+
+    private :
+
+        const rpDynamicAABBTree& mCompoundTree;
+
+        unsigned short mRaycastWithCategoryMaskBits;
+
+        RaycastTest& mRaycastTest;
+
+        const Ray& mWorldRay;
+
+        /// Smallest hit fraction returned for the proxy shapes of the body (-1 if none)
+        scalar mHitFraction;
+
+    public:
+
+        // Constructor
+        rpCompoundRaycastCallback(const rpDynamicAABBTree& compoundTree,
+                                  unsigned short raycastWithCategoryMaskBits,
+                                  RaycastTest& raycastTest, const Ray& worldRay)
+            : mCompoundTree(compoundTree),
+              mRaycastWithCategoryMaskBits(raycastWithCategoryMaskBits),
+              mRaycastTest(raycastTest),
+              mWorldRay(worldRay),
+              mHitFraction(scalar(-1.0))
+        {
+
+        }
+
+        // Called for a proxy shape of the compound body that has to be tested for raycast
+        virtual scalar raycastBroadPhaseShape(int32 nodeId, const Ray& ray);
+
+        // Return the smallest hit fraction of the proxy shapes of the body (-1 if none)
+        scalar getHitFraction() const
+        {
+            return mHitFraction;
+        }
+};
+
+
+
 // Class BroadPhaseAlgorithm
 /**
  * This class represents the broad-phase collision detection. The
@@ -169,6 +249,12 @@ class rpBroadPhaseAlgorithm
         /// Reference to the collision detection object
         rpCollisionManager *mCollisionDetection;
 
+        /// Number of broad-phase IDs given to the collision shapes of the compound bodies
+        int mNbCompoundShapeIDs;
+
+        /// Broad-phase IDs of the removed collision shapes of the compound bodies
+        std::vector<int> mFreeCompoundShapeIDs;
+
         // -------------------- Methods -------------------- //
 
         /// Private copy-constructor
@@ -213,8 +299,20 @@ class rpBroadPhaseAlgorithm
         /// Return true if the two broad-phase collision shapes are overlapping
         bool testOverlappingShapes(const rpProxyShape* shape1, const rpProxyShape* shape2) const;
 
+        /// Return the fat AABB of a collision shape in the broad-phase
+        const rpAABB& getFatAABB(const rpProxyShape* shape) const;
+
+        /// Give a broad-phase ID to a collision shape of a compound body
+        void addCompoundShapeID(rpProxyShape* proxyShape);
+
+        /// Release the broad-phase ID of a collision shape of a compound body
+        void removeCompoundShapeID(rpProxyShape* proxyShape);
+
         /// Ray casting method
         void raycast(const Ray& ray, RaycastTest& raycastTest , unsigned short raycastWithCategoryMaskBits) const;
+
+        /// Report all the proxy shapes overlapping with the AABB
+        void reportAllShapesOverlappingWithAABB(const rpAABB& aabb, std::vector<rpProxyShape*>& overlappingShapes) const;
 };
 
 // Method used to compare two pairs for sorting algorithm
@@ -241,6 +339,12 @@ SIMD_INLINE bool rpBroadPhaseAlgorithm::testOverlappingShapes(const rpProxyShape
     return aabb1.testCollision(aabb2);
 }
 
+// Return the fat AABB of a collision shape in the broad-phase
+SIMD_INLINE const rpAABB& rpBroadPhaseAlgorithm::getFatAABB(const rpProxyShape* shape) const
+{
+    return mDynamicAABBTree.getFatAABB(shape->mBroadPhaseID);
+}
+
 // Ray casting method
 SIMD_INLINE void rpBroadPhaseAlgorithm::raycast(const Ray& ray, RaycastTest& raycastTest,
                                          unsigned short raycastWithCategoryMaskBits) const
@@ -256,6 +360,15 @@ SIMD_INLINE void rpBroadPhaseAlgorithm::raycast(const Ray& ray, RaycastTest& ray
 
 
 
+// Report all the proxy shapes overlapping with the AABB
+SIMD_INLINE void rpBroadPhaseAlgorithm::reportAllShapesOverlappingWithAABB(const rpAABB& aabb,
+                                                                      std::vector<rpProxyShape*>& overlappingShapes) const
+{
+    rpAABBShapesCollectorCallback callback(mDynamicAABBTree, overlappingShapes);
+    mDynamicAABBTree.reportAllShapesOverlappingWithAABB(aabb, callback);
+}
+
+
 } /* namespace real_physics */
 
 #endif /* SOURCE_ENGIE_COLLISION_BROADPHASE_RBBROADPHASEALGORITHM_H_ */
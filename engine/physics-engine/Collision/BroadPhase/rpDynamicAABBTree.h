@@ -224,6 +224,9 @@ class rpDynamicAABBTree
         /// Return the root AABB of the tree
         rpAABB getRootAABB() const;
 
+        /// Return true if the tree has no object
+        bool isEmpty() const;
+
         /// Clear all the nodes and reset the tree
         void reset();
 };
@@ -263,6 +266,12 @@ SIMD_INLINE rpAABB rpDynamicAABBTree::getRootAABB() const
     return getFatAABB(mRootNodeID);
 }
 
+// Return true if the tree has no object
+SIMD_INLINE bool rpDynamicAABBTree::isEmpty() const
+{
+    return mRootNodeID == rpTreeNode::NULL_TREE_NODE;
+}
+
 // Add an object into the tree. This method creates a new leaf node in the tree and
 // returns the ID of the corresponding node.
 SIMD_INLINE int rpDynamicAABBTree::addObject(const rpAABB& aabb, int32 data1, int32 data2)
@@ -0,0 +1,190 @@
+/*
+ * rpStaticAABBTree.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#include "rpStaticAABBTree.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include "../../Memory/memory.h"
+
+namespace real_physics
+{
+
+
+// Constructor
+rpStaticAABBTree::rpStaticAABBTree()
+{
+
+}
+
+// Build the tree over the AABBs of the items
+/**
+ * @param aabbs Array with the AABB of each item
+ * @param nbItems Number of items
+ */
+void rpStaticAABBTree::build(const rpAABB* aabbs, uint nbItems)
+{
+    clear();
+    if (nbItems == 0) return;
+
+    // A balanced binary tree with leaves of one item at least has less than 2n nodes
+    mNodes.reserve(2 * nbItems);
+    mItems.resize(nbItems);
+
+    std::vector<Vector3> centers(nbItems);
+    for (uint i = 0; i < nbItems; i++)
+    {
+        mItems[i] = i;
+        centers[i] = aabbs[i].getCenter();
+    }
+
+    buildNode(aabbs, centers, 0, nbItems);
+}
+
+// Build the sub-tree over the items [begin , end) and return its node index
+int32 rpStaticAABBTree::buildNode(const rpAABB* aabbs, const std::vector<Vector3>& centers,
+                                  int32 begin, int32 end)
+{
+    assert(begin < end);
+
+    // Compute the AABB of the items and the bounds of their centers
+    rpAABB aabb = aabbs[mItems[begin]];
+    Vector3 minCenter = centers[mItems[begin]];
+    Vector3 maxCenter = minCenter;
+    for (int32 i = begin + 1; i < end; i++)
+    {
+        aabb.mergeWithAABB(aabbs[mItems[i]]);
+
+        const Vector3& center = centers[mItems[i]];
+        minCenter.setAllValues(Min(minCenter.x, center.x), Min(minCenter.y, center.y), Min(minCenter.z, center.z));
+        maxCenter.setAllValues(Max(maxCenter.x, center.x), Max(maxCenter.y, center.y), Max(maxCenter.z, center.z));
+    }
+
+    const int32 nodeIndex = mNodes.size();
+    mNodes.push_back(rpStaticTreeNode());
+    mNodes[nodeIndex].aabb = aabb;
+
+    // Few items are kept in a leaf
+    if (end - begin <= MAX_ITEMS_IN_LEAF)
+    {
+        mNodes[nodeIndex].index = begin;
+        mNodes[nodeIndex].nbItems = end - begin;
+        return nodeIndex;
+    }
+
+    // Split the items at the median of their centers along the largest axis
+    const int axis = (maxCenter - minCenter).getMaxAxis();
+    const int32 middle = begin + (end - begin) / 2;
+    std::nth_element(mItems.begin() + begin, mItems.begin() + middle, mItems.begin() + end,
+                     [&centers, axis](int32 item1, int32 item2)
+                     {
+                         return centers[item1][axis] < centers[item2][axis];
+                     });
+
+    // The first child is the next node of the array
+    buildNode(aabbs, centers, begin, middle);
+    const int32 secondChild = buildNode(aabbs, centers, middle, end);
+
+    mNodes[nodeIndex].index = secondChild;
+    mNodes[nodeIndex].nbItems = 0;
+    return nodeIndex;
+}
+
+// Remove all the nodes of the tree
+void rpStaticAABBTree::clear()
+{
+    mNodes.clear();
+    mItems.clear();
+}
+
+// Report the index of all the items overlapping with the AABB in parameter
+void rpStaticAABBTree::reportAllItemsOverlappingWithAABB(const rpAABB& aabb,
+                                                         rpDynamicAABBTreeOverlapCallback& callback) const
+{
+    if (mNodes.empty()) return;
+
+    // Create a stack with the nodes to visit
+    Stack<int32, 64> stack;
+    stack.push(0);
+
+    // While there are still nodes to visit
+    while (stack.getNbElements() > 0)
+    {
+        const int32 nodeIndex = stack.pop();
+        const rpStaticTreeNode& node = mNodes[nodeIndex];
+
+        // Skip the node if the AABB in parameter does not overlap with it
+        if (!aabb.testCollision(node.aabb)) continue;
+
+        if (node.isLeaf())
+        {
+            for (int32 i = node.index; i < node.index + node.nbItems; i++)
+            {
+                callback.notifyOverlappingNode(mItems[i]);
+            }
+        }
+        else
+        {
+            // We need to visit its children
+            stack.push(nodeIndex + 1);
+            stack.push(node.index);
+        }
+    }
+}
+
+// Ray casting method , the callback receives the index of the items hit by the ray
+void rpStaticAABBTree::raycast(const Ray& ray, rpDynamicAABBTreeRaycastCallback& callback) const
+{
+    if (mNodes.empty()) return;
+
+    scalar maxFraction = ray.maxFraction;
+
+    Stack<int32, 64> stack;
+    stack.push(0);
+
+    while (stack.getNbElements() > 0)
+    {
+        const int32 nodeIndex = stack.pop();
+        const rpStaticTreeNode& node = mNodes[nodeIndex];
+
+        Ray rayTemp(ray.point1, ray.point2, maxFraction);
+
+        // Test if the ray intersects with the current node AABB
+        if (!node.aabb.testRayIntersect(rayTemp)) continue;
+
+        if (node.isLeaf())
+        {
+            for (int32 i = node.index; i < node.index + node.nbItems; i++)
+            {
+                // Call the callback that will raycast again the item
+                scalar hitFraction = callback.raycastBroadPhaseShape(mItems[i], rayTemp);
+
+                // If the user returned a hitFraction of zero, it means that
+                // the raycasting should stop here
+                if (hitFraction == scalar(0.0)) return;
+
+                // If the user returned a positive fraction , the ray is shortened
+                if (hitFraction > scalar(0.0) && hitFraction < maxFraction)
+                {
+                    maxFraction = hitFraction;
+                    rayTemp.maxFraction = maxFraction;
+                }
+            }
+        }
+        else
+        {
+            // Push its children in the stack of nodes to explore
+            stack.push(nodeIndex + 1);
+            stack.push(node.index);
+        }
+    }
+}
+
+
+} /* namespace real_physics */
@@ -0,0 +1,128 @@
+/*
+ * rpStaticAABBTree.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SOURCE_ENGIE_COLLISION_BROADPHASE_RPSTATICAABBTREE_H_
+#define SOURCE_ENGIE_COLLISION_BROADPHASE_RPSTATICAABBTREE_H_
+
+
+#include "../Shapes/rpAABB.h"
+#include "rpDynamicAABBTree.h"
+#include <vector>
+
+namespace real_physics
+{
+
+
+// Structure StaticTreeNode
+/**
+ * This structure represents a node of the static AABB tree. The nodes are
+ * stored in depth-first order : the first child of an inner node is the
+ * next node of the array.
+ */
+struct rpStaticTreeNode
+{
+
+    /// AABB of the node
+    rpAABB aabb;
+
+    /// Index of the first item of a leaf in the items array ,
+    /// or index of the second child of an inner node
+    int32 index;
+
+    /// Number of items of a leaf (zero for an inner node)
+    int32 nbItems;
+
+    /// Return true if the node is a leaf of the tree
+    bool isLeaf() const;
+};
+
+
+// Class StaticAABBTree
+/**
+ * This class implements an AABB tree built once over a fixed set of items
+ * (the triangles of a mesh for instance). The tree is built from the top by
+ * splitting the items at the median of their centers along the largest axis ,
+ * so it stays balanced and its nodes are packed in a single array. The items
+ * are given back by their index in the array of AABBs used to build the tree.
+ */
+class rpStaticAABBTree
+{
+
+    private:
+
+        // -------------------- Attributes -------------------- //
+
+        /// Nodes of the tree (the root is the first node)
+        std::vector<rpStaticTreeNode> mNodes;
+
+        /// Indexes of the items , grouped by leaf
+        std::vector<int32> mItems;
+
+
+        // -------------------- Methods -------------------- //
+
+        /// Build the sub-tree over the items [begin , end) and return its node index
+        int32 buildNode(const rpAABB* aabbs, const std::vector<Vector3>& centers,
+                        int32 begin, int32 end);
+
+    public:
+
+        // -------------------- Constants -------------------- //
+
+        /// Maximum number of items in a leaf of the tree
+        static const int32 MAX_ITEMS_IN_LEAF = 4;
+
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        rpStaticAABBTree();
+
+        /// Build the tree over the AABBs of the items
+        void build(const rpAABB* aabbs, uint nbItems);
+
+        /// Remove all the nodes of the tree
+        void clear();
+
+        /// Return the number of nodes of the tree
+        uint getNbNodes() const;
+
+        /// Return the AABB containing all the items of the tree
+        rpAABB getRootAABB() const;
+
+        /// Report the index of all the items overlapping with the AABB in parameter
+        void reportAllItemsOverlappingWithAABB(const rpAABB& aabb,
+                                               rpDynamicAABBTreeOverlapCallback& callback) const;
+
+        /// Ray casting method , the callback receives the index of the items hit by the ray
+        void raycast(const Ray& ray, rpDynamicAABBTreeRaycastCallback& callback) const;
+};
+
+
+// Return true if the node is a leaf of the tree
+SIMD_INLINE bool rpStaticTreeNode::isLeaf() const
+{
+    return (nbItems > 0);
+}
+
+// Return the number of nodes of the tree
+SIMD_INLINE uint rpStaticAABBTree::getNbNodes() const
+{
+    return mNodes.size();
+}
+
+// Return the AABB containing all the items of the tree
+SIMD_INLINE rpAABB rpStaticAABBTree::getRootAABB() const
+{
+    assert(!mNodes.empty());
+    return mNodes[0].aabb;
+}
+
+
+} /* namespace real_physics */
+
+#endif /* SOURCE_ENGIE_COLLISION_BROADPHASE_RPSTATICAABBTREE_H_ */
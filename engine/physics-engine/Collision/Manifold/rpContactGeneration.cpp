@@ -328,7 +328,9 @@ SIMD_INLINE bool rpContactGeneration::ConvertSupportPointsToContacts(const Vecto
 
 
 
-void rpContactGeneration::computeContacteOverlappingPair(rpOverlappingPair *OverlappingPair , rpCollisionManager *meneger , bool approximationCorretion )
+bool rpContactGeneration::computeContacteOverlappingPair(rpOverlappingPair *OverlappingPair , rpCollisionManager *meneger ,
+                                                         bool approximationCorretion , bool isSpeculative ,
+                                                         bool isClearContacts )
 {
 
 
@@ -346,6 +348,22 @@ void rpContactGeneration::computeContacteOverlappingPair(rpOverlappingPair *Over
     free(SupportVertA);
     free(SupportVertB);
 
+    // The two points of a speculative contact face each other along the axis. The solver
+    // lets the bodies approach by their distance , so a point clipped far away on a large
+    // face (like a corner of the ground) is rejected instead of giving a wrong distance
+    if( isSpeculative && isOutside )
+    {
+        for (uint i = 0; i < mNbContacts; ++i)
+        {
+            Vector3 delta = mInfoContacts[i].localPoint2 - mInfoContacts[i].localPoint1;
+            Vector3 tangent = delta - delta.dot(mSeparatonAxis) * mSeparatonAxis;
+            if( tangent.lengthSquare() > PERSISTENT_CONTACT_DIST_THRESHOLD * PERSISTENT_CONTACT_DIST_THRESHOLD )
+            {
+                return false;
+            }
+        }
+    }
+
     Transform transform_1 = mShape1->getWorldTransform();
     Transform transform_2 = mShape2->getWorldTransform();
 
@@ -353,7 +371,7 @@ void rpContactGeneration::computeContacteOverlappingPair(rpOverlappingPair *Over
 //    std::vector< rpContactPoint* > OldContacts;
 //    OverlappingPair->getAllContacts(OldContacts);
 
-    OverlappingPair->clearContactPoints();
+    if( isClearContacts ) OverlappingPair->clearContactPoints();
     for (uint i = 0; i < mNbContacts && isOutside; ++i)
     {
         mInfoContacts[i].normal = -mInfoContacts[i].normal;
@@ -370,6 +388,7 @@ void rpContactGeneration::computeContacteOverlappingPair(rpOverlappingPair *Over
 
         mInfoContacts[i].localPoint1 = ((transform_1.getInverse() * mInfoContacts[i].localPoint1));
         mInfoContacts[i].localPoint2 = ((transform_2.getInverse() * mInfoContacts[i].localPoint2));
+        mInfoContacts[i].isSpeculative = isSpeculative;
 
        // rpContactPoint *contact = new rpContactPoint( mInfoContacts[i] );
 
@@ -378,6 +397,7 @@ void rpContactGeneration::computeContacteOverlappingPair(rpOverlappingPair *Over
 
 //    OldContacts.clear();
 
+    return (isOutside && mNbContacts > 0);
 }
 
 
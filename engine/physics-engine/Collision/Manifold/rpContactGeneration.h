@@ -70,9 +70,14 @@ class rpContactGeneration
     virtual ~rpContactGeneration();
 
 
-         void computeContacteOverlappingPair( rpOverlappingPair*  OverlappingPair ,
+         /// Create the contacts of the overlapping pair , return true if at least one contact was
+         /// created (isSpeculative : the shapes are separated along the axis , isClearContacts : false
+         /// keeps the contacts already in the pair , like the ones of the other triangles of a mesh)
+         bool computeContacteOverlappingPair( rpOverlappingPair*  OverlappingPair ,
                                              rpCollisionManager*  meneger         ,
-                                             bool approximationCorretion = INTERPOLATION_CONTACT_POINTS );
+                                             bool approximationCorretion = INTERPOLATION_CONTACT_POINTS ,
+                                             bool isSpeculative = false ,
+                                             bool isClearContacts = true );
 
 
 };
@@ -17,8 +17,9 @@ namespace real_physics
 
 rpContactManifold::rpContactManifold(rpProxyShape* shape1, rpProxyShape* shape2 , short  normalDirectionId)
 : mShape1(shape1), mShape2(shape2),
-  mNormalDirectionId(normalDirectionId),
   mNbContactPoints(0),
+  mNormalDirectionId(normalDirectionId),
+  mManifoldIndex(0),
   mFrictionImpulse1(0.0),
   mFrictionImpulse2(0.0),
   mFrictionTwistImpulse(0.0),
@@ -57,6 +57,9 @@ class rpContactManifold
         /// Normal direction Id (Unique Id representing the normal direction)
         short int mNormalDirectionId;
 
+        /// Index of the manifold in its contact manifold set
+        short int mManifoldIndex;
+
 
 
         /// First friction vector of the contact manifold
@@ -142,6 +145,9 @@ class rpContactManifold
         /// Return the normal direction Id
         short int getNormalDirectionId() const;
 
+        /// Return the index of the manifold in its contact manifold set
+        short int getManifoldIndex() const;
+
         /// Add a contact point to the manifold
         void addContactPoint(rpContactPoint* contact);
 
@@ -277,6 +283,12 @@ SIMD_INLINE short int rpContactManifold::getNormalDirectionId() const
     return mNormalDirectionId;
 }
 
+// Return the index of the manifold in its contact manifold set
+SIMD_INLINE short int rpContactManifold::getManifoldIndex() const
+{
+    return mManifoldIndex;
+}
+
 // Return the number of contact points in the manifold
 SIMD_INLINE uint rpContactManifold::getNbContactPoints() const
 {
@@ -377,13 +389,18 @@ SIMD_INLINE Vector3 rpContactManifold::getAverageContactNormal() const
 }
 
 // Return the largest depth of all the contact points
+/// The depths are the signed ones for the current transforms of the shapes
 SIMD_INLINE scalar rpContactManifold::getLargestContactDepth() const
 {
-    scalar largestDepth = 0.0f;
+    if (mNbContactPoints == 0) return scalar(0.0);
 
-    for (uint i=0; i<mNbContactPoints; i++)
+    const Transform transform1 = mShape1->getWorldTransform();
+    const Transform transform2 = mShape2->getWorldTransform();
+
+    scalar largestDepth = mContactPoints[0]->computeSignedDepth(transform1, transform2);
+    for (uint i=1; i<mNbContactPoints; i++)
     {
-        scalar depth = mContactPoints[i]->getPenetrationDepth();
+        scalar depth = mContactPoints[i]->computeSignedDepth(transform1, transform2);
         if (depth > largestDepth)
         {
             largestDepth = depth;
@@ -98,7 +98,8 @@ void rpContactManifoldSet::addContactPoint(rpContactPoint* contact)
     // manifolds condidates. We need to remove one. We choose to keep the manifolds
     // with the largest contact depth among their points
     int smallestDepthIndex = -1;
-    scalar minDepth = contact->getPenetrationDepth();
+    scalar minDepth = contact->computeSignedDepth(mShape1->getWorldTransform(),
+                                                  mShape2->getWorldTransform());
     assert(mNbManifolds == mNbMaxManifolds);
     for (int i=0; i<mNbManifolds; i++)
     {
@@ -169,13 +170,14 @@ short int rpContactManifoldSet::computeCubemapNormalId(const Vector3& normal) co
     scalar max = max3(Abs(normal.x), Abs(normal.y), Abs(normal.z));
     Vector3 normalScaled = normal / max;
 
-    if (normalScaled.x >= normalScaled.y && normalScaled.x >= normalScaled.z)
+    // The face of the cube is given by the largest absolute coordinate
+    if (Abs(normalScaled.x) >= Abs(normalScaled.y) && Abs(normalScaled.x) >= Abs(normalScaled.z))
     {
         faceNo = normalScaled.x > 0 ? 0 : 1;
         u = normalScaled.y;
         v = normalScaled.z;
     }
-    else if (normalScaled.y >= normalScaled.x && normalScaled.y >= normalScaled.z)
+    else if (Abs(normalScaled.y) >= Abs(normalScaled.x) && Abs(normalScaled.y) >= Abs(normalScaled.z))
     {
         faceNo = normalScaled.y > 0 ? 2 : 3;
         u = normalScaled.x;
@@ -238,6 +240,7 @@ void rpContactManifoldSet::createManifold(short int normalDirectionId)
     assert(mNbManifolds < mNbMaxManifolds);
 
     mManifolds[mNbManifolds] = new rpContactManifold(mShape1, mShape2 , normalDirectionId);
+    mManifolds[mNbManifolds]->mManifoldIndex = mNbManifolds;
     mNbManifolds++;
 }
 
@@ -258,6 +261,7 @@ void rpContactManifoldSet::removeManifold(int index)
     for (int i=index; (i+1) < mNbManifolds; i++)
     {
         mManifolds[i] = mManifolds[i+1];
+        mManifolds[i]->mManifoldIndex = i;
     }
 
     mNbManifolds--;
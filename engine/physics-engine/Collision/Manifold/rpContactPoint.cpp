@@ -18,7 +18,8 @@ rpContactPoint::rpContactPoint(const rpContactPointInfo& contactInfo)
   mLocalPointOnBody2(contactInfo.localPoint2),
   mWorldPointOnBody1((contactInfo.localPoint1)),
   mWorldPointOnBody2( contactInfo.localPoint2),
-  mIsRestingContact(false)
+  mIsRestingContact(false),
+  mIsSpeculative(contactInfo.isSpeculative)
 {
     //    mFrictionVectors[0] = Vector3(0, 0, 0);
     //	mFrictionVectors[1] = Vector3(0, 0, 0);
@@ -46,17 +46,25 @@ struct rpContactPointInfo
         /// Contact point of body 2 in local space of body 2
         Vector3 localPoint2;
 
+        /// True if the contact is speculative (the shapes are still separated)
+        bool isSpeculative;
+
         //-------------------- Methods --------------------//
 
-        rpContactPointInfo(void){}
+        rpContactPointInfo(void)
+         : isSpeculative(false)
+        {
+        }
 
         /// Constructor
         rpContactPointInfo(const Vector3& normal, scalar penetrationDepth,
-                         const Vector3& localPoint1, const Vector3& localPoint2)
+                         const Vector3& localPoint1, const Vector3& localPoint2,
+                         bool isSpeculative = false)
             : normal(normal),
 			  penetrationDepth(penetrationDepth),
               localPoint1(localPoint1),
-              localPoint2(localPoint2)
+              localPoint2(localPoint2),
+              isSpeculative(isSpeculative)
         {
 
         }
@@ -115,6 +123,9 @@ class rpContactPoint : public BlockAlloc<rpContactPoint>
         /// Penetration depth
         scalar  mPenetrationDepth;
 
+        /// True if the contact is speculative (the bodies are still separated)
+        bool    mIsSpeculative;
+
         // -------------------- Methods -------------------- //
 
         // Private copy-constructor
@@ -142,6 +153,7 @@ class rpContactPoint : public BlockAlloc<rpContactPoint>
               mLocalPointOnBody2 = contactInfo.localPoint2;
               mWorldPointOnBody1 = contactInfo.localPoint1;
               mWorldPointOnBody2 = contactInfo.localPoint2;
+              mIsSpeculative     = contactInfo.isSpeculative;
          }
 
 
@@ -214,6 +226,12 @@ class rpContactPoint : public BlockAlloc<rpContactPoint>
         /// Return the penetration depth
         scalar getPenetrationDepth() const;
 
+        /// Return true if the contact is speculative
+        bool getIsSpeculative() const;
+
+        /// Return the signed depth of the contact for the given transforms of the bodies
+        scalar computeSignedDepth(const Transform& transform1, const Transform& transform2) const;
+
         /// Return the number of bytes used by the contact point
         size_t getSizeInBytes() const;
 
@@ -362,6 +380,20 @@ SIMD_INLINE scalar rpContactPoint::getPenetrationDepth() const
     return mPenetrationDepth;
 }
 
+// Return true if the contact is speculative
+SIMD_INLINE bool rpContactPoint::getIsSpeculative() const
+{
+    return mIsSpeculative;
+}
+
+// Return the signed depth of the contact for the given transforms of the bodies
+/// The depth given by the contact generation is unsigned , this one is
+/// negative for a speculative contact whose points are still separated
+SIMD_INLINE scalar rpContactPoint::computeSignedDepth(const Transform& transform1, const Transform& transform2) const
+{
+    return ((transform2 * mLocalPointOnBody2) - (transform1 * mLocalPointOnBody1)).dot(mNormal);
+}
+
 // Return the number of bytes used by the contact point
 SIMD_INLINE size_t rpContactPoint::getSizeInBytes() const
 {
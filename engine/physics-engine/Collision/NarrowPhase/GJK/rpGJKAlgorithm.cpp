@@ -15,8 +15,7 @@ namespace
 
     static Vector3 Support( const rpCollisionShapeInfo& shape , const Vector3& dir )
     {
-        const Transform &t = shape.getWorldTransform();
-        return t * shape.getLocalSupportPointWithMargin( t.getOrientation().getInverse() * dir );
+        return shape.getWorldSupportPointWithMargin( dir );
     }
 
 
@@ -316,6 +315,75 @@ bool rpGJKAlgorithm::computePenetrationDepthForEnlargedObjects(const rpCollision
 }
 
 
+// Return true if the two shapes (with margins) intersect , without computing a contact
+/// The GJK algorithm stops as soon as a separating axis is found or the simplex
+/// contains the origin , the penetration depth is never computed by the EPA.
+/// The search starts from the cached separating axis , and the axis separating
+/// the shapes is cached again for the next test of the same pair.
+bool rpGJKAlgorithm::testIntersection(const rpCollisionShapeInfo& shape1Info,
+                                      const rpCollisionShapeInfo& shape2Info)
+{
+    Vector3 suppA;             // Support point of object A
+    Vector3 suppB;             // Support point of object B
+    Vector3 w;                 // Support point of Minkowski difference A-B
+    scalar  prevDistSquare;
+
+    assert(shape1Info.collisionShape->isConvex());
+    assert(shape2Info.collisionShape->isConvex());
+
+    // Create a simplex set
+    Simplex simplex;
+
+    // Initial supporting direction (last cached separating axis)
+    Vector3 v = mCachedSeparatingAxis;
+    if (v.lengthSquare() < MACHINE_EPSILON) v = Vector3(1, 1, 1);
+
+    // Initialize the upper bound for the square distance
+    scalar distSquare = DECIMAL_LARGEST;
+
+    do
+    {
+        // Compute the support points for the enlarged objects A and B
+        suppA = Support(shape1Info, -v);
+        suppB = Support(shape2Info,  v);
+
+        // Compute the support point for the Minkowski difference A-B
+        w = suppA - suppB;
+
+        // If the enlarged objects do not intersect
+        if (v.dot(w) > 0.0)
+        {
+            // Cache the current separating axis for frame coherence
+            setCachedSeparatingAxis(v);
+            return false;
+        }
+
+        // Add the new support point to the simplex
+        simplex.addPoint(w, suppA, suppB);
+
+        // The objects only touch , the closest points are found
+        if (simplex.isAffinelyDependent() || !simplex.computeClosestPoint(v))
+        {
+            return false;
+        }
+
+        // Store and update the squared distance of the closest point
+        prevDistSquare = distSquare;
+        distSquare = v.lengthSquare();
+
+        // If the distance to the closest point doesn't improve a lot
+        if (prevDistSquare - distSquare <= MACHINE_EPSILON * prevDistSquare)
+        {
+            return false;
+        }
+
+    } while(!simplex.isFull() && distSquare > MACHINE_EPSILON * simplex.getMaxLengthSquareOfAPoint());
+
+    // The simplex contains the origin
+    return true;
+}
+
+
 // Use the GJK Algorithm to find if a point is inside a convex collision shape
 bool rpGJKAlgorithm::testPointInside(const Vector3 &localPoint, rpProxyShape *proxyShape)
 {
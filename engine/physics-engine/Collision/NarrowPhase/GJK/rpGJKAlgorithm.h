@@ -57,7 +57,9 @@ class rpGJKAlgorithm
                         const rpCollisionShapeInfo& shape2Info,
                         OutContactInfo& _outInfo);
 
-
+        /// Return true if the two shapes (with margins) intersect , without computing a contact
+        bool testIntersection(const rpCollisionShapeInfo& shape1Info,
+                              const rpCollisionShapeInfo& shape2Info);
 
 
         /// Use the GJK Algorithm to find if a point is inside a convex collision shape
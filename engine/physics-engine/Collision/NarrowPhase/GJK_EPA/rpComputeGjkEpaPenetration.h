@@ -56,8 +56,9 @@ bool GjkEpaCalcPenDepth(const ConvexTemplate &a,
             wWitnessOnA = results.witnesses[0];
             wWitnessOnB = results.witnesses[1];
 
+            // Separated shapes : negative penetration depth (the distance between the shapes)
             normal = results.normal;
-            wDepth = results.distance;
+            wDepth = -results.distance;
 
             return false;
         }
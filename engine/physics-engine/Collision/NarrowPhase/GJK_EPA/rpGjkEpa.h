@@ -140,9 +140,6 @@ struct	MinkowskiDiff
     const ConvexTemplate* m_convexAPtr;
     const ConvexTemplate* m_convexBPtr;
 
-    Transform				m_world0;
-    Transform				m_world1;
-
     bool					m_enableMargin;
 
 
@@ -157,13 +154,13 @@ struct	MinkowskiDiff
 
     SIMD_INLINE Vector3		Support0( const Vector3& dir ) const
     {
-        return m_world0 * m_convexAPtr->getLocalSupportPointWithMargin( m_world0.getOrientation().getInverse() * dir );
+        return m_convexAPtr->getWorldSupportPointWithMargin( dir );
     }
 
     SIMD_INLINE Vector3		Support1( const Vector3& dir ) const
     {
 
-       return  m_world1 * m_convexBPtr->getLocalSupportPointWithMargin( m_world1.getOrientation().getInverse() * dir );
+       return  m_convexBPtr->getWorldSupportPointWithMargin( dir );
     }
 
 
@@ -969,10 +966,7 @@ static void	Initialize(	const ConvexTemplate& a,
     results.witnesses[0]	=
     results.witnesses[1]	=	Vector3(0,0,0);
     results.status			=	rpGjkEpaSolver::sResults::Separated;
-    /* Shape		*/
-
-    shape.m_world1		=	b.getWorldTransform();//.getBasis().transposeTimes(a.getWorldTransform().getBasis());
-    shape.m_world0		=	a.getWorldTransform();//.inverseTimes(b.getWorldTransform());
+    /* Shape : the supports use the local-to-world matrices of a and b */
 
 }
 
@@ -997,11 +991,12 @@ bool rpGjkEpaSolver::Distance(const ConvexTemplate &a,
         for(U i=0;i<gjk.m_simplex->rank;++i)
         {
             const scalar	p=gjk.m_simplex->p[i];
-            w0+=shape.Support( gjk.m_simplex->c[i]->d,0)*p;
-            w1+=shape.Support(-gjk.m_simplex->c[i]->d,1)*p;
+            w0+=shape.Support0( gjk.m_simplex->c[i]->d)*p;
+            w1+=shape.Support1(-gjk.m_simplex->c[i]->d)*p;
         }
-        results.witnesses[0]	=	a.getWorldTransform()*w0;
-        results.witnesses[1]	=	a.getWorldTransform()*w1;
+        /* the support points of the Minkowski difference are already in world-space */
+        results.witnesses[0]	=	w0;
+        results.witnesses[1]	=	w1;
         results.normal			=	w0-w1;
         results.distance		=	results.normal.length();
         results.normal			/=	results.distance>GJK_MIN_DISTANCE?results.distance:scalar(1);
@@ -15,8 +15,7 @@ namespace real_physics
 
 SIMD_INLINE void rpMPRAlgorithm::supportTransformed(const rpCollisionShapeInfo *s, const Vector3 &dir, Vector3 &result) const
 {
-    const Transform &t = s->getWorldTransform();
-    result =  t * s->getLocalSupportPointWithMargin( t.getOrientation().getInverse() * dir );
+    result = s->getWorldSupportPointWithMargin( dir );
 }
 
 
@@ -0,0 +1,332 @@
+/*
+ * rpNarrowPhaseCapsuleAlgorithm.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#include "rpNarrowPhaseCapsuleAlgorithm.h"
+#include "../Shapes/rpCapsuleShape.h"
+#include "../Shapes/rpSphereShape.h"
+#include "../Shapes/rpBoxShape.h"
+
+#include <cassert>
+
+namespace real_physics
+{
+
+rpNarrowPhaseCapsuleAlgorithm::rpNarrowPhaseCapsuleAlgorithm()
+{
+
+}
+
+rpNarrowPhaseCapsuleAlgorithm::~rpNarrowPhaseCapsuleAlgorithm()
+{
+
+}
+
+// Compute the world-space segment and the radius of a capsule or a sphere
+/// The segment of a sphere is its center
+void rpNarrowPhaseCapsuleAlgorithm::computeSegment(const rpCollisionShapeInfo& shapeInfo,
+                                                   Vector3& point1, Vector3& point2, scalar& radius)
+{
+    if (shapeInfo.collisionShape->getType() == CAPSULE)
+    {
+        const rpCapsuleShape* capsule = static_cast<const rpCapsuleShape*>(shapeInfo.collisionShape);
+        const Vector3 halfAxis = shapeInfo.worldMatrix * Vector3(0.0, capsule->getHeight() * scalar(0.5), 0.0);
+        point1 = shapeInfo.worldPosition - halfAxis;
+        point2 = shapeInfo.worldPosition + halfAxis;
+        radius = capsule->getRadius();
+    }
+    else
+    {
+        const rpSphereShape* sphere = static_cast<const rpSphereShape*>(shapeInfo.collisionShape);
+        point1 = point2 = shapeInfo.worldPosition;
+        radius = sphere->getRadius();
+    }
+}
+
+// Collision between two capsules or between a capsule and a sphere
+/// The closest points of the two segments are computed like in "Real-Time
+/// Collision Detection" (C. Ericson , 5.1.9) , the shapes collide if their
+/// distance is smaller than the sum of the radii.
+bool rpNarrowPhaseCapsuleAlgorithm::testSegmentSegment(const rpCollisionShapeInfo& shape1Info,
+                                                       const rpCollisionShapeInfo& shape2Info,
+                                                       OutContactInfo& outInfo)
+{
+    Vector3 p1, q1, p2, q2;
+    scalar  radius1, radius2;
+    computeSegment(shape1Info, p1, q1, radius1);
+    computeSegment(shape2Info, p2, q2, radius2);
+
+    const Vector3 d1 = q1 - p1;
+    const Vector3 d2 = q2 - p2;
+    const Vector3 r  = p1 - p2;
+    const scalar  a  = d1.dot(d1);
+    const scalar  e  = d2.dot(d2);
+    const scalar  f  = d2.dot(r);
+
+    scalar s = 0.0;
+    scalar t = 0.0;
+    if (a <= MACHINE_EPSILON && e <= MACHINE_EPSILON)
+    {
+        // Both segments are points
+    }
+    else if (a <= MACHINE_EPSILON)
+    {
+        t = Clamp(f / e, scalar(0.0), scalar(1.0));
+    }
+    else
+    {
+        const scalar c = d1.dot(r);
+        if (e <= MACHINE_EPSILON)
+        {
+            s = Clamp(-c / a, scalar(0.0), scalar(1.0));
+        }
+        else
+        {
+            // For parallel segments any point of the first segment is as good
+            const scalar b = d1.dot(d2);
+            const scalar denominator = a * e - b * b;
+            if (denominator > MACHINE_EPSILON)
+            {
+                s = Clamp((b * f - c * e) / denominator, scalar(0.0), scalar(1.0));
+            }
+
+            t = (b * s + f) / e;
+            if (t < scalar(0.0))
+            {
+                t = 0.0;
+                s = Clamp(-c / a, scalar(0.0), scalar(1.0));
+            }
+            else if (t > scalar(1.0))
+            {
+                t = 1.0;
+                s = Clamp((b - c) / a, scalar(0.0), scalar(1.0));
+            }
+        }
+    }
+
+    const Vector3 closest1 = p1 + s * d1;
+    const Vector3 closest2 = p2 + t * d2;
+
+    Vector3 normal = closest1 - closest2;
+    const scalar distance = normal.length();
+    if (distance > MACHINE_EPSILON)
+    {
+        normal /= distance;
+    }
+    else
+    {
+        // The segments cross each other : any direction orthogonal to them separates the shapes
+        if (a > MACHINE_EPSILON && e > MACHINE_EPSILON && d1.cross(d2).lengthSquare() > MACHINE_EPSILON)
+        {
+            normal = d1.cross(d2).getUnit();
+        }
+        else if (a > MACHINE_EPSILON)
+        {
+            normal = d1.getOneUnitOrthogonalVector();
+        }
+        else if (e > MACHINE_EPSILON)
+        {
+            normal = d2.getOneUnitOrthogonalVector();
+        }
+        else
+        {
+            normal = Vector3(0.0, 1.0, 0.0);
+        }
+    }
+
+    const scalar penetration = radius1 + radius2 - distance;
+
+    outInfo.m_normal = normal;
+    outInfo.m_penetrationDepth = penetration;
+    outInfo.pALocal = closest1 - normal * radius1;
+    outInfo.pBLocal = closest2 + normal * radius2;
+
+    return (penetration > scalar(0.0));
+}
+
+// Collision between a capsule and a box
+/// The segment of the capsule is tested in the local space of the box against the
+/// box reduced by its margin , and the radius of the capsule is increased by the
+/// margin. The squared distance between the segment and the box is a convex
+/// quadratic function by parts along the segment , with the parts delimited by the
+/// planes of the faces of the box , so its minimum is found exactly on each part.
+/// When the segment goes through the box , the minimal penetration is given by the
+/// separating axis test on the axes of the box and their cross products with the
+/// segment.
+bool rpNarrowPhaseCapsuleAlgorithm::testCapsuleBox(const rpCollisionShapeInfo& capsuleInfo,
+                                                   const rpCollisionShapeInfo& boxInfo,
+                                                   OutContactInfo& outInfo)
+{
+    const rpCapsuleShape* capsule = static_cast<const rpCapsuleShape*>(capsuleInfo.collisionShape);
+    const rpBoxShape* box = static_cast<const rpBoxShape*>(boxInfo.collisionShape);
+
+    const scalar  margin = box->getMargin();
+    const Vector3 extent = box->getExtent() - Vector3(margin, margin, margin);
+    const scalar  capsuleRadius = capsule->getRadius();
+    const scalar  radius = capsuleRadius + margin;
+
+    // Segment of the capsule in the local space of the box
+    Vector3 p1, p2;
+    scalar  unused;
+    computeSegment(capsuleInfo, p1, p2, unused);
+    p1 = boxInfo.inverseDirectionMatrix * (p1 - boxInfo.worldPosition);
+    p2 = boxInfo.inverseDirectionMatrix * (p2 - boxInfo.worldPosition);
+    const Vector3 direction = p2 - p1;
+
+    // Parameters of the segment where it crosses the planes of the faces
+    scalar breaks[8];
+    int nbBreaks = 0;
+    breaks[nbBreaks++] = 0.0;
+    breaks[nbBreaks++] = 1.0;
+    for (int i = 0; i < 3; i++)
+    {
+        if (Abs(direction[i]) < MACHINE_EPSILON) continue;
+        for (int side = -1; side <= 1; side += 2)
+        {
+            const scalar t = (side * extent[i] - p1[i]) / direction[i];
+            if (t > scalar(0.0) && t < scalar(1.0)) breaks[nbBreaks++] = t;
+        }
+    }
+
+    // Sort the parameters (there are at most 8 of them)
+    for (int i = 1; i < nbBreaks; i++)
+    {
+        for (int j = i; j > 0 && breaks[j] < breaks[j - 1]; j--) Swap(breaks[j], breaks[j - 1]);
+    }
+
+    // Minimum of the squared distance on each part of the segment
+    scalar bestT = 0.0;
+    scalar bestSquareDistance = DECIMAL_LARGEST;
+    for (int k = 0; k + 1 < nbBreaks; k++)
+    {
+        const scalar start = breaks[k];
+        const scalar end   = breaks[k + 1];
+        const scalar middle = scalar(0.5) * (start + end);
+
+        scalar numerator = 0.0;
+        scalar denominator = 0.0;
+        for (int i = 0; i < 3; i++)
+        {
+            const scalar value = p1[i] + middle * direction[i];
+            if (value > extent[i] || value < -extent[i])
+            {
+                const scalar face = (value > extent[i]) ? extent[i] : -extent[i];
+                numerator   += (p1[i] - face) * direction[i];
+                denominator += direction[i] * direction[i];
+            }
+        }
+
+        const scalar t = (denominator > MACHINE_EPSILON) ? Clamp(-numerator / denominator, start, end) : start;
+
+        scalar squareDistance = 0.0;
+        for (int i = 0; i < 3; i++)
+        {
+            const scalar outside = Abs(p1[i] + t * direction[i]) - extent[i];
+            if (outside > scalar(0.0)) squareDistance += outside * outside;
+        }
+
+        if (squareDistance < bestSquareDistance)
+        {
+            bestSquareDistance = squareDistance;
+            bestT = t;
+        }
+    }
+
+    Vector3 normal;
+    Vector3 pointOnCapsule;
+    scalar  penetration;
+
+    if (bestSquareDistance > MACHINE_EPSILON)
+    {
+        // The segment is outside of the box : the normal goes from the closest point of the box
+        const Vector3 closest = p1 + bestT * direction;
+        const Vector3 closestOnBox(Clamp(closest.x, -extent.x, extent.x),
+                                   Clamp(closest.y, -extent.y, extent.y),
+                                   Clamp(closest.z, -extent.z, extent.z));
+        const scalar distance = SquareRoot(bestSquareDistance);
+
+        normal = (closest - closestOnBox) / distance;
+        penetration = radius - distance;
+        pointOnCapsule = closest - normal * capsuleRadius;
+    }
+    else
+    {
+        // The segment goes through the box : separating axis test
+        Vector3 axes[6];
+        int nbAxes = 0;
+        axes[nbAxes++] = Vector3(1.0, 0.0, 0.0);
+        axes[nbAxes++] = Vector3(0.0, 1.0, 0.0);
+        axes[nbAxes++] = Vector3(0.0, 0.0, 1.0);
+        for (int i = 0; i < 3; i++)
+        {
+            const Vector3 axis = direction.cross(axes[i]);
+            if (axis.lengthSquare() > MACHINE_EPSILON) axes[nbAxes++] = axis.getUnit();
+        }
+
+        penetration = DECIMAL_LARGEST;
+        for (int i = 0; i < nbAxes; i++)
+        {
+            const Vector3& axis = axes[i];
+            const scalar boxProjection = extent.x * Abs(axis.x) + extent.y * Abs(axis.y) + extent.z * Abs(axis.z);
+            const scalar projection1 = p1.dot(axis);
+            const scalar projection2 = p2.dot(axis);
+
+            // Overlaps when the capsule is pushed out in the direction of the axis or in the opposite one
+            const scalar overlapPositive = boxProjection - Min(projection1, projection2) + radius;
+            const scalar overlapNegative = boxProjection + Max(projection1, projection2) + radius;
+
+            if (overlapPositive < penetration)
+            {
+                penetration = overlapPositive;
+                normal = axis;
+            }
+            if (overlapNegative < penetration)
+            {
+                penetration = overlapNegative;
+                normal = -axis;
+            }
+        }
+
+        // Deepest point of the capsule along the normal
+        const Vector3& deepest = (p1.dot(normal) < p2.dot(normal)) ? p1 : p2;
+        pointOnCapsule = deepest - normal * capsuleRadius;
+    }
+
+    const Vector3 pointOnBox = pointOnCapsule + normal * penetration;
+
+    outInfo.m_normal = boxInfo.worldMatrix * normal;
+    outInfo.m_penetrationDepth = penetration;
+    outInfo.pALocal = boxInfo.worldMatrix * pointOnCapsule + boxInfo.worldPosition;
+    outInfo.pBLocal = boxInfo.worldMatrix * pointOnBox + boxInfo.worldPosition;
+
+    return (penetration > scalar(0.0));
+}
+
+// Compute a contact info if the two bounding volume collide
+bool rpNarrowPhaseCapsuleAlgorithm::testCollision(const rpCollisionShapeInfo& shape1Info,
+                                                  const rpCollisionShapeInfo& shape2Info,
+                                                  OutContactInfo& outInfo)
+{
+    assert(isSupportedPair(shape1Info.collisionShape->getType(), shape2Info.collisionShape->getType()));
+
+    if (shape2Info.collisionShape->getType() == BOX)
+    {
+        return testCapsuleBox(shape1Info, shape2Info, outInfo);
+    }
+
+    if (shape1Info.collisionShape->getType() == BOX)
+    {
+        // The result of the test is computed from the capsule , so it is reversed
+        const bool isCollision = testCapsuleBox(shape2Info, shape1Info, outInfo);
+        outInfo.m_normal = -outInfo.m_normal;
+        Swap(outInfo.pALocal, outInfo.pBLocal);
+        return isCollision;
+    }
+
+    return testSegmentSegment(shape1Info, shape2Info, outInfo);
+}
+
+} /* namespace real_physics */
@@ -0,0 +1,87 @@
+/*
+ * rpNarrowPhaseCapsuleAlgorithm.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SOURCE_ENGIE_COLLISION_NARROWPHASE_RPNARROWPHASECAPSULEALGORITHM_H_
+#define SOURCE_ENGIE_COLLISION_NARROWPHASE_RPNARROWPHASECAPSULEALGORITHM_H_
+
+#include "../rpCollisionShapeInfo.h"
+#include "rpNarrowPhaseCollisionAlgorithm.h"
+
+namespace real_physics
+{
+
+// Class rpNarrowPhaseCapsuleAlgorithm
+/**
+ * This class computes the collision between a capsule and a capsule , a sphere
+ * or a box in closed form , without the GJK/EPA iterations. A capsule and a
+ * sphere are both the points at a distance of a radius from a segment (a point
+ * for the sphere) , so their collision is the distance between two segments. The
+ * box is tested against the segment of the capsule in the local space of the box.
+ *
+ * The result follows the convention of the GJK/EPA algorithm : the normal goes
+ * from the second shape to the first one , and if the shapes are separated the
+ * method returns false with the opposite of the distance as penetration depth
+ * and the closest points of the two shapes in world-space.
+ */
+class rpNarrowPhaseCapsuleAlgorithm : public rpNarrowPhaseCollisionAlgorithm
+{
+
+    private :
+
+        // -------------------- Methods -------------------- //
+
+        /// Private copy-constructor
+        rpNarrowPhaseCapsuleAlgorithm(const rpNarrowPhaseCapsuleAlgorithm& algorithm);
+
+        /// Private assignment operator
+        rpNarrowPhaseCapsuleAlgorithm& operator=(const rpNarrowPhaseCapsuleAlgorithm& algorithm);
+
+        /// Compute the world-space segment and the radius of a capsule or a sphere
+        static void computeSegment(const rpCollisionShapeInfo& shapeInfo,
+                                   Vector3& point1, Vector3& point2, scalar& radius);
+
+        /// Collision between two capsules or between a capsule and a sphere
+        static bool testSegmentSegment(const rpCollisionShapeInfo& shape1Info,
+                                       const rpCollisionShapeInfo& shape2Info,
+                                       OutContactInfo& outInfo);
+
+        /// Collision between a capsule and a box
+        static bool testCapsuleBox(const rpCollisionShapeInfo& capsuleInfo,
+                                   const rpCollisionShapeInfo& boxInfo,
+                                   OutContactInfo& outInfo);
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        rpNarrowPhaseCapsuleAlgorithm();
+
+        /// Destructor
+        virtual ~rpNarrowPhaseCapsuleAlgorithm();
+
+        /// Return true if the algorithm handles the collision between two types of shapes
+        static bool isSupportedPair(CollisionShapeType type1, CollisionShapeType type2);
+
+        /// Compute a contact info if the two bounding volume collide
+        virtual bool testCollision(const rpCollisionShapeInfo& shape1Info,
+                                   const rpCollisionShapeInfo& shape2Info,
+                                   OutContactInfo& outInfo);
+};
+
+// Return true if the algorithm handles the collision between two types of shapes
+/// One of the shapes is a capsule and the other one a capsule , a sphere or a box
+SIMD_INLINE bool rpNarrowPhaseCapsuleAlgorithm::isSupportedPair(CollisionShapeType type1,
+                                                                CollisionShapeType type2)
+{
+    if (type1 != CAPSULE) Swap(type1, type2);
+    return (type1 == CAPSULE && (type2 == CAPSULE || type2 == SPHERE || type2 == BOX));
+}
+
+} /* namespace real_physics */
+
+#endif /* SOURCE_ENGIE_COLLISION_NARROWPHASE_RPNARROWPHASECAPSULEALGORITHM_H_ */
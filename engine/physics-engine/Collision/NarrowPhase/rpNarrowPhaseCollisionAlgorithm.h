@@ -34,6 +34,7 @@ class OutContactInfo
         Vector3 pBLocal;
 
         OutContactInfo()
+         : m_penetrationDepth(0)
         {
 
         }
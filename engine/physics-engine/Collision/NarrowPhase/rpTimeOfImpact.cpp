@@ -0,0 +1,95 @@
+/*
+ * rpTimeOfImpact.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#include "rpTimeOfImpact.h"
+#include "../rpCollisionShapeInfo.h"
+#include "GJK_EPA/rpGjkEpa.h"
+
+namespace real_physics
+{
+
+
+// Return the distance from the origin of the body of the farthest point of the shape
+scalar rpTimeOfImpact::computeBoundingRadius(const rpProxyShape* shape)
+{
+    Vector3 minBounds(0,0,0);
+    Vector3 maxBounds(0,0,0);
+    shape->getCollisionShape()->getLocalBounds(minBounds, maxBounds);
+
+    Vector3 extent(Max(Abs(minBounds.x), Abs(maxBounds.x)),
+                   Max(Abs(minBounds.y), Abs(maxBounds.y)),
+                   Max(Abs(minBounds.z), Abs(maxBounds.z)));
+
+    return shape->getLocalToBodyTransform().getPosition().length() + extent.length();
+}
+
+
+// Compute the first time of impact of the two shapes after the fraction tMin of the step
+bool rpTimeOfImpact::computeTimeOfImpact( const rpProxyShape* shape1 , const rpSweep& sweep1 ,
+                                          const rpProxyShape* shape2 , const rpSweep& sweep2 ,
+                                          scalar tMin , scalar& toi , Vector3& normal )
+{
+    scalar t = Max(tMin, sweep1.alpha0, sweep2.alpha0);
+    if (t >= scalar(1.0)) return false;
+
+    // Velocities of the bodies per fraction of the step
+    Vector3 linearVelocity1 = (sweep1.alpha0 < scalar(1.0)) ?
+            (sweep1.transform1.getPosition() - sweep1.transform0.getPosition()) / (scalar(1.0) - sweep1.alpha0) : Vector3(0,0,0);
+    Vector3 linearVelocity2 = (sweep2.alpha0 < scalar(1.0)) ?
+            (sweep2.transform1.getPosition() - sweep2.transform0.getPosition()) / (scalar(1.0) - sweep2.alpha0) : Vector3(0,0,0);
+
+    scalar angularBound = scalar(0.0);
+    if (sweep1.alpha0 < scalar(1.0))
+        angularBound += sweep1.getRotationAngle() / (scalar(1.0) - sweep1.alpha0) * computeBoundingRadius(shape1);
+    if (sweep2.alpha0 < scalar(1.0))
+        angularBound += sweep2.getRotationAngle() / (scalar(1.0) - sweep2.alpha0) * computeBoundingRadius(shape2);
+
+
+    rpGjkEpaSolver::sResults results;
+    for (uint iteration = 0; iteration < CCD_MAX_TIME_OF_IMPACT_ITERATIONS; ++iteration)
+    {
+        rpCollisionShapeInfo shape1Info(shape1->getCollisionShape(), sweep1.getTransform(t) * shape1->getLocalToBodyTransform(), NULL);
+        rpCollisionShapeInfo shape2Info(shape2->getCollisionShape(), sweep2.getTransform(t) * shape2->getLocalToBodyTransform(), NULL);
+
+        Vector3 guessVector(shape1Info.getWorldTransform().getPosition() -
+                            shape2Info.getWorldTransform().getPosition());
+        if (guessVector.length2() < MACHINE_EPSILON) guessVector = Vector3(1,0,0);
+
+        // The shapes are overlapping : at the start of the sweep the discrete
+        // collision detection takes care of them , otherwise the step was too big
+        if (!rpGjkEpaSolver::Distance(shape1Info, shape2Info, guessVector, results))
+        {
+            if (iteration == 0) return false;
+            toi = t;
+            return true;
+        }
+
+        // Normal from shape2 toward shape1
+        normal = results.normal;
+
+        if (results.distance < CCD_TIME_OF_IMPACT_TOLERANCE)
+        {
+            if (iteration == 0) return false;
+            toi = t;
+            return true;
+        }
+
+        // Bound of the approach velocity along the normal
+        scalar approachVelocity = (linearVelocity2 - linearVelocity1).dot(normal) + angularBound;
+        if (approachVelocity <= MACHINE_EPSILON) return false;
+
+        t += (results.distance - scalar(0.5) * CCD_TIME_OF_IMPACT_TOLERANCE) / approachVelocity;
+        if (t >= scalar(1.0)) return false;
+    }
+
+    // No convergence , the last safe fraction is reported
+    toi = t;
+    return true;
+}
+
+
+} /* namespace real_physics */
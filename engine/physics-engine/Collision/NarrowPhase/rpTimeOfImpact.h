@@ -0,0 +1,139 @@
+/*
+ * rpTimeOfImpact.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SOURCE_ENGIE_COLLISION_NARROWPHASE_RPTIMEOFIMPACT_H_
+#define SOURCE_ENGIE_COLLISION_NARROWPHASE_RPTIMEOFIMPACT_H_
+
+#include "../rpProxyShape.h"
+#include "../../LinearMaths/mathematics.h"
+
+namespace real_physics
+{
+
+
+// Structure rpSweep
+/**
+ * Motion of a body during a step. The transform of the body is interpolated
+ * between transform0 at the fraction of the step alpha0 and transform1 at the
+ * end of the step (fraction 1).
+ */
+struct rpSweep
+{
+
+    // -------------------- Attributes -------------------- //
+
+    /// Transform of the body at the fraction alpha0 of the step
+    Transform transform0;
+
+    /// Transform of the body at the end of the step
+    Transform transform1;
+
+    /// Fraction of the step of transform0
+    scalar alpha0;
+
+
+    // -------------------- Methods -------------------- //
+
+    /// Constructor
+    rpSweep()
+     : alpha0(0)
+    {
+    }
+
+    /// Constructor
+    rpSweep(const Transform& _transform0 , const Transform& _transform1 , scalar _alpha0 = scalar(0))
+     : transform0(_transform0) ,
+       transform1(_transform1) ,
+       alpha0(_alpha0)
+    {
+    }
+
+    /// Return the transform at the fraction t of the step (alpha0 <= t <= 1)
+    Transform getTransform( scalar t ) const;
+
+    /// Return the rotation angle of the body during the sweep
+    scalar getRotationAngle() const;
+
+    /// Advance the start of the sweep to the fraction t of the step
+    void advance( scalar t );
+};
+
+
+// Structure rpTimeOfImpactEvent
+/**
+ * Time of impact found by the continuous collision detection
+ * between two proxy shapes during a step.
+ */
+struct rpTimeOfImpactEvent
+{
+    /// Proxy shape of the moving body
+    rpProxyShape* shape1;
+
+    /// Proxy shape hit by the moving body
+    rpProxyShape* shape2;
+
+    /// Fraction of the step of the impact
+    scalar time;
+
+    /// Normal of the contact (from shape2 toward shape1)
+    Vector3 normal;
+};
+
+
+// Class rpTimeOfImpact
+/**
+ * Time of impact between two moving convex shapes computed by conservative
+ * advancement : the shapes are advanced along their sweeps by steps that can
+ * not make them interpenetrate , using the distance between them given by the
+ * GJK algorithm and a bound of their approach velocity.
+ */
+class rpTimeOfImpact
+{
+
+    private:
+
+      /// Return the distance from the origin of the body of the farthest point of the shape
+      static scalar computeBoundingRadius( const rpProxyShape* shape );
+
+    public:
+
+      /// Compute the first time of impact of the two shapes after the fraction tMin
+      /// of the step , return false if the shapes don't collide during the step
+      static bool computeTimeOfImpact( const rpProxyShape* shape1 , const rpSweep& sweep1 ,
+                                       const rpProxyShape* shape2 , const rpSweep& sweep2 ,
+                                       scalar tMin , scalar& toi , Vector3& normal );
+
+};
+
+
+// Return the transform at the fraction t of the step
+SIMD_INLINE Transform rpSweep::getTransform( scalar t ) const
+{
+    if (alpha0 >= scalar(1.0)) return transform1;
+    scalar factor = (t - alpha0) / (scalar(1.0) - alpha0);
+    return Transform::interpolateTransforms( transform0 , transform1 , Clamp(factor , scalar(0.0) , scalar(1.0)) );
+}
+
+// Return the rotation angle of the body during the sweep
+SIMD_INLINE scalar rpSweep::getRotationAngle() const
+{
+    Quaternion delta = transform1.getOrientation() * transform0.getOrientation().getInverse();
+    scalar cosHalf = Clamp(Abs(delta.w) , scalar(0.0) , scalar(1.0));
+    return scalar(2.0) * ArcCos(cosHalf);
+}
+
+// Advance the start of the sweep to the fraction t of the step
+SIMD_INLINE void rpSweep::advance( scalar t )
+{
+    transform0 = getTransform(t);
+    alpha0 = t;
+}
+
+
+} /* namespace real_physics */
+
+#endif /* SOURCE_ENGIE_COLLISION_NARROWPHASE_RPTIMEOFIMPACT_H_ */
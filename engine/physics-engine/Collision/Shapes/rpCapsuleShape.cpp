@@ -0,0 +1,155 @@
+/*
+ * rpCapsuleShape.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+// Libraries
+#include "rpCapsuleShape.h"
+
+#include <cassert>
+
+#include "../rpProxyShape.h"
+
+namespace real_physics
+{
+
+#define MAX_PETURBERATION_ITERATIONS	    4
+#define EPS_PETURBERATION_ANGLES_COFFICIENT	0.08
+
+// Constructor
+/**
+ * @param radius Radius of the hemispheres of the capsule (in meters)
+ * @param height Distance between the centers of the two hemispheres (in meters)
+ */
+rpCapsuleShape::rpCapsuleShape(scalar radius, scalar height)
+: rpConvexShape(CAPSULE, radius),
+  mHalfHeight(height * scalar(0.5))
+{
+    assert(radius > scalar(0.0));
+    assert(height > scalar(0.0));
+
+    // The two ends of the segment give the contacts of a capsule lying on its side
+    mNbMaxPeturberationIteration = MAX_PETURBERATION_ITERATIONS; // maximum iteration  for Axis Peturberation
+    mEpsilonPeturberation = EPS_PETURBERATION_ANGLES_COFFICIENT;// epsilon for Peturberation
+}
+
+// Destructor
+rpCapsuleShape::~rpCapsuleShape()
+{
+
+}
+
+// Return the local inertia tensor of the capsule
+/// The tensor is the one of the cylinder between the hemispheres plus the one of
+/// the two hemispheres moved at the ends of the cylinder. The mass is shared
+/// between the cylinder and the sphere in proportion to their volumes.
+/**
+ * @param[out] tensor The 3x3 inertia tensor matrix of the shape in local-space
+ *                    coordinates
+ * @param mass Mass to use to compute the inertia tensor of the collision shape
+ */
+void rpCapsuleShape::computeLocalInertiaTensor(Matrix3x3& tensor, scalar mass) const
+{
+    const scalar radius = mMargin;
+    const scalar height = mHalfHeight + mHalfHeight;
+    const scalar radiusSquare = radius * radius;
+
+    // Volumes of the cylinder and of the sphere (without the factor pi)
+    const scalar cylinderVolume = radiusSquare * height;
+    const scalar sphereVolume   = scalar(4.0) / scalar(3.0) * radiusSquare * radius;
+
+    const scalar cylinderMass = mass * cylinderVolume / (cylinderVolume + sphereVolume);
+    const scalar sphereMass   = mass - cylinderMass;
+
+    const scalar diagY  = cylinderMass * radiusSquare * scalar(0.5) +
+                          sphereMass * radiusSquare * scalar(0.4);
+    const scalar diagXZ = cylinderMass * (radiusSquare * scalar(0.25) + height * height / scalar(12.0)) +
+                          sphereMass * (radiusSquare * scalar(0.4) + height * height * scalar(0.25) +
+                                        scalar(0.375) * height * radius);
+
+    tensor.setAllValues(diagXZ, 0.0, 0.0,
+                        0.0, diagY, 0.0,
+                        0.0, 0.0, diagXZ);
+}
+
+// Raycast method with feedback information
+/// The capsule is the union of the side of a cylinder and of two spheres. The ray
+/// starts outside of the capsule , so its first hit is the closest of the hits on them.
+bool rpCapsuleShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, rpProxyShape* proxyShape) const
+{
+    const scalar radius = mMargin;
+    const scalar radiusSquare = radius * radius;
+
+    // If the origin of the ray is inside the capsule, we return no intersection
+    if (testPointInside(ray.point1, proxyShape)) return false;
+
+    const Vector3 rayDirection = ray.point2 - ray.point1;
+    const scalar raySquareLength = rayDirection.lengthSquare();
+    if (raySquareLength < MACHINE_EPSILON) return false;
+
+    scalar  hitFraction = ray.maxFraction;
+    Vector3 hitNormal;
+    bool    isHit = false;
+
+    // Side of the cylinder between the two hemispheres
+    const scalar a = rayDirection.x * rayDirection.x + rayDirection.z * rayDirection.z;
+    if (a > MACHINE_EPSILON)
+    {
+        const scalar b = ray.point1.x * rayDirection.x + ray.point1.z * rayDirection.z;
+        const scalar c = ray.point1.x * ray.point1.x + ray.point1.z * ray.point1.z - radiusSquare;
+        const scalar discriminant = b * b - a * c;
+        if (discriminant >= scalar(0.0))
+        {
+            const scalar t = (-b - SquareRoot(discriminant)) / a;
+            const Vector3 point = ray.point1 + t * rayDirection;
+            if (t >= scalar(0.0) && t <= hitFraction && Abs(point.y) <= mHalfHeight)
+            {
+                hitFraction = t;
+                hitNormal = Vector3(point.x, 0.0, point.z);
+                isHit = true;
+            }
+        }
+    }
+
+    // The two hemispheres
+    for (int i = 0; i < 2; i++)
+    {
+        const Vector3 center(0.0, (i == 0) ? mHalfHeight : -mHalfHeight, 0.0);
+        const Vector3 m = ray.point1 - center;
+        const scalar b = m.dot(rayDirection);
+        const scalar c = m.dot(m) - radiusSquare;
+
+        // The ray starts outside of the sphere and goes away from it
+        if (c > scalar(0.0) && b > scalar(0.0)) continue;
+
+        const scalar discriminant = b * b - raySquareLength * c;
+        if (discriminant < scalar(0.0)) continue;
+
+        const scalar t = (-b - SquareRoot(discriminant)) / raySquareLength;
+        if (t >= scalar(0.0) && t <= hitFraction)
+        {
+            hitFraction = t;
+            hitNormal = ray.point1 + t * rayDirection - center;
+            isHit = true;
+        }
+    }
+
+    if (!isHit) return false;
+
+    raycastInfo.body = proxyShape->getBody();
+    raycastInfo.proxyShape = proxyShape;
+    raycastInfo.hitFraction = hitFraction;
+    raycastInfo.worldPoint = ray.point1 + hitFraction * rayDirection;
+    raycastInfo.worldNormal = hitNormal;
+
+    return true;
+}
+
+
+#undef MAX_PETURBERATION_ITERATIONS
+#undef EPS_PETURBERATION_ANGLES_COFFICIENT
+
+
+} /* namespace real_physics */
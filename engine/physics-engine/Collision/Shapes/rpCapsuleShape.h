@@ -0,0 +1,143 @@
+/*
+ * rpCapsuleShape.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef COLLISION_SHAPES_RPCAPSULESHAPE_H_
+#define COLLISION_SHAPES_RPCAPSULESHAPE_H_
+
+#include "rpConvexShape.h"
+
+namespace real_physics
+{
+
+// Class CapsuleShape
+/**
+ * This class represents a capsule collision shape that is centered at the
+ * origin and aligned with the local y axis. The capsule is the set of the points
+ * at a distance of the radius from the segment between the centers of its two
+ * hemispheres. Like the sphere , the capsule does not have an explicit object
+ * margin : the margin is the radius and the support point without margin is an
+ * end of the inner segment.
+ */
+class rpCapsuleShape : public rpConvexShape
+{
+
+    protected :
+
+        // -------------------- Attributes -------------------- //
+
+        /// Half height of the inner segment (between the centers of the hemispheres)
+        scalar mHalfHeight;
+
+        // -------------------- Methods -------------------- //
+
+        /// Private copy-constructor
+        rpCapsuleShape(const rpCapsuleShape& shape);
+
+        /// Private assignment operator
+        rpCapsuleShape& operator=(const rpCapsuleShape& shape);
+
+        /// Return a local support point in a given direction without the object margin
+        virtual Vector3 getLocalSupportPointWithoutMargin(const Vector3& direction,
+                                                          void** cachedCollisionData) const;
+
+        /// Return true if a point is inside the collision shape
+        virtual bool testPointInside(const Vector3& localPoint, rpProxyShape* proxyShape) const;
+
+        /// Raycast method with feedback information
+        virtual bool raycast(const Ray& ray, RaycastInfo& raycastInfo, rpProxyShape* proxyShape) const;
+
+        /// Return the number of bytes used by the collision shape
+        virtual size_t getSizeInBytes() const;
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        rpCapsuleShape(scalar radius, scalar height);
+
+        /// Destructor
+        virtual ~rpCapsuleShape();
+
+        /// Return the radius of the capsule
+        scalar getRadius() const;
+
+        /// Return the height of the inner segment of the capsule
+        scalar getHeight() const;
+
+        /// Set the scaling vector of the collision shape
+        virtual void setLocalScaling(const Vector3& scaling);
+
+        /// Return the local bounds of the shape in x, y and z directions.
+        virtual void getLocalBounds(Vector3& min, Vector3& max) const;
+
+        /// Return the local inertia tensor of the collision shape
+        virtual void computeLocalInertiaTensor(Matrix3x3& tensor, scalar mass) const;
+};
+
+// Return the radius of the capsule
+/**
+ * @return Radius of the hemispheres of the capsule (in meters)
+ */
+SIMD_INLINE scalar rpCapsuleShape::getRadius() const
+{
+    return mMargin;
+}
+
+// Return the height of the inner segment of the capsule
+/**
+ * @return Distance between the centers of the two hemispheres (in meters)
+ */
+SIMD_INLINE scalar rpCapsuleShape::getHeight() const
+{
+    return mHalfHeight + mHalfHeight;
+}
+
+// Set the scaling vector of the collision shape
+/// The radius follows the x scaling and the height the y scaling
+SIMD_INLINE void rpCapsuleShape::setLocalScaling(const Vector3& scaling)
+{
+    mMargin     = (mMargin / mScaling.x) * scaling.x;
+    mHalfHeight = (mHalfHeight / mScaling.y) * scaling.y;
+    rpCollisionShape::setLocalScaling(scaling);
+}
+
+// Return the number of bytes used by the collision shape
+SIMD_INLINE size_t rpCapsuleShape::getSizeInBytes() const
+{
+    return sizeof(rpCapsuleShape);
+}
+
+// Return a local support point in a given direction without the object margin
+/// The radius is the margin of the capsule , so the support point is an end of the segment
+SIMD_INLINE Vector3 rpCapsuleShape::getLocalSupportPointWithoutMargin(const Vector3& direction,
+                                                                      void** /*cachedCollisionData*/) const
+{
+    return Vector3(0.0, direction.y < scalar(0.0) ? -mHalfHeight : mHalfHeight, 0.0);
+}
+
+// Return the local bounds of the shape in x, y and z directions.
+/**
+ * @param min The minimum bounds of the shape in local-space coordinates
+ * @param max The maximum bounds of the shape in local-space coordinates
+ */
+SIMD_INLINE void rpCapsuleShape::getLocalBounds(Vector3& min, Vector3& max) const
+{
+    max = Vector3(mMargin, mHalfHeight + mMargin, mMargin);
+    min = -max;
+}
+
+// Return true if a point is inside the collision shape
+SIMD_INLINE bool rpCapsuleShape::testPointInside(const Vector3& localPoint, rpProxyShape* /*proxyShape*/) const
+{
+    const scalar y = Min(mHalfHeight, Max(-mHalfHeight, localPoint.y));
+    return ((localPoint - Vector3(0.0, y, 0.0)).lengthSquare() < mMargin * mMargin);
+}
+
+} /* namespace real_physics */
+
+#endif /* COLLISION_SHAPES_RPCAPSULESHAPE_H_ */
@@ -36,7 +36,7 @@ namespace real_physics
    *                  computed in world-space coordinates
    * @param transform Transform used to compute the AABB of the collision shape
    */
-  void rpCollisionShape::computeAABB(rpAABB& aabb, const Transform& transform0 , const Transform& transform1 , const Matrix3x3& matrixBoost ) const
+  void rpCollisionShape::computeAABB(rpAABB& aabb, const Transform& transform0 , const Transform& transform1 , const LorentzContraction& relativityMotion ) const
   {
 
 	  Transform transform = transform0 * transform1;
@@ -54,7 +54,17 @@ namespace real_physics
 
 
       // Rotate the local bounds according to the orientation of the body
-      Matrix3x3 worldAxis = matrixBoost * transform.getOrientation().getMatrix().getAbsoluteMatrix();
+      Matrix3x3 worldAxis = transform.getOrientation().getMatrix().getAbsoluteMatrix();
+      Vector3   localPosition = transform0.getBasis() * transform1.getPosition();
+
+      // The Newtonian bodies keep the identity boost and skip its products
+      if (!relativityMotion.isIdentityBoost())
+      {
+          const Matrix3x3 matrixBoost = relativityMotion.getLorentzMatrix();
+          worldAxis     = matrixBoost * worldAxis;
+          localPosition = matrixBoost * localPosition;
+      }
+
       Vector3 worldMinBounds(worldAxis.getRow(0).dot(minBounds),
                              worldAxis.getRow(1).dot(minBounds),
                              worldAxis.getRow(2).dot(minBounds));
@@ -79,7 +89,7 @@ namespace real_physics
 
 
       /// theory of reletivity to displacement boost matrix
-      Vector3 position = transform0.getPosition() + (matrixBoost * (transform0.getBasis() * transform1.getPosition()));
+      Vector3 position = transform0.getPosition() + localPosition;
 
 //				      glPushMatrix();
 //				      Vector3 halfSize = (worldMinBounds - worldMaxBounds);
@@ -101,4 +111,26 @@ namespace real_physics
 
 
 
+  // Compute the world-space AABB of the collision shape swept between two transforms of the body
+  /**
+   * @param[out] aabb The AABB containing the collision shape at the two transforms
+   * @param bodyTransform0 Transform of the body at the start of the motion
+   * @param bodyTransform1 Transform of the body at the end of the motion
+   * @param localTransform Transform of the shape in the local-space of the body
+   * @param relativityMotion0 Lorentz contraction of the body at the start of the motion
+   * @param relativityMotion1 Lorentz contraction of the body at the end of the motion
+   */
+  void rpCollisionShape::computeSweptAABB(rpAABB& aabb, const Transform& bodyTransform0 , const Transform& bodyTransform1 , const Transform& localTransform ,
+                                          const LorentzContraction& relativityMotion0 , const LorentzContraction& relativityMotion1 ) const
+  {
+      computeAABB(aabb, bodyTransform0 , localTransform , relativityMotion0);
+
+      rpAABB endAABB;
+      computeAABB(endAABB, bodyTransform1 , localTransform , relativityMotion1);
+
+      aabb.mergeWithAABB(endAABB);
+  }
+
+
+
 } /* namespace real_physics */
@@ -206,7 +206,12 @@ namespace real_physics
           virtual void computeLocalInertiaTensor(Matrix3x3& tensor, scalar mass) const {}
 
           /// Compute the world-space AABB of the collision shape given a transform
-          virtual void computeAABB(rpAABB& aabb, const Transform& transform0 , const Transform& transform1 , const Matrix3x3& matrixBoost = Matrix3x3::identity()) const;
+          virtual void computeAABB(rpAABB& aabb, const Transform& transform0 , const Transform& transform1 , const LorentzContraction& relativityMotion = LorentzContraction()) const;
+
+          /// Compute the world-space AABB of the collision shape swept between two transforms of the body
+          void computeSweptAABB(rpAABB& aabb, const Transform& bodyTransform0 , const Transform& bodyTransform1 , const Transform& localTransform ,
+                                const LorentzContraction& relativityMotion0 = LorentzContraction() ,
+                                const LorentzContraction& relativityMotion1 = LorentzContraction()) const;
 
           /// Return true if the collision shape type is a convex shape
           static bool isConvex(CollisionShapeType shapeType);
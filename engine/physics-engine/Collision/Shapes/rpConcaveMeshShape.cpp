@@ -0,0 +1,195 @@
+/*
+ * rpConcaveMeshShape.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#include "rpConcaveMeshShape.h"
+#include "../rpProxyShape.h"
+
+namespace real_physics
+{
+
+
+  // Class TriangleOverlapCallback
+  /**
+   * Gather the triangles reported by the AABB tree of the mesh.
+   */
+  class TriangleOverlapCallback : public rpDynamicAABBTreeOverlapCallback
+  {
+
+      private:
+
+          std::vector<uint>& mTriangles;
+
+      public:
+
+          TriangleOverlapCallback(std::vector<uint>& triangles)
+           : mTriangles(triangles)
+          {
+
+          }
+
+          // Called for each triangle overlapping the AABB
+          virtual void notifyOverlappingNode(int triangleIndex)
+          {
+              mTriangles.push_back(triangleIndex);
+          }
+  };
+
+
+  // Class ConcaveMeshRaycastCallback
+  /**
+   * Raycast the triangles hit by the ray in the AABB tree of the mesh
+   * and keep the closest hit.
+   */
+  class ConcaveMeshRaycastCallback : public rpDynamicAABBTreeRaycastCallback
+  {
+
+      private:
+
+          const rpConcaveMeshShape* mConcaveMeshShape;
+          rpProxyShape* mProxyShape;
+          RaycastInfo&  mRaycastInfo;
+          bool          mIsHit;
+
+      public:
+
+          ConcaveMeshRaycastCallback(const rpConcaveMeshShape* concaveMeshShape, rpProxyShape* proxyShape,
+                                     RaycastInfo& raycastInfo)
+           : mConcaveMeshShape(concaveMeshShape), mProxyShape(proxyShape),
+             mRaycastInfo(raycastInfo), mIsHit(false)
+          {
+
+          }
+
+          // Called for each triangle whose AABB is hit by the ray
+          virtual scalar raycastBroadPhaseShape(int32 triangleIndex, const Ray& ray)
+          {
+              Vector3 trianglePoints[3];
+              mConcaveMeshShape->getTriangleVertices(triangleIndex, trianglePoints);
+
+              rpTriangleShape triangleShape(trianglePoints[0], trianglePoints[1], trianglePoints[2]);
+              triangleShape.setRaycastTestType(mConcaveMeshShape->getRaycastTestType());
+
+              RaycastInfo triangleRaycastInfo;
+              if (!triangleShape.raycast(ray, triangleRaycastInfo, mProxyShape)) return scalar(-1.0);
+
+              // The tree gives a shorter ray after each hit , so this hit is the closest one
+              mRaycastInfo.body          = triangleRaycastInfo.body;
+              mRaycastInfo.proxyShape    = triangleRaycastInfo.proxyShape;
+              mRaycastInfo.worldPoint    = triangleRaycastInfo.worldPoint;
+              mRaycastInfo.worldNormal   = triangleRaycastInfo.worldNormal;
+              mRaycastInfo.hitFraction   = triangleRaycastInfo.hitFraction;
+              mRaycastInfo.meshSubpart   = 0;
+              mRaycastInfo.triangleIndex = triangleIndex;
+              mIsHit = true;
+              return triangleRaycastInfo.hitFraction;
+          }
+
+          bool isHit() const
+          {
+              return mIsHit;
+          }
+  };
+
+
+
+  // Constructor
+  /**
+   * @param vertices Array of the vertices of the mesh
+   * @param nbVertices Number of vertices
+   * @param indices Array of three vertex indexes for each triangle
+   * @param nbTriangles Number of triangles
+   */
+  rpConcaveMeshShape::rpConcaveMeshShape(const Vector3* vertices, uint nbVertices,
+                                         const uint* indices, uint nbTriangles)
+   : rpConcaveShape(CONCAVE_MESH),
+     mVertices(vertices, vertices + nbVertices),
+     mIndices(indices, indices + 3 * nbTriangles)
+  {
+      initBVH();
+  }
+
+  // Constructor with the vertex and index buffers of a mesh
+  /**
+   * @param vertices Vertices of the mesh
+   * @param indices Three vertex indexes for each triangle
+   */
+  rpConcaveMeshShape::rpConcaveMeshShape(const std::vector<Vector3>& vertices, const std::vector<uint>& indices)
+   : rpConcaveShape(CONCAVE_MESH),
+     mVertices(vertices),
+     mIndices(indices)
+  {
+      assert(mIndices.size() % 3 == 0);
+      initBVH();
+  }
+
+  // Destructor
+  rpConcaveMeshShape::~rpConcaveMeshShape()
+  {
+
+  }
+
+  // Build the AABB tree over the triangles of the mesh
+  void rpConcaveMeshShape::initBVH()
+  {
+      const uint nbTriangles = getNbTriangles();
+
+      std::vector<rpAABB> aabbs(nbTriangles);
+      for (uint i = 0; i < nbTriangles; i++)
+      {
+          Vector3 trianglePoints[3];
+          getTriangleVertices(i, trianglePoints);
+
+          // The AABB contains the collision margin of the triangle
+          aabbs[i] = rpAABB::createAABBForTriangle(trianglePoints);
+          aabbs[i].inflate(OBJECT_MARGIN, OBJECT_MARGIN, OBJECT_MARGIN);
+      }
+
+      mTree.build(aabbs.data(), nbTriangles);
+  }
+
+  // Return the local bounds of the shape in x, y and z directions.
+  /**
+   * @param min The minimum bounds of the shape in local-space coordinates
+   * @param max The maximum bounds of the shape in local-space coordinates
+   */
+  void rpConcaveMeshShape::getLocalBounds(Vector3& min, Vector3& max) const
+  {
+      if (mTree.getNbNodes() == 0)
+      {
+          min.setToZero();
+          max.setToZero();
+          return;
+      }
+
+      const rpAABB rootAABB = mTree.getRootAABB();
+      min = rootAABB.getMin();
+      max = rootAABB.getMax();
+  }
+
+  // Return the index of the triangles overlapping with an AABB in the local-space of the shape
+  /**
+   * @param localAABB AABB in the scaled local-space of the shape
+   * @param[out] triangles Index of the triangles whose AABB overlaps with the AABB
+   */
+  void rpConcaveMeshShape::getTrianglesOverlappingWithAABB(const rpAABB& localAABB,
+                                                           std::vector<uint>& triangles) const
+  {
+      TriangleOverlapCallback callback(triangles);
+      mTree.reportAllItemsOverlappingWithAABB(localAABB, callback);
+  }
+
+  // Raycast method with feedback information
+  /// The ray is in the local-space of the shape
+  bool rpConcaveMeshShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, rpProxyShape* proxyShape) const
+  {
+      ConcaveMeshRaycastCallback callback(this, proxyShape, raycastInfo);
+      mTree.raycast(ray, callback);
+      return callback.isHit();
+  }
+
+
+} /* namespace real_physics */
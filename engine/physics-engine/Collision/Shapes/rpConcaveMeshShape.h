@@ -0,0 +1,144 @@
+/*
+ * rpConcaveMeshShape.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef COLLISION_SHAPES_RPCONCAVEMESHSHAPE_H_
+#define COLLISION_SHAPES_RPCONCAVEMESHSHAPE_H_
+
+#include "rpConcaveShape.h"
+#include "../BroadPhase/rpStaticAABBTree.h"
+#include <vector>
+
+namespace real_physics
+{
+
+  // Class ConcaveMeshShape
+  /**
+   * This class represents a static concave mesh made of triangles (the level
+   * geometry for instance). The shape owns a copy of the vertex and index
+   * buffers of the mesh , so it can be shared by several bodies , and a static
+   * AABB tree over its triangles used as the midphase of the collision detection.
+   */
+  class rpConcaveMeshShape : public rpConcaveShape
+  {
+
+      protected :
+
+          // -------------------- Attributes -------------------- //
+
+          /// Vertices of the mesh (without the local scaling)
+          std::vector<Vector3> mVertices;
+
+          /// Three vertex indexes for each triangle of the mesh
+          std::vector<uint> mIndices;
+
+          /// Static AABB tree over the triangles in the scaled local-space
+          rpStaticAABBTree mTree;
+
+          // -------------------- Methods -------------------- //
+
+          /// Private copy-constructor
+          rpConcaveMeshShape(const rpConcaveMeshShape& shape);
+
+          /// Private assignment operator
+          rpConcaveMeshShape& operator=(const rpConcaveMeshShape& shape);
+
+          /// Build the AABB tree over the triangles of the mesh
+          void initBVH();
+
+          /// Raycast method with feedback information
+          virtual bool raycast(const Ray& ray, RaycastInfo& raycastInfo, rpProxyShape* proxyShape) const;
+
+          /// Return the number of bytes used by the collision shape
+          virtual size_t getSizeInBytes() const;
+
+      public :
+
+          // -------------------- Methods -------------------- //
+
+          /// Constructor
+          rpConcaveMeshShape(const Vector3* vertices, uint nbVertices,
+                             const uint* indices, uint nbTriangles);
+
+          /// Constructor with the vertex and index buffers of a mesh
+          rpConcaveMeshShape(const std::vector<Vector3>& vertices, const std::vector<uint>& indices);
+
+          /// Destructor
+          virtual ~rpConcaveMeshShape();
+
+          /// Return the local bounds of the shape in x, y and z directions.
+          virtual void getLocalBounds(Vector3& min, Vector3& max) const;
+
+          /// Set the local scaling vector of the collision shape
+          virtual void setLocalScaling(const Vector3& scaling);
+
+          /// Return the number of triangles of the mesh
+          uint getNbTriangles() const;
+
+          /// Return the vertices of the mesh (without the local scaling)
+          const std::vector<Vector3>& getVertices() const;
+
+          /// Return the three vertex indexes of each triangle
+          const std::vector<uint>& getIndices() const;
+
+          /// Return the index of the triangles overlapping with an AABB in the local-space of the shape
+          virtual void getTrianglesOverlappingWithAABB(const rpAABB& localAABB,
+                                                       std::vector<uint>& triangles) const;
+
+          /// Return the three vertices of a triangle in the local-space of the shape
+          virtual void getTriangleVertices(uint triangleIndex, Vector3* outTriangleVertices) const;
+  };
+
+
+  // Return the number of bytes used by the collision shape
+  SIMD_INLINE size_t rpConcaveMeshShape::getSizeInBytes() const
+  {
+      return sizeof(rpConcaveMeshShape);
+  }
+
+  // Return the number of triangles of the mesh
+  SIMD_INLINE uint rpConcaveMeshShape::getNbTriangles() const
+  {
+      return mIndices.size() / 3;
+  }
+
+  // Return the vertices of the mesh (without the local scaling)
+  SIMD_INLINE const std::vector<Vector3>& rpConcaveMeshShape::getVertices() const
+  {
+      return mVertices;
+  }
+
+  // Return the three vertex indexes of each triangle
+  SIMD_INLINE const std::vector<uint>& rpConcaveMeshShape::getIndices() const
+  {
+      return mIndices;
+  }
+
+  // Return the three vertices of a triangle in the local-space of the shape
+  /**
+   * @param triangleIndex Index of the triangle in the mesh
+   * @param[out] outTriangleVertices Array of three vertices with the local scaling
+   */
+  SIMD_INLINE void rpConcaveMeshShape::getTriangleVertices(uint triangleIndex, Vector3* outTriangleVertices) const
+  {
+      assert(triangleIndex < getNbTriangles());
+      outTriangleVertices[0] = mVertices[mIndices[3 * triangleIndex + 0]] * mScaling;
+      outTriangleVertices[1] = mVertices[mIndices[3 * triangleIndex + 1]] * mScaling;
+      outTriangleVertices[2] = mVertices[mIndices[3 * triangleIndex + 2]] * mScaling;
+  }
+
+  // Set the local scaling vector of the collision shape
+  SIMD_INLINE void rpConcaveMeshShape::setLocalScaling(const Vector3& scaling)
+  {
+      rpCollisionShape::setLocalScaling(scaling);
+
+      // The tree is built in the scaled local-space
+      initBVH();
+  }
+
+} /* namespace real_physics */
+
+#endif /* COLLISION_SHAPES_RPCONCAVEMESHSHAPE_H_ */
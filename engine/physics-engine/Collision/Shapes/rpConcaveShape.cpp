@@ -0,0 +1,74 @@
+/*
+ * rpConcaveShape.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#include "rpConcaveShape.h"
+
+namespace real_physics
+{
+
+
+  // Constructor
+  rpConcaveShape::rpConcaveShape(CollisionShapeType type)
+  : rpCollisionShape(type),
+    mRaycastTestType(FRONT)
+  {
+
+  }
+
+  // Destructor
+  rpConcaveShape::~rpConcaveShape()
+  {
+
+  }
+
+  // Compute the world-space AABB of the collision shape given a transform
+  /// The triangles are not centered at the origin of the shape like the convex
+  /// shapes , so the local bounds are rotated around their own center
+  /**
+   * @param[out] aabb The axis-aligned bounding box (AABB) of the collision shape
+   *                  computed in world-space coordinates
+   * @param transform0 Transform of the body
+   * @param transform1 Transform of the shape in the local-space of the body
+   */
+  void rpConcaveShape::computeAABB(rpAABB& aabb, const Transform& transform0 , const Transform& transform1 ,
+                                   const LorentzContraction& relativityMotion) const
+  {
+      const Transform transform = transform0 * transform1;
+
+      // Get the local bounds in x,y and z direction
+      Vector3 minBounds;
+      Vector3 maxBounds;
+      getLocalBounds(minBounds, maxBounds);
+
+      const Vector3 localCenter = (minBounds + maxBounds) * scalar(0.5);
+      const Vector3 halfExtents = (maxBounds - minBounds) * scalar(0.5);
+
+      // Rotate the local bounds according to the orientation of the body
+      Matrix3x3 worldAxis = transform.getOrientation().getMatrix().getAbsoluteMatrix();
+      Vector3   localPosition = transform0.getBasis() * (transform1 * localCenter);
+
+      // The Newtonian bodies keep the identity boost and skip its products
+      if (!relativityMotion.isIdentityBoost())
+      {
+          const Matrix3x3 matrixBoost = relativityMotion.getLorentzMatrix();
+          worldAxis     = matrixBoost * worldAxis;
+          localPosition = matrixBoost * localPosition;
+      }
+
+      const Vector3 worldHalfExtents(worldAxis.getRow(0).dot(halfExtents),
+                                     worldAxis.getRow(1).dot(halfExtents),
+                                     worldAxis.getRow(2).dot(halfExtents));
+
+      const Vector3 position = transform0.getPosition() + localPosition;
+
+      // Update the AABB with the new minimum and maximum coordinates
+      aabb.setMin(position - worldHalfExtents);
+      aabb.setMax(position + worldHalfExtents);
+  }
+
+
+} /* namespace real_physics */
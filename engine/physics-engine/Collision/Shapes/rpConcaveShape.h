@@ -0,0 +1,113 @@
+/*
+ * rpConcaveShape.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef COLLISION_SHAPES_RPCONCAVESHAPE_H_
+#define COLLISION_SHAPES_RPCONCAVESHAPE_H_
+
+#include "rpCollisionShape.h"
+#include "rpTriangleShape.h"
+#include <vector>
+
+namespace real_physics
+{
+
+  // Class ConcaveShape
+  /**
+   * This abstract class represents a concave collision shape made of triangles.
+   * The narrow-phase collision detection does not test the whole shape : its
+   * midphase gives the triangles overlapping the AABB of the other shape and
+   * each triangle is tested as a convex shape.
+   */
+  class rpConcaveShape : public rpCollisionShape
+  {
+
+      protected :
+
+          // -------------------- Attributes -------------------- //
+
+          /// Raycast test type for the triangles (front, back, front-back)
+          TriangleRaycastSide mRaycastTestType;
+
+          // -------------------- Methods -------------------- //
+
+          /// Private copy-constructor
+          rpConcaveShape(const rpConcaveShape& shape);
+
+          /// Private assignment operator
+          rpConcaveShape& operator=(const rpConcaveShape& shape);
+
+          /// Return true if a point is inside the collision shape
+          virtual bool testPointInside(const Vector3& localPoint, rpProxyShape* proxyShape) const;
+
+      public :
+
+          // -------------------- Methods -------------------- //
+
+          /// Constructor
+          rpConcaveShape(CollisionShapeType type);
+
+          /// Destructor
+          virtual ~rpConcaveShape();
+
+          /// Return true if the collision shape is convex, false if it is concave
+          virtual bool isConvex() const;
+
+          /// Return the local inertia tensor of the collision shape
+          virtual void computeLocalInertiaTensor(Matrix3x3& tensor, scalar mass) const;
+
+          /// Compute the world-space AABB of the collision shape given a transform
+          virtual void computeAABB(rpAABB& aabb, const Transform& transform0 , const Transform& transform1 ,
+                                   const LorentzContraction& relativityMotion = LorentzContraction()) const;
+
+          /// Return the raycast test type (front, back, front-back)
+          TriangleRaycastSide getRaycastTestType() const;
+
+          // Set the raycast test type (front, back, front-back)
+          void setRaycastTestType(TriangleRaycastSide testType);
+
+          /// Return the index of the triangles overlapping with an AABB in the local-space of the shape
+          virtual void getTrianglesOverlappingWithAABB(const rpAABB& localAABB,
+                                                       std::vector<uint>& triangles) const=0;
+
+          /// Return the three vertices of a triangle in the local-space of the shape
+          virtual void getTriangleVertices(uint triangleIndex, Vector3* outTriangleVertices) const=0;
+  };
+
+
+  // Return true if the collision shape is convex, false if it is concave
+  SIMD_INLINE bool rpConcaveShape::isConvex() const
+  {
+      return false;
+  }
+
+  // Return true if a point is inside the collision shape
+  SIMD_INLINE bool rpConcaveShape::testPointInside(const Vector3& /*localPoint*/, rpProxyShape* /*proxyShape*/) const
+  {
+      return false;
+  }
+
+  // Return the local inertia tensor of the concave shape (it is used by static bodies only)
+  SIMD_INLINE void rpConcaveShape::computeLocalInertiaTensor(Matrix3x3& tensor, scalar /*mass*/) const
+  {
+      tensor.setToZero();
+  }
+
+  // Return the raycast test type (front, back, front-back)
+  SIMD_INLINE TriangleRaycastSide rpConcaveShape::getRaycastTestType() const
+  {
+      return mRaycastTestType;
+  }
+
+  // Set the raycast test type (front, back, front-back)
+  SIMD_INLINE void rpConcaveShape::setRaycastTestType(TriangleRaycastSide testType)
+  {
+      mRaycastTestType = testType;
+  }
+
+} /* namespace real_physics */
+
+#endif /* COLLISION_SHAPES_RPCONCAVESHAPE_H_ */
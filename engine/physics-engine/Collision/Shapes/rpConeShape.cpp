@@ -0,0 +1,157 @@
+/*
+ * rpConeShape.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+// Libraries
+#include "rpConeShape.h"
+
+#include <cassert>
+
+#include "../rpProxyShape.h"
+
+namespace real_physics
+{
+
+#define MAX_PETURBERATION_ITERATIONS	    8
+#define EPS_PETURBERATION_ANGLES_COFFICIENT	0.08
+
+// Constructor
+/**
+ * @param radius Radius of the base of the cone (in meters)
+ * @param height Height of the cone (in meters)
+ * @param margin The collision margin (in meters) around the collision shape
+ */
+rpConeShape::rpConeShape(scalar radius, scalar height, scalar margin)
+: rpConvexShape(CONE, margin),
+  mRadius(radius),
+  mHeight(height)
+{
+    assert(radius > margin);
+    assert(height * scalar(0.25) > margin);
+
+    // The rim of the base lying on a face gives several contacts
+    mNbMaxPeturberationIteration = MAX_PETURBERATION_ITERATIONS; // maximum iteration  for Axis Peturberation
+    mEpsilonPeturberation = EPS_PETURBERATION_ANGLES_COFFICIENT;// epsilon for Peturberation
+}
+
+// Destructor
+rpConeShape::~rpConeShape()
+{
+
+}
+
+// Return the local inertia tensor of the cone
+/// The tensor is given at the center of mass of the cone , which is the origin of the shape
+/**
+ * @param[out] tensor The 3x3 inertia tensor matrix of the shape in local-space
+ *                    coordinates
+ * @param mass Mass to use to compute the inertia tensor of the collision shape
+ */
+void rpConeShape::computeLocalInertiaTensor(Matrix3x3& tensor, scalar mass) const
+{
+    const scalar radiusSquare = mRadius * mRadius;
+    const scalar heightSquare = mHeight * mHeight;
+
+    const scalar diagY  = scalar(0.3) * mass * radiusSquare;
+    const scalar diagXZ = mass * (scalar(3.0) / scalar(20.0) * radiusSquare +
+                                  scalar(3.0) / scalar(80.0) * heightSquare);
+
+    tensor.setAllValues(diagXZ, 0.0, 0.0,
+                        0.0, diagY, 0.0,
+                        0.0, 0.0, diagXZ);
+}
+
+// Raycast method with feedback information
+/// The side of the cone is the part of the quadric x^2 + z^2 = k^2 (apexY - y)^2
+/// between the base and the apex , with k the ratio between the radius and the height
+bool rpConeShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, rpProxyShape* proxyShape) const
+{
+    // If the origin of the ray is inside the cone, we return no intersection
+    if (testPointInside(ray.point1, proxyShape)) return false;
+
+    const scalar apexY = scalar(0.75) * mHeight;
+    const scalar baseY = scalar(-0.25) * mHeight;
+    const scalar k = mRadius / mHeight;
+    const scalar kSquare = k * k;
+
+    const Vector3 rayDirection = ray.point2 - ray.point1;
+
+    scalar  hitFraction = ray.maxFraction;
+    Vector3 hitNormal;
+    bool    isHit = false;
+
+    // Side of the cone
+    const scalar q = apexY - ray.point1.y;
+    const scalar a = rayDirection.x * rayDirection.x + rayDirection.z * rayDirection.z -
+                     kSquare * rayDirection.y * rayDirection.y;
+    const scalar b = ray.point1.x * rayDirection.x + ray.point1.z * rayDirection.z +
+                     kSquare * q * rayDirection.y;
+    const scalar c = ray.point1.x * ray.point1.x + ray.point1.z * ray.point1.z - kSquare * q * q;
+
+    scalar roots[2];
+    int nbRoots = 0;
+    if (Abs(a) < MACHINE_EPSILON)
+    {
+        if (Abs(b) > MACHINE_EPSILON) roots[nbRoots++] = -c / (scalar(2.0) * b);
+    }
+    else
+    {
+        const scalar discriminant = b * b - a * c;
+        if (discriminant >= scalar(0.0))
+        {
+            const scalar root = SquareRoot(discriminant);
+            roots[nbRoots++] = (-b - root) / a;
+            roots[nbRoots++] = (-b + root) / a;
+        }
+    }
+
+    for (int i = 0; i < nbRoots; i++)
+    {
+        const scalar t = roots[i];
+        if (t < scalar(0.0) || t > hitFraction) continue;
+
+        // Only the nappe of the quadric below the apex and above the base is the cone
+        const Vector3 point = ray.point1 + t * rayDirection;
+        if (point.y < baseY || point.y > apexY) continue;
+
+        const scalar lengthXZ = SquareRoot(point.x * point.x + point.z * point.z);
+        hitFraction = t;
+        hitNormal = (lengthXZ > MACHINE_EPSILON) ? Vector3(point.x / lengthXZ, k, point.z / lengthXZ) :
+                                                   Vector3(0.0, 1.0, 0.0);
+        isHit = true;
+    }
+
+    // Base of the cone
+    if (rayDirection.y > MACHINE_EPSILON)
+    {
+        const scalar t = (baseY - ray.point1.y) / rayDirection.y;
+        const Vector3 point = ray.point1 + t * rayDirection;
+        if (t >= scalar(0.0) && t <= hitFraction &&
+            point.x * point.x + point.z * point.z <= mRadius * mRadius)
+        {
+            hitFraction = t;
+            hitNormal = Vector3(0.0, -1.0, 0.0);
+            isHit = true;
+        }
+    }
+
+    if (!isHit) return false;
+
+    raycastInfo.body = proxyShape->getBody();
+    raycastInfo.proxyShape = proxyShape;
+    raycastInfo.hitFraction = hitFraction;
+    raycastInfo.worldPoint = ray.point1 + hitFraction * rayDirection;
+    raycastInfo.worldNormal = hitNormal;
+
+    return true;
+}
+
+
+#undef MAX_PETURBERATION_ITERATIONS
+#undef EPS_PETURBERATION_ANGLES_COFFICIENT
+
+
+} /* namespace real_physics */
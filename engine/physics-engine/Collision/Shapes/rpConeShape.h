@@ -0,0 +1,167 @@
+/*
+ * rpConeShape.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef COLLISION_SHAPES_RPCONESHAPE_H_
+#define COLLISION_SHAPES_RPCONESHAPE_H_
+
+#include "rpConvexShape.h"
+
+namespace real_physics
+{
+
+// Class ConeShape
+/**
+ * This class represents a cone collision shape aligned with the local y axis ,
+ * with its apex upward. The origin of the shape is the center of mass of the
+ * cone : the base is a quarter of the height below the origin and the apex three
+ * quarters of the height above it , so the body rotates around the right point
+ * with the inertia tensor of the shape. Like the box , the shape uses an object
+ * margin for the collision detection.
+ */
+class rpConeShape : public rpConvexShape
+{
+
+    protected :
+
+        // -------------------- Attributes -------------------- //
+
+        /// Radius of the base of the cone
+        scalar mRadius;
+
+        /// Height of the cone
+        scalar mHeight;
+
+        // -------------------- Methods -------------------- //
+
+        /// Private copy-constructor
+        rpConeShape(const rpConeShape& shape);
+
+        /// Private assignment operator
+        rpConeShape& operator=(const rpConeShape& shape);
+
+        /// Return a local support point in a given direction without the object margin
+        virtual Vector3 getLocalSupportPointWithoutMargin(const Vector3& direction,
+                                                          void** cachedCollisionData) const;
+
+        /// Return true if a point is inside the collision shape
+        virtual bool testPointInside(const Vector3& localPoint, rpProxyShape* proxyShape) const;
+
+        /// Raycast method with feedback information
+        virtual bool raycast(const Ray& ray, RaycastInfo& raycastInfo, rpProxyShape* proxyShape) const;
+
+        /// Return the number of bytes used by the collision shape
+        virtual size_t getSizeInBytes() const;
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        rpConeShape(scalar radius, scalar height, scalar margin = OBJECT_MARGIN);
+
+        /// Destructor
+        virtual ~rpConeShape();
+
+        /// Return the radius of the base of the cone
+        scalar getRadius() const;
+
+        /// Return the height of the cone
+        scalar getHeight() const;
+
+        /// Set the scaling vector of the collision shape
+        virtual void setLocalScaling(const Vector3& scaling);
+
+        /// Return the local bounds of the shape in x, y and z directions.
+        virtual void getLocalBounds(Vector3& min, Vector3& max) const;
+
+        /// Return the local inertia tensor of the collision shape
+        virtual void computeLocalInertiaTensor(Matrix3x3& tensor, scalar mass) const;
+};
+
+// Return the radius of the base of the cone
+/**
+ * @return Radius of the base of the cone (in meters)
+ */
+SIMD_INLINE scalar rpConeShape::getRadius() const
+{
+    return mRadius;
+}
+
+// Return the height of the cone
+/**
+ * @return Height of the cone (in meters)
+ */
+SIMD_INLINE scalar rpConeShape::getHeight() const
+{
+    return mHeight;
+}
+
+// Set the scaling vector of the collision shape
+/// The radius follows the x scaling and the height the y scaling
+SIMD_INLINE void rpConeShape::setLocalScaling(const Vector3& scaling)
+{
+    mRadius = (mRadius / mScaling.x) * scaling.x;
+    mHeight = (mHeight / mScaling.y) * scaling.y;
+    rpCollisionShape::setLocalScaling(scaling);
+}
+
+// Return the number of bytes used by the collision shape
+SIMD_INLINE size_t rpConeShape::getSizeInBytes() const
+{
+    return sizeof(rpConeShape);
+}
+
+// Return a local support point in a given direction without the object margin
+/// The apex is the support point of the directions inside the cone of the normals
+/// at the apex , the rim of the base the one of the other directions
+SIMD_INLINE Vector3 rpConeShape::getLocalSupportPointWithoutMargin(const Vector3& direction,
+                                                                   void** /*cachedCollisionData*/) const
+{
+    const scalar radius = mRadius - mMargin;
+    const scalar apexY  = scalar(0.75) * mHeight - mMargin;
+    const scalar baseY  = scalar(-0.25) * mHeight + mMargin;
+
+    const scalar sinAngle = radius / SquareRoot(radius * radius + (apexY - baseY) * (apexY - baseY));
+    if (direction.y > direction.length() * sinAngle)
+    {
+        return Vector3(0.0, apexY, 0.0);
+    }
+
+    const scalar lengthXZ = SquareRoot(direction.x * direction.x + direction.z * direction.z);
+    if (lengthXZ > MACHINE_EPSILON)
+    {
+        const scalar factor = radius / lengthXZ;
+        return Vector3(direction.x * factor, baseY, direction.z * factor);
+    }
+
+    return Vector3(0.0, baseY, 0.0);
+}
+
+// Return the local bounds of the shape in x, y and z directions.
+/**
+ * @param min The minimum bounds of the shape in local-space coordinates
+ * @param max The maximum bounds of the shape in local-space coordinates
+ */
+SIMD_INLINE void rpConeShape::getLocalBounds(Vector3& min, Vector3& max) const
+{
+    max = Vector3( mRadius, scalar( 0.75) * mHeight,  mRadius);
+    min = Vector3(-mRadius, scalar(-0.25) * mHeight, -mRadius);
+}
+
+// Return true if a point is inside the collision shape
+SIMD_INLINE bool rpConeShape::testPointInside(const Vector3& localPoint, rpProxyShape* /*proxyShape*/) const
+{
+    const scalar apexY = scalar(0.75) * mHeight;
+    if (localPoint.y >= apexY || localPoint.y <= scalar(-0.25) * mHeight) return false;
+
+    const scalar radius = mRadius * (apexY - localPoint.y) / mHeight;
+    return (localPoint.x * localPoint.x + localPoint.z * localPoint.z < radius * radius);
+}
+
+} /* namespace real_physics */
+
+#endif /* COLLISION_SHAPES_RPCONESHAPE_H_ */
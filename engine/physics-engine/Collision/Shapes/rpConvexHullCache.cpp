@@ -0,0 +1,200 @@
+/*
+ * rpConvexHullCache.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+// Libraries
+#include "rpConvexHullCache.h"
+
+namespace real_physics
+{
+
+// Constructor
+rpConvexHullCache::rpConvexHullCache()
+: mNbHits(0),
+  mNbMisses(0),
+  mIsSimplified(false)
+{
+
+}
+
+// Constructor of a cache simplifying the hulls it computes
+/**
+ * @param simplification The simplification of every hull computed by the cache
+ */
+rpConvexHullCache::rpConvexHullCache(const rpConvexHullSimplification& simplification)
+: mNbHits(0),
+  mNbMisses(0),
+  mIsSimplified(true),
+  mSimplification(simplification)
+{
+
+}
+
+// Destructor
+rpConvexHullCache::~rpConvexHullCache()
+{
+    clear();
+}
+
+// Return the hull of the vertices , computed only if it is not in the cache
+/**
+ * @param vertices The source vertices of the hull
+ * @param nbVertices Number of source vertices
+ * @return The shared hull , a shape using it takes its own reference
+ */
+rpModelConvexHull* rpConvexHullCache::getHull(const Vector3* vertices, uint nbVertices)
+{
+    assert(vertices != NULL && nbVertices > 0);
+
+    const uint64 hash = computeHash(vertices, nbVertices);
+
+    rpModelConvexHull* hull = findHull(hash, vertices, nbVertices);
+    if (hull != NULL)
+    {
+        mNbHits++;
+        return hull;
+    }
+
+    // Compute the hull of the new mesh
+    hull = new rpModelConvexHull(vertices, nbVertices);
+    if (mIsSimplified) hull->simplify(mSimplification);
+    addHull(hash, vertices, nbVertices, hull);
+    mNbMisses++;
+
+    return hull;
+}
+
+// Return the hull of the vertices , computed only if it is not in the cache
+rpModelConvexHull* rpConvexHullCache::getHull(const std::vector<Vector3>& vertices)
+{
+    return getHull(&vertices[0], uint(vertices.size()));
+}
+
+// Cook the hulls of the meshes not in the cache yet on the threads of the pool
+/**
+ * Every thread has its own QuickHull object , the shapes created later from
+ * these meshes find the hulls in the cache.
+ * @param meshes The source vertices of the hulls
+ * @param threadPool The threads computing the hulls
+ * @return Number of hulls computed
+ */
+uint rpConvexHullCache::cookHulls(const std::vector< std::vector<Vector3> >& meshes, rpThreadPool& threadPool)
+{
+    // The meshes not in the cache , once each
+    std::vector<uint64> hashes;
+    std::vector<uint> newMeshes;
+    std::multimap<uint64, uint> newMeshIndices;
+    for (uint i = 0; i < meshes.size(); i++)
+    {
+        if (meshes[i].empty()) continue;
+
+        const uint64 hash = computeHash(&meshes[i][0], uint(meshes[i].size()));
+        if (findHull(hash, &meshes[i][0], uint(meshes[i].size())) != NULL) continue;
+
+        bool isNewMesh = true;
+        typedef std::multimap<uint64, uint>::const_iterator iterator;
+        std::pair<iterator, iterator> range = newMeshIndices.equal_range(hash);
+        for (iterator it = range.first; it != range.second && isNewMesh; ++it)
+        {
+            isNewMesh = (meshes[it->second] != meshes[i]);
+        }
+        if (!isNewMesh) continue;
+
+        newMeshIndices.insert(std::make_pair(hash, i));
+        hashes.push_back(hash);
+        newMeshes.push_back(i);
+    }
+
+    // The hulls and their simplification are computed in parallel
+    quickhull::QuickHull<scalar>* quickHulls = new quickhull::QuickHull<scalar>[threadPool.getNbThreads()];
+    std::vector<rpModelConvexHull*> hulls(newMeshes.size());
+    threadPool.parallelFor(uint(newMeshes.size()), [&](uint i, uint slot)
+    {
+        hulls[i] = new rpModelConvexHull(quickHulls[slot].getConvexHull(meshes[newMeshes[i]], true, false));
+        if (mIsSimplified) hulls[i]->simplify(mSimplification);
+    });
+    delete [] quickHulls;
+
+    for (size_t i = 0; i < newMeshes.size(); i++)
+    {
+        const std::vector<Vector3>& vertices = meshes[newMeshes[i]];
+        addHull(hashes[i], &vertices[0], uint(vertices.size()), hulls[i]);
+    }
+    mNbMisses += uint(newMeshes.size());
+
+    return uint(newMeshes.size());
+}
+
+// Create a convex hull shape with the shared hull of the vertices
+/**
+ * @param vertices The source vertices of the hull
+ * @param scaling The scaling of the hull for this shape only
+ * @param margin The collision margin (in meters) around the collision shape
+ */
+rpConvexHullShape* rpConvexHullCache::createShape(const std::vector<Vector3>& vertices,
+                                                  const Vector3& scaling, scalar margin)
+{
+    rpConvexHullShape* shape = new rpConvexHullShape(getHull(vertices), margin);
+    shape->setLocalScaling(scaling);
+    return shape;
+}
+
+// Remove the references of the cache on its hulls
+/// The hulls still used by shapes stay alive until the last shape is deleted
+void rpConvexHullCache::clear()
+{
+    for (std::multimap<uint64, rpCachedHull>::iterator it = mHulls.begin(); it != mHulls.end(); ++it)
+    {
+        if (it->second.hull->release()) delete it->second.hull;
+    }
+
+    mHulls.clear();
+}
+
+// Return the cached hull of the vertices , NULL if it is not in the cache
+/// The meshes with the same hash are compared vertex by vertex
+rpModelConvexHull* rpConvexHullCache::findHull(uint64 hash, const Vector3* vertices, uint nbVertices) const
+{
+    typedef std::multimap<uint64, rpCachedHull>::const_iterator iterator;
+    std::pair<iterator, iterator> range = mHulls.equal_range(hash);
+    for (iterator it = range.first; it != range.second; ++it)
+    {
+        const std::vector<Vector3>& cachedVertices = it->second.vertices;
+        if (cachedVertices.size() != nbVertices) continue;
+
+        bool isSameMesh = true;
+        for (uint i = 0; i < nbVertices && isSameMesh; i++)
+        {
+            isSameMesh = (cachedVertices[i] == vertices[i]);
+        }
+
+        if (isSameMesh) return it->second.hull;
+    }
+
+    return NULL;
+}
+
+// Add a computed hull to the cache , the cache keeps a reference on it
+void rpConvexHullCache::addHull(uint64 hash, const Vector3* vertices, uint nbVertices, rpModelConvexHull* hull)
+{
+    rpCachedHull cachedHull;
+    cachedHull.vertices.assign(vertices, vertices + nbVertices);
+    cachedHull.hull = hull;
+    cachedHull.hull->retain();
+
+    mHulls.insert(std::make_pair(hash, cachedHull));
+}
+
+// Return the hash of the vertices
+/// FNV-1a hash of the bytes of the coordinates
+uint64 rpConvexHullCache::computeHash(const Vector3* vertices, uint nbVertices)
+{
+    uint64 hash = VERTEX_HASH_OFFSET_BASIS;
+    rpHashVertices(hash, vertices, nbVertices);
+    return hash;
+}
+
+} /* namespace real_physics */
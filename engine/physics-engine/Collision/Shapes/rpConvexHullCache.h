@@ -0,0 +1,139 @@
+/*
+ * rpConvexHullCache.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef COLLISION_SHAPES_RPCONVEXHULLCACHE_H_
+#define COLLISION_SHAPES_RPCONVEXHULLCACHE_H_
+
+// Libraries
+#include <map>
+#include <vector>
+
+#include "rpConvexHullShape.h"
+#include "../../Parallel/rpThreadPool.h"
+
+namespace real_physics
+{
+
+// Class rpConvexHullCache
+/**
+ * This class shares the convex hulls between the shapes built from the same
+ * vertices. The hulls are found with a hash of the source vertices , so the
+ * QuickHull pass and the memory of a hull are paid once per mesh and not once
+ * per body. A cache can also simplify the hulls it computes , only once per
+ * mesh too. The shared hulls are never modified , every shape has its own
+ * scaling. The cache keeps a reference on its hulls until it is cleared , a
+ * hull still used by shapes is deleted with the last of them. The hulls of
+ * the meshes of a level can be cooked together on a thread pool before the
+ * shapes are created.
+ */
+class rpConvexHullCache
+{
+
+    private :
+
+        // -------------------- Attributes -------------------- //
+
+        /// Hull of a mesh with the source vertices , to tell apart two meshes with the same hash
+        struct rpCachedHull
+        {
+            std::vector<Vector3> vertices;
+            rpModelConvexHull*   hull;
+        };
+
+        /// Hulls of the cache by hash of their source vertices
+        std::multimap<uint64, rpCachedHull> mHulls;
+
+        /// Number of hulls found in the cache
+        uint mNbHits;
+
+        /// Number of hulls computed by the cache
+        uint mNbMisses;
+
+        /// True if the computed hulls are simplified
+        bool mIsSimplified;
+
+        /// Simplification of the computed hulls
+        rpConvexHullSimplification mSimplification;
+
+        // -------------------- Methods -------------------- //
+
+        /// Private copy-constructor
+        rpConvexHullCache(const rpConvexHullCache& cache);
+
+        /// Private assignment operator
+        rpConvexHullCache& operator=(const rpConvexHullCache& cache);
+
+        /// Return the cached hull of the vertices , NULL if it is not in the cache
+        rpModelConvexHull* findHull(uint64 hash, const Vector3* vertices, uint nbVertices) const;
+
+        /// Add a computed hull to the cache
+        void addHull(uint64 hash, const Vector3* vertices, uint nbVertices, rpModelConvexHull* hull);
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        rpConvexHullCache();
+
+        /// Constructor of a cache simplifying the hulls it computes
+        explicit rpConvexHullCache(const rpConvexHullSimplification& simplification);
+
+        /// Destructor
+        ~rpConvexHullCache();
+
+        /// Return the hull of the vertices , computed only if it is not in the cache
+        rpModelConvexHull* getHull(const Vector3* vertices, uint nbVertices);
+
+        /// Return the hull of the vertices , computed only if it is not in the cache
+        rpModelConvexHull* getHull(const std::vector<Vector3>& vertices);
+
+        /// Cook the hulls of the meshes not in the cache yet on the threads of the pool
+        uint cookHulls(const std::vector< std::vector<Vector3> >& meshes, rpThreadPool& threadPool);
+
+        /// Create a convex hull shape with the shared hull of the vertices
+        rpConvexHullShape* createShape(const std::vector<Vector3>& vertices,
+                                       const Vector3& scaling = Vector3(1.0, 1.0, 1.0),
+                                       scalar margin = OBJECT_MARGIN);
+
+        /// Remove the references of the cache on its hulls
+        void clear();
+
+        /// Return the number of hulls in the cache
+        uint getNbHulls() const;
+
+        /// Return the number of hulls found in the cache
+        uint getNbHits() const;
+
+        /// Return the number of hulls computed by the cache
+        uint getNbMisses() const;
+
+        /// Return the hash of the vertices
+        static uint64 computeHash(const Vector3* vertices, uint nbVertices);
+};
+
+// Return the number of hulls in the cache
+SIMD_INLINE uint rpConvexHullCache::getNbHulls() const
+{
+    return uint(mHulls.size());
+}
+
+// Return the number of hulls found in the cache
+SIMD_INLINE uint rpConvexHullCache::getNbHits() const
+{
+    return mNbHits;
+}
+
+// Return the number of hulls computed by the cache
+SIMD_INLINE uint rpConvexHullCache::getNbMisses() const
+{
+    return mNbMisses;
+}
+
+} /* namespace real_physics */
+
+#endif /* COLLISION_SHAPES_RPCONVEXHULLCACHE_H_ */
@@ -22,6 +22,8 @@ rpConvexHullShape::rpConvexHullShape( rpModelConvexHull* initHull , scalar margi
 {
 	mNbMaxPeturberationIteration = 10;
     mEpsilonPeturberation = 0.055;
+
+    if( mInitHull != NULL ) mInitHull->retain();
 }
 
 
@@ -29,23 +31,28 @@ rpConvexHullShape::rpConvexHullShape( rpModelConvexHull* initHull , scalar margi
 rpConvexHullShape::~rpConvexHullShape()
 {
 
+    // The hull is deleted with the last shape using it
     if( mInitHull != NULL )
     {
-       delete mInitHull;
+       if( mInitHull->release() ) delete mInitHull;
        mInitHull = NULL;
     }
 
 }
 
 
+/// The hull is shared without scaling : the support point of the scaled hull in a
+/// direction is the scaled support point of the hull in the scaled direction
 Vector3 rpConvexHullShape::getLocalSupportPointWithoutMargin(const Vector3& direction , void** cachedCollisionData) const
 {
+    const Vector3 scaledDirection = direction * mScaling;
+
 	uint index = 0;
-    scalar max = (mInitHull->mConvexHull.getVertexBuffer()[0].dot(direction));
+    scalar max = (mInitHull->mConvexHull.getVertexBuffer()[0].dot(scaledDirection));
 
     for (uint i = 1; i < mInitHull->mConvexHull.getVertexBuffer().size(); i++)
 	{
-        scalar d = (mInitHull->mConvexHull.getVertexBuffer()[i].dot(direction));
+        scalar d = (mInitHull->mConvexHull.getVertexBuffer()[i].dot(scaledDirection));
 		if (d > max)
 		{
 			max = d;
@@ -53,7 +60,7 @@ Vector3 rpConvexHullShape::getLocalSupportPointWithoutMargin(const Vector3& dire
 		}
 	}
 
-    return mInitHull->mConvexHull.getVertexBuffer()[index];
+    return mInitHull->mConvexHull.getVertexBuffer()[index] * mScaling;
 }
 
 
@@ -105,6 +112,22 @@ void rpConvexHullShape::getLocalBounds(Vector3& min, Vector3& max) const
 
 void rpConvexHullShape::computeLocalInertiaTensor(Matrix3x3& tensor, scalar mass) const
 {
+    // Exact tensor of the hull about its origin , the second moment follows the scaling
+    if( mInitHull->mIsSecondMomentKnown )
+    {
+        Matrix3x3 secondMoment = mInitHull->mSecondMoment;
+        for( int i = 0; i < 3; ++i )
+        {
+            for( int j = 0; j < 3; ++j )
+            {
+                secondMoment[i][j] *= mScaling[i] * mScaling[j];
+            }
+        }
+
+        tensor = (Matrix3x3::identity() * secondMoment.getTrace() - secondMoment) * mass;
+        return;
+    }
+
 	Vector3 min;
 	Vector3 max;
 	getLocalBounds( min , max );
@@ -29,26 +29,108 @@ struct rpModelConvexHull
     //------------ Attribute -----------//
      rpConvexHull<scalar> mConvexHull;
 
+     /// Number of shapes (and caches) sharing the hull , the last one deletes it
+     uint mNbReferences;
+
+     /// Second moment of the volume of the hull about its origin divided by the
+     /// volume , the inertia tensor of a unit mass is trace(C) * I - C
+     Matrix3x3 mSecondMoment;
+
+     /// True if the mass properties of the hull are known (hulls of the scene files)
+     bool mIsSecondMomentKnown;
+
  public:
 
     rpModelConvexHull( const Vector3 *axVertices , uint NbCount )
+    : mNbReferences(0),
+      mIsSecondMomentKnown(false)
     {
         mConvexHull = QuickHullAlgorithm.getConvexHull( axVertices , NbCount , true, false);
     }
 
 
     rpModelConvexHull( std::vector<Vector3> Vertices )
+    : mNbReferences(0),
+      mIsSecondMomentKnown(false)
     {
         mConvexHull = QuickHullAlgorithm.getConvexHull( Vertices , true, false);
     }
 
 
+    /// Hull cooked beforehand (by a rpQuickHullBatch or on the threads of rpConvexHullCache::cookHulls)
+    explicit rpModelConvexHull( rpConvexHull<scalar>&& ConvexHull )
+    : mConvexHull( std::move(ConvexHull) ),
+      mNbReferences(0),
+      mIsSecondMomentKnown(false)
+    {
+    }
+
+
+    /// Prebuilt hull (no QuickHull pass), the vertices are referenced and must outlive the model
+    rpModelConvexHull( const Vector3 *axVertices , uint NbVertices , const uint32 *axIndices , uint NbIndices )
+    : mConvexHull( axVertices , NbVertices , axIndices , NbIndices ),
+      mNbReferences(0),
+      mIsSecondMomentKnown(false)
+    {
+    }
+
+
     ~rpModelConvexHull()
     {
         mConvexHull.getIndexBuffer().clear();
     }
 
 
+    /// Simplify the hull (fewer vertices for the support queries) , the hull
+    /// must not be used by any shape yet
+    rpConvexHullSimplificationReport simplify( const rpConvexHullSimplification& simplification )
+    {
+        assert(mNbReferences == 0);
+
+        rpConvexHullSimplifier simplifier;
+        rpConvexHullSimplificationReport report;
+        mConvexHull = simplifier.simplify( mConvexHull , simplification , &report );
+        mIsSecondMomentKnown = false;
+        return report;
+    }
+
+
+    /// Set the mass properties of the hull for a unit density : its volume , its centre
+    /// of mass and its inertia tensor relative to the centre of mass
+    void setMassProperties( scalar volume , const Vector3& centerOfMass , const Matrix3x3& inertiaTensor )
+    {
+        if( volume <= MACHINE_EPSILON ) return;
+
+        // Covariance about the centre of mass , moved to the origin of the hull
+        Matrix3x3 secondMoment = Matrix3x3::identity() * (scalar(0.5) * inertiaTensor.getTrace()) - inertiaTensor;
+        for( int i = 0; i < 3; ++i )
+        {
+            for( int j = 0; j < 3; ++j )
+            {
+                secondMoment[i][j] += volume * centerOfMass[i] * centerOfMass[j];
+            }
+        }
+
+        mSecondMoment = secondMoment * (scalar(1.0) / volume);
+        mIsSecondMomentKnown = true;
+    }
+
+
+    /// Add a user of the hull
+    void retain()
+    {
+        mNbReferences++;
+    }
+
+    /// Remove a user of the hull , return true if it was the last one
+    /// (the caller deletes the hull then)
+    bool release()
+    {
+        assert(mNbReferences > 0);
+        return (--mNbReferences == 0);
+    }
+
+
 };
 
 
@@ -63,6 +145,8 @@ private:
 
 
     //-------------------- Attributes --------------------//
+
+    /// Hull of the shape , it can be shared by several shapes with their own scaling
     rpModelConvexHull*    mInitHull;
 
 
@@ -117,6 +201,13 @@ public:
     virtual void computeLocalInertiaTensor(Matrix3x3& tensor, scalar mass) const;
 
 
+    /// Return the model of the convex hull
+    rpModelConvexHull* getModelHull() const
+    {
+        return mInitHull;
+    }
+
+
 };
 
 } /* namespace real_physics */
@@ -0,0 +1,132 @@
+/*
+ * rpCylinderShape.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+// Libraries
+#include "rpCylinderShape.h"
+
+#include <cassert>
+
+#include "../rpProxyShape.h"
+
+namespace real_physics
+{
+
+#define MAX_PETURBERATION_ITERATIONS	    8
+#define EPS_PETURBERATION_ANGLES_COFFICIENT	0.08
+
+// Constructor
+/**
+ * @param radius Radius of the cylinder (in meters)
+ * @param height Height of the cylinder (in meters)
+ * @param margin The collision margin (in meters) around the collision shape
+ */
+rpCylinderShape::rpCylinderShape(scalar radius, scalar height, scalar margin)
+: rpConvexShape(CYLINDER, margin),
+  mRadius(radius),
+  mHalfHeight(height * scalar(0.5))
+{
+    assert(radius > margin);
+    assert(height * scalar(0.5) > margin);
+
+    // The rim of a cap lying on a face gives several contacts
+    mNbMaxPeturberationIteration = MAX_PETURBERATION_ITERATIONS; // maximum iteration  for Axis Peturberation
+    mEpsilonPeturberation = EPS_PETURBERATION_ANGLES_COFFICIENT;// epsilon for Peturberation
+}
+
+// Destructor
+rpCylinderShape::~rpCylinderShape()
+{
+
+}
+
+// Return the local inertia tensor of the cylinder
+/**
+ * @param[out] tensor The 3x3 inertia tensor matrix of the shape in local-space
+ *                    coordinates
+ * @param mass Mass to use to compute the inertia tensor of the collision shape
+ */
+void rpCylinderShape::computeLocalInertiaTensor(Matrix3x3& tensor, scalar mass) const
+{
+    const scalar radiusSquare = mRadius * mRadius;
+    const scalar height = mHalfHeight + mHalfHeight;
+
+    const scalar diagY  = scalar(0.5) * mass * radiusSquare;
+    const scalar diagXZ = mass * (scalar(3.0) * radiusSquare + height * height) / scalar(12.0);
+
+    tensor.setAllValues(diagXZ, 0.0, 0.0,
+                        0.0, diagY, 0.0,
+                        0.0, 0.0, diagXZ);
+}
+
+// Raycast method with feedback information
+/// The ray enters the cylinder when it is both between the planes of the caps
+/// and inside the infinite cylinder of the side
+bool rpCylinderShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, rpProxyShape* proxyShape) const
+{
+    const Vector3 rayDirection = ray.point2 - ray.point1;
+
+    // Interval of the ray between the planes of the two caps
+    scalar tCapMin = DECIMAL_SMALLEST;
+    scalar tCapMax = DECIMAL_LARGEST;
+    if (Abs(rayDirection.y) < MACHINE_EPSILON)
+    {
+        if (Abs(ray.point1.y) > mHalfHeight) return false;
+    }
+    else
+    {
+        scalar t1 = (-mHalfHeight - ray.point1.y) / rayDirection.y;
+        scalar t2 = ( mHalfHeight - ray.point1.y) / rayDirection.y;
+        if (t1 > t2) Swap(t1, t2);
+        tCapMin = t1;
+        tCapMax = t2;
+    }
+
+    // Interval of the ray inside the infinite cylinder of the side
+    scalar tSideMin = DECIMAL_SMALLEST;
+    scalar tSideMax = DECIMAL_LARGEST;
+    const scalar a = rayDirection.x * rayDirection.x + rayDirection.z * rayDirection.z;
+    const scalar b = ray.point1.x * rayDirection.x + ray.point1.z * rayDirection.z;
+    const scalar c = ray.point1.x * ray.point1.x + ray.point1.z * ray.point1.z - mRadius * mRadius;
+    if (a < MACHINE_EPSILON)
+    {
+        if (c > scalar(0.0)) return false;
+    }
+    else
+    {
+        const scalar discriminant = b * b - a * c;
+        if (discriminant < scalar(0.0)) return false;
+
+        const scalar root = SquareRoot(discriminant);
+        tSideMin = (-b - root) / a;
+        tSideMax = (-b + root) / a;
+    }
+
+    const scalar tMin = Max(tCapMin, tSideMin);
+    const scalar tMax = Min(tCapMax, tSideMax);
+
+    // If the intervals do not overlap , if the origin of the ray is inside the
+    // cylinder or if the hit is beyond the ray fraction , there is no hit
+    if (tMin > tMax || tMin < scalar(0.0) || tMin > ray.maxFraction) return false;
+
+    const Vector3 localHitPoint = ray.point1 + tMin * rayDirection;
+
+    raycastInfo.body = proxyShape->getBody();
+    raycastInfo.proxyShape = proxyShape;
+    raycastInfo.hitFraction = tMin;
+    raycastInfo.worldPoint = localHitPoint;
+    raycastInfo.worldNormal = (tCapMin >= tSideMin) ? Vector3(0.0, rayDirection.y > scalar(0.0) ? -1.0 : 1.0, 0.0) :
+                                                      Vector3(localHitPoint.x, 0.0, localHitPoint.z);
+
+    return true;
+}
+
+
+#undef MAX_PETURBERATION_ITERATIONS
+#undef EPS_PETURBERATION_ANGLES_COFFICIENT
+
+
+} /* namespace real_physics */
@@ -0,0 +1,158 @@
+/*
+ * rpCylinderShape.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef COLLISION_SHAPES_RPCYLINDERSHAPE_H_
+#define COLLISION_SHAPES_RPCYLINDERSHAPE_H_
+
+#include "rpConvexShape.h"
+
+namespace real_physics
+{
+
+// Class CylinderShape
+/**
+ * This class represents a cylinder collision shape that is centered at the
+ * origin and aligned with the local y axis (a wheel for instance). The shape
+ * uses an object margin for the collision detection : the support function
+ * works on the cylinder reduced by the margin , so the rounded cylinder with
+ * the margin has the radius and the height given to the constructor.
+ */
+class rpCylinderShape : public rpConvexShape
+{
+
+    protected :
+
+        // -------------------- Attributes -------------------- //
+
+        /// Radius of the cylinder
+        scalar mRadius;
+
+        /// Half height of the cylinder
+        scalar mHalfHeight;
+
+        // -------------------- Methods -------------------- //
+
+        /// Private copy-constructor
+        rpCylinderShape(const rpCylinderShape& shape);
+
+        /// Private assignment operator
+        rpCylinderShape& operator=(const rpCylinderShape& shape);
+
+        /// Return a local support point in a given direction without the object margin
+        virtual Vector3 getLocalSupportPointWithoutMargin(const Vector3& direction,
+                                                          void** cachedCollisionData) const;
+
+        /// Return true if a point is inside the collision shape
+        virtual bool testPointInside(const Vector3& localPoint, rpProxyShape* proxyShape) const;
+
+        /// Raycast method with feedback information
+        virtual bool raycast(const Ray& ray, RaycastInfo& raycastInfo, rpProxyShape* proxyShape) const;
+
+        /// Return the number of bytes used by the collision shape
+        virtual size_t getSizeInBytes() const;
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        rpCylinderShape(scalar radius, scalar height, scalar margin = OBJECT_MARGIN);
+
+        /// Destructor
+        virtual ~rpCylinderShape();
+
+        /// Return the radius of the cylinder
+        scalar getRadius() const;
+
+        /// Return the height of the cylinder
+        scalar getHeight() const;
+
+        /// Set the scaling vector of the collision shape
+        virtual void setLocalScaling(const Vector3& scaling);
+
+        /// Return the local bounds of the shape in x, y and z directions.
+        virtual void getLocalBounds(Vector3& min, Vector3& max) const;
+
+        /// Return the local inertia tensor of the collision shape
+        virtual void computeLocalInertiaTensor(Matrix3x3& tensor, scalar mass) const;
+};
+
+// Return the radius of the cylinder
+/**
+ * @return Radius of the cylinder (in meters)
+ */
+SIMD_INLINE scalar rpCylinderShape::getRadius() const
+{
+    return mRadius;
+}
+
+// Return the height of the cylinder
+/**
+ * @return Height of the cylinder (in meters)
+ */
+SIMD_INLINE scalar rpCylinderShape::getHeight() const
+{
+    return mHalfHeight + mHalfHeight;
+}
+
+// Set the scaling vector of the collision shape
+/// The radius follows the x scaling and the height the y scaling
+SIMD_INLINE void rpCylinderShape::setLocalScaling(const Vector3& scaling)
+{
+    mRadius     = (mRadius / mScaling.x) * scaling.x;
+    mHalfHeight = (mHalfHeight / mScaling.y) * scaling.y;
+    rpCollisionShape::setLocalScaling(scaling);
+}
+
+// Return the number of bytes used by the collision shape
+SIMD_INLINE size_t rpCylinderShape::getSizeInBytes() const
+{
+    return sizeof(rpCylinderShape);
+}
+
+// Return a local support point in a given direction without the object margin
+/// The point is on the rim of the cap facing the direction
+SIMD_INLINE Vector3 rpCylinderShape::getLocalSupportPointWithoutMargin(const Vector3& direction,
+                                                                       void** /*cachedCollisionData*/) const
+{
+    const scalar radius = mRadius - mMargin;
+    const scalar halfHeight = mHalfHeight - mMargin;
+
+    Vector3 supportPoint(0.0, direction.y < scalar(0.0) ? -halfHeight : halfHeight, 0.0);
+
+    const scalar lengthXZ = SquareRoot(direction.x * direction.x + direction.z * direction.z);
+    if (lengthXZ > MACHINE_EPSILON)
+    {
+        const scalar factor = radius / lengthXZ;
+        supportPoint.x = direction.x * factor;
+        supportPoint.z = direction.z * factor;
+    }
+
+    return supportPoint;
+}
+
+// Return the local bounds of the shape in x, y and z directions.
+/**
+ * @param min The minimum bounds of the shape in local-space coordinates
+ * @param max The maximum bounds of the shape in local-space coordinates
+ */
+SIMD_INLINE void rpCylinderShape::getLocalBounds(Vector3& min, Vector3& max) const
+{
+    max = Vector3(mRadius, mHalfHeight, mRadius);
+    min = -max;
+}
+
+// Return true if a point is inside the collision shape
+SIMD_INLINE bool rpCylinderShape::testPointInside(const Vector3& localPoint, rpProxyShape* /*proxyShape*/) const
+{
+    return (Abs(localPoint.y) < mHalfHeight &&
+            localPoint.x * localPoint.x + localPoint.z * localPoint.z < mRadius * mRadius);
+}
+
+} /* namespace real_physics */
+
+#endif /* COLLISION_SHAPES_RPCYLINDERSHAPE_H_ */
@@ -0,0 +1,260 @@
+/*
+ * rpHeightFieldShape.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#include "rpHeightFieldShape.h"
+#include "../rpProxyShape.h"
+
+#include <cmath>
+
+namespace real_physics
+{
+
+
+  // Constructor
+  /**
+   * @param nbGridColumns Number of columns of the grid (along the x axis)
+   * @param nbGridRows Number of rows of the grid (along the z axis)
+   * @param minHeight Minimum height of the field
+   * @param maxHeight Maximum height of the field
+   * @param heightFieldData Heights of the grid , row after row (float or short values)
+   * @param dataType Type of the height values
+   * @param integerHeightScale Scale applied to the short height values
+   */
+  rpHeightFieldShape::rpHeightFieldShape(int nbGridColumns, int nbGridRows, scalar minHeight, scalar maxHeight,
+                                         const void* heightFieldData, HeightDataType dataType,
+                                         scalar integerHeightScale)
+   : rpConcaveShape(HEIGHTFIELD),
+     mNbColumns(nbGridColumns),
+     mNbRows(nbGridRows),
+     mMinHeight(minHeight),
+     mMaxHeight(maxHeight),
+     mHeightDataType(dataType),
+     mIntegerHeightScale(integerHeightScale)
+  {
+      assert(nbGridColumns >= 2);
+      assert(nbGridRows >= 2);
+      assert(minHeight <= maxHeight);
+
+      const size_t nbSamples = size_t(nbGridColumns) * size_t(nbGridRows);
+      if (dataType == HEIGHT_FLOAT_TYPE)
+      {
+          const float* heights = static_cast<const float*>(heightFieldData);
+          mFloatHeights.assign(heights, heights + nbSamples);
+      }
+      else
+      {
+          const int16* heights = static_cast<const int16*>(heightFieldData);
+          mShortHeights.assign(heights, heights + nbSamples);
+      }
+  }
+
+  // Destructor
+  rpHeightFieldShape::~rpHeightFieldShape()
+  {
+
+  }
+
+  // Return the local bounds of the shape in x, y and z directions.
+  /**
+   * @param min The minimum bounds of the shape in local-space coordinates
+   * @param max The maximum bounds of the shape in local-space coordinates
+   */
+  void rpHeightFieldShape::getLocalBounds(Vector3& min, Vector3& max) const
+  {
+      max = Vector3(scalar(mNbColumns - 1) * scalar(0.5),
+                    (mMaxHeight - mMinHeight) * scalar(0.5),
+                    scalar(mNbRows - 1) * scalar(0.5)) * mScaling;
+      min = -max;
+  }
+
+  // Return the index of the triangles overlapping with an AABB in the local-space of the shape
+  /// Only the cells under the AABB are visited and their triangles are skipped
+  /// when their range of heights does not reach the AABB
+  /**
+   * @param localAABB AABB in the scaled local-space of the shape
+   * @param[out] triangles Index of the triangles whose AABB overlaps with the AABB
+   */
+  void rpHeightFieldShape::getTrianglesOverlappingWithAABB(const rpAABB& localAABB,
+                                                           std::vector<uint>& triangles) const
+  {
+      // The AABB in the unscaled space of the grid , enlarged by the margin of the triangles
+      const Vector3 aabbMin = localAABB.getMin();
+      const Vector3 aabbMax = localAABB.getMax();
+
+      const scalar minX = (aabbMin.x - OBJECT_MARGIN) / mScaling.x + scalar(mNbColumns - 1) * scalar(0.5);
+      const scalar maxX = (aabbMax.x + OBJECT_MARGIN) / mScaling.x + scalar(mNbColumns - 1) * scalar(0.5);
+      const scalar minZ = (aabbMin.z - OBJECT_MARGIN) / mScaling.z + scalar(mNbRows - 1) * scalar(0.5);
+      const scalar maxZ = (aabbMax.z + OBJECT_MARGIN) / mScaling.z + scalar(mNbRows - 1) * scalar(0.5);
+      const scalar minY = (aabbMin.y - OBJECT_MARGIN) / mScaling.y;
+      const scalar maxY = (aabbMax.y + OBJECT_MARGIN) / mScaling.y;
+
+      if (maxX < scalar(0.0) || maxZ < scalar(0.0)) return;
+
+      const int minColumn = Max(0, int(std::floor(minX)));
+      const int maxColumn = Min(mNbColumns - 2, int(std::floor(maxX)));
+      const int minRow    = Max(0, int(std::floor(minZ)));
+      const int maxRow    = Min(mNbRows - 2, int(std::floor(maxZ)));
+
+      for (int row = minRow; row <= maxRow; row++)
+      {
+          for (int column = minColumn; column <= maxColumn; column++)
+          {
+              const scalar height00 = getVertexAt(column    , row    ).y;
+              const scalar height10 = getVertexAt(column + 1, row    ).y;
+              const scalar height01 = getVertexAt(column    , row + 1).y;
+              const scalar height11 = getVertexAt(column + 1, row + 1).y;
+
+              const uint triangleIndex = 2 * (row * (mNbColumns - 1) + column);
+
+              if (max3(height00, height01, height10) >= minY &&
+                  min3(height00, height01, height10) <= maxY)
+              {
+                  triangles.push_back(triangleIndex);
+              }
+
+              if (max3(height10, height01, height11) >= minY &&
+                  min3(height10, height01, height11) <= maxY)
+              {
+                  triangles.push_back(triangleIndex + 1);
+              }
+          }
+      }
+  }
+
+  // Test the two triangles of a cell against a ray and keep the closest hit
+  bool rpHeightFieldShape::raycastCell(int column, int row, const Ray& ray, RaycastInfo& raycastInfo,
+                                       rpProxyShape* proxyShape) const
+  {
+      bool isHit = false;
+      scalar closestFraction = ray.maxFraction;
+
+      const uint firstTriangle = 2 * (row * (mNbColumns - 1) + column);
+      for (uint triangleIndex = firstTriangle; triangleIndex < firstTriangle + 2; triangleIndex++)
+      {
+          Vector3 trianglePoints[3];
+          getTriangleVertices(triangleIndex, trianglePoints);
+
+          rpTriangleShape triangleShape(trianglePoints[0], trianglePoints[1], trianglePoints[2]);
+          triangleShape.setRaycastTestType(mRaycastTestType);
+
+          RaycastInfo triangleRaycastInfo;
+          if (!triangleShape.raycast(ray, triangleRaycastInfo, proxyShape)) continue;
+          if (triangleRaycastInfo.hitFraction > closestFraction) continue;
+
+          closestFraction = triangleRaycastInfo.hitFraction;
+
+          raycastInfo.body          = triangleRaycastInfo.body;
+          raycastInfo.proxyShape    = triangleRaycastInfo.proxyShape;
+          raycastInfo.worldPoint    = triangleRaycastInfo.worldPoint;
+          raycastInfo.worldNormal   = triangleRaycastInfo.worldNormal;
+          raycastInfo.hitFraction   = triangleRaycastInfo.hitFraction;
+          raycastInfo.meshSubpart   = 0;
+          raycastInfo.triangleIndex = triangleIndex;
+          isHit = true;
+      }
+
+      return isHit;
+  }
+
+  // Raycast method with feedback information
+  /// The ray is in the local-space of the shape. It is clipped to the bounds of the
+  /// field and walks the cells of the grid from the first point (DDA) , so the first
+  /// cell with a hit gives the closest one.
+  bool rpHeightFieldShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, rpProxyShape* proxyShape) const
+  {
+      // The ray in the unscaled space of the grid (the cells are unit squares from the origin)
+      const Vector3 gridOffset(scalar(mNbColumns - 1) * scalar(0.5), scalar(0.0), scalar(mNbRows - 1) * scalar(0.5));
+      const Vector3 start = Vector3(ray.point1.x / mScaling.x, ray.point1.y / mScaling.y, ray.point1.z / mScaling.z) + gridOffset;
+      const Vector3 end   = Vector3(ray.point2.x / mScaling.x, ray.point2.y / mScaling.y, ray.point2.z / mScaling.z) + gridOffset;
+      const Vector3 direction = end - start;
+
+      // Clip the segment of the ray to the bounds of the field
+      const scalar halfHeight = (mMaxHeight - mMinHeight) * scalar(0.5);
+      const Vector3 boundsMin(scalar(0.0), -halfHeight, scalar(0.0));
+      const Vector3 boundsMax(scalar(mNbColumns - 1), halfHeight, scalar(mNbRows - 1));
+
+      scalar tMin = scalar(0.0);
+      scalar tMax = ray.maxFraction;
+      for (int axis = 0; axis < 3; axis++)
+      {
+          if (Abs(direction[axis]) < MACHINE_EPSILON)
+          {
+              if (start[axis] < boundsMin[axis] - OBJECT_MARGIN ||
+                  start[axis] > boundsMax[axis] + OBJECT_MARGIN) return false;
+          }
+          else
+          {
+              const scalar inverse = scalar(1.0) / direction[axis];
+              scalar t1 = (boundsMin[axis] - OBJECT_MARGIN - start[axis]) * inverse;
+              scalar t2 = (boundsMax[axis] + OBJECT_MARGIN - start[axis]) * inverse;
+              if (t1 > t2) Swap(t1, t2);
+              tMin = Max(tMin, t1);
+              tMax = Min(tMax, t2);
+              if (tMin > tMax) return false;
+          }
+      }
+
+      // The first cell of the walk
+      const Vector3 entry = start + direction * tMin;
+      int column = Min(mNbColumns - 2, Max(0, int(std::floor(entry.x))));
+      int row    = Min(mNbRows - 2,    Max(0, int(std::floor(entry.z))));
+
+      const int stepColumn = (direction.x > scalar(0.0)) ? 1 : -1;
+      const int stepRow    = (direction.z > scalar(0.0)) ? 1 : -1;
+
+      // Ray parameters of the next column and row boundaries and between two boundaries
+      const scalar infinity = DECIMAL_LARGEST;
+      const scalar tDeltaColumn = (Abs(direction.x) < MACHINE_EPSILON) ? infinity : Abs(scalar(1.0) / direction.x);
+      const scalar tDeltaRow    = (Abs(direction.z) < MACHINE_EPSILON) ? infinity : Abs(scalar(1.0) / direction.z);
+      scalar tNextColumn = (Abs(direction.x) < MACHINE_EPSILON) ? infinity :
+                           (scalar(column + (stepColumn > 0 ? 1 : 0)) - start.x) / direction.x;
+      scalar tNextRow    = (Abs(direction.z) < MACHINE_EPSILON) ? infinity :
+                           (scalar(row + (stepRow > 0 ? 1 : 0)) - start.z) / direction.z;
+
+      scalar tCell = tMin;
+      while (true)
+      {
+          const scalar tCellExit = Min(tMax, Min(tNextColumn, tNextRow));
+
+          // Skip the cell if the ray passes above or below its heights
+          const scalar rayHeight1 = start.y + direction.y * tCell;
+          const scalar rayHeight2 = start.y + direction.y * tCellExit;
+          const scalar height00 = getVertexAt(column    , row    ).y;
+          const scalar height10 = getVertexAt(column + 1, row    ).y;
+          const scalar height01 = getVertexAt(column    , row + 1).y;
+          const scalar height11 = getVertexAt(column + 1, row + 1).y;
+          const scalar cellMin = Min(Min(height00, height10), Min(height01, height11));
+          const scalar cellMax = Max(Max(height00, height10), Max(height01, height11));
+
+          if (Max(rayHeight1, rayHeight2) >= cellMin - OBJECT_MARGIN &&
+              Min(rayHeight1, rayHeight2) <= cellMax + OBJECT_MARGIN)
+          {
+              if (raycastCell(column, row, ray, raycastInfo, proxyShape)) return true;
+          }
+
+          if (tCellExit >= tMax) return false;
+
+          // Go to the next cell crossed by the ray
+          if (tNextColumn < tNextRow)
+          {
+              column += stepColumn;
+              tCell = tNextColumn;
+              tNextColumn += tDeltaColumn;
+          }
+          else
+          {
+              row += stepRow;
+              tCell = tNextRow;
+              tNextRow += tDeltaRow;
+          }
+
+          if (column < 0 || column > mNbColumns - 2 || row < 0 || row > mNbRows - 2) return false;
+      }
+  }
+
+
+} /* namespace real_physics */
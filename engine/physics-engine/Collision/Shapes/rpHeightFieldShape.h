@@ -0,0 +1,182 @@
+/*
+ * rpHeightFieldShape.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef COLLISION_SHAPES_RPHEIGHTFIELDSHAPE_H_
+#define COLLISION_SHAPES_RPHEIGHTFIELDSHAPE_H_
+
+#include "rpConcaveShape.h"
+#include <vector>
+
+namespace real_physics
+{
+
+  /// Type of the height values of a height field
+  enum HeightDataType { HEIGHT_FLOAT_TYPE , HEIGHT_SHORT_TYPE };
+
+  // Class HeightFieldShape
+  /**
+   * This class represents a static terrain given by a regular grid of heights.
+   * The grid lies in the x-z plane of the shape with the heights along the y axis
+   * and it is centered at the origin of the shape. Only the heights are stored
+   * (2 bytes per sample for the short type , 4 bytes for the float type) : the
+   * two triangles of a cell are generated on the fly when the midphase asks for
+   * the triangles under an AABB , and the rays walk the cells of the grid (DDA)
+   * instead of a tree.
+   */
+  class rpHeightFieldShape : public rpConcaveShape
+  {
+
+      protected :
+
+          // -------------------- Attributes -------------------- //
+
+          /// Number of columns of the grid (along the x axis)
+          int mNbColumns;
+
+          /// Number of rows of the grid (along the z axis)
+          int mNbRows;
+
+          /// Minimum height of the field
+          scalar mMinHeight;
+
+          /// Maximum height of the field
+          scalar mMaxHeight;
+
+          /// Type of the height values
+          HeightDataType mHeightDataType;
+
+          /// Scale applied to the short height values
+          scalar mIntegerHeightScale;
+
+          /// Heights of the grid for the float type (row after row)
+          std::vector<float> mFloatHeights;
+
+          /// Heights of the grid for the short type (row after row)
+          std::vector<int16> mShortHeights;
+
+          // -------------------- Methods -------------------- //
+
+          /// Private copy-constructor
+          rpHeightFieldShape(const rpHeightFieldShape& shape);
+
+          /// Private assignment operator
+          rpHeightFieldShape& operator=(const rpHeightFieldShape& shape);
+
+          /// Return the unscaled local position of a vertex of the grid
+          Vector3 getVertexAt(int column, int row) const;
+
+          /// Test the two triangles of a cell against a ray and keep the closest hit
+          bool raycastCell(int column, int row, const Ray& ray, RaycastInfo& raycastInfo,
+                           rpProxyShape* proxyShape) const;
+
+          /// Raycast method with feedback information
+          virtual bool raycast(const Ray& ray, RaycastInfo& raycastInfo, rpProxyShape* proxyShape) const;
+
+          /// Return the number of bytes used by the collision shape
+          virtual size_t getSizeInBytes() const;
+
+      public :
+
+          // -------------------- Methods -------------------- //
+
+          /// Constructor
+          rpHeightFieldShape(int nbGridColumns, int nbGridRows, scalar minHeight, scalar maxHeight,
+                             const void* heightFieldData, HeightDataType dataType,
+                             scalar integerHeightScale = scalar(1.0));
+
+          /// Destructor
+          virtual ~rpHeightFieldShape();
+
+          /// Return the number of columns of the grid
+          int getNbColumns() const;
+
+          /// Return the number of rows of the grid
+          int getNbRows() const;
+
+          /// Return the height of a vertex of the grid
+          scalar getHeightAt(int column, int row) const;
+
+          /// Return the local bounds of the shape in x, y and z directions.
+          virtual void getLocalBounds(Vector3& min, Vector3& max) const;
+
+          /// Return the index of the triangles overlapping with an AABB in the local-space of the shape
+          virtual void getTrianglesOverlappingWithAABB(const rpAABB& localAABB,
+                                                       std::vector<uint>& triangles) const;
+
+          /// Return the three vertices of a triangle in the local-space of the shape
+          virtual void getTriangleVertices(uint triangleIndex, Vector3* outTriangleVertices) const;
+  };
+
+
+  // Return the number of bytes used by the collision shape
+  SIMD_INLINE size_t rpHeightFieldShape::getSizeInBytes() const
+  {
+      return sizeof(rpHeightFieldShape);
+  }
+
+  // Return the number of columns of the grid
+  SIMD_INLINE int rpHeightFieldShape::getNbColumns() const
+  {
+      return mNbColumns;
+  }
+
+  // Return the number of rows of the grid
+  SIMD_INLINE int rpHeightFieldShape::getNbRows() const
+  {
+      return mNbRows;
+  }
+
+  // Return the height of a vertex of the grid
+  SIMD_INLINE scalar rpHeightFieldShape::getHeightAt(int column, int row) const
+  {
+      assert(column >= 0 && column < mNbColumns);
+      assert(row >= 0 && row < mNbRows);
+
+      const int index = row * mNbColumns + column;
+      return (mHeightDataType == HEIGHT_FLOAT_TYPE) ? scalar(mFloatHeights[index]) :
+                                                       scalar(mShortHeights[index]) * mIntegerHeightScale;
+  }
+
+  // Return the unscaled local position of a vertex of the grid
+  /// The grid and the range of heights are centered at the origin of the shape
+  SIMD_INLINE Vector3 rpHeightFieldShape::getVertexAt(int column, int row) const
+  {
+      return Vector3(column - scalar(mNbColumns - 1) * scalar(0.5),
+                     getHeightAt(column, row) - (mMinHeight + mMaxHeight) * scalar(0.5),
+                     row - scalar(mNbRows - 1) * scalar(0.5));
+  }
+
+  // Return the three vertices of a triangle in the local-space of the shape
+  /// The cell (i , j) contains the triangles 2*(j*(columns-1)+i) and 2*(j*(columns-1)+i)+1
+  /**
+   * @param triangleIndex Index of the triangle in the grid
+   * @param[out] outTriangleVertices Array of three vertices with the local scaling
+   */
+  SIMD_INLINE void rpHeightFieldShape::getTriangleVertices(uint triangleIndex, Vector3* outTriangleVertices) const
+  {
+      const int cell   = triangleIndex / 2;
+      const int column = cell % (mNbColumns - 1);
+      const int row    = cell / (mNbColumns - 1);
+      assert(row < mNbRows - 1);
+
+      if ((triangleIndex & 1) == 0)
+      {
+          outTriangleVertices[0] = getVertexAt(column    , row    ) * mScaling;
+          outTriangleVertices[1] = getVertexAt(column    , row + 1) * mScaling;
+          outTriangleVertices[2] = getVertexAt(column + 1, row    ) * mScaling;
+      }
+      else
+      {
+          outTriangleVertices[0] = getVertexAt(column + 1, row    ) * mScaling;
+          outTriangleVertices[1] = getVertexAt(column    , row + 1) * mScaling;
+          outTriangleVertices[2] = getVertexAt(column + 1, row + 1) * mScaling;
+      }
+  }
+
+} /* namespace real_physics */
+
+#endif /* COLLISION_SHAPES_RPHEIGHTFIELDSHAPE_H_ */
@@ -133,6 +133,7 @@ namespace real_physics
 
           friend class ConcaveMeshRaycastCallback;
           friend class TriangleOverlapCallback;
+          friend class rpHeightFieldShape;
   };
 
   // Return the number of bytes used by the collision shape
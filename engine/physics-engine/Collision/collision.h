@@ -15,7 +15,14 @@
 #include  "Shapes/rpTriangleShape.h"
 #include  "Shapes/rpBoxShape.h"
 #include  "Shapes/rpSphereShape.h"
+#include  "Shapes/rpCapsuleShape.h"
+#include  "Shapes/rpCylinderShape.h"
+#include  "Shapes/rpConeShape.h"
 #include  "Shapes/rpConvexHullShape.h"
+#include  "Shapes/rpConvexHullCache.h"
+#include  "Shapes/rpConcaveShape.h"
+#include  "Shapes/rpConcaveMeshShape.h"
+#include  "Shapes/rpHeightFieldShape.h"
 #include  "rpProxyShape.h"
 #include  "rpRaycastInfo.h"
 
@@ -19,8 +19,10 @@
 #include "../LinearMaths/rpVector3D.h"
 #include "NarrowPhase/rpNarrowPhaseGjkEpaAlgorithm.h"
 #include "NarrowPhase/rpNarrowPhaseMprAlgorithm.h"
+#include "NarrowPhase/rpNarrowPhaseCapsuleAlgorithm.h"
 #include "NarrowPhase/GJK/rpGJKAlgorithm.h"
 #include "rpCollisionShapeInfo.h"
+#include "Shapes/rpConcaveShape.h"
 #include "rpProxyShape.h"
 #include "rpRaycastInfo.h"
 
@@ -38,7 +40,11 @@ namespace real_physics
 
 
 rpCollisionManager::rpCollisionManager()
-: mBroadPhaseAlgorithm(this)
+: mBroadPhaseAlgorithm(this),
+  mIsTemporalCoherenceEnabled(true),
+  mTemporalCoherenceLinearTolerance(DEFAULT_TEMPORAL_COHERENCE_LINEAR_TOLERANCE),
+  mTemporalCoherenceAngularTolerance(DEFAULT_TEMPORAL_COHERENCE_ANGULAR_TOLERANCE),
+  mNbTemporalCoherencePairs(0)
 {
 
 }
@@ -67,6 +73,113 @@ void rpCollisionManager::computeBroadPhase()
          mBroadPhaseAlgorithm.computeOverlappingPairs();
     }
 
+    // Pair the shapes of the compound bodies that overlap in the broad-phase
+    computeCompoundMidPhase();
+}
+
+
+
+// Compute the overlapping pairs of shapes of the compound bodies overlapping in the broad-phase
+/// The pairs of the compound bodies are kept as long as the bodies overlap in the
+/// broad-phase , and their local AABB trees are queried at each step since the
+/// shapes of a body can start to overlap without any change in the broad-phase
+void rpCollisionManager::computeCompoundMidPhase()
+{
+    for (auto it = mCompoundOverlappingPairs.begin(); it != mCompoundOverlappingPairs.end(); )
+    {
+        rpProxyShape* shape1 = it->second.first;
+        rpProxyShape* shape2 = it->second.second;
+
+        rpCollisionBody* const body1 = shape1->getBody();
+        rpCollisionBody* const body2 = shape2->getBody();
+
+        // The shapes of the sleeping and static bodies have not moved
+        bool isBody1Active = !body1->isSleeping() && body1->getType() != STATIC;
+        bool isBody2Active = !body2->isSleeping() && body2->getType() != STATIC;
+        if (!isBody1Active && !isBody2Active)
+        {
+            ++it;
+            continue;
+        }
+
+        // Destroy the pair of the bodies that are not overlapping anymore
+        if (!mBroadPhaseAlgorithm.testOverlappingShapes(shape1, shape2))
+        {
+            std::map<overlappingpairid, std::pair<rpProxyShape*, rpProxyShape*> >::iterator itToRemove = it;
+            ++it;
+            mCompoundOverlappingPairs.erase(itToRemove);
+            continue;
+        }
+        ++it;
+
+        // Check if the bodies are in the set of bodies that cannot collide between each other
+        bodyindexpair bodiesIndex = rpOverlappingPair::computeBodiesIndexPair(body1, body2);
+        if (mNoCollisionPairs.count(bodiesIndex) > 0) continue;
+
+        if (shape1->isCompoundProxy())
+        {
+            computeCompoundOverlappingPairs(shape1, shape2);
+        }
+        else
+        {
+            computeCompoundOverlappingPairs(shape2, shape1);
+        }
+    }
+}
+
+
+
+// Create the overlapping pairs of the shapes of a compound body with another shape
+/// If the other shape is a compound body too , the shapes of the body with the
+/// fewest shapes overlapping with the other body are tested against the local
+/// tree of the other body
+/**
+ * @param compoundShape The broad-phase proxy shape of the compound body
+ * @param shape The other proxy shape (a shape or a compound body)
+ */
+void rpCollisionManager::computeCompoundOverlappingPairs(rpProxyShape* compoundShape, rpProxyShape* shape)
+{
+    if (shape->isCompoundProxy() &&
+        shape->getBody()->mNbCollisionShapes > compoundShape->getBody()->mNbCollisionShapes)
+    {
+        Swap(compoundShape, shape);
+    }
+
+    rpCollisionBody* const compoundBody = compoundShape->getBody();
+    rpCollisionBody* const body = shape->getBody();
+
+    std::vector<rpProxyShape*> shapes;
+    if (shape->isCompoundProxy())
+    {
+        body->reportCompoundShapesOverlappingWithAABB(mBroadPhaseAlgorithm.getFatAABB(compoundShape), shapes);
+    }
+    else
+    {
+        shapes.push_back(shape);
+    }
+
+    std::vector<rpProxyShape*> compoundShapes;
+    for (uint i = 0; i < shapes.size(); ++i)
+    {
+        const rpAABB aabb = shape->isCompoundProxy() ? body->computeCompoundShapeAABB(shapes[i]) :
+                                                       mBroadPhaseAlgorithm.getFatAABB(shape);
+
+        compoundShapes.clear();
+        compoundBody->reportCompoundShapesOverlappingWithAABB(aabb, compoundShapes);
+
+        for (uint j = 0; j < compoundShapes.size(); ++j)
+        {
+            overlappingpairid pairID = rpOverlappingPair::computeID(compoundShapes[j], shapes[i]);
+            if (mOverlappingPairs.find(pairID) != mOverlappingPairs.end()) continue;
+
+            // The local query is larger than the shape , the pairs are created only
+            // if they are not destroyed by the narrow-phase of the step
+            if (testOverlappingShapes(compoundShapes[j], shapes[i]))
+            {
+                addOverlappingPair(compoundShapes[j], shapes[i]);
+            }
+        }
+    }
 }
 
 
@@ -100,6 +213,7 @@ void rpCollisionManager::computeNarrowPhase()
 
 
     int CollisionPairNbCount = 0;
+    mNbTemporalCoherencePairs = 0;
 
     // For each possible collision pair of bodies
     // std::map<overlappingpairid, OverlappingPair*>::iterator it;
@@ -113,12 +227,29 @@ void rpCollisionManager::computeNarrowPhase()
 
         assert(shape1->mBroadPhaseID != shape2->mBroadPhaseID);
 
+        rpCollisionBody* const body1 = shape1->getBody();
+        rpCollisionBody* const body2 = shape2->getBody();
+
+        // Check that at least one body is awake and not static. The proxies of the
+        // sleeping and static bodies have not moved , so the pair is kept untouched
+        // with its contacts : the islands walk over them to wake up a whole stack
+        bool isBody1Active = !body1->isSleeping() && body1->getType() != STATIC;
+        bool isBody2Active = !body2->isSleeping() && body2->getType() != STATIC;
+        if (!isBody1Active && !isBody2Active)
+        {
+            auto itContact = mContactOverlappingPairs.find(rpOverlappingPair::computeID(shape1, shape2));
+            if (itContact != mContactOverlappingPairs.end()) itContact->second->isFakeCollision = false;
+
+            ++it;
+            continue;
+        }
+
         // Check if the collision filtering allows collision between the two shapes and
         // that the two shapes are still overlapping. Otherwise, we destroy the
         // overlapping pair
         if (((shape1->getCollideWithMaskBits() & shape2->getCollisionCategoryBits()) == 0  ||
              (shape1->getCollisionCategoryBits() & shape2->getCollideWithMaskBits()) == 0) ||
-             !mBroadPhaseAlgorithm.testOverlappingShapes(shape1, shape2))
+             !testOverlappingShapes(shape1, shape2))
         {
 
             std::map<overlappingpairid, rpOverlappingPair*>::iterator itToRemove = it;
@@ -126,6 +257,9 @@ void rpCollisionManager::computeNarrowPhase()
 
             // TODO : Remove all the contact manifold of the overlapping pair from the contact manifolds list of the two bodies involved
 
+            // The shapes of a pair with a sensor stop to overlap
+            setSensorOverlapping(itToRemove->second, false);
+
             // Destroy the overlapping pair
             delete itToRemove->second;
             mOverlappingPairs.erase(itToRemove);
@@ -139,28 +273,56 @@ void rpCollisionManager::computeNarrowPhase()
 
 
 
-        rpCollisionBody* const body1 = shape1->getBody();
-        rpCollisionBody* const body2 = shape2->getBody();
-
         // Update the contact cache of the overlapping pair
         pair->update();
 
-        // Check that at least one body is awake and not static
-        bool isBody1Active = !body1->isSleeping() && body1->getType() != STATIC;
-        bool isBody2Active = !body2->isSleeping() && body2->getType() != STATIC;
-        if (!isBody1Active && !isBody2Active) continue;
-
         // Check if the bodies are in the set of bodies that cannot collide between each other
         bodyindexpair bodiesIndex = rpOverlappingPair::computeBodiesIndexPair(body1, body2);
-        if (mNoCollisionPairs.count(bodiesIndex) > 0) continue;
+        const bool isNoCollisionPair = (mNoCollisionPairs.count(bodiesIndex) > 0);
+
+        // The pairs with a sensor only test if their shapes overlap , they never
+        // have contacts (a shape no longer a sensor ends its overlap first)
+        if (pair->isSensorPair() || pair->isSensorOverlapping())
+        {
+            setSensorOverlapping(pair, pair->isSensorPair() && !isNoCollisionPair && testSensorOverlap(pair));
+            if (pair->isSensorPair()) continue;
+        }
+
+        if (isNoCollisionPair) continue;
 
         CollisionPairNbCount++;
 
+        // The shapes have barely moved relative to each other , the contacts are kept
+        if (computeTemporalCoherence(pair)) continue;
+
+        // The concave shapes are tested triangle by triangle
+        if (!rpCollisionShape::isConvex(shape1->getCollisionShape()->getType()) ||
+            !rpCollisionShape::isConvex(shape2->getCollisionShape()->getType()))
+        {
+            computeConcaveNarrowPhase(pair);
+            updateCachedRelativeTransform(pair);
+            continue;
+        }
+
 
 
         /**********************************************************************/
 
-        rpNarrowPhaseCollisionAlgorithm* narrowPhaseAlgorithm = new rpNarrowPhaseGjkEpaAlgorithm;// mCollisionMatrix[shape1Type][shape2Type];
+        // The capsules are tested in closed form against the capsules , the spheres and
+        // the boxes. The shapes of the bodies contracted by their relativistic motion
+        // are not capsules or boxes anymore , so they always go through GJK/EPA.
+        rpNarrowPhaseCollisionAlgorithm* narrowPhaseAlgorithm = NULL;
+        if (rpNarrowPhaseCapsuleAlgorithm::isSupportedPair(shape1->getCollisionShape()->getType(),
+                                                           shape2->getCollisionShape()->getType()) &&
+            body1->getRelativityMotion().isIdentityBoost() &&
+            body2->getRelativityMotion().isIdentityBoost())
+        {
+            narrowPhaseAlgorithm = new rpNarrowPhaseCapsuleAlgorithm;
+        }
+        else
+        {
+            narrowPhaseAlgorithm = new rpNarrowPhaseGjkEpaAlgorithm;// mCollisionMatrix[shape1Type][shape2Type];
+        }
 
         // If there is no collision algorithm between those two kinds of shapes
         if (narrowPhaseAlgorithm == NULL) continue;
@@ -169,13 +331,8 @@ void rpCollisionManager::computeNarrowPhase()
         narrowPhaseAlgorithm->setCurrentOverlappingPair(pair);
 
         // Create the CollisionShapeInfo objects
-        rpCollisionShapeInfo shape1Info( shape1->getCollisionShape(),
-                                         shape1->getWorldTransform(),
-                                         shape1->getCachedCollisionData());
-
-        rpCollisionShapeInfo shape2Info( shape2->getCollisionShape(),
-                                         shape2->getWorldTransform(),
-                                         shape2->getCachedCollisionData());
+        rpCollisionShapeInfo shape1Info( shape1 );
+        rpCollisionShapeInfo shape2Info( shape2 );
 
 
 
@@ -212,20 +369,69 @@ void rpCollisionManager::computeNarrowPhase()
             mContactOverlappingPairs[pairId]->mContactManifoldSet.setExtermalPenetration(penetration);
 
         }
+        else if( infoContact.m_penetrationDepth < scalar(0.0) &&
+                 infoContact.m_normal.lengthSquare() > MACHINE_EPSILON )
+        {
+            // The shapes are separated : if they can close the distance between them
+            // during the step , speculative contacts are created and the solver only
+            // removes the part of the approach velocity that would make them interpenetrate
+            Vector3 axis = infoContact.m_normal;
+            scalar  distance = -infoContact.m_penetrationDepth;
+            scalar  approach = (body1->getStepDisplacement() - body2->getStepDisplacement()).dot(axis);
+
+            if( distance < Max(approach , scalar(0.0)) + SPECULATIVE_CONTACT_MARGIN )
+            {
+                overlappingpairid pairId = rpOverlappingPair::computeID(shape1,  shape2);
+
+                if( mContactOverlappingPairs.find(pairId) == mContactOverlappingPairs.end())
+                {
+                    const int maxContacts = 2;
+                    mContactOverlappingPairs.insert( std::make_pair( pairId , new rpOverlappingPair(shape1,shape2,maxContacts)) );
+                }
+
+                rpOverlappingPair* contactPair = mContactOverlappingPairs[pairId];
+
+                // The features of the shapes facing each other along the axis , or
+                // one contact between the closest points of the shapes otherwise
+                rpContactGeneration generatorManiflod( shape1 , shape2 , axis );
+                if( !generatorManiflod.computeContacteOverlappingPair( contactPair , this , INTERPOLATION_CONTACT_POINTS , true ) )
+                {
+                    rpContactPointInfo info( -axis , infoContact.m_penetrationDepth ,
+                                             shape1->getWorldTransform().getInverse() * infoContact.pBLocal ,
+                                             shape2->getWorldTransform().getInverse() * infoContact.pALocal , true );
+
+                    contactPair->clearContactPoints();
+                    createContact( contactPair , info );
+                }
+
+                contactPair->update();
+
+                contactPair->isFakeCollision = false;
+                contactPair->setCachedSeparatingAxis(axis);
+                contactPair->mContactManifoldSet.setExtermalPenetration(infoContact.m_penetrationDepth);
+            }
+        }
 
 
         delete narrowPhaseAlgorithm;
         /*********************************************************************/
 
+        updateCachedRelativeTransform(pair);
+
     }
 
     // Delete contacts
-    for( auto pair : mContactOverlappingPairs )
+    for( auto it = mContactOverlappingPairs.begin(); it != mContactOverlappingPairs.end(); )
     {
-        if(pair.second->isFakeCollision)
+        if(it->second->isFakeCollision)
         {
-            delete pair.second;
-            mContactOverlappingPairs.erase(pair.first);
+            resetContactManifoldsListsOfPair(it->second);
+            delete it->second;
+            it = mContactOverlappingPairs.erase(it);
+        }
+        else
+        {
+            ++it;
         }
     }
 
@@ -238,8 +444,264 @@ void rpCollisionManager::computeNarrowPhase()
 
 
 
+// Keep the contacts of the pair if its shapes have barely moved relative to each other
+/// The GJK/EPA and the contact generation are skipped , the contact points keep
+/// their local points and their world points and penetrations are updated by the
+/// manifolds. The contracted shapes of the relativistic bodies change with their
+/// velocity , so their pairs are always computed.
+bool rpCollisionManager::computeTemporalCoherence(rpOverlappingPair* pair)
+{
+    if (!mIsTemporalCoherenceEnabled) return false;
+
+    if (!pair->getShape1()->getBody()->getRelativityMotion().isIdentityBoost() ||
+        !pair->getShape2()->getBody()->getRelativityMotion().isIdentityBoost()) return false;
+
+    if (!pair->isRelativeMotionSmall(mTemporalCoherenceLinearTolerance, mTemporalCoherenceAngularTolerance)) return false;
+
+    auto itContact = mContactOverlappingPairs.find(rpOverlappingPair::computeID(pair->getShape1(), pair->getShape2()));
+    if (itContact == mContactOverlappingPairs.end() || itContact->second->getNbContactManifolds() == 0) return false;
+
+    rpOverlappingPair* contactPair = itContact->second;
+    contactPair->update();
+    contactPair->isFakeCollision = false;
+
+    mNbTemporalCoherencePairs++;
+    return true;
+}
+
+// Cache the relative transform of the pair if the narrow-phase has found contacts
+void rpCollisionManager::updateCachedRelativeTransform(rpOverlappingPair* pair)
+{
+    auto itContact = mContactOverlappingPairs.find(rpOverlappingPair::computeID(pair->getShape1(), pair->getShape2()));
+    if (itContact != mContactOverlappingPairs.end() && !itContact->second->isFakeCollision)
+    {
+        pair->cacheRelativeTransform();
+    }
+    else
+    {
+        pair->resetCachedRelativeTransform();
+    }
+}
+
+
+
+// Call the function for each triangle of the concave shape given by its midphase
+/// The midphase returns the triangles overlapping the AABB of the convex shape in the
+/// local-space of the concave shape , enlarged by the gap. Each triangle takes the place
+/// of the concave shape in a temporary proxy shape , so the convex algorithms run
+/// unchanged on it. The loop stops when the function returns false
+template<class Function>
+void rpCollisionManager::computeConcaveMidPhase(rpProxyShape* convexProxy, rpProxyShape* concaveProxy,
+                                                scalar gap, Function function) const
+{
+    const rpConcaveShape* concaveShape = static_cast<const rpConcaveShape*>(concaveProxy->getCollisionShape());
+
+    const Transform concaveToWorld = concaveProxy->getWorldTransform();
+    rpAABB localAABB;
+    convexProxy->getCollisionShape()->computeAABB(localAABB, concaveToWorld.getInverse() * convexProxy->getBody()->getTransform(),
+                                                  convexProxy->getLocalToBodyTransform());
+    localAABB.inflate(gap, gap, gap);
+
+    std::vector<uint> triangles;
+    concaveShape->getTrianglesOverlappingWithAABB(localAABB, triangles);
+
+    for (uint i = 0; i < triangles.size(); i++)
+    {
+        Vector3 trianglePoints[3];
+        concaveShape->getTriangleVertices(triangles[i], trianglePoints);
+
+        rpTriangleShape triangleShape(trianglePoints[0], trianglePoints[1], trianglePoints[2]);
+        rpProxyShape triangleProxy(concaveProxy->getBody(), &triangleShape, concaveProxy->getLocalToBodyTransform());
+
+        if (!function(&triangleProxy)) return;
+    }
+}
+
+
+
+// Return true if the shapes of a pair with a sensor overlap (boolean test , no contacts)
+/// The GJK algorithm stops at the first separating axis or simplex containing the
+/// origin : there is no EPA , no contact generation and no contact manifold. A
+/// concave shape overlaps if one of its triangles found by the midphase does.
+bool rpCollisionManager::testSensorOverlap(rpOverlappingPair* pair)
+{
+    rpProxyShape* shape1 = pair->getShape1();
+    rpProxyShape* shape2 = pair->getShape2();
+
+    const bool isShape1Convex = rpCollisionShape::isConvex(shape1->getCollisionShape()->getType());
+    const bool isShape2Convex = rpCollisionShape::isConvex(shape2->getCollisionShape()->getType());
+
+    rpGJKAlgorithm gjkAlgorithm;
+    gjkAlgorithm.setCachedSeparatingAxis(pair->getCachedSeparatingAxis());
+
+    if (isShape1Convex && isShape2Convex)
+    {
+        rpCollisionShapeInfo shape1Info( shape1 );
+        rpCollisionShapeInfo shape2Info( shape2 );
+
+        bool isOverlapping = gjkAlgorithm.testIntersection(shape1Info, shape2Info);
+
+        // The separating axis starts the test of the next step
+        pair->setCachedSeparatingAxis(gjkAlgorithm.getCachedSeparatingAxis());
+
+        return isOverlapping;
+    }
+
+    // Two concave shapes do not overlap
+    if (!isShape1Convex && !isShape2Convex) return false;
+
+    rpProxyShape* convexProxy  = isShape1Convex ? shape1 : shape2;
+    rpProxyShape* concaveProxy = isShape1Convex ? shape2 : shape1;
+
+    // A concave shape overlaps if one of its triangles does
+    rpCollisionShapeInfo convexInfo( convexProxy );
+    bool isOverlapping = false;
+    computeConcaveMidPhase(convexProxy, concaveProxy, scalar(0.0), [&](rpProxyShape* triangleProxy)
+    {
+        rpCollisionShapeInfo triangleInfo( triangleProxy );
+        isOverlapping = gjkAlgorithm.testIntersection(convexInfo, triangleInfo);
+        return !isOverlapping;
+    });
+
+    return isOverlapping;
+}
+
+// Set the overlap state of a pair with a sensor and report its changes
+/// The events of all the pairs are collected during the narrow-phase and read
+/// together after the step , no user code runs inside the collision detection
+void rpCollisionManager::setSensorOverlapping(rpOverlappingPair* pair, bool isOverlapping)
+{
+    if (pair->mIsSensorOverlapping == isOverlapping) return;
+    pair->mIsSensorOverlapping = isOverlapping;
+
+    const bool isShape1Sensor = pair->getShape1()->isSensor() || !pair->getShape2()->isSensor();
+    rpProxyShape* sensorShape = isShape1Sensor ? pair->getShape1() : pair->getShape2();
+    rpProxyShape* otherShape  = isShape1Sensor ? pair->getShape2() : pair->getShape1();
+
+    mSensorEvents.push_back(rpSensorEvent(sensorShape, otherShape, isOverlapping));
+}
+
+
+
+// Compute the narrow-phase collision detection between a convex shape and
+// the triangles of a concave shape given by the midphase of the concave shape
+/// Each triangle takes the place of the concave shape in a temporary proxy shape ,
+/// so the convex collision and the contact generation run unchanged and their
+/// contacts are added together in the contact pair (one manifold by normal direction)
+void rpCollisionManager::computeConcaveNarrowPhase(rpOverlappingPair* pair)
+{
+    rpProxyShape* shape1 = pair->getShape1();
+    rpProxyShape* shape2 = pair->getShape2();
+
+    const bool isShape1Convex = rpCollisionShape::isConvex(shape1->getCollisionShape()->getType());
+    const bool isShape2Convex = rpCollisionShape::isConvex(shape2->getCollisionShape()->getType());
+
+    // Two concave shapes do not collide
+    if (!isShape1Convex && !isShape2Convex) return;
+
+    rpProxyShape* convexProxy  = isShape1Convex ? shape1 : shape2;
+    rpProxyShape* concaveProxy = isShape1Convex ? shape2 : shape1;
+
+    // The AABB of the convex shape is enlarged by the motion of the step
+    // to find the triangles of the speculative contacts
+    const Vector3 displacement = convexProxy->getBody()->getStepDisplacement() - concaveProxy->getBody()->getStepDisplacement();
+    const scalar  gap = displacement.length() + SPECULATIVE_CONTACT_MARGIN;
+
+    overlappingpairid pairId = rpOverlappingPair::computeID(shape1, shape2);
+    rpOverlappingPair* contactPair = NULL;
+    scalar  penetration = DECIMAL_SMALLEST;
+    Vector3 separatingAxis;
+
+    computeConcaveMidPhase(convexProxy, concaveProxy, gap, [&](rpProxyShape* triangleProxy)
+    {
+        rpProxyShape* triangleShape1 = isShape1Convex ? shape1 : triangleProxy;
+        rpProxyShape* triangleShape2 = isShape1Convex ? triangleProxy : shape2;
+
+        rpNarrowPhaseGjkEpaAlgorithm narrowPhaseAlgorithm;
+        narrowPhaseAlgorithm.setCurrentOverlappingPair(pair);
+
+        rpCollisionShapeInfo shape1Info( triangleShape1 );
+        rpCollisionShapeInfo shape2Info( triangleShape2 );
+
+        OutContactInfo infoContact;
+        bool testCollision = narrowPhaseAlgorithm.testCollision( shape2Info , shape1Info , infoContact );
+
+        bool isSpeculative = false;
+        if (!testCollision)
+        {
+            // The triangle is separated : speculative contacts are only created
+            // if the shapes can close the distance during the step
+            if (infoContact.m_penetrationDepth >= scalar(0.0) ||
+                infoContact.m_normal.lengthSquare() <= MACHINE_EPSILON) return true;
+
+            scalar approach = (shape1->getBody()->getStepDisplacement() -
+                               shape2->getBody()->getStepDisplacement()).dot(infoContact.m_normal);
+            if (-infoContact.m_penetrationDepth >= Max(approach , scalar(0.0)) + SPECULATIVE_CONTACT_MARGIN) return true;
+
+            isSpeculative = true;
+        }
+
+        // The contacts of the previous step are removed before the first new contact
+        if (contactPair == NULL)
+        {
+            if( mContactOverlappingPairs.find(pairId) == mContactOverlappingPairs.end())
+            {
+                const int maxContactManifolds = rpCollisionShape::computeNbMaxContactManifolds(shape1->getCollisionShape()->getType(),
+                                                                                                shape2->getCollisionShape()->getType());
+                mContactOverlappingPairs.insert( std::make_pair( pairId , new rpOverlappingPair(shape1,shape2,maxContactManifolds)) );
+            }
+
+            contactPair = mContactOverlappingPairs[pairId];
+            contactPair->clearContactPoints();
+        }
+
+        rpContactGeneration generatorManiflod( triangleShape1 , triangleShape2 , infoContact.m_normal );
+        if( !generatorManiflod.computeContacteOverlappingPair( contactPair , this , INTERPOLATION_CONTACT_POINTS ,
+                                                               isSpeculative , false ) && isSpeculative )
+        {
+            // The contact points are in the local-space of the proxy shapes of the pair
+            // (the triangle has the transform of the concave shape)
+            rpContactPointInfo info( -infoContact.m_normal , infoContact.m_penetrationDepth ,
+                                     shape1->getWorldTransform().getInverse() * infoContact.pBLocal ,
+                                     shape2->getWorldTransform().getInverse() * infoContact.pALocal , true );
+            createContact( contactPair , info );
+        }
+
+        if (infoContact.m_penetrationDepth > penetration)
+        {
+            penetration = infoContact.m_penetrationDepth;
+            separatingAxis = infoContact.m_normal;
+        }
+
+        return true;
+    });
+
+    if (contactPair == NULL) return;
+
+    // All the triangles may have been rejected by the contact generation
+    if (contactPair->getNbContactManifolds() == 0) return;
+
+    contactPair->update();
+
+    contactPair->isFakeCollision = false;
+    contactPair->setCachedSeparatingAxis(separatingAxis);
+    contactPair->mContactManifoldSet.setExtermalPenetration(penetration);
+}
+
+
+
 void rpCollisionManager::addAllContactManifoldsToBodies()
 {
+    // The lists of the sleeping bodies are not reset by the step , they are
+    // built again here from their pairs
+    for (auto it = mContactOverlappingPairs.begin(); it != mContactOverlappingPairs.end(); ++it)
+    {
+        rpCollisionBody* body1 = it->second->getShape1()->getBody();
+        rpCollisionBody* body2 = it->second->getShape2()->getBody();
+        if (body1->isSleeping()) body1->resetContactManifoldsList();
+        if (body2->isSleeping()) body2->resetContactManifoldsList();
+    }
+
     for (auto it = mContactOverlappingPairs.begin(); it != mContactOverlappingPairs.end(); ++it)
     {
           // Add all the contact manifolds of the pair into the list of contact manifolds
@@ -249,6 +711,15 @@ void rpCollisionManager::addAllContactManifoldsToBodies()
 
 }
 
+// Remove the contact manifolds of a contact pair about to be destroyed from the lists of its bodies
+/// The lists hold the manifolds of every pair of the body , so they are reset and the
+/// remaining pairs add their manifolds again at the end of the narrow-phase
+void rpCollisionManager::resetContactManifoldsListsOfPair(rpOverlappingPair* pair)
+{
+    pair->getShape1()->getBody()->resetContactManifoldsList();
+    pair->getShape2()->getBody()->resetContactManifoldsList();
+}
+
 void rpCollisionManager::addContactManifoldToBody(rpOverlappingPair *pair)
 {
 
@@ -293,6 +764,22 @@ void rpCollisionManager::broadPhaseNotifyOverlappingPair( rpProxyShape* shape1 ,
 	// If the two proxy collision shapes are from the same body, skip it
 	if (shape1->getBody()->getID() == shape2->getBody()->getID()) return;
 
+	// The pairs of the compound bodies are kept apart , the midphase pairs their
+	// shapes at each step
+	if (shape1->isCompoundProxy() || shape2->isCompoundProxy())
+	{
+		overlappingpairid pairID = rpOverlappingPair::computeID(shape1, shape2);
+		mCompoundOverlappingPairs.insert(make_pair(pairID, make_pair(shape1, shape2)));
+		return;
+	}
+
+	addOverlappingPair(shape1, shape2);
+}
+
+// Create the overlapping pair of two proxy shapes if it does not exist yet
+void rpCollisionManager::addOverlappingPair(rpProxyShape* shape1, rpProxyShape* shape2)
+{
+
 	// Check if the collision filtering allows collision between the two shapes
 	if ((shape1->getCollideWithMaskBits() & shape2->getCollisionCategoryBits()) == 0 ||
 		(shape1->getCollisionCategoryBits() & shape2->getCollideWithMaskBits()) == 0) return;
@@ -362,12 +849,59 @@ void rpCollisionManager::createContact(rpOverlappingPair *overlappingPair , cons
 
 void rpCollisionManager::addProxyCollisionShape(rpProxyShape* proxyShape, const rpAABB& aabb)
 {
-	// Add the body to the broad-phase
-	mBroadPhaseAlgorithm.addProxyCollisionShape(proxyShape, aabb);
+	// The shapes of a compound body go into the local tree of the body
+	if (proxyShape->getBody()->isCompound())
+	{
+		addCompoundProxyShape(proxyShape);
+	}
+	else
+	{
+		// Add the body to the broad-phase
+		mBroadPhaseAlgorithm.addProxyCollisionShape(proxyShape, aabb);
+	}
 
 	mIsCollisionShapesAdded = true;
 }
 
+// Add a proxy shape into the local AABB tree of its compound body
+/// The broad-phase entry of the body is created with its first shape
+void rpCollisionManager::addCompoundProxyShape(rpProxyShape* proxyShape)
+{
+	rpCollisionBody* const body = proxyShape->getBody();
+
+	body->addCompoundShape(proxyShape);
+	mBroadPhaseAlgorithm.addCompoundShapeID(proxyShape);
+
+	rpProxyShape* const compoundProxy = body->mCompoundProxy;
+	compoundProxy->updateCachedWorldTransform();
+
+	const rpAABB aabb = body->computeCompoundAABB(body->mTransform, body->mRelativityMotion);
+	if (compoundProxy->mBroadPhaseID == -1)
+	{
+		mBroadPhaseAlgorithm.addProxyCollisionShape(compoundProxy, aabb);
+	}
+	else
+	{
+		mBroadPhaseAlgorithm.updateProxyCollisionShape(compoundProxy, aabb, Vector3::ZERO, true);
+	}
+}
+
+// Remove a proxy shape from the local AABB tree of its compound body
+/// The broad-phase entry of the body is removed with its last shape
+void rpCollisionManager::removeCompoundProxyShape(rpProxyShape* proxyShape)
+{
+	rpCollisionBody* const body = proxyShape->getBody();
+
+	body->removeCompoundShape(proxyShape);
+	mBroadPhaseAlgorithm.removeCompoundShapeID(proxyShape);
+
+	if (body->mCompoundTree->isEmpty())
+	{
+		removeProxyCollisionShape(body->mCompoundProxy);
+		body->mCompoundProxy->mBroadPhaseID = -1;
+	}
+}
+
 void rpCollisionManager::removeProxyCollisionShape(rpProxyShape* proxyShape)
 {
 
@@ -396,8 +930,61 @@ void rpCollisionManager::removeProxyCollisionShape(rpProxyShape* proxyShape)
 		}
 	}
 
+	// Destroy the contacts of this proxy shape , the contact pairs would point to the
+	// removed shape until the next narrow-phase
+	for (auto it = mContactOverlappingPairs.begin(); it != mContactOverlappingPairs.end(); )
+	{
+		if (it->second->getShape1() == proxyShape || it->second->getShape2() == proxyShape)
+		{
+			resetContactManifoldsListsOfPair(it->second);
+			delete it->second;
+			it = mContactOverlappingPairs.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	// Forget the sensor events of this proxy shape , a removed shape ends its
+	// overlaps without an event since the pointer of the shape would not be valid
+	for (auto it = mSensorEvents.begin(); it != mSensorEvents.end(); )
+	{
+		if (it->sensorShape == proxyShape || it->otherShape == proxyShape)
+		{
+			it = mSensorEvents.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	// Remove the pairs of the compound bodies involving this proxy shape
+	for (auto it = mCompoundOverlappingPairs.begin(); it != mCompoundOverlappingPairs.end(); )
+	{
+		if (it->second.first == proxyShape || it->second.second == proxyShape)
+		{
+			std::map<overlappingpairid, std::pair<rpProxyShape*, rpProxyShape*> >::iterator itToRemove = it;
+			++it;
+			mCompoundOverlappingPairs.erase(itToRemove);
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	if (proxyShape->mCompoundNodeID != -1)
+	{
+		// Remove the shape from the local tree of its compound body
+		removeCompoundProxyShape(proxyShape);
+	}
+	else
+	{
 	    // Remove the body from the broad-phase
 	    mBroadPhaseAlgorithm.removeProxyCollisionShape(proxyShape);
+	}
 
 }
 
@@ -409,6 +996,24 @@ void rpCollisionManager::updateProxyCollisionShape(rpProxyShape* shape, const rp
 
 }
 
+// Return true if the fat AABBs of two proxy shapes are overlapping
+/// The shapes of the compound bodies are not in the broad-phase , their AABBs are
+/// computed from the body like the fat AABBs of the broad-phase
+bool rpCollisionManager::testOverlappingShapes(const rpProxyShape* shape1, const rpProxyShape* shape2) const
+{
+    if (shape1->mCompoundNodeID == -1 && shape2->mCompoundNodeID == -1)
+    {
+        return mBroadPhaseAlgorithm.testOverlappingShapes(shape1, shape2);
+    }
+
+    const rpAABB aabb1 = (shape1->mCompoundNodeID != -1) ? shape1->getBody()->computeCompoundShapeAABB(shape1) :
+                                                           mBroadPhaseAlgorithm.getFatAABB(shape1);
+    const rpAABB aabb2 = (shape2->mCompoundNodeID != -1) ? shape2->getBody()->computeCompoundShapeAABB(shape2) :
+                                                           mBroadPhaseAlgorithm.getFatAABB(shape2);
+
+    return aabb1.testCollision(aabb2);
+}
+
 void rpCollisionManager::addNoCollisionPair(rpCollisionBody* body1, rpCollisionBody* body2)
 {
 	 mNoCollisionPairs.insert(rpOverlappingPair::computeBodiesIndexPair(body1, body2));
@@ -424,6 +1029,16 @@ void rpCollisionManager::askForBroadPhaseCollisionCheck(rpProxyShape* shape)
     mBroadPhaseAlgorithm.addMovedCollisionShape(shape->mBroadPhaseID);
 }
 
+void rpCollisionManager::notifySleepingStateChanged(rpCollisionBody* body)
+{
+    mSleepingStateChangedBodies.insert(body);
+}
+
+void rpCollisionManager::removeSleepingStateChanged(rpCollisionBody* body)
+{
+    mSleepingStateChangedBodies.erase(body);
+}
+
 /// Delete all the contact points in the currently overlapping pairs
 void rpCollisionManager::clearContactPoints()
 {
@@ -444,6 +1059,50 @@ void rpCollisionManager::raycast(RaycastCallback* raycastCallback, const Ray& ra
 	    mBroadPhaseAlgorithm.raycast(ray, rayCastTest, raycastWithCategoryMaskBits);
 }
 
+// Report all the proxy shapes overlapping with the AABB that can collide with the proxy shape
+void rpCollisionManager::reportShapesOverlappingWithAABB(const rpProxyShape* shape, const rpAABB& aabb,
+                                                         std::vector<rpProxyShape*>& overlappingShapes) const
+{
+    uint nbShapes = overlappingShapes.size();
+    mBroadPhaseAlgorithm.reportAllShapesOverlappingWithAABB(aabb, overlappingShapes);
+
+    // Remove the shapes filtered by the collision masks , of the same body or sensors
+    uint i = nbShapes;
+    while (i < overlappingShapes.size())
+    {
+        rpProxyShape* overlappingShape = overlappingShapes[i];
+
+        // The node of a compound body is replaced by the shapes of the body overlapping with the AABB
+        if (overlappingShape->isCompoundProxy())
+        {
+            overlappingShapes[i] = overlappingShapes.back();
+            overlappingShapes.pop_back();
+
+            if (overlappingShape->getBody() != shape->getBody())
+            {
+                overlappingShape->getBody()->reportCompoundShapesOverlappingWithAABB(aabb, overlappingShapes);
+            }
+            continue;
+        }
+
+        bool isFiltered = (overlappingShape->getBody() == shape->getBody()) ||
+                          shape->isSensor() || overlappingShape->isSensor() ||
+                          (shape->getCollideWithMaskBits() & overlappingShape->getCollisionCategoryBits()) == 0 ||
+                          (shape->getCollisionCategoryBits() & overlappingShape->getCollideWithMaskBits()) == 0 ||
+                          mNoCollisionPairs.count(rpOverlappingPair::computeBodiesIndexPair(shape->getBody(),
+                                                                                            overlappingShape->getBody())) > 0;
+        if (isFiltered)
+        {
+            overlappingShapes[i] = overlappingShapes.back();
+            overlappingShapes.pop_back();
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
 } /* namespace real_physics */
 
 
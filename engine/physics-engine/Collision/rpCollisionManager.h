@@ -15,6 +15,7 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 
 #include "../LinearMaths/mathematics.h"
@@ -38,6 +39,31 @@ class rpBroadPhaseAlgorithm;
 class rpCollisionWorld;
 
 
+// Structure rpSensorEvent
+/**
+ * A sensor shape has started or stopped to overlap another shape during the
+ * narrow-phase of the last step
+ */
+struct rpSensorEvent
+{
+    /// The sensor shape (the first shape of the pair if both are sensors)
+    rpProxyShape* sensorShape;
+
+    /// The shape entering or leaving the sensor
+    rpProxyShape* otherShape;
+
+    /// True if the shapes have started to overlap , false if they have stopped
+    bool isBeginOverlap;
+
+    /// Constructor
+    rpSensorEvent(rpProxyShape* sensorShape, rpProxyShape* otherShape, bool isBeginOverlap)
+    : sensorShape(sensorShape),
+      otherShape(otherShape),
+      isBeginOverlap(isBeginOverlap)
+    {
+
+    }
+};
 
 // Class CollisionDetection
 /**
@@ -62,6 +88,10 @@ class rpCollisionManager
         std::map<overlappingpairid, rpOverlappingPair*> mOverlappingPairs;
         std::map<overlappingpairid, rpOverlappingPair*> mContactOverlappingPairs;
 
+        /// Broad-phase overlapping pairs involving a compound body (the pairs of the
+        /// shapes of the compound bodies are found by the midphase of these pairs)
+        std::map<overlappingpairid, std::pair<rpProxyShape*, rpProxyShape*> > mCompoundOverlappingPairs;
+
 
 		/// Broad-phase algorithm
 		rpBroadPhaseAlgorithm mBroadPhaseAlgorithm;
@@ -70,6 +100,22 @@ class rpCollisionManager
 	    /// True if some collision shapes have been added previously
 	    bool mIsCollisionShapesAdded;
 
+	    /// Bodies which have been put to sleep or woken up since the last update of the world
+	    std::set<rpCollisionBody*> mSleepingStateChangedBodies;
+
+	    /// True if the pairs whose shapes have barely moved keep their contacts
+	    bool mIsTemporalCoherenceEnabled;
+
+	    /// Relative motion under which a pair keeps its contacts
+	    scalar mTemporalCoherenceLinearTolerance;
+	    scalar mTemporalCoherenceAngularTolerance;
+
+	    /// Number of pairs of the last narrow-phase which kept their contacts
+	    uint mNbTemporalCoherencePairs;
+
+	    /// Begin and end of overlap events of the sensor shapes of the last narrow-phase
+	    std::vector<rpSensorEvent> mSensorEvents;
+
 
 
         // -------------------- Methods -------------------- //
@@ -83,9 +129,37 @@ class rpCollisionManager
         /// Compute the broad-phase collision detection
         void computeBroadPhase();
 
+        /// Compute the overlapping pairs of shapes of the compound bodies overlapping in the broad-phase
+        void computeCompoundMidPhase();
+
+        /// Create the overlapping pairs of the shapes of a compound body with another shape
+        void computeCompoundOverlappingPairs(rpProxyShape* compoundShape, rpProxyShape* shape);
+
         /// Compute the narrow-phase collision detection
         void computeNarrowPhase();
 
+        /// Call the function for each triangle of the concave shape given by its midphase ,
+        /// the triangle takes the place of the concave shape in a temporary proxy shape
+        template<class Function>
+        void computeConcaveMidPhase(rpProxyShape* convexProxy, rpProxyShape* concaveProxy,
+                                    scalar gap, Function function) const;
+
+        /// Compute the narrow-phase collision detection between a convex shape and
+        /// the triangles of a concave shape given by the midphase of the concave shape
+        void computeConcaveNarrowPhase(rpOverlappingPair* pair);
+
+        /// Keep the contacts of the pair if its shapes have barely moved relative to each other
+        bool computeTemporalCoherence(rpOverlappingPair* pair);
+
+        /// Cache the relative transform of the pair if the narrow-phase has found contacts
+        void updateCachedRelativeTransform(rpOverlappingPair* pair);
+
+        /// Return true if the shapes of a pair with a sensor overlap (boolean test , no contacts)
+        bool testSensorOverlap(rpOverlappingPair* pair);
+
+        /// Set the overlap state of a pair with a sensor and report its changes
+        void setSensorOverlapping(rpOverlappingPair* pair, bool isOverlapping);
+
         /// Add a contact manifold to the linked list of contact manifolds of the two bodies
         /// involed in the corresponding contact.
         void addContactManifoldToBody(rpOverlappingPair* pair);
@@ -93,10 +167,26 @@ class rpCollisionManager
         /// Add all the contact manifold of colliding pairs to their bodies
         void addAllContactManifoldsToBodies();
 
+        /// Remove the contact manifolds of a contact pair about to be destroyed from the
+        /// lists of its two bodies (the lists of the sleeping bodies are not reset by the step)
+        void resetContactManifoldsListsOfPair(rpOverlappingPair* pair);
+
 
 	    void broadPhaseNotifyOverlappingPair( rpProxyShape* shape1 ,
 	    		                              rpProxyShape* shape2 );
 
+        /// Create the overlapping pair of two proxy shapes if it does not exist yet
+        void addOverlappingPair(rpProxyShape* shape1, rpProxyShape* shape2);
+
+        /// Return true if the fat AABBs of two proxy shapes are overlapping
+        bool testOverlappingShapes(const rpProxyShape* shape1, const rpProxyShape* shape2) const;
+
+        /// Add a proxy shape into the local AABB tree of its compound body
+        void addCompoundProxyShape(rpProxyShape* proxyShape);
+
+        /// Remove a proxy shape from the local AABB tree of its compound body
+        void removeCompoundProxyShape(rpProxyShape* proxyShape);
+
 
     public :
 
@@ -140,14 +230,43 @@ class rpCollisionManager
         /// Ask for a collision shape to be tested again during broad-phase.
         void askForBroadPhaseCollisionCheck(rpProxyShape* shape);
 
+        /// Notify that the body has been put to sleep or woken up
+        void notifySleepingStateChanged(rpCollisionBody* body);
+
+        /// Forget the body (it is destroyed)
+        void removeSleepingStateChanged(rpCollisionBody* body);
+
 
         /// Delete all the contact points in the currently overlapping pairs
         void clearContactPoints();
 
+        /// Return true if the pairs whose shapes have barely moved keep their contacts
+        bool isTemporalCoherenceEnabled() const;
+
+        /// Enable or disable the reuse of the contacts of the pairs whose shapes have barely moved
+        void setIsTemporalCoherenceEnabled(bool isEnabled);
+
+        /// Set the relative motion under which a pair keeps its contacts
+        void setTemporalCoherenceTolerances(scalar linearTolerance, scalar angularTolerance);
+
+        /// Return the number of pairs of the last narrow-phase which kept their contacts
+        uint getNbTemporalCoherencePairs() const;
+
+        /// Return the begin and end of overlap events of the sensor shapes since they were cleared
+        const std::vector<rpSensorEvent>& getSensorEvents() const;
+
+        /// Remove the events of the sensor shapes , the narrow-phases add theirs after them
+        void clearSensorEvents();
+
         /// Ray casting method
         void raycast(RaycastCallback* raycastCallback, const Ray& ray,
                        unsigned short raycastWithCategoryMaskBits) const;
 
+        /// Report all the proxy shapes overlapping with the AABB (the swept AABB of the
+        /// shape for instance) that are allowed to collide with the proxy shape
+        void reportShapesOverlappingWithAABB(const rpProxyShape* shape, const rpAABB& aabb,
+                                             std::vector<rpProxyShape*>& overlappingShapes) const;
+
         // -------------------- Friendships -------------------- //
 
         friend class rpDynamicsWorld;
@@ -163,6 +282,48 @@ class rpCollisionManager
 
 
 
+// Return true if the pairs whose shapes have barely moved keep their contacts
+SIMD_INLINE bool rpCollisionManager::isTemporalCoherenceEnabled() const
+{
+    return mIsTemporalCoherenceEnabled;
+}
+
+// Enable or disable the reuse of the contacts of the pairs whose shapes have barely moved
+SIMD_INLINE void rpCollisionManager::setIsTemporalCoherenceEnabled(bool isEnabled)
+{
+    mIsTemporalCoherenceEnabled = isEnabled;
+}
+
+// Set the relative motion under which a pair keeps its contacts
+/**
+ * @param linearTolerance Distance (in meters) a shape can move relative to the other one
+ * @param angularTolerance Angle (in radians) a shape can turn relative to the other one
+ */
+SIMD_INLINE void rpCollisionManager::setTemporalCoherenceTolerances(scalar linearTolerance, scalar angularTolerance)
+{
+    assert(linearTolerance >= scalar(0.0) && angularTolerance >= scalar(0.0));
+    mTemporalCoherenceLinearTolerance = linearTolerance;
+    mTemporalCoherenceAngularTolerance = angularTolerance;
+}
+
+// Return the number of pairs of the last narrow-phase which kept their contacts
+SIMD_INLINE uint rpCollisionManager::getNbTemporalCoherencePairs() const
+{
+    return mNbTemporalCoherencePairs;
+}
+
+// Return the begin and end of overlap events of the sensor shapes since they were cleared
+SIMD_INLINE const std::vector<rpSensorEvent>& rpCollisionManager::getSensorEvents() const
+{
+    return mSensorEvents;
+}
+
+// Remove the events of the sensor shapes , the narrow-phases add theirs after them
+SIMD_INLINE void rpCollisionManager::clearSensorEvents()
+{
+    mSensorEvents.clear();
+}
+
 } /* namespace real_physics */
 
 #endif /* SOURCE_ENGIE_COLLISION_RPCOLLISIONMANAGER_H_ */
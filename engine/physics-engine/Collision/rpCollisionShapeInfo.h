@@ -45,13 +45,38 @@ struct rpCollisionShapeInfo
     /// Cached collision data of the proxy shape
     void** cachedCollisionData;
 
+    /// Matrix that maps from collision shape local-space to world-space
+    Matrix3x3 worldMatrix;
+
+    /// Translation from collision shape local-space to world-space
+    Vector3 worldPosition;
+
+    /// Matrix that maps the world-space directions into the collision shape local-space
+    Matrix3x3 inverseDirectionMatrix;
+
     /// Constructor
     rpCollisionShapeInfo(const rpCollisionShape* _CollisionShape,
                          const Transform& shapeLocalToWorldTransform,
                          void** cachedData)
         : collisionShape(_CollisionShape),
           shapeToWorldTransform(shapeLocalToWorldTransform) ,
-          cachedCollisionData(cachedData)
+          cachedCollisionData(cachedData) ,
+          worldMatrix(shapeLocalToWorldTransform.getBasis()) ,
+          worldPosition(shapeLocalToWorldTransform.getPosition()) ,
+          inverseDirectionMatrix(worldMatrix.getTranspose())
+    {
+
+
+    }
+
+    /// Constructor with the cached local-to-world matrices of a proxy shape
+    rpCollisionShapeInfo(rpProxyShape* proxyShape)
+        : collisionShape(proxyShape->getCollisionShape()),
+          shapeToWorldTransform(proxyShape->getWorldTransform()) ,
+          cachedCollisionData(proxyShape->getCachedCollisionData()) ,
+          worldMatrix(proxyShape->getCachedWorldMatrix()) ,
+          worldPosition(proxyShape->getCachedWorldPosition()) ,
+          inverseDirectionMatrix(proxyShape->getCachedInverseDirectionMatrix())
     {
 
 
@@ -65,6 +90,12 @@ struct rpCollisionShapeInfo
 
     }
 
+    // Return a world-space support point in a given world-space direction with the object margin
+    Vector3 getWorldSupportPointWithMargin(const Vector3 &direction ) const
+    {
+        return worldMatrix * collisionShape->getLocalSupportPointWithMarginn(inverseDirectionMatrix * direction) + worldPosition;
+    }
+
 
     const Transform& getWorldTransform() const
     {
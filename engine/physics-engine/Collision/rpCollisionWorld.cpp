@@ -75,6 +75,9 @@ void rpCollisionWorld::destroyCollisionBody(rpCollisionBody* collisionBody)
     // Add the body ID to the list of free IDs
     mFreeBodiesIDs.push_back(collisionBody->getID());
 
+    // Forget the sleeping state notifications of the body
+    mCollisionDetection.removeSleepingStateChanged(collisionBody);
+
     // Call the destructor of the collision body
    // collisionBody->~rpCollisionBody();
     delete collisionBody;
@@ -125,6 +128,12 @@ void rpCollisionWorld::UpdateCollision()
 
     resetContactManifoldListsOfBodies();
 
+    // Every update of the collision world is a single step
+    mCollisionDetection.clearSensorEvents();
+
+    // The collision world does not use the sleeping partitions
+    mCollisionDetection.mSleepingStateChangedBodies.clear();
+
 	/**/
 	for( auto itBodies = mBodies.begin(); itBodies != mBodies.end(); ++itBodies )
 	{
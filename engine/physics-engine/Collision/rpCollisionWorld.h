@@ -114,6 +114,24 @@ class rpCollisionWorld
         }
 
 
+        /// Return true if the pairs whose shapes have barely moved keep their contacts
+        bool isTemporalCoherenceEnabled() const;
+
+        /// Enable or disable the reuse of the contacts of the pairs whose shapes have barely
+        /// moved relative to each other since their contacts were computed
+        void setIsTemporalCoherenceEnabled(bool isEnabled);
+
+        /// Set the relative motion (in meters and radians) under which a pair keeps its contacts
+        void setTemporalCoherenceTolerances(scalar linearTolerance, scalar angularTolerance);
+
+        /// Return the number of pairs of the last step which kept their contacts
+        uint getNbTemporalCoherencePairs() const;
+
+        /// Return the events of the sensor shapes which have started or stopped
+        /// to overlap another shape during the last update of the world
+        const std::vector<rpSensorEvent>& getSensorEvents() const;
+
+
         //// Add Collision New contact Solver
         virtual void addChekCollisionPair( rpContactManifold* maniflod ) {}
 
@@ -129,6 +147,42 @@ class rpCollisionWorld
 
 
 
+// Return true if the pairs whose shapes have barely moved keep their contacts
+SIMD_INLINE bool rpCollisionWorld::isTemporalCoherenceEnabled() const
+{
+    return mCollisionDetection.isTemporalCoherenceEnabled();
+}
+
+// Enable or disable the reuse of the contacts of the pairs whose shapes have barely moved
+SIMD_INLINE void rpCollisionWorld::setIsTemporalCoherenceEnabled(bool isEnabled)
+{
+    mCollisionDetection.setIsTemporalCoherenceEnabled(isEnabled);
+}
+
+// Set the relative motion under which a pair keeps its contacts
+SIMD_INLINE void rpCollisionWorld::setTemporalCoherenceTolerances(scalar linearTolerance, scalar angularTolerance)
+{
+    mCollisionDetection.setTemporalCoherenceTolerances(linearTolerance, angularTolerance);
+}
+
+// Return the number of pairs of the last step which kept their contacts
+SIMD_INLINE uint rpCollisionWorld::getNbTemporalCoherencePairs() const
+{
+    return mCollisionDetection.getNbTemporalCoherencePairs();
+}
+
+// Return the events of the sensor shapes which have started or stopped to overlap during the last update
+/**
+ * The events of all the fixed steps of the last update() are kept together , in the order
+ * of the steps. They stay valid until the next update or until one of their shapes is removed
+ * @return The begin and end of overlap events , in the order of the overlapping pairs
+ */
+SIMD_INLINE const std::vector<rpSensorEvent>& rpCollisionWorld::getSensorEvents() const
+{
+    return mCollisionDetection.getSensorEvents();
+}
+
+
 // Return an iterator to the beginning of the bodies of the physics world
 /**
  * @return An starting iterator to the set of bodies of the world
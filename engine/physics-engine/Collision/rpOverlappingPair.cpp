@@ -15,9 +15,11 @@ namespace real_physics
 
 // Constructor
 rpOverlappingPair::rpOverlappingPair(rpProxyShape* shape1, rpProxyShape* shape2,  int nbMaxContactManifolds)
-: mShape1(shape1) ,mShape2(shape2) ,
+: mContactManifoldSet(shape1, shape2, nbMaxContactManifolds) ,
+  mShape1(shape1) ,mShape2(shape2) ,
   mCachedSeparatingAxis(1.0, 1.0, 1.0) ,
-  mContactManifoldSet(shape1, shape2, nbMaxContactManifolds)
+  mIsRelativeTransformCached(false) ,
+  mIsSensorOverlapping(false)
 {
 
 }
@@ -46,6 +48,45 @@ void rpOverlappingPair::clearContactPoints()
     mContactManifoldSet.clear();
 }
 
+// Store the relative transform of the shapes the contacts are computed with
+void rpOverlappingPair::cacheRelativeTransform()
+{
+    mCachedRelativeTransform = computeRelativeTransform();
+    mCachedOrientation1 = mShape1->getWorldTransform().getOrientation();
+    mIsRelativeTransformCached = true;
+}
+
+// Return true if the shapes have moved relative to each other by less than the tolerances
+/// The motion is measured from the relative transform of the last computation
+/// of the contacts , not of the last step , so that slow drifts add up. The world
+/// contact normals are not updated with the contact points , so two shapes turning
+/// together (a toppling stack , a box on a turning platform) also need new contacts :
+/// the first shape must not have turned in world-space more than the angular tolerance ,
+/// and with the small relative rotation the second shape has not turned much either
+/**
+ * @param linearTolerance Distance (in meters) the second shape can move in the space of the first one
+ * @param angularTolerance Angle (in radians) the second shape can turn in the space of the first one ,
+ *                         and the first shape in world-space
+ */
+bool rpOverlappingPair::isRelativeMotionSmall(scalar linearTolerance, scalar angularTolerance) const
+{
+    if (!mIsRelativeTransformCached) return false;
+
+    const Transform relativeTransform = computeRelativeTransform();
+
+    const Vector3 translation = relativeTransform.getPosition() - mCachedRelativeTransform.getPosition();
+    if (translation.lengthSquare() > linearTolerance * linearTolerance) return false;
+
+    // The angle between two orientations q1 and q2 is 2 * acos(|q1.q2|)
+    const scalar cosHalfTolerance = Cos(scalar(0.5) * angularTolerance);
+
+    const scalar cosHalfAngle = Abs(relativeTransform.getOrientation().dot(mCachedRelativeTransform.getOrientation()));
+    if (cosHalfAngle < cosHalfTolerance) return false;
+
+    const scalar cosHalfWorldAngle = Abs(mShape1->getWorldTransform().getOrientation().dot(mCachedOrientation1));
+    return cosHalfWorldAngle >= cosHalfTolerance;
+}
+
 
 
 } /* namespace real_physics */
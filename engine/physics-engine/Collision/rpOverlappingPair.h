@@ -24,6 +24,9 @@ namespace real_physics
 // Type for the overlapping pair ID
 typedef std::pair<uint, uint> overlappingpairid;
 
+// Type for the contact manifold ID (the overlapping pair ID and the index of the manifold in its set)
+typedef std::pair<overlappingpairid, int> contactmanifoldid;
+
 /**
  * This class represents a pair of two proxy collision shapes that are overlapping
  * during the broad-phase collision detection. It is created when
@@ -50,6 +53,20 @@ class rpOverlappingPair : public BlockAlloc<rpOverlappingPair>
         /// Cached previous separating axis
         Vector3 mCachedSeparatingAxis;
 
+        /// Transform of the second shape in the space of the first one when
+        /// the contacts of the pair were computed
+        Transform mCachedRelativeTransform;
+
+        /// World orientation of the first shape when the contacts of the pair were
+        /// computed (the contact normals are stored in world-space)
+        Quaternion mCachedOrientation1;
+
+        /// True if the contacts of the cached relative transform can be reused
+        bool mIsRelativeTransformCached;
+
+        /// True if the shapes of a pair with a sensor were overlapping at the last step
+        bool mIsSensorOverlapping;
+
         // -------------------- Methods -------------------- //
 
         /// Private copy-constructor
@@ -95,6 +112,25 @@ class rpOverlappingPair : public BlockAlloc<rpOverlappingPair>
 
 
 
+        /// Store the relative transform of the shapes the contacts are computed with
+        void cacheRelativeTransform();
+
+        /// Forget the cached relative transform (the pair has no contacts to reuse)
+        void resetCachedRelativeTransform();
+
+        /// Return true if the shapes have moved relative to each other , and turned
+        /// in world-space , by less than the tolerances since the relative transform was cached
+        bool isRelativeMotionSmall(scalar linearTolerance, scalar angularTolerance) const;
+
+        /// Return the transform of the second shape in the space of the first one
+        Transform computeRelativeTransform() const;
+
+        /// Return true if the shapes of a pair with a sensor were overlapping at the last step
+        bool isSensorOverlapping() const;
+
+        /// Return true if one of the shapes is a sensor
+        bool isSensorPair() const;
+
         /// Return the number of contacts in the cache
         int getNbContactManifolds() const;
 
@@ -127,6 +163,9 @@ class rpOverlappingPair : public BlockAlloc<rpOverlappingPair>
         static overlappingpairid computeID(rpProxyShape* shape1,
         		                           rpProxyShape* shape2);
 
+        /// Return the ID of a contact manifold of the pair
+        static contactmanifoldid computeManifoldID(const rpContactManifold* manifold);
+
         /// Return the pair of bodies index of the pair
         static bodyindexpair computeBodiesIndexPair( rpCollisionBody* body1,
         		                                     rpCollisionBody* body2);
@@ -168,6 +207,32 @@ SIMD_INLINE  void rpOverlappingPair::setCachedSeparatingAxis(const Vector3& axis
 
 
 
+// Forget the cached relative transform
+SIMD_INLINE void rpOverlappingPair::resetCachedRelativeTransform()
+{
+    mIsRelativeTransformCached = false;
+}
+
+// Return the transform of the second shape in the space of the first one
+SIMD_INLINE Transform rpOverlappingPair::computeRelativeTransform() const
+{
+    return mShape1->getWorldTransform().getInverse() * mShape2->getWorldTransform();
+}
+
+
+
+// Return true if the shapes of a pair with a sensor were overlapping at the last step
+SIMD_INLINE bool rpOverlappingPair::isSensorOverlapping() const
+{
+    return mIsSensorOverlapping;
+}
+
+// Return true if one of the shapes is a sensor
+SIMD_INLINE bool rpOverlappingPair::isSensorPair() const
+{
+    return mShape1->isSensor() || mShape2->isSensor();
+}
+
 SIMD_INLINE int rpOverlappingPair::getNbContactManifolds() const
 {
 	return mContactManifoldSet.getNbContactManifolds();
@@ -208,6 +273,15 @@ SIMD_INLINE   overlappingpairid rpOverlappingPair::computeID(rpProxyShape* shape
 	return pairID;
 }
 
+// Return the ID of a contact manifold of the pair
+/// A convex pair has a single manifold , the pairs with a concave shape
+/// have one manifold for each direction of their contact normals
+SIMD_INLINE contactmanifoldid rpOverlappingPair::computeManifoldID(const rpContactManifold* manifold)
+{
+    return std::make_pair(computeID(manifold->getShape1(), manifold->getShape2()),
+                          int(manifold->getManifoldIndex()));
+}
+
 
 
 
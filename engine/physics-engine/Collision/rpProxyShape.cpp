@@ -33,12 +33,14 @@ namespace real_physics
 	 mLocalToBodyTransform(transform), mMass(mass),
      mNext(NULL),
 	 mBroadPhaseID(-1),
+	 mCompoundNodeID(-1),
 	 mCachedCollisionData(NULL),
 	 mUserData(NULL),
      mCollisionCategoryBits(0x0001),
-	 mCollideWithMaskBits(0xFFFF)
+	 mCollideWithMaskBits(0xFFFF),
+	 mIsSensor(false)
   {
-
+      updateCachedWorldTransform();
   }
 
   // Destructor
@@ -51,12 +51,24 @@ namespace real_physics
           /// Broad-phase ID (node ID in the dynamic AABB tree)
           int               mBroadPhaseID;
 
+          /// Node ID in the local AABB tree of a compound body (-1 if the body is not compound)
+          int               mCompoundNodeID;
+
           /// Cached collision data
           void*             mCachedCollisionData;
 
           /// Pointer to user data
           void*             mUserData;
 
+          /// Cached local-to-world matrix (rotation and Lorentz boost of the body)
+          Matrix3x3         mCachedWorldMatrix;
+
+          /// Cached local-to-world translation
+          Vector3           mCachedWorldPosition;
+
+          /// Cached matrix that maps the world-space directions into the local-space of the shape
+          Matrix3x3         mCachedInverseDirectionMatrix;
+
 
 
 
@@ -73,6 +85,10 @@ namespace real_physics
           /// proxy shape will collide with every collision categories by default.
           unsigned short mCollideWithMaskBits;
 
+          /// True if the shape is a sensor : it only reports when it starts and stops
+          /// to overlap other shapes , it has no contacts and does not stop the bodies
+          bool mIsSensor;
+
 
 
 
@@ -93,17 +109,13 @@ namespace real_physics
 
           Vector3 getRelativisticTransformLorentzBoost( const Vector3& point ) const
           {
-        	  Vector3 temp = (getLocalToBodyTransform() * point);
-        	  temp = mBody->mRelativityMotion.getLorentzMatrix() * (mBody->mTransform.getBasis() * temp);
-        	  return (temp + mBody->mTransform.getPosition());
+        	  return mCachedWorldMatrix * point + mCachedWorldPosition;
           }
 
 
           Vector3 supportWorldTransformed(const Vector3 &direction ) const
           {
-        	  Matrix3x3 m = getWorldTransform().getBasis().getTranspose();
-
-        	  Vector3    antiRotDirect = m * direction;
+        	  Vector3    antiRotDirect = mCachedInverseDirectionMatrix * direction;
         	  Vector3         spVertex = mCollisionShape->getLocalSupportPointWithMarginn(antiRotDirect);
         	  return getRelativisticTransformLorentzBoost(  /*(getWorldTransform() */ spVertex );
           }
@@ -131,8 +143,7 @@ namespace real_physics
 
         	  const scalar OFF_SET_COLLISION_CONTACT = scalar(0.02);
 
-        	  Matrix3x3 InverseRotate = getWorldTransform().getBasis().getTranspose();
-        	  Vector3 axis = InverseRotate * xAxis;
+        	  Vector3 axis = mCachedInverseDirectionMatrix * xAxis;
 
         	  Vector3 n0, n1;
         	  Vector3::btPlaneSpace1(axis , n0 , n1 );
@@ -226,6 +237,18 @@ namespace real_physics
           /// Return the local to world transform
           const Transform getWorldTransform() const;
 
+          /// Update the cached local-to-world matrices from the transform and the Lorentz boost of the body
+          void updateCachedWorldTransform();
+
+          /// Return the cached local-to-world matrix (rotation and Lorentz boost)
+          const Matrix3x3& getCachedWorldMatrix() const;
+
+          /// Return the cached local-to-world translation
+          const Vector3& getCachedWorldPosition() const;
+
+          /// Return the cached matrix that maps the world-space directions into the local-space
+          const Matrix3x3& getCachedInverseDirectionMatrix() const;
+
 
           /// Return true if a point is inside the collision shape
           bool testPointInside(const Vector3& worldPoint);
@@ -246,6 +269,12 @@ namespace real_physics
           /// Set the collision category bits
           void setCollisionCategoryBits(unsigned short collisionCategoryBits);
 
+          /// Return true if the shape is a sensor
+          bool isSensor() const;
+
+          /// Make the shape a sensor (overlap events only) or a solid shape
+          void setIsSensor(bool isSensor);
+
           /// Return the next proxy shape in the linked list of proxy shapes
                 rpProxyShape* getNext();
 
@@ -261,6 +290,9 @@ namespace real_physics
           /// Set the local scaling vector of the collision shape
           virtual void setLocalScaling(const Vector3& scaling);
 
+          /// Return true if the proxy is the broad-phase entry of a compound body
+          bool isCompoundProxy() const;
+
 
 
 
@@ -352,6 +384,10 @@ namespace real_physics
   SIMD_INLINE void rpProxyShape::setLocalToBodyTransform(const Transform& transform)
   {
       mLocalToBodyTransform = transform;
+      updateCachedWorldTransform();
+
+      // The shape has moved in the local AABB tree of a compound body
+      if (mCompoundNodeID != -1) mBody->updateCompoundShapeAABB(this);
   }
 
 
@@ -367,6 +403,41 @@ namespace real_physics
   }
 
 
+  // Update the cached local-to-world matrices from the transform and the Lorentz boost of the body
+  /// The support queries of the collision detection use them instead of rebuilding the
+  /// basis of the body from its quaternion and applying the Lorentz boost for each point
+  SIMD_INLINE void rpProxyShape::updateCachedWorldTransform()
+  {
+	  const Matrix3x3 bodyBasis = mBody->mTransform.getBasis();
+	  const Matrix3x3 bodyBoostBasis = mBody->mRelativityMotion.isIdentityBoost() ? bodyBasis :
+			                           mBody->mRelativityMotion.getLorentzMatrix() * bodyBasis;
+
+	  mCachedWorldMatrix   = bodyBoostBasis * mLocalToBodyTransform.getBasis();
+	  mCachedWorldPosition = bodyBoostBasis * mLocalToBodyTransform.getPosition() + mBody->mTransform.getPosition();
+	  // The support point of the boosted shape in a direction d is the image of the local
+	  // support point in the direction (L*R)^T * d , the boost is part of the direction transform
+	  mCachedInverseDirectionMatrix = mCachedWorldMatrix.getTranspose();
+  }
+
+  // Return the cached local-to-world matrix (rotation and Lorentz boost)
+  SIMD_INLINE const Matrix3x3& rpProxyShape::getCachedWorldMatrix() const
+  {
+	  return mCachedWorldMatrix;
+  }
+
+  // Return the cached local-to-world translation
+  SIMD_INLINE const Vector3& rpProxyShape::getCachedWorldPosition() const
+  {
+	  return mCachedWorldPosition;
+  }
+
+  // Return the cached matrix that maps the world-space directions into the local-space
+  SIMD_INLINE const Matrix3x3& rpProxyShape::getCachedInverseDirectionMatrix() const
+  {
+	  return mCachedInverseDirectionMatrix;
+  }
+
+
 
   // Return the next proxy shape in the linked list of proxy shapes
   /**
@@ -422,6 +493,24 @@ namespace real_physics
       mCollideWithMaskBits = collideWithMaskBits;
   }
 
+  // Return true if the shape is a sensor
+  /**
+   * @return True if the shape only reports its overlaps with the other shapes
+   */
+  SIMD_INLINE bool rpProxyShape::isSensor() const
+  {
+      return mIsSensor;
+  }
+
+  // Make the shape a sensor (overlap events only) or a solid shape
+  /**
+   * @param isSensor True if the shape only reports its overlaps with the other shapes
+   */
+  SIMD_INLINE void rpProxyShape::setIsSensor(bool isSensor)
+  {
+      mIsSensor = isSensor;
+  }
+
   // Return the local scaling vector of the collision shape
   /**
    * @return The local scaling vector
@@ -442,6 +531,17 @@ namespace real_physics
 
       // Set the local scaling of the collision shape
       mCollisionShape->setLocalScaling(scaling);
+
+      // The shape has changed of size in the local AABB tree of a compound body
+      if (mCompoundNodeID != -1) mBody->updateCompoundShapeAABB(this);
+  }
+
+  // Return true if the proxy is the broad-phase entry of a compound body
+  /// This proxy shape has no collision shape , it stands for all the proxy
+  /// shapes of the body in the broad-phase
+  SIMD_INLINE bool rpProxyShape::isCompoundProxy() const
+  {
+      return mBody->mCompoundProxy == this;
   }
 
 } /* namespace real_physics */
@@ -0,0 +1,576 @@
+/*
+ * rpArticulation.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#include "rpArticulation.h"
+#include <map>
+
+namespace real_physics
+{
+
+
+// Block C(n x k) = A(n x m) * B(m x k) , the blocks are stored by rows
+static void multiplyBlock(const scalar* A , const scalar* B , scalar* C , uint n , uint m , uint k)
+{
+    for (uint i = 0; i < n; i++)
+    {
+        for (uint j = 0; j < k; j++)
+        {
+            scalar sum = 0;
+            for (uint l = 0; l < m; l++) sum += A[i*m + l] * B[l*k + j];
+            C[i*k + j] = sum;
+        }
+    }
+}
+
+// Block C(n x n) -= A^T * B , with A(m x n) and B(m x n)
+static void subtractTransposeProductBlock(const scalar* A , const scalar* B , scalar* C , uint n , uint m)
+{
+    for (uint i = 0; i < n; i++)
+    {
+        for (uint j = 0; j < n; j++)
+        {
+            scalar sum = 0;
+            for (uint l = 0; l < m; l++) sum += A[l*n + i] * B[l*n + j];
+            C[i*n + j] -= sum;
+        }
+    }
+}
+
+// Inverse of a block (n x n) by Gauss-Jordan elimination with partial pivoting ,
+// a singular direction is left to zero
+static void invertBlock(const scalar* A , scalar* inverse , uint n)
+{
+    scalar a[36];
+    for (uint i = 0; i < n*n; i++) a[i] = A[i];
+    for (uint i = 0; i < n; i++)
+    {
+        for (uint j = 0; j < n; j++) inverse[i*n + j] = (i == j) ? scalar(1.0) : scalar(0.0);
+    }
+
+    for (uint col = 0; col < n; col++)
+    {
+        uint pivot = col;
+        for (uint row = col + 1; row < n; row++)
+        {
+            if (Abs(a[row*n + col]) > Abs(a[pivot*n + col])) pivot = row;
+        }
+
+        if (Abs(a[pivot*n + col]) < MACHINE_EPSILON)
+        {
+            for (uint j = 0; j < n; j++) inverse[col*n + j] = scalar(0.0);
+            continue;
+        }
+
+        if (pivot != col)
+        {
+            for (uint j = 0; j < n; j++)
+            {
+                Swap(a[col*n + j] , a[pivot*n + j]);
+                Swap(inverse[col*n + j] , inverse[pivot*n + j]);
+            }
+        }
+
+        const scalar invPivot = scalar(1.0) / a[col*n + col];
+        for (uint j = 0; j < n; j++)
+        {
+            a[col*n + j] *= invPivot;
+            inverse[col*n + j] *= invPivot;
+        }
+
+        for (uint row = 0; row < n; row++)
+        {
+            if (row == col) continue;
+            const scalar factor = a[row*n + col];
+            if (factor == scalar(0.0)) continue;
+            for (uint j = 0; j < n; j++)
+            {
+                a[row*n + j] -= factor * a[col*n + j];
+                inverse[row*n + j] -= factor * inverse[col*n + j];
+            }
+        }
+    }
+}
+
+
+
+// Constructor
+rpArticulation::rpArticulation()
+ : mSolverBodies(NULL),
+   mIsDirty(true),
+   mIsInJointStore(false)
+{
+
+}
+
+// Destructor
+rpArticulation::~rpArticulation()
+{
+    for (uint i = 0; i < mJoints.size(); i++)
+    {
+        mJoints[i]->mArticulation = NULL;
+        mJoints[i]->mIsArticulated = false;
+    }
+}
+
+// Add a ball-and-socket joint into the articulation
+bool rpArticulation::addJoint(rpJoint* joint)
+{
+    if (joint->getType() != BALLSOCKETJOINT || joint->mArticulation != NULL) return false;
+
+    joint->mArticulation = this;
+    mJoints.push_back(joint);
+    mIsDirty = true;
+    return true;
+}
+
+// Remove a joint from the articulation
+void rpArticulation::removeJoint(rpJoint* joint)
+{
+    for (uint i = 0; i < mJoints.size(); i++)
+    {
+        if (mJoints[i] == joint)
+        {
+            mJoints.erase(mJoints.begin() + i);
+            joint->mArticulation = NULL;
+            joint->mIsArticulated = false;
+            mIsDirty = true;
+            return;
+        }
+    }
+}
+
+
+// Add a node into the tree
+int rpArticulation::addNode(bool isBody , uint index , int parent)
+{
+    Node node;
+    node.isBody = isBody;
+    node.index = index;
+    node.parent = parent;
+    node.firstChild = -1;
+    node.nextSibling = -1;
+    node.dim = (isBody) ? 6 : 3;
+
+    const int nodeIndex = mNodes.size();
+    if (parent >= 0)
+    {
+        node.nextSibling = mNodes[parent].firstChild;
+        mNodes[parent].firstChild = nodeIndex;
+    }
+
+    mNodes.push_back(node);
+    return nodeIndex;
+}
+
+// Build the tree of the nodes from the joints
+void rpArticulation::updateTopology()
+{
+    // A body that changed of type changes the tree
+    if (!mIsDirty)
+    {
+        for (uint i = 0; i < mBodies.size(); i++)
+        {
+            if (mBodies[i]->getType() != DYNAMIC) mIsDirty = true;
+        }
+
+        for (uint i = 0; i < mLinks.size(); i++)
+        {
+            if ((mLinks[i].bodyNode1 < 0 && mLinks[i].joint->mBody1->getType() == DYNAMIC) ||
+                (mLinks[i].bodyNode2 < 0 && mLinks[i].joint->mBody2->getType() == DYNAMIC))
+            {
+                mIsDirty = true;
+            }
+        }
+    }
+
+    if (!mIsDirty) return;
+    mIsDirty = false;
+
+    // Keep the impulses of the joints of the previous tree
+    storeImpulses();
+
+    mBodies.clear();
+    mLinks.clear();
+    mNodes.clear();
+
+    // Dynamic bodies of the joints and their joints
+    std::map<rpRigidPhysicsBody*, std::vector<uint> > bodyJoints;
+    for (uint i = 0; i < mJoints.size(); i++)
+    {
+        mJoints[i]->mIsArticulated = false;
+
+        if (mJoints[i]->mBody1->getType() == DYNAMIC)
+            bodyJoints[static_cast<rpRigidPhysicsBody*>(mJoints[i]->mBody1)].push_back(i);
+        if (mJoints[i]->mBody2->getType() == DYNAMIC)
+            bodyJoints[static_cast<rpRigidPhysicsBody*>(mJoints[i]->mBody2)].push_back(i);
+    }
+
+    std::map<rpRigidPhysicsBody*, int> bodyNodes;
+    std::vector<int> queue;
+
+    // The root is the first joint to a static body , or else the first body
+    int rootJoint = -1;
+    for (uint i = 0; i < mJoints.size() && rootJoint < 0; i++)
+    {
+        if ((mJoints[i]->mBody1->getType() == DYNAMIC) != (mJoints[i]->mBody2->getType() == DYNAMIC))
+        {
+            rootJoint = i;
+        }
+    }
+
+    rpRigidPhysicsBody* rootBody = NULL;
+    int rootParent = -1;
+    if (rootJoint >= 0)
+    {
+        rpJoint* joint = mJoints[rootJoint];
+        const bool isBody1Dynamic = (joint->mBody1->getType() == DYNAMIC);
+
+        Link link = Link();
+        link.joint = static_cast<rpBallAndSocketJoint*>(joint);
+        link.bodyNode1 = -1;
+        link.bodyNode2 = -1;
+        link.impulse = link.joint->mImpulse;
+        mLinks.push_back(link);
+        joint->mIsArticulated = true;
+
+        rootParent = addNode(false , mLinks.size() - 1 , -1);
+        rootBody = static_cast<rpRigidPhysicsBody*>((isBody1Dynamic) ? joint->mBody1 : joint->mBody2);
+    }
+    else
+    {
+        for (uint i = 0; i < mJoints.size() && rootBody == NULL; i++)
+        {
+            if (mJoints[i]->mBody1->getType() == DYNAMIC) rootBody = static_cast<rpRigidPhysicsBody*>(mJoints[i]->mBody1);
+        }
+    }
+
+    if (rootBody == NULL) return;
+
+    mBodies.push_back(rootBody);
+    const int rootNode = addNode(true , mBodies.size() - 1 , rootParent);
+    bodyNodes[rootBody] = rootNode;
+    queue.push_back(rootNode);
+
+    if (rootParent >= 0)
+    {
+        Link& link = mLinks[mNodes[rootParent].index];
+        if (link.joint->mBody1 == rootBody) link.bodyNode1 = rootNode;
+        else                                link.bodyNode2 = rootNode;
+    }
+
+    // Breadth-first traversal of the joints from the root , a parent
+    // node is always stored before its children
+    std::vector<bool> isVisited(mJoints.size() , false);
+    if (rootJoint >= 0) isVisited[rootJoint] = true;
+
+    for (uint q = 0; q < queue.size(); q++)
+    {
+        const int bodyNode = queue[q];
+        rpRigidPhysicsBody* body = mBodies[mNodes[bodyNode].index];
+        const std::vector<uint>& joints = bodyJoints[body];
+
+        for (uint i = 0; i < joints.size(); i++)
+        {
+            if (isVisited[joints[i]]) continue;
+            isVisited[joints[i]] = true;
+
+            rpJoint* joint = mJoints[joints[i]];
+            const bool isBody1 = (joint->mBody1 == body);
+            rpRigidPhysicsBody* other = static_cast<rpRigidPhysicsBody*>((isBody1) ? joint->mBody2 : joint->mBody1);
+
+            // A loop or a second joint to a static body stays iterative
+            if (other->getType() != DYNAMIC || bodyNodes.count(other) > 0) continue;
+
+            Link link = Link();
+            link.joint = static_cast<rpBallAndSocketJoint*>(joint);
+            link.bodyNode1 = -1;
+            link.bodyNode2 = -1;
+            link.impulse = link.joint->mImpulse;
+            mLinks.push_back(link);
+            joint->mIsArticulated = true;
+
+            const int linkNode = addNode(false , mLinks.size() - 1 , bodyNode);
+
+            mBodies.push_back(other);
+            const int otherNode = addNode(true , mBodies.size() - 1 , linkNode);
+            bodyNodes[other] = otherNode;
+            queue.push_back(otherNode);
+
+            Link& newLink = mLinks.back();
+            newLink.bodyNode1 = (isBody1) ? bodyNode : otherNode;
+            newLink.bodyNode2 = (isBody1) ? otherNode : bodyNode;
+        }
+    }
+}
+
+
+// Return the block of the system between a node and its parent
+void rpArticulation::computeParentBlock(int nodeIndex , scalar* block) const
+{
+    const Node& node = mNodes[nodeIndex];
+
+    // The block links a joint node with a body node : J (3 x 6) or J^T (6 x 3)
+    const uint linkIndex = (node.isBody) ? mNodes[node.parent].index : node.index;
+    const int  bodyNode  = (node.isBody) ? nodeIndex : node.parent;
+    const Link& link = mLinks[linkIndex];
+
+    // Velocity of the anchor point : J = [-I , [r1]x] for the body 1 and [I , -[r2]x] for the body 2
+    const bool isBody1 = (link.bodyNode1 == bodyNode);
+    const Vector3& r = (isBody1) ? link.r1World : link.r2World;
+    const scalar sign = (isBody1) ? scalar(-1.0) : scalar(1.0);
+
+    const scalar J[18] = { sign , 0 , 0 ,      0 ,  sign*r.z , -sign*r.y ,
+                           0 , sign , 0 , -sign*r.z ,      0 ,  sign*r.x ,
+                           0 , 0 , sign ,  sign*r.y , -sign*r.x ,      0 };
+
+    if (node.isBody)
+    {
+        for (uint i = 0; i < 6; i++)
+        {
+            for (uint j = 0; j < 3; j++) block[i*3 + j] = J[j*6 + i];
+        }
+    }
+    else
+    {
+        for (uint i = 0; i < 18; i++) block[i] = J[i];
+    }
+}
+
+// Factorize the system
+void rpArticulation::factorize()
+{
+    scalar H[36];
+    scalar temp[36];
+
+    // The children are stored after their parent : eliminate from the leaves to the root
+    for (int i = int(mNodes.size()) - 1; i >= 0; --i)
+    {
+        Node& node = mNodes[i];
+        const uint n = node.dim;
+
+        // D = H_ii - sum( L_c^T D_c L_c )
+        for (int c = node.firstChild; c >= 0; c = mNodes[c].nextSibling)
+        {
+            const Node& child = mNodes[c];
+            multiplyBlock(child.D , child.L , temp , child.dim , child.dim , n);
+            subtractTransposeProductBlock(child.L , temp , node.D , n , child.dim);
+        }
+
+        invertBlock(node.D , node.DInverse , n);
+
+        // L = D^-1 H_ip
+        if (node.parent >= 0)
+        {
+            computeParentBlock(i , H);
+            multiplyBlock(node.DInverse , H , node.L , n , n , mNodes[node.parent].dim);
+        }
+    }
+}
+
+// Solve the system with the right-hand sides of the joint nodes
+void rpArticulation::solve()
+{
+    // Forward substitution from the leaves to the root
+    for (int i = int(mNodes.size()) - 1; i >= 0; --i)
+    {
+        Node& node = mNodes[i];
+        const uint n = node.dim;
+
+        for (int c = node.firstChild; c >= 0; c = mNodes[c].nextSibling)
+        {
+            const Node& child = mNodes[c];
+            for (uint j = 0; j < n; j++)
+            {
+                scalar sum = 0;
+                for (uint l = 0; l < child.dim; l++) sum += child.L[l*n + j] * child.x[l];
+                node.x[j] -= sum;
+            }
+        }
+
+        multiplyBlock(node.DInverse , node.x , node.z , n , n , 1);
+    }
+
+    // Back substitution from the root to the leaves
+    for (uint i = 0; i < mNodes.size(); i++)
+    {
+        Node& node = mNodes[i];
+        const uint n = node.dim;
+
+        for (uint j = 0; j < n; j++) node.x[j] = node.z[j];
+
+        if (node.parent >= 0)
+        {
+            const Node& parent = mNodes[node.parent];
+            for (uint j = 0; j < n; j++)
+            {
+                scalar sum = 0;
+                for (uint l = 0; l < parent.dim; l++) sum += node.L[j*parent.dim + l] * parent.x[l];
+                node.x[j] -= sum;
+            }
+        }
+    }
+}
+
+
+// Compute the factorization of the step
+void rpArticulation::initBeforeSolve(scalar timeStep , rpSolverBody* solverBodies)
+{
+    mSolverBodies = solverBodies;
+
+    const scalar biasFactor = rpBallAndSocketJoint::BETA / timeStep;
+
+    for (uint i = 0; i < mLinks.size(); i++)
+    {
+        Link& link = mLinks[i];
+        const Transform& transform1 = link.joint->mBody1->getTransform();
+        const Transform& transform2 = link.joint->mBody2->getTransform();
+
+        link.indexBody1 = link.joint->mIndexBody1;
+        link.indexBody2 = link.joint->mIndexBody2;
+        link.r1World = transform1.getOrientation() * link.joint->mLocalAnchorPointBody1;
+        link.r2World = transform2.getOrientation() * link.joint->mLocalAnchorPointBody2;
+
+        // The articulation is always stabilized by a velocity bias : a nonlinear
+        // correction of the whole tree at once overshoots when the errors are large
+        link.bias = biasFactor * (transform2.getPosition() + link.r2World -
+                                  transform1.getPosition() - link.r1World);
+    }
+
+    // Diagonal blocks : the mass matrix of the bodies and zero for the joints
+    for (uint i = 0; i < mNodes.size(); i++)
+    {
+        Node& node = mNodes[i];
+        for (uint j = 0; j < 36; j++) node.D[j] = scalar(0.0);
+
+        if (node.isBody)
+        {
+            const rpSolverBody& body = mSolverBodies[mBodies[node.index]->mSolverBodyIndex];
+            const scalar mass = scalar(1.0) / body.massInverse;
+            const Matrix3x3 inertia = body.inverseInertiaTensorWorld.getInverse();
+
+            for (uint j = 0; j < 3; j++)
+            {
+                node.D[j*6 + j] = mass;
+                for (uint k = 0; k < 3; k++) node.D[(j+3)*6 + (k+3)] = inertia[j][k];
+            }
+        }
+    }
+
+    factorize();
+}
+
+// Apply the previous impulses
+void rpArticulation::warmstart()
+{
+    for (uint i = 0; i < mLinks.size(); i++)
+    {
+        const Link& link = mLinks[i];
+        rpSolverBody& body1 = mSolverBodies[link.indexBody1];
+        rpSolverBody& body2 = mSolverBodies[link.indexBody2];
+
+        body1.applyImpulseLinear(-link.impulse);
+        body1.applyImpulseAngular(link.impulse.cross(link.r1World));
+
+        body2.applyImpulseLinear(link.impulse);
+        body2.applyImpulseAngular(-link.impulse.cross(link.r2World));
+    }
+}
+
+// Solve all the joints of the tree for the velocities
+void rpArticulation::solveVelocityConstraint()
+{
+    for (uint i = 0; i < mNodes.size(); i++)
+    {
+        Node& node = mNodes[i];
+        if (node.isBody)
+        {
+            for (uint j = 0; j < 6; j++) node.x[j] = scalar(0.0);
+        }
+        else
+        {
+            const Link& link = mLinks[node.index];
+            const rpSolverBody& body1 = mSolverBodies[link.indexBody1];
+            const rpSolverBody& body2 = mSolverBodies[link.indexBody2];
+
+            // Right-hand side -(J*v + b)
+            const Vector3 Jv = body2.linearVelocity + body2.angularVelocity.cross(link.r2World) -
+                               body1.linearVelocity - body1.angularVelocity.cross(link.r1World);
+            const Vector3 rhs = -Jv - link.bias;
+            node.x[0] = rhs.x;
+            node.x[1] = rhs.y;
+            node.x[2] = rhs.z;
+        }
+    }
+
+    solve();
+
+    // The solution is the change of velocity of the bodies and minus the impulses of the joints
+    for (uint i = 0; i < mNodes.size(); i++)
+    {
+        const Node& node = mNodes[i];
+        if (node.isBody)
+        {
+            rpSolverBody& body = mSolverBodies[mBodies[node.index]->mSolverBodyIndex];
+            body.linearVelocity  += Vector3(node.x[0], node.x[1], node.x[2]);
+            body.angularVelocity += Vector3(node.x[3], node.x[4], node.x[5]);
+        }
+        else
+        {
+            mLinks[node.index].impulse -= Vector3(node.x[0], node.x[1], node.x[2]);
+        }
+    }
+}
+
+// Solve all the joints of the tree for the split velocities
+void rpArticulation::solvePositionConstraint()
+{
+    // Remove the split velocities of the contacts along the joints
+    for (uint i = 0; i < mNodes.size(); i++)
+    {
+        Node& node = mNodes[i];
+        if (node.isBody)
+        {
+            for (uint j = 0; j < 6; j++) node.x[j] = scalar(0.0);
+        }
+        else
+        {
+            const Link& link = mLinks[node.index];
+            const rpSolverBody& body1 = mSolverBodies[link.indexBody1];
+            const rpSolverBody& body2 = mSolverBodies[link.indexBody2];
+
+            const Vector3 Jv = body2.splitLinearVelocity + body2.splitAngularVelocity.cross(link.r2World) -
+                               body1.splitLinearVelocity - body1.splitAngularVelocity.cross(link.r1World);
+            node.x[0] = -Jv.x;
+            node.x[1] = -Jv.y;
+            node.x[2] = -Jv.z;
+        }
+    }
+
+    solve();
+
+    for (uint i = 0; i < mNodes.size(); i++)
+    {
+        const Node& node = mNodes[i];
+        if (!node.isBody) continue;
+
+        rpSolverBody& body = mSolverBodies[mBodies[node.index]->mSolverBodyIndex];
+        body.splitLinearVelocity  += Vector3(node.x[0], node.x[1], node.x[2]);
+        body.splitAngularVelocity += Vector3(node.x[3], node.x[4], node.x[5]);
+    }
+}
+
+// Give the accumulated impulses back to the joints
+void rpArticulation::storeImpulses()
+{
+    for (uint i = 0; i < mLinks.size(); i++)
+    {
+        mLinks[i].joint->mImpulse = mLinks[i].impulse;
+    }
+}
+
+
+} /* namespace real_physics */
@@ -0,0 +1,210 @@
+/*
+ * rpArticulation.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SOURCE_ENGIE_KINEMATICPHYSICS_CONSTRAINT_RPARTICULATION_H_
+#define SOURCE_ENGIE_KINEMATICPHYSICS_CONSTRAINT_RPARTICULATION_H_
+
+// Libraries
+#include "rpJoint.h"
+#include "rpBallAndSocketJoint.h"
+#include "../Solver/rpSolverBody.h"
+#include <vector>
+
+namespace real_physics
+{
+
+
+/**********************************************
+ *  Articulation : a tree of ball-and-socket joints solved
+ *  exactly in linear time.
+ *
+ *  The bodies and the joints of the tree are the nodes of the
+ *  sparse system  [ M  J^T ; J  0 ] , which keeps the tree
+ *  structure of the articulation. Its LDL^T factorization
+ *  (Baraff , "Linear-time dynamics using Lagrange multipliers")
+ *  eliminates the nodes from the leaves to the root without
+ *  fill-in , so one exact solve of all the joints costs O(n).
+ *
+ *  The factorization is computed once per step with the solver
+ *  bodies of the island. Each velocity iteration of the island
+ *  solves the whole tree , so the contacts of the island are
+ *  coupled to the articulation by the iterations of the island.
+ *  The position error of the joints is corrected by a Baumgarte
+ *  velocity bias , whatever the technique of the joints.
+ *
+ *  A joint that closes a loop , a second joint to a static body
+ *  or a joint of a second tree is solved by the iterative joint
+ *  solver. The types of the bodies must be set before the joints
+ *  are added.
+ **********************************************/
+class rpArticulation
+{
+
+    private:
+
+        /// Joint of the tree
+        struct Link
+        {
+            /// Handle of the joint
+            rpBallAndSocketJoint* joint;
+
+            /// Body nodes of the joint (-1 for a static or kinematic body)
+            int bodyNode1;
+            int bodyNode2;
+
+            /// Indexes of the bodies in the solver bodies of the island
+            uint indexBody1;
+            uint indexBody2;
+
+            /// Vectors from the centers of the bodies to the anchor point in world-space
+            Vector3 r1World;
+            Vector3 r2World;
+
+            /// Bias velocity of the constraint (Baumgarte)
+            Vector3 bias;
+
+            /// Accumulated impulse
+            Vector3 impulse;
+        };
+
+        /// Node of the system : a body (6 rows) or a joint (3 rows)
+        struct Node
+        {
+            bool isBody;
+
+            /// Index in the array of bodies or of links
+            uint index;
+
+            /// Parent node (-1 for the root) and the children list
+            int parent;
+            int firstChild;
+            int nextSibling;
+
+            /// Number of rows of the node
+            uint dim;
+
+            /// Diagonal block D , its inverse and the block L to the parent
+            scalar D[36];
+            scalar DInverse[36];
+            scalar L[36];
+
+            /// Right-hand side and solution of the node
+            scalar x[6];
+            scalar z[6];
+        };
+
+
+        //-------------------- Attributes -----------------//
+
+        /// All the joints of the articulation
+        std::vector<rpJoint*> mJoints;
+
+        /// Dynamic bodies of the tree
+        std::vector<rpRigidPhysicsBody*> mBodies;
+
+        /// Joints of the tree
+        std::vector<Link> mLinks;
+
+        /// Nodes of the tree , a parent is always stored before its children
+        std::vector<Node> mNodes;
+
+        /// Solver bodies of the island
+        rpSolverBody* mSolverBodies;
+
+        /// True when the tree must be built again
+        bool mIsDirty;
+
+        /// True while the articulation is in the joint store of its island ,
+        /// its tree is updated once per step by the first of its joints
+        bool mIsInJointStore;
+
+
+        //-------------------- Methods -------------------//
+
+        /// Private copy-constructor
+        rpArticulation(const rpArticulation& articulation);
+
+        /// Private assignment operator
+        rpArticulation& operator=(const rpArticulation& articulation);
+
+
+        /// Build the tree of the nodes from the joints
+        void updateTopology();
+
+        /// Add a node into the tree
+        int addNode(bool isBody , uint index , int parent);
+
+        /// Return the block of the system between a node and its parent
+        void computeParentBlock(int nodeIndex , scalar* block) const;
+
+        /// Factorize the system
+        void factorize();
+
+        /// Solve the system with the right-hand sides of the joint nodes
+        void solve();
+
+
+        /// Compute the factorization of the step
+        void initBeforeSolve(scalar timeStep , rpSolverBody* solverBodies);
+
+        /// Apply the previous impulses
+        void warmstart();
+
+        /// Solve all the joints of the tree for the velocities
+        void solveVelocityConstraint();
+
+        /// Solve all the joints of the tree for the split velocities
+        void solvePositionConstraint();
+
+        /// Give the accumulated impulses back to the joints
+        void storeImpulses();
+
+    public:
+
+        //-------------------- Methods --------------------//
+
+        /// Constructor
+        rpArticulation();
+
+        /// Destructor
+        ~rpArticulation();
+
+        /// Add a ball-and-socket joint into the articulation
+        bool addJoint(rpJoint* joint);
+
+        /// Remove a joint from the articulation
+        void removeJoint(rpJoint* joint);
+
+        /// Return the number of joints of the articulation
+        uint getNbJoints() const;
+
+        /// Return the number of joints solved by the tree (the others are iterative)
+        uint getNbLinks();
+
+
+        //-------------------- Friendship --------------------//
+        friend class rpJointStore;
+};
+
+
+// Return the number of joints of the articulation
+SIMD_INLINE uint rpArticulation::getNbJoints() const
+{
+    return mJoints.size();
+}
+
+// Return the number of joints solved by the tree (the others are iterative)
+SIMD_INLINE uint rpArticulation::getNbLinks()
+{
+    updateTopology();
+    return mLinks.size();
+}
+
+
+} /* namespace real_physics */
+
+#endif /* SOURCE_ENGIE_KINEMATICPHYSICS_CONSTRAINT_RPARTICULATION_H_ */
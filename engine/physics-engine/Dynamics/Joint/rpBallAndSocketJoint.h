@@ -63,9 +63,6 @@ class rpBallAndSocketJoint : public rpJoint
 	    bool isSplitActive;
 	    bool isWarmStartingActive = true;
 
-	    rpRigidPhysicsBody *Body1;
-	    rpRigidPhysicsBody *Body2;
-
         // -------------------- Constants -------------------- //
 
         // Beta value for the bias factor of position correction
@@ -79,26 +76,6 @@ class rpBallAndSocketJoint : public rpJoint
         /// Anchor point of body 2 (in local-space coordinates of body 2)
         Vector3 mLocalAnchorPointBody2;
 
-        /// Vector from center of body 2 to anchor point in world-space
-        Vector3 mR1World;
-
-        /// Vector from center of body 2 to anchor point in world-space
-        Vector3 mR2World;
-
-        /// Inertia tensor of body 1 (in world-space coordinates)
-        Matrix3x3 mI1;
-
-        /// Inertia tensor of body 2 (in world-space coordinates)
-        Matrix3x3 mI2;
-
-        /// Bias vector for the constraint
-        Vector3 mBiasVector;
-
-
-
-        /// Inverse mass matrix K=JM^-1J^-t of the constraint
-        Matrix3x3 mInverseMassMatrix;
-
         /// Accumulated impulse
         Vector3 mImpulse;
 
@@ -113,18 +90,6 @@ class rpBallAndSocketJoint : public rpJoint
         /// Return the number of bytes used by the joint
         virtual size_t getSizeInBytes() const;
 
-        /// Initialize before solving the constraint
-        virtual void initBeforeSolve( scalar timeStep );
-
-        /// Warm start the constraint (apply the previous impulse at the beginning of the step)
-        virtual void warmstart();
-
-        /// Solve the velocity constraint
-        virtual void solveVelocityConstraint();
-
-        /// Solve the position constraint (for position error correction)
-        virtual void solvePositionConstraint();
-
     public :
 
         // -------------------- Methods -------------------- //
@@ -134,6 +99,10 @@ class rpBallAndSocketJoint : public rpJoint
 
         /// Destructor
         virtual ~rpBallAndSocketJoint();
+
+        // -------------------- Friendship -------------------- //
+        friend class rpJointStore;
+        friend class rpArticulation;
 };
 
 
@@ -44,32 +44,10 @@ class rpDistanceJoint : public rpJoint
 
 	private:
 
-		enum DistanceBehavior
-		{
-			LimitDistance, LimitMaximumDistance, LimitMinimumDistance,
-		}behavior;
-
-
-		Vector3 jacobian[4];
-
-		Vector3 mR1World;
-		Vector3 mR2World;
-
 		scalar  mDistance;
 
-
-		scalar  mBias;
-		scalar  mLength;
-
 		scalar  mAccumulatedImpulse;
 
-		scalar softnessOverDt;
-		scalar mEffectiveMass;
-
-
-		rpRigidPhysicsBody *Body1;
-		rpRigidPhysicsBody *Body2;
-
   public:
 
     rpDistanceJoint(const rpDistanceJointInfo& jointInfo) :
@@ -81,29 +59,15 @@ class rpDistanceJoint : public rpJoint
 
 
         mAccumulatedImpulse = 0.0f;
-        mLength = scalar(0);
-        mBias = scalar(0);
 
 
         this->biasFactor = 0.02f;
         this->softness = 0.0001f;
 
-        Body1 = static_cast<rpRigidPhysicsBody*>(mBody1);
-        Body2 = static_cast<rpRigidPhysicsBody*>(mBody2);
-
 
     }
 
 
-    void initBeforeSolve( scalar timeStep );
-
-    void warmstart();
-
-    void solveVelocityConstraint();
-
-    void solvePositionConstraint();
-
-
     /// Return the number of bytes used by the joint
     virtual size_t getSizeInBytes() const
     {
@@ -111,8 +75,8 @@ class rpDistanceJoint : public rpJoint
     }
 
 
-
-
+        // -------------------- Friendship -------------------- //
+        friend class rpJointStore;
 };
 
 } /* namespace real_physics */
@@ -58,8 +58,6 @@ class rpFixedJoint : public rpJoint
       bool isSplitActive = true;
 	  bool isWarmStartingActive = true;
 
-	  rpRigidPhysicsBody *Body1;
-	  rpRigidPhysicsBody *Body2;
         // -------------------- Constants -------------------- //
 
         // Beta value for the bias factor of position correction
@@ -73,36 +71,12 @@ class rpFixedJoint : public rpJoint
         /// Anchor point of body 2 (in local-space coordinates of body 2)
         Vector3 mLocalAnchorPointBody2;
 
-        /// Vector from center of body 2 to anchor point in world-space
-        Vector3 mR1World;
-
-        /// Vector from center of body 2 to anchor point in world-space
-        Vector3 mR2World;
-
-        /// Inertia tensor of body 1 (in world-space coordinates)
-        Matrix3x3 mI1;
-
-        /// Inertia tensor of body 2 (in world-space coordinates)
-        Matrix3x3 mI2;
-
         /// Accumulated impulse for the 3 translation constraints
         Vector3 mImpulseTranslation;
 
         /// Accumulate impulse for the 3 rotation constraints
         Vector3 mImpulseRotation;
 
-        /// Inverse mass matrix K=JM^-1J^-t of the 3 translation constraints (3x3 matrix)
-        Matrix3x3 mInverseMassMatrixTranslation;
-
-        /// Inverse mass matrix K=JM^-1J^-t of the 3 rotation constraints (3x3 matrix)
-        Matrix3x3 mInverseMassMatrixRotation;
-
-        /// Bias vector for the 3 translation constraints
-        Vector3 mBiasTranslation;
-
-        /// Bias vector for the 3 rotation constraints
-        Vector3 mBiasRotation;
-
         /// Inverse of the initial orientation difference between the two bodies
         Quaternion mInitOrientationDifferenceInv;
 
@@ -117,18 +91,6 @@ class rpFixedJoint : public rpJoint
         /// Return the number of bytes used by the joint
         virtual size_t getSizeInBytes() const;
 
-        /// Initialize before solving the constraint
-        virtual void initBeforeSolve( scalar timeStep  );
-
-        /// Warm start the constraint (apply the previous impulse at the beginning of the step)
-        virtual void warmstart();
-
-        /// Solve the velocity constraint
-        virtual void solveVelocityConstraint();
-
-        /// Solve the position constraint (for position error correction)
-        virtual void solvePositionConstraint();
-
     public :
 
         // -------------------- Methods -------------------- //
@@ -138,6 +100,9 @@ class rpFixedJoint : public rpJoint
 
         /// Destructor
         virtual ~rpFixedJoint();
+
+        // -------------------- Friendship -------------------- //
+        friend class rpJointStore;
 };
 
 // Return the number of bytes used by the joint
@@ -244,8 +244,8 @@ void rpHingeJoint::warmstart()
     // Apply the impulse to the body 1
       //v1 += inverseMassBody1 * linearImpulseBody1;
       //w1 += mI1 * angularImpulseBody1;
-    Body1->applyImpulseLinear(linearImpulseBody1);
-    Body1->applyImpulseAngular(angularImpulseBody1);
+    mSolverBodies[mIndexBody1].applyImpulseLinear(linearImpulseBody1);
+    mSolverBodies[mIndexBody1].applyImpulseAngular(angularImpulseBody1);
 
 
     // Compute the impulse P=J^T * lambda for the 3 translation constraints of body 2
@@ -264,8 +264,8 @@ void rpHingeJoint::warmstart()
     // Apply the impulse to the body 2
        //v2 += inverseMassBody2 * mImpulseTranslation;
        //w2 += mI2 * angularImpulseBody2;
-    Body2->applyImpulseLinear(linearImpulseBody2);
-    Body2->applyImpulseAngular(angularImpulseBody2);
+    mSolverBodies[mIndexBody2].applyImpulseLinear(linearImpulseBody2);
+    mSolverBodies[mIndexBody2].applyImpulseAngular(angularImpulseBody2);
 
    /**/
 }
@@ -276,10 +276,10 @@ void rpHingeJoint::solveVelocityConstraint()
 
     /**/
 	// Get the velocities
-	const Vector3& v1 = Body1->mLinearVelocity;
-	const Vector3& v2 = Body2->mLinearVelocity;
-          Vector3& w1 = Body1->mAngularVelocity;
-          Vector3& w2 = Body2->mAngularVelocity;
+	const Vector3& v1 = mSolverBodies[mIndexBody1].linearVelocity;
+	const Vector3& v2 = mSolverBodies[mIndexBody2].linearVelocity;
+          Vector3& w1 = mSolverBodies[mIndexBody1].angularVelocity;
+          Vector3& w2 = mSolverBodies[mIndexBody2].angularVelocity;
 
 
     // Get the inverse mass and inverse inertia tensors of the bodies
@@ -305,8 +305,8 @@ void rpHingeJoint::solveVelocityConstraint()
     // Apply the impulse to the body 1
       //v1 += inverseMassBody1 * linearImpulseBody1;
       //w1 += mI1 * angularImpulseBody1;
-    Body1->applyImpulseLinear(linearImpulseBody1);
-    Body1->applyImpulseAngular(angularImpulseBody1);
+    mSolverBodies[mIndexBody1].applyImpulseLinear(linearImpulseBody1);
+    mSolverBodies[mIndexBody1].applyImpulseAngular(angularImpulseBody1);
 
     // Compute the impulse P=J^T * lambda of body 2
     const Vector3 linearImpulseBody2 = deltaLambdaTranslation;
@@ -315,8 +315,8 @@ void rpHingeJoint::solveVelocityConstraint()
     // Apply the impulse to the body 2
       //v2 += inverseMassBody2 * deltaLambdaTranslation;
       //w2 += mI2 * angularImpulseBody2;
-    Body2->applyImpulseLinear(linearImpulseBody2);
-    Body2->applyImpulseAngular(angularImpulseBody2);
+    mSolverBodies[mIndexBody2].applyImpulseLinear(linearImpulseBody2);
+    mSolverBodies[mIndexBody2].applyImpulseAngular(angularImpulseBody2);
 
     // --------------- Rotation Constraints --------------- //
 
@@ -334,7 +334,7 @@ void rpHingeJoint::solveVelocityConstraint()
 
     // Apply the impulse to the body 1
     //w1 += mI1 * angularImpulseBody1;
-    Body1->applyImpulseAngular(angularImpulseBody1);
+    mSolverBodies[mIndexBody1].applyImpulseAngular(angularImpulseBody1);
 
     // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 2
     angularImpulseBody2 = mB2CrossA1 * deltaLambdaRotation.x +
@@ -342,7 +342,7 @@ void rpHingeJoint::solveVelocityConstraint()
 
     // Apply the impulse to the body 2
     //w2 += mI2 * angularImpulseBody2;
-    Body2->applyImpulseAngular(angularImpulseBody2);
+    mSolverBodies[mIndexBody2].applyImpulseAngular(angularImpulseBody2);
 
 
     /**/
@@ -369,14 +369,14 @@ void rpHingeJoint::solveVelocityConstraint()
     		const Vector3 angularImpulseBody1 = -deltaLambdaLower * mA1;
     		// Apply the impulse to the body 1
     		//w1 += mI1 * angularImpulseBody1;
-    		Body1->applyImpulseAngular(angularImpulseBody1);
+    		mSolverBodies[mIndexBody1].applyImpulseAngular(angularImpulseBody1);
 
 
     		// Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
     		const Vector3 angularImpulseBody2 = deltaLambdaLower * mA1;
     		// Apply the impulse to the body 2
     		//w2 += mI2 * angularImpulseBody2;
-    		Body2->applyImpulseAngular(angularImpulseBody2);
+    		mSolverBodies[mIndexBody2].applyImpulseAngular(angularImpulseBody2);
     	}
 
     	// If the upper limit is violated
@@ -396,14 +396,14 @@ void rpHingeJoint::solveVelocityConstraint()
     		const Vector3 angularImpulseBody1 = deltaLambdaUpper * mA1;
     		// Apply the impulse to the body 1
     		// w1 += mI1 * angularImpulseBody1;
-    		Body1->applyImpulseAngular(angularImpulseBody1);
+    		mSolverBodies[mIndexBody1].applyImpulseAngular(angularImpulseBody1);
 
 
     		// Compute the impulse P=J^T * lambda for the upper limit constraint of body 2
     		const Vector3 angularImpulseBody2 = -deltaLambdaUpper * mA1;
     		// Apply the impulse to the body 2
     		// w2 += mI2 * angularImpulseBody2;
-    		Body2->applyImpulseAngular(angularImpulseBody2);
+    		mSolverBodies[mIndexBody2].applyImpulseAngular(angularImpulseBody2);
     	}
     }
 
@@ -429,13 +429,13 @@ void rpHingeJoint::solveVelocityConstraint()
     	const Vector3 angularImpulseBody1 = -deltaLambdaMotor * mA1;
     	// Apply the impulse to the body 1
     	// w1 += mI1 * angularImpulseBody1;
-    	Body1->applyImpulseAngular(angularImpulseBody1);
+    	mSolverBodies[mIndexBody1].applyImpulseAngular(angularImpulseBody1);
 
     	// Compute the impulse P=J^T * lambda for the motor of body 2
     	const Vector3 angularImpulseBody2 = deltaLambdaMotor * mA1;
     	// Apply the impulse to the body 2
     	//w2 += mI2 * angularImpulseBody2;
-    	Body2->applyImpulseAngular(angularImpulseBody2);
+    	mSolverBodies[mIndexBody2].applyImpulseAngular(angularImpulseBody2);
 
 
 
@@ -526,11 +526,11 @@ void rpHingeJoint::solvePositionConstraint()
     if( isSplitActive )
     {
 
-        Vector3 v1p = Body1->mSplitLinearVelocity;
-        Vector3 w1p = Body1->mSplitAngularVelocity;
+        Vector3 v1p = mSolverBodies[mIndexBody1].splitLinearVelocity;
+        Vector3 w1p = mSolverBodies[mIndexBody1].splitAngularVelocity;
 
-        Vector3 v2p = Body2->mSplitLinearVelocity;
-        Vector3 w2p = Body2->mSplitAngularVelocity;
+        Vector3 v2p = mSolverBodies[mIndexBody2].splitLinearVelocity;
+        Vector3 w2p = mSolverBodies[mIndexBody2].splitAngularVelocity;
 
         // --------------- Translation Constraints --------------- //
 
@@ -550,8 +550,8 @@ void rpHingeJoint::solvePositionConstraint()
         // Apply the impulse to the body 1
         //v1p += inverseMassBody1 * linearImpulseBody1;
         //w1p += mI1 * angularImpulseBody1;
-        Body1->applySplitImpulseLinear(linearImpulseBody1);
-        Body1->applySplitImpulseAngular(angularImpulseBody1);
+        mSolverBodies[mIndexBody1].applySplitImpulseLinear(linearImpulseBody1);
+        mSolverBodies[mIndexBody1].applySplitImpulseAngular(angularImpulseBody1);
 
         // Compute the impulse P=J^T * lambda of body 2
         const Vector3 linearImpulseBody2 = deltaLambdaTranslation;
@@ -560,8 +560,8 @@ void rpHingeJoint::solvePositionConstraint()
         // Apply the impulse to the body 2
         //v2p += inverseMassBody2 * deltaLambdaTranslation;
         //w2p += mI2 * angularImpulseBody2;
-        Body2->applySplitImpulseLinear(linearImpulseBody2);
-        Body2->applySplitImpulseAngular(angularImpulseBody2);
+        mSolverBodies[mIndexBody2].applySplitImpulseLinear(linearImpulseBody2);
+        mSolverBodies[mIndexBody2].applySplitImpulseAngular(angularImpulseBody2);
 
 
 
@@ -588,11 +588,11 @@ void rpHingeJoint::solvePositionConstraint()
 
         // Apply the impulse to the body 1
         //w1p += mI1 * angularImpulseBody1;
-        Body1->applySplitImpulseAngular(angularImpulseBody1);
+        mSolverBodies[mIndexBody1].applySplitImpulseAngular(angularImpulseBody1);
 
         // Apply the impulse to the body 2
         //w2p += mI2 * angularImpulseBody2;
-        Body2->applySplitImpulseAngular(angularImpulseBody2);
+        mSolverBodies[mIndexBody2].applySplitImpulseAngular(angularImpulseBody2);
 
     }
     /**/
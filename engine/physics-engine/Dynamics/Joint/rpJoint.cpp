@@ -15,9 +15,13 @@ namespace real_physics
 rpJoint::rpJoint(const rpJointInfo& jointInfo)
     :mBody1(jointInfo.body1), mBody2(jointInfo.body2),
 			mType(jointInfo.type),
+			mIndexBody1(0), mIndexBody2(0),
+			mSolverBodies(NULL),
             mPositionCorrectionTechnique(jointInfo.positionCorrectionTechnique),
             mIsCollisionEnabled(jointInfo.isCollisionEnabled),
-			mIsAlreadyInIsland(false)
+			mIsAlreadyInIsland(false),
+			mArticulation(NULL),
+			mIsArticulated(false)
 {
 
     assert(mBody1 != NULL);
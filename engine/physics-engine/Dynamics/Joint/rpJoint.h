@@ -12,6 +12,7 @@
 
 #include "../../Body/rpPhysicsBody.h"
 #include "../../Body/rpRigidPhysicsBody.h"
+#include "../Solver/rpSolverBody.h"
 
 namespace real_physics
 {
@@ -29,6 +30,7 @@ enum JointType { BALLSOCKETJOINT,
 // Class declarations
 struct ConstraintSolverData;
 class  rpJoint;
+class  rpArticulation;
 
 
 struct rpJointInfo
@@ -107,6 +109,9 @@ class rpJoint
         /// Body 2 index in the velocity array to solve the constraint
         uint mIndexBody2;
 
+        /// Solver bodies of the island of the rpJoint (velocity array)
+        rpSolverBody* mSolverBodies;
+
         /// Position correction technique used for the constraint (used for joints)
         JointsPositionCorrectionTechnique mPositionCorrectionTechnique;
 
@@ -116,6 +121,12 @@ class rpJoint
         /// True if the rpJoint has already been added into an island
         bool mIsAlreadyInIsland;
 
+        /// Articulation of the rpJoint (NULL if the rpJoint is solved alone)
+        rpArticulation* mArticulation;
+
+        /// True if the articulation solves the rpJoint exactly (joint of its tree)
+        bool mIsArticulated;
+
 
         /****************************/
         scalar biasFactor;
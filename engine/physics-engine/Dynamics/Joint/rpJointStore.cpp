@@ -0,0 +1,686 @@
+/*
+ * rpJointStore.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#include "rpJointStore.h"
+
+namespace real_physics
+{
+
+
+// Constructor
+rpJointStore::rpJointStore()
+ : mSolverBodies(NULL)
+{
+
+}
+
+// Remove all the joints
+void rpJointStore::clear()
+{
+    mBallAndSocketJoints.clear();
+    mFixedJoints.clear();
+    mDistanceJoints.clear();
+    mOtherJoints.clear();
+
+    for (uint i = 0; i < mArticulations.size(); i++)
+    {
+        mArticulations[i]->mIsInJointStore = false;
+    }
+    mArticulations.clear();
+}
+
+// Copy a joint into the batch of its type (the body indexes must be set)
+void rpJointStore::addJoint(rpJoint* joint)
+{
+    // The joints of the tree of an articulation are solved together
+    if (joint->mArticulation != NULL)
+    {
+        rpArticulation* articulation = joint->mArticulation;
+
+        // The first joint of the articulation updates its tree for the step
+        if (!articulation->mIsInJointStore)
+        {
+            articulation->mIsInJointStore = true;
+            articulation->updateTopology();
+            mArticulations.push_back(articulation);
+        }
+
+        if (joint->mIsArticulated) return;
+    }
+
+    const bool isDynamic = (joint->mBody1->getType() == DYNAMIC ||
+                            joint->mBody2->getType() == DYNAMIC);
+
+    switch (joint->mType)
+    {
+        case BALLSOCKETJOINT:
+        {
+            rpBallAndSocketJoint* ballJoint = static_cast<rpBallAndSocketJoint*>(joint);
+
+            rpBallAndSocketJointData data;
+            data.joint = ballJoint;
+            data.indexBody1 = joint->mIndexBody1;
+            data.indexBody2 = joint->mIndexBody2;
+            data.localAnchorPointBody1 = ballJoint->mLocalAnchorPointBody1;
+            data.localAnchorPointBody2 = ballJoint->mLocalAnchorPointBody2;
+            data.impulse = ballJoint->mImpulse;
+            data.softness = ballJoint->softness;
+            data.isBaumgarte = (joint->mPositionCorrectionTechnique == BAUMGARTE_JOINTS);
+            data.isNonLinearGaussSeidel = (joint->mPositionCorrectionTechnique == NON_LINEAR_GAUSS_SEIDEL);
+            data.isWarmStartingActive = ballJoint->isWarmStartingActive;
+            data.isSplitActive = ballJoint->isSplitActive;
+            data.isDynamic = isDynamic;
+            mBallAndSocketJoints.push_back(data);
+            break;
+        }
+
+        case FIXEDJOINT:
+        {
+            rpFixedJoint* fixedJoint = static_cast<rpFixedJoint*>(joint);
+
+            rpFixedJointData data;
+            data.joint = fixedJoint;
+            data.indexBody1 = joint->mIndexBody1;
+            data.indexBody2 = joint->mIndexBody2;
+            data.localAnchorPointBody1 = fixedJoint->mLocalAnchorPointBody1;
+            data.localAnchorPointBody2 = fixedJoint->mLocalAnchorPointBody2;
+            data.impulseTranslation = fixedJoint->mImpulseTranslation;
+            data.impulseRotation = fixedJoint->mImpulseRotation;
+            data.initOrientationDifferenceInv = fixedJoint->mInitOrientationDifferenceInv;
+            data.isBaumgarte = (joint->mPositionCorrectionTechnique == BAUMGARTE_JOINTS);
+            data.isNonLinearGaussSeidel = (joint->mPositionCorrectionTechnique == NON_LINEAR_GAUSS_SEIDEL);
+            data.isWarmStartingActive = fixedJoint->isWarmStartingActive;
+            data.isDynamic = isDynamic;
+            mFixedJoints.push_back(data);
+            break;
+        }
+
+        case DISTANCEJOINT:
+        {
+            rpDistanceJoint* distanceJoint = static_cast<rpDistanceJoint*>(joint);
+
+            rpDistanceJointData data = rpDistanceJointData();
+            data.joint = distanceJoint;
+            data.indexBody1 = joint->mIndexBody1;
+            data.indexBody2 = joint->mIndexBody2;
+            data.distance = distanceJoint->mDistance;
+            data.biasFactor = distanceJoint->biasFactor;
+            data.softness = distanceJoint->softness;
+            data.accumulatedImpulse = distanceJoint->mAccumulatedImpulse;
+            data.isBaumgarte = (joint->mPositionCorrectionTechnique == BAUMGARTE_JOINTS);
+            mDistanceJoints.push_back(data);
+            break;
+        }
+
+        default:
+        {
+            mOtherJoints.push_back(joint);
+            break;
+        }
+    }
+}
+
+
+// Initialize the joints and apply their previous impulses
+void rpJointStore::warmStart(scalar timeStep)
+{
+    for (uint i = 0; i < mArticulations.size(); i++)
+    {
+        mArticulations[i]->initBeforeSolve(timeStep , mSolverBodies);
+        mArticulations[i]->warmstart();
+    }
+
+    initBallAndSocketJoints(timeStep);
+    initFixedJoints(timeStep);
+    initDistanceJoints();
+
+    warmstartBallAndSocketJoints();
+    warmstartFixedJoints();
+    warmstartDistanceJoints();
+
+    for (uint i = 0; i < mOtherJoints.size(); i++)
+    {
+        mOtherJoints[i]->initBeforeSolve(timeStep);
+        mOtherJoints[i]->warmstart();
+    }
+}
+
+// Solve the velocity constraints of all the joints
+void rpJointStore::solveVelocityConstraint()
+{
+    for (uint i = 0; i < mArticulations.size(); i++)
+    {
+        mArticulations[i]->solveVelocityConstraint();
+    }
+
+    solveVelocityBallAndSocketJoints();
+    solveVelocityFixedJoints();
+    solveVelocityDistanceJoints();
+
+    for (uint i = 0; i < mOtherJoints.size(); i++)
+    {
+        mOtherJoints[i]->solveVelocityConstraint();
+    }
+}
+
+// Solve the position constraints of all the joints
+void rpJointStore::solvePositionConstraint()
+{
+    for (uint i = 0; i < mArticulations.size(); i++)
+    {
+        mArticulations[i]->solvePositionConstraint();
+    }
+
+    solvePositionBallAndSocketJoints();
+    solvePositionFixedJoints();
+    solvePositionDistanceJoints();
+
+    for (uint i = 0; i < mOtherJoints.size(); i++)
+    {
+        mOtherJoints[i]->solvePositionConstraint();
+    }
+}
+
+// Give the accumulated impulses back to the joints
+void rpJointStore::storeImpulses()
+{
+    // The step of the articulations is over , the next one updates their tree again
+    for (uint i = 0; i < mArticulations.size(); i++)
+    {
+        mArticulations[i]->storeImpulses();
+        mArticulations[i]->mIsInJointStore = false;
+    }
+
+    for (uint i = 0; i < mBallAndSocketJoints.size(); i++)
+    {
+        mBallAndSocketJoints[i].joint->mImpulse = mBallAndSocketJoints[i].impulse;
+    }
+
+    for (uint i = 0; i < mFixedJoints.size(); i++)
+    {
+        mFixedJoints[i].joint->mImpulseTranslation = mFixedJoints[i].impulseTranslation;
+        mFixedJoints[i].joint->mImpulseRotation    = mFixedJoints[i].impulseRotation;
+    }
+
+    for (uint i = 0; i < mDistanceJoints.size(); i++)
+    {
+        mDistanceJoints[i].joint->mAccumulatedImpulse = mDistanceJoints[i].accumulatedImpulse;
+    }
+}
+
+
+//------------------------------ Ball-and-socket joints ------------------------------//
+
+void rpJointStore::initBallAndSocketJoints(scalar timeStep)
+{
+    const scalar biasFactor = rpBallAndSocketJoint::BETA / timeStep;
+
+    for (uint i = 0; i < mBallAndSocketJoints.size(); i++)
+    {
+        rpBallAndSocketJointData& joint = mBallAndSocketJoints[i];
+        const rpSolverBody& body1 = mSolverBodies[joint.indexBody1];
+        const rpSolverBody& body2 = mSolverBodies[joint.indexBody2];
+
+        const Transform& transform1 = body1.body->getTransform();
+        const Transform& transform2 = body2.body->getTransform();
+
+        // Compute the vector from body center to the anchor point in world-space
+        joint.r1World = transform1.getOrientation() * joint.localAnchorPointBody1;
+        joint.r2World = transform2.getOrientation() * joint.localAnchorPointBody2;
+
+        // Compute the corresponding skew-symmetric matrices
+        Matrix3x3 skewSymmetricMatrixU1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(joint.r1World);
+        Matrix3x3 skewSymmetricMatrixU2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(joint.r2World);
+
+        // Compute the matrix K=JM^-1J^t (3x3 matrix) , the solver bodies
+        // already hold the inverse inertia tensors in world-space
+        scalar inverseMassBodies = body1.massInverse + body2.massInverse;
+        Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
+                                         0, inverseMassBodies, 0,
+                                         0, 0, inverseMassBodies) +
+                               skewSymmetricMatrixU1 * body1.inverseInertiaTensorWorld * skewSymmetricMatrixU1.getTranspose() +
+                               skewSymmetricMatrixU2 * body2.inverseInertiaTensorWorld * skewSymmetricMatrixU2.getTranspose();
+
+        // Compute the inverse mass matrix K^-1
+        joint.inverseMassMatrix.setToZero();
+        if (joint.isDynamic)
+        {
+            joint.inverseMassMatrix = massMatrix.getInverse();
+        }
+
+        // Compute the bias "b" of the constraint
+        joint.biasVector.setToZero();
+        if (joint.isBaumgarte)
+        {
+            joint.biasVector = biasFactor * (transform2.getPosition() + joint.r2World -
+                                             transform1.getPosition() - joint.r1World);
+        }
+
+        // If warm-starting is not enabled
+        if (!joint.isWarmStartingActive)
+        {
+            joint.impulse.setToZero();
+        }
+    }
+}
+
+void rpJointStore::warmstartBallAndSocketJoints()
+{
+    for (uint i = 0; i < mBallAndSocketJoints.size(); i++)
+    {
+        const rpBallAndSocketJointData& joint = mBallAndSocketJoints[i];
+        rpSolverBody& body1 = mSolverBodies[joint.indexBody1];
+        rpSolverBody& body2 = mSolverBodies[joint.indexBody2];
+
+        // Apply the impulse P=J^T * lambda to the bodies
+        body1.applyImpulseLinear(-joint.impulse);
+        body1.applyImpulseAngular(joint.impulse.cross(joint.r1World));
+
+        body2.applyImpulseLinear(joint.impulse);
+        body2.applyImpulseAngular(-joint.impulse.cross(joint.r2World));
+    }
+}
+
+void rpJointStore::solveVelocityBallAndSocketJoints()
+{
+    for (uint i = 0; i < mBallAndSocketJoints.size(); i++)
+    {
+        rpBallAndSocketJointData& joint = mBallAndSocketJoints[i];
+        rpSolverBody& body1 = mSolverBodies[joint.indexBody1];
+        rpSolverBody& body2 = mSolverBodies[joint.indexBody2];
+
+        // Compute J*v
+        const Vector3 Jv = body2.linearVelocity + body2.angularVelocity.cross(joint.r2World) -
+                           body1.linearVelocity - body1.angularVelocity.cross(joint.r1World);
+
+        // Compute the Lagrange multiplier lambda
+        const Vector3 deltaLambda = joint.inverseMassMatrix * (-Jv - joint.biasVector);
+
+        joint.impulse += (deltaLambda - (deltaLambda.getUnit() * joint.impulse.length() * joint.softness));
+
+        // Apply the impulse P=J^T * lambda to the bodies
+        body1.applyImpulseLinear(-deltaLambda);
+        body1.applyImpulseAngular(deltaLambda.cross(joint.r1World));
+
+        body2.applyImpulseLinear(deltaLambda);
+        body2.applyImpulseAngular(-deltaLambda.cross(joint.r2World));
+    }
+}
+
+void rpJointStore::solvePositionBallAndSocketJoints()
+{
+    for (uint i = 0; i < mBallAndSocketJoints.size(); i++)
+    {
+        rpBallAndSocketJointData& joint = mBallAndSocketJoints[i];
+        if (!joint.isNonLinearGaussSeidel) continue;
+
+        rpSolverBody& body1 = mSolverBodies[joint.indexBody1];
+        rpSolverBody& body2 = mSolverBodies[joint.indexBody2];
+
+        const Transform& transform1 = body1.body->getTransform();
+        const Transform& transform2 = body2.body->getTransform();
+
+        // The position correction moves the bodies , recompute the inverse inertia tensors
+        const Matrix3x3 I1 = body1.body->getInertiaTensorInverseWorld();
+        const Matrix3x3 I2 = body2.body->getInertiaTensorInverseWorld();
+
+        // Compute the vector from body center to the anchor point in world-space
+        joint.r1World = transform1.getOrientation() * joint.localAnchorPointBody1;
+        joint.r2World = transform2.getOrientation() * joint.localAnchorPointBody2;
+
+        // Compute the corresponding skew-symmetric matrices
+        Matrix3x3 skewSymmetricMatrixU1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(joint.r1World);
+        Matrix3x3 skewSymmetricMatrixU2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(joint.r2World);
+
+        // Recompute the inverse mass matrix K=J^TM^-1J of of the 3 translation constraints
+        scalar inverseMassBodies = body1.massInverse + body2.massInverse;
+        Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
+                                         0, inverseMassBodies, 0,
+                                         0, 0, inverseMassBodies) +
+                               skewSymmetricMatrixU1 * I1 * skewSymmetricMatrixU1.getTranspose() +
+                               skewSymmetricMatrixU2 * I2 * skewSymmetricMatrixU2.getTranspose();
+
+        joint.inverseMassMatrix.setToZero();
+        if (joint.isDynamic)
+        {
+            joint.inverseMassMatrix = massMatrix.getInverse();
+        }
+
+        if (joint.isSplitActive)
+        {
+            // Compute J*v of the split velocities
+            const Vector3 Jv = body2.splitLinearVelocity + body2.splitAngularVelocity.cross(joint.r2World) -
+                               body1.splitLinearVelocity - body1.splitAngularVelocity.cross(joint.r1World);
+
+            const Vector3 lambda = joint.inverseMassMatrix * (-Jv);
+
+            body1.applySplitImpulseLinear(-lambda);
+            body1.applySplitImpulseAngular(lambda.cross(joint.r1World));
+
+            body2.applySplitImpulseLinear(lambda);
+            body2.applySplitImpulseAngular(-lambda.cross(joint.r2World));
+        }
+
+        // Compute the constraint error (value of the C(x) function)
+        Vector3 constraintError = (transform2.getPosition() + joint.r2World -
+                                   transform1.getPosition() - joint.r1World);
+
+        // Relaxation offset damping to the constraint error
+        scalar dampingRelaxation = 0.0008;
+        if (constraintError.length() > dampingRelaxation)
+        {
+            constraintError -= (constraintError.getUnit() * scalar(1.0 - dampingRelaxation));
+        }
+        else
+        {
+            constraintError = Vector3::ZERO;
+        }
+
+        // Compute the Lagrange multiplier lambda
+        const Vector3 lambda = joint.inverseMassMatrix * (-constraintError);
+
+        // Compute the pseudo velocities of the bodies
+        const Vector3 v1 = body1.massInverse * -lambda;
+        const Vector3 w1 = I1 * lambda.cross(joint.r1World);
+        const Vector3 v2 = body2.massInverse * lambda;
+        const Vector3 w2 = I2 * -lambda.cross(joint.r2World);
+
+        // Update the body center of mass and orientation
+        body1.body->setWorldTransform(TransformUtil::integrateTransform(transform1 , v1 , w1 , 1.0));
+        body2.body->setWorldTransform(TransformUtil::integrateTransform(transform2 , v2 , w2 , 1.0));
+    }
+}
+
+
+//------------------------------ Fixed joints ------------------------------//
+
+void rpJointStore::initFixedJoints(scalar timeStep)
+{
+    const scalar biasFactor = rpFixedJoint::BETA / timeStep;
+
+    for (uint i = 0; i < mFixedJoints.size(); i++)
+    {
+        rpFixedJointData& joint = mFixedJoints[i];
+        const rpSolverBody& body1 = mSolverBodies[joint.indexBody1];
+        const rpSolverBody& body2 = mSolverBodies[joint.indexBody2];
+
+        const Vector3& x1 = body1.body->mCenterOfMassWorld;
+        const Vector3& x2 = body2.body->mCenterOfMassWorld;
+        const Quaternion& orientationBody1 = body1.body->getTransform().getOrientation();
+        const Quaternion& orientationBody2 = body2.body->getTransform().getOrientation();
+
+        // Compute the vector from body center to the anchor point in world-space
+        joint.r1World = orientationBody1 * joint.localAnchorPointBody1;
+        joint.r2World = orientationBody2 * joint.localAnchorPointBody2;
+
+        // Compute the corresponding skew-symmetric matrices
+        Matrix3x3 skewSymmetricMatrixU1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(joint.r1World);
+        Matrix3x3 skewSymmetricMatrixU2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(joint.r2World);
+
+        // Compute the matrix K=JM^-1J^t (3x3 matrix) for the 3 translation constraints
+        scalar inverseMassBodies = body1.massInverse + body2.massInverse;
+        Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
+                                         0, inverseMassBodies, 0,
+                                         0, 0, inverseMassBodies) +
+                               skewSymmetricMatrixU1 * body1.inverseInertiaTensorWorld * skewSymmetricMatrixU1.getTranspose() +
+                               skewSymmetricMatrixU2 * body2.inverseInertiaTensorWorld * skewSymmetricMatrixU2.getTranspose();
+
+        joint.inverseMassMatrixTranslation.setToZero();
+        if (joint.isDynamic)
+        {
+            joint.inverseMassMatrixTranslation = massMatrix.getInverse();
+        }
+
+        // Compute the bias "b" of the constraint for the 3 translation constraints
+        joint.biasTranslation.setToZero();
+        if (joint.isBaumgarte)
+        {
+            joint.biasTranslation = biasFactor * (x2 + joint.r2World -
+                                                  x1 - joint.r1World);
+        }
+
+        // Compute the inverse of the mass matrix K=JM^-1J^t for the 3 rotation constraints
+        joint.inverseMassMatrixRotation = body1.inverseInertiaTensorWorld + body2.inverseInertiaTensorWorld;
+        if (joint.isDynamic)
+        {
+            joint.inverseMassMatrixRotation = joint.inverseMassMatrixRotation.getInverse();
+        }
+
+        // Compute the bias "b" for the 3 rotation constraints
+        joint.biasRotation.setToZero();
+        if (joint.isBaumgarte)
+        {
+            Quaternion currentOrientationDifference = orientationBody2 * orientationBody1.getInverse();
+            currentOrientationDifference.normalize();
+            const Quaternion qError = currentOrientationDifference * joint.initOrientationDifferenceInv;
+            joint.biasRotation = biasFactor * scalar(2.0) * qError.getVectorV();
+        }
+
+        // If warm-starting is not enabled
+        if (!joint.isWarmStartingActive)
+        {
+            joint.impulseTranslation.setToZero();
+            joint.impulseRotation.setToZero();
+        }
+    }
+}
+
+void rpJointStore::warmstartFixedJoints()
+{
+    for (uint i = 0; i < mFixedJoints.size(); i++)
+    {
+        const rpFixedJointData& joint = mFixedJoints[i];
+        rpSolverBody& body1 = mSolverBodies[joint.indexBody1];
+        rpSolverBody& body2 = mSolverBodies[joint.indexBody2];
+
+        // Apply the impulse P=J^T * lambda of the translation and the rotation constraints
+        body1.applyImpulseLinear(-joint.impulseTranslation);
+        body1.applyImpulseAngular(joint.impulseTranslation.cross(joint.r1World) - joint.impulseRotation);
+
+        body2.applyImpulseLinear(joint.impulseTranslation);
+        body2.applyImpulseAngular(-joint.impulseTranslation.cross(joint.r2World) + joint.impulseRotation);
+    }
+}
+
+void rpJointStore::solveVelocityFixedJoints()
+{
+    for (uint i = 0; i < mFixedJoints.size(); i++)
+    {
+        rpFixedJointData& joint = mFixedJoints[i];
+        rpSolverBody& body1 = mSolverBodies[joint.indexBody1];
+        rpSolverBody& body2 = mSolverBodies[joint.indexBody2];
+
+        // --------------- Translation Constraints --------------- //
+
+        const Vector3 JvTranslation = body2.linearVelocity + body2.angularVelocity.cross(joint.r2World) -
+                                      body1.linearVelocity - body1.angularVelocity.cross(joint.r1World);
+
+        const Vector3 deltaLambda = joint.inverseMassMatrixTranslation * (-JvTranslation - joint.biasTranslation);
+        joint.impulseTranslation += deltaLambda;
+
+        body1.applyImpulseLinear(-deltaLambda);
+        body1.applyImpulseAngular(deltaLambda.cross(joint.r1World));
+
+        body2.applyImpulseLinear(deltaLambda);
+        body2.applyImpulseAngular(-deltaLambda.cross(joint.r2World));
+
+        // --------------- Rotation Constraints --------------- //
+
+        const Vector3 JvRotation = body2.angularVelocity - body1.angularVelocity;
+
+        const Vector3 deltaLambda2 = joint.inverseMassMatrixRotation * (-JvRotation - joint.biasRotation);
+        joint.impulseRotation += deltaLambda2;
+
+        body1.applyImpulseAngular(-deltaLambda2);
+        body2.applyImpulseAngular(deltaLambda2);
+    }
+}
+
+void rpJointStore::solvePositionFixedJoints()
+{
+    for (uint i = 0; i < mFixedJoints.size(); i++)
+    {
+        rpFixedJointData& joint = mFixedJoints[i];
+        if (!joint.isNonLinearGaussSeidel) continue;
+
+        const rpSolverBody& body1 = mSolverBodies[joint.indexBody1];
+        const rpSolverBody& body2 = mSolverBodies[joint.indexBody2];
+
+        Vector3    x1 = body1.body->getTransform().getPosition();
+        Vector3    x2 = body2.body->getTransform().getPosition();
+        Quaternion q1 = body1.body->getTransform().getOrientation();
+        Quaternion q2 = body2.body->getTransform().getOrientation();
+
+        // The position correction moves the bodies , recompute the inverse inertia tensors
+        const Matrix3x3 I1 = body1.body->getInertiaTensorInverseWorld();
+        const Matrix3x3 I2 = body2.body->getInertiaTensorInverseWorld();
+
+        // Compute the vector from body center to the anchor point in world-space
+        joint.r1World = q1 * joint.localAnchorPointBody1;
+        joint.r2World = q2 * joint.localAnchorPointBody2;
+
+        // Compute the corresponding skew-symmetric matrices
+        Matrix3x3 skewSymmetricMatrixU1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(joint.r1World);
+        Matrix3x3 skewSymmetricMatrixU2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(joint.r2World);
+
+        // --------------- Translation Constraints --------------- //
+
+        scalar inverseMassBodies = body1.massInverse + body2.massInverse;
+        Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
+                                         0, inverseMassBodies, 0,
+                                         0, 0, inverseMassBodies) +
+                               skewSymmetricMatrixU1 * I1 * skewSymmetricMatrixU1.getTranspose() +
+                               skewSymmetricMatrixU2 * I2 * skewSymmetricMatrixU2.getTranspose();
+        joint.inverseMassMatrixTranslation.setToZero();
+        if (joint.isDynamic)
+        {
+            joint.inverseMassMatrixTranslation = massMatrix.getInverse();
+        }
+
+        // Compute the Lagrange multiplier lambda of the position error
+        const Vector3 errorTranslation = x2 + joint.r2World - x1 - joint.r1World;
+        const Vector3 lambdaTranslation = joint.inverseMassMatrixTranslation * (-errorTranslation);
+
+        // Update the body position/orientation of body 1
+        Vector3 w1 = I1 * lambdaTranslation.cross(joint.r1World);
+        x1 += body1.massInverse * -lambdaTranslation;
+        q1 += Quaternion(0, w1) * q1 * scalar(0.5);
+        q1.normalize();
+
+        // Update the body position/orientation of body 2
+        Vector3 w2 = I2 * -lambdaTranslation.cross(joint.r2World);
+        x2 += body2.massInverse * lambdaTranslation;
+        q2 += Quaternion(0, w2) * q2 * scalar(0.5);
+        q2.normalize();
+
+        // --------------- Rotation Constraints --------------- //
+
+        joint.inverseMassMatrixRotation = I1 + I2;
+        if (joint.isDynamic)
+        {
+            joint.inverseMassMatrixRotation = joint.inverseMassMatrixRotation.getInverse();
+        }
+
+        // Compute the position error for the 3 rotation constraints
+        Quaternion currentOrientationDifference = q2 * q1.getInverse();
+        currentOrientationDifference.normalize();
+        const Quaternion qError = currentOrientationDifference * joint.initOrientationDifferenceInv;
+        const Vector3 errorRotation = scalar(2.0) * qError.getVectorV();
+
+        const Vector3 lambdaRotation = joint.inverseMassMatrixRotation * (-errorRotation);
+
+        // Update the body orientations
+        w1 = I1 * -lambdaRotation;
+        q1 += Quaternion(0, w1) * q1 * scalar(0.5);
+        q1.normalize();
+
+        w2 = I2 * lambdaRotation;
+        q2 += Quaternion(0, w2) * q2 * scalar(0.5);
+        q2.normalize();
+
+        body1.body->setWorldTransform(Transform(x1,q1));
+        body2.body->setWorldTransform(Transform(x2,q2));
+    }
+}
+
+
+//------------------------------ Distance joints ------------------------------//
+
+void rpJointStore::initDistanceJoints()
+{
+    for (uint i = 0; i < mDistanceJoints.size(); i++)
+    {
+        rpDistanceJointData& joint = mDistanceJoints[i];
+        const rpSolverBody& body1 = mSolverBodies[joint.indexBody1];
+        const rpSolverBody& body2 = mSolverBodies[joint.indexBody2];
+
+        Vector3 dp = body2.body->getTransform().getPosition() -
+                     body1.body->getTransform().getPosition();
+
+        scalar deltaLength = dp.length() - joint.distance;
+        joint.normal = dp.getUnit();
+
+        // The effective mass of the bodies with the softness of the joint
+        joint.effectiveMass = scalar(1.0) / (body1.massInverse + body2.massInverse);
+        joint.effectiveMass += joint.softness;
+
+        joint.bias = scalar(0);
+        if (joint.isBaumgarte)
+        {
+            joint.bias = deltaLength * joint.biasFactor;
+        }
+
+        joint.length = deltaLength;
+    }
+}
+
+void rpJointStore::warmstartDistanceJoints()
+{
+    for (uint i = 0; i < mDistanceJoints.size(); i++)
+    {
+        const rpDistanceJointData& joint = mDistanceJoints[i];
+
+        mSolverBodies[joint.indexBody1].applyImpulseLinear(-joint.normal * joint.accumulatedImpulse);
+        mSolverBodies[joint.indexBody2].applyImpulseLinear( joint.normal * joint.accumulatedImpulse);
+    }
+}
+
+void rpJointStore::solveVelocityDistanceJoints()
+{
+    for (uint i = 0; i < mDistanceJoints.size(); i++)
+    {
+        rpDistanceJointData& joint = mDistanceJoints[i];
+        rpSolverBody& body1 = mSolverBodies[joint.indexBody1];
+        rpSolverBody& body2 = mSolverBodies[joint.indexBody2];
+
+        scalar jv = (body2.linearVelocity - body1.linearVelocity).dot(joint.normal);
+
+        scalar softnessScalar = joint.accumulatedImpulse * joint.softness;
+
+        scalar lambda = -joint.effectiveMass * (jv + joint.bias + softnessScalar);
+        joint.accumulatedImpulse += lambda;
+
+        body1.applyImpulseLinear(-joint.normal * lambda);
+        body2.applyImpulseLinear( joint.normal * lambda);
+    }
+}
+
+void rpJointStore::solvePositionDistanceJoints()
+{
+    for (uint i = 0; i < mDistanceJoints.size(); i++)
+    {
+        const rpDistanceJointData& joint = mDistanceJoints[i];
+
+        scalar lambda = -joint.effectiveMass * joint.length;
+
+        mSolverBodies[joint.indexBody1].applySplitImpulseLinear(-joint.normal * lambda);
+        mSolverBodies[joint.indexBody2].applySplitImpulseLinear( joint.normal * lambda);
+    }
+}
+
+
+} /* namespace real_physics */
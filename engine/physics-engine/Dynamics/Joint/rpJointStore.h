@@ -0,0 +1,246 @@
+/*
+ * rpJointStore.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SOURCE_ENGIE_KINEMATICPHYSICS_CONSTRAINT_RPJOINTSTORE_H_
+#define SOURCE_ENGIE_KINEMATICPHYSICS_CONSTRAINT_RPJOINTSTORE_H_
+
+// Libraries
+#include "rpJoint.h"
+#include "rpBallAndSocketJoint.h"
+#include "rpFixedJoint.h"
+#include "rpDistanceJoint.h"
+#include "rpArticulation.h"
+#include "../Solver/rpSolverBody.h"
+#include <vector>
+
+namespace real_physics
+{
+
+
+/// Constraint data of a ball-and-socket joint for the batched solver
+struct rpBallAndSocketJointData
+{
+    /// Handle of the joint (keeps the accumulated impulse between the steps)
+    rpBallAndSocketJoint* joint;
+
+    /// Indexes of the bodies in the solver bodies of the island
+    uint indexBody1;
+    uint indexBody2;
+
+    /// Anchor points in the local-space of the bodies
+    Vector3 localAnchorPointBody1;
+    Vector3 localAnchorPointBody2;
+
+    /// Vectors from the centers of the bodies to the anchor point in world-space
+    Vector3 r1World;
+    Vector3 r2World;
+
+    /// Inverse mass matrix K=JM^-1J^-t of the constraint
+    Matrix3x3 inverseMassMatrix;
+
+    /// Bias vector for the constraint
+    Vector3 biasVector;
+
+    /// Accumulated impulse
+    Vector3 impulse;
+
+    scalar softness;
+    bool   isBaumgarte;
+    bool   isNonLinearGaussSeidel;
+    bool   isWarmStartingActive;
+    bool   isSplitActive;
+    bool   isDynamic;
+};
+
+
+/// Constraint data of a fixed joint for the batched solver
+struct rpFixedJointData
+{
+    /// Handle of the joint (keeps the accumulated impulses between the steps)
+    rpFixedJoint* joint;
+
+    /// Indexes of the bodies in the solver bodies of the island
+    uint indexBody1;
+    uint indexBody2;
+
+    /// Anchor points in the local-space of the bodies
+    Vector3 localAnchorPointBody1;
+    Vector3 localAnchorPointBody2;
+
+    /// Vectors from the centers of the bodies to the anchor point in world-space
+    Vector3 r1World;
+    Vector3 r2World;
+
+    /// Inverse mass matrices of the 3 translation and the 3 rotation constraints
+    Matrix3x3 inverseMassMatrixTranslation;
+    Matrix3x3 inverseMassMatrixRotation;
+
+    /// Bias vectors of the translation and the rotation constraints
+    Vector3 biasTranslation;
+    Vector3 biasRotation;
+
+    /// Accumulated impulses of the translation and the rotation constraints
+    Vector3 impulseTranslation;
+    Vector3 impulseRotation;
+
+    /// Inverse of the initial orientation difference between the two bodies
+    Quaternion initOrientationDifferenceInv;
+
+    bool   isBaumgarte;
+    bool   isNonLinearGaussSeidel;
+    bool   isWarmStartingActive;
+    bool   isDynamic;
+};
+
+
+/// Constraint data of a distance joint for the batched solver
+struct rpDistanceJointData
+{
+    /// Handle of the joint (keeps the accumulated impulse between the steps)
+    rpDistanceJoint* joint;
+
+    /// Indexes of the bodies in the solver bodies of the island
+    uint indexBody1;
+    uint indexBody2;
+
+    /// Linear jacobian of the body 2 (the body 1 has the opposite one)
+    Vector3 normal;
+
+    scalar distance;
+    scalar length;
+    scalar bias;
+    scalar biasFactor;
+    scalar softness;
+    scalar effectiveMass;
+    scalar accumulatedImpulse;
+    bool   isBaumgarte;
+};
+
+
+
+/**********************************************
+ *  Joints of an island grouped by their type.
+ *  Each type is stored in a contiguous array of plain
+ *  constraint data and solved by its own loop , without
+ *  a virtual call per joint. The joint classes stay the
+ *  handles of the user and hold no solver code : the store
+ *  copies their data in after the solver bodies are gathered
+ *  and gives the accumulated impulses back at the end of the step.
+ *
+ *  The joints without a batch (hinge , slider , angle axis)
+ *  are solved through their virtual methods , and the joints
+ *  of an articulation tree are solved by their articulation.
+ **********************************************/
+class rpJointStore
+{
+
+    private:
+
+        //-------------------- Attributes -----------------//
+
+        /// Solver bodies of the island
+        rpSolverBody* mSolverBodies;
+
+        /// Batches of the joints
+        std::vector<rpBallAndSocketJointData> mBallAndSocketJoints;
+        std::vector<rpFixedJointData>         mFixedJoints;
+        std::vector<rpDistanceJointData>      mDistanceJoints;
+
+        /// Joints without a batch
+        std::vector<rpJoint*> mOtherJoints;
+
+        /// Articulations of the joints
+        std::vector<rpArticulation*> mArticulations;
+
+
+        //-------------------- Methods -------------------//
+
+        /// Private copy-constructor
+        rpJointStore(const rpJointStore& store);
+
+        /// Private assignment operator
+        rpJointStore& operator=(const rpJointStore& store);
+
+
+        /// Kernels of the ball-and-socket joints
+        void initBallAndSocketJoints(scalar timeStep);
+        void warmstartBallAndSocketJoints();
+        void solveVelocityBallAndSocketJoints();
+        void solvePositionBallAndSocketJoints();
+
+        /// Kernels of the fixed joints
+        void initFixedJoints(scalar timeStep);
+        void warmstartFixedJoints();
+        void solveVelocityFixedJoints();
+        void solvePositionFixedJoints();
+
+        /// Kernels of the distance joints
+        void initDistanceJoints();
+        void warmstartDistanceJoints();
+        void solveVelocityDistanceJoints();
+        void solvePositionDistanceJoints();
+
+    public:
+
+        //-------------------- Methods --------------------//
+
+        /// Constructor
+        rpJointStore();
+
+        /// Remove all the joints
+        void clear();
+
+        /// Set the solver bodies of the island
+        void setSolverBodies(rpSolverBody* solverBodies);
+
+        /// Copy a joint into the batch of its type (the body indexes must be set)
+        void addJoint(rpJoint* joint);
+
+        /// Return the number of joints in the store
+        uint getNbJoints() const;
+
+        /// Return true if some joints are solved by iterations (not by an articulation)
+        bool hasIterativeJoints() const;
+
+
+        /// Initialize the joints and apply their previous impulses
+        void warmStart(scalar timeStep);
+
+        /// Solve the velocity constraints of all the joints
+        void solveVelocityConstraint();
+
+        /// Solve the position constraints of all the joints
+        void solvePositionConstraint();
+
+        /// Give the accumulated impulses back to the joints
+        void storeImpulses();
+};
+
+
+// Set the solver bodies of the island
+SIMD_INLINE void rpJointStore::setSolverBodies(rpSolverBody* solverBodies)
+{
+    mSolverBodies = solverBodies;
+}
+
+// Return the number of joints in the store
+SIMD_INLINE uint rpJointStore::getNbJoints() const
+{
+    return mBallAndSocketJoints.size() + mFixedJoints.size() +
+           mDistanceJoints.size() + mOtherJoints.size();
+}
+
+// Return true if some joints are solved by iterations (not by an articulation)
+SIMD_INLINE bool rpJointStore::hasIterativeJoints() const
+{
+    return getNbJoints() > 0;
+}
+
+
+} /* namespace real_physics */
+
+#endif /* SOURCE_ENGIE_KINEMATICPHYSICS_CONSTRAINT_RPJOINTSTORE_H_ */
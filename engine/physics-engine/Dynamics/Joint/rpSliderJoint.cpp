@@ -208,10 +208,10 @@ void rpSliderJoint::warmstart()
 {
 
 	// Get the velocities
-	Vector3& v1 = Body1->mLinearVelocity;
-	Vector3& v2 = Body2->mLinearVelocity;
-	Vector3& w1 = Body1->mAngularVelocity;
-	Vector3& w2 = Body2->mAngularVelocity;
+	Vector3& v1 = mSolverBodies[mIndexBody1].linearVelocity;
+	Vector3& v2 = mSolverBodies[mIndexBody2].linearVelocity;
+	Vector3& w1 = mSolverBodies[mIndexBody1].angularVelocity;
+	Vector3& w2 = mSolverBodies[mIndexBody2].angularVelocity;
 
     // Get the inverse mass and inverse inertia tensors of the bodies
     const scalar inverseMassBody1 = Body1->mMassInverse;
@@ -268,10 +268,10 @@ void rpSliderJoint::solveVelocityConstraint()
 {
 
 	// Get the velocities
-	Vector3& v1 = Body1->mLinearVelocity;
-	Vector3& v2 = Body2->mLinearVelocity;
-	Vector3& w1 = Body1->mAngularVelocity;
-	Vector3& w2 = Body2->mAngularVelocity;
+	Vector3& v1 = mSolverBodies[mIndexBody1].linearVelocity;
+	Vector3& v2 = mSolverBodies[mIndexBody2].linearVelocity;
+	Vector3& w1 = mSolverBodies[mIndexBody1].angularVelocity;
+	Vector3& w2 = mSolverBodies[mIndexBody2].angularVelocity;
 
     // Get the inverse mass and inverse inertia tensors of the bodies
     scalar inverseMassBody1 = Body1->mMassInverse;
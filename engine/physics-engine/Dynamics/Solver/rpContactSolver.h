@@ -18,6 +18,7 @@ namespace real_physics
 
 class rpContactManifold;
 class rpPhysicsBody;
+struct rpSolverBody;
 
 class rpContactSolver //: public BlockAlloc<rpContactSolver>
 {
@@ -36,14 +37,20 @@ class rpContactSolver //: public BlockAlloc<rpContactSolver>
 	/// set add To maniflod for contact Pair
 	virtual void  initManiflod( rpContactManifold * manilod ) = 0;
 
+	/// Set the solver bodies of the island (the velocities are read and written there)
+	virtual void  setSolverBodies( rpSolverBody* solverBodies ) = 0;
+
 	///initilize solver LCP
 	virtual void  initializeForIsland( scalar dt ) = 0;
 	virtual void  initializeContactConstraints() = 0;
 
 	/// Warm start the solver.
 	virtual void warmStart() = 0;
-	virtual void solveVelocityConstraint() = 0;
-	virtual void solvePositionConstraint() = 0;
+
+	/// Solve the constraints once , return the residual (largest change of an accumulated impulse)
+	virtual scalar solveVelocityConstraint() = 0;
+	virtual scalar solvePositionConstraint() = 0;
+
     virtual void storeImpulses() = 0;
 
 
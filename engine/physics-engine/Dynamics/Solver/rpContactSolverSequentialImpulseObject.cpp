@@ -16,6 +16,7 @@ namespace real_physics
 const scalar rpContactSolverSequentialImpulseObject::BETA = scalar(0.2);
 const scalar rpContactSolverSequentialImpulseObject::BETA_SPLIT_IMPULSE = scalar(0.2);
 const scalar rpContactSolverSequentialImpulseObject::SLOP= scalar(0.01);
+const scalar rpContactSolverSequentialImpulseObject::BLOCK_SOLVER_PIVOT_TOLERANCE = scalar(0.001);
 
 
 
@@ -25,7 +26,8 @@ rpContactSolverSequentialImpulseObject::rpContactSolverSequentialImpulseObject(
  mIsWarmStartingActive(true),
  mIsSplitImpulseActive(true),
  mIsStaticFriction(true),
- mIsSolveFrictionAtContactManifoldCenterActive(true)
+ mIsSolveFrictionAtContactManifoldCenterActive(true),
+ mIsBlockSolverActive(false)
 {
 
     //mContactManifolds = new rpContactManifold;
@@ -73,6 +75,16 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::initManiflod(rpContactM
 }
 
 
+SIMD_INLINE void rpContactSolverSequentialImpulseObject::setSolverBodies(rpSolverBody* solverBodies)
+{
+    mSolverBodies = solverBodies;
+
+    // Index of the bodies in the solver-body array of the island
+    mContactConstraints->indexBody1 = mBody1->mSolverBodyIndex;
+    mContactConstraints->indexBody2 = mBody2->mSolverBodyIndex;
+}
+
+
 
 
 
@@ -157,6 +169,7 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::initializeForIsland(sca
         contactPoint.r1 = p1 - x1;
         contactPoint.r2 = p2 - x2;
         contactPoint.penetrationDepth = externalContact->getPenetrationDepth();
+        contactPoint.isSpeculative = externalContact->getIsSpeculative();
         contactPoint.isRestingContact = true;//externalContact->getIsRestingContact();
         //externalContact->setIsRestingContact(true);
         contactPoint.oldFrictionVector1 = externalContact->getFrictionVector1();
@@ -222,8 +235,8 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::initializeContactConstr
 {
 
 
-    rpRigidPhysicsBody*  body1 = (rpRigidPhysicsBody* )(mBody1);
-    rpRigidPhysicsBody*  body2 = (rpRigidPhysicsBody* )(mBody2);
+    rpSolverBody& body1 = mSolverBodies[mContactConstraints->indexBody1];
+    rpSolverBody& body2 = mSolverBodies[mContactConstraints->indexBody2];
 
 
     ContactManifoldSolver* manifold = mContactConstraints;
@@ -239,10 +252,10 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::initializeContactConstr
         manifold->normal = Vector3(0.0, 0.0, 0.0);
     }
 
-    const Vector3& v1 = body1->mLinearVelocity;
-    const Vector3& w1 = body1->mAngularVelocity;
-    const Vector3& v2 = body2->mLinearVelocity;
-    const Vector3& w2 = body2->mAngularVelocity;
+    const Vector3& v1 = body1.linearVelocity;
+    const Vector3& w1 = body1.angularVelocity;
+    const Vector3& v2 = body2.linearVelocity;
+    const Vector3& w2 = body2.angularVelocity;
 
     // For each contact point constraint
     for (uint i=0; i<manifold->nbContacts; i++)
@@ -310,7 +323,10 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::initializeContactConstr
         scalar damping =  RESTITUTION_VELOCITY_THRESHOLD * 2.0;
         scalar bounce  =  manifold->restitutionFactor;
 
-        if ( deltaVDotN < -damping )
+        // A speculative contact only bounces if the bodies close
+        // the distance between them during the step
+        if ( deltaVDotN < -damping && (!contactPoint.isSpeculative ||
+                                       deltaVDotN * mTimeStep < -Abs(contactPoint.penetrationDepth)) )
         {
             contactPoint.restitutionBias =  bounce * deltaVDotN;
         }
@@ -354,6 +370,24 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::initializeContactConstr
         manifold->inverseRollingResistance = manifold->inverseRollingResistance.getInverse();
     }
 
+    // Compute the matrix K of the normal constraints of all the contact points for the block solver
+    if (isBlockSolved())
+    {
+        const uint nbContacts = manifold->nbContacts;
+        for (uint i=0; i<nbContacts; i++)
+        {
+            const ContactPointSolver& contactPoint1 = manifold->contacts[i];
+            for (uint j=0; j<nbContacts; j++)
+            {
+                const ContactPointSolver& contactPoint2 = manifold->contacts[j];
+                manifold->normalMass[i * nbContacts + j] = (body1.massInverse + body2.massInverse) *
+                                                           contactPoint1.normal.dot(contactPoint2.normal) +
+                                                           contactPoint1.r1CrossN.dot(body1.inverseInertiaTensorWorld * contactPoint2.r1CrossN) +
+                                                           contactPoint1.r2CrossN.dot(body2.inverseInertiaTensorWorld * contactPoint2.r2CrossN);
+            }
+        }
+    }
+
 
     // If we solve the friction constraints at the center of the contact manifold
     if (mIsSolveFrictionAtContactManifoldCenterActive &&  manifold->nbContacts > 0)
@@ -406,8 +440,8 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::warmStart()
      //-------------------------------------------------------//
 
 
-        rpRigidPhysicsBody*  body1 = (rpRigidPhysicsBody* )(mBody1);
-        rpRigidPhysicsBody*  body2 = (rpRigidPhysicsBody* )(mBody2);
+        rpSolverBody& body1 = mSolverBodies[mContactConstraints->indexBody1];
+        rpSolverBody& body2 = mSolverBodies[mContactConstraints->indexBody2];
 
 
        atLeastOneRestingContactPoint = false;
@@ -420,8 +454,6 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::warmStart()
             rpContactPoint *cp = contactPoint.externalContact;
 
 
-            Vector3 ContactPointA = (cp->getWorldPointOnBody1());
-            Vector3 ContactPointB = (cp->getWorldPointOnBody2());
 
 
             scalar  &_accumulaterImpuls                        =  contactPoint.AccumulatedPenetrationImpulse;
@@ -433,9 +465,13 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::warmStart()
 
             /****************************************************************************/
             /// Penetration Distance
-            scalar beta = mIsSplitImpulseActive ? BETA_SPLIT_IMPULSE : BETA;
-            scalar sepp = -Abs( cp->getPenetrationDepth() );
-            cp->setPenetrationDepth( -(beta/mTimeStep) * Min( scalar(0), sepp + SLOP ));
+            /// (the speculative contacts keep the distance between the bodies)
+            if( !contactPoint.isSpeculative )
+            {
+                scalar beta = mIsSplitImpulseActive ? BETA_SPLIT_IMPULSE : BETA;
+                scalar sepp = -Abs( cp->getPenetrationDepth() );
+                cp->setPenetrationDepth( -(beta/mTimeStep) * Min( scalar(0), sepp + SLOP ));
+            }
             /****************************************************************************/
 
 
@@ -455,8 +491,8 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::warmStart()
                 _accumulaterImpulsFriction2 = oldFrictionImpulse.dot(contactPoint.frictionVector2);
 
                 //------------------------  accumulation impulse -----------------------------//
-                body1->applyImpulse(-contactPoint.normal * _accumulaterImpuls , ContactPointA );
-                body2->applyImpulse( contactPoint.normal * _accumulaterImpuls , ContactPointB );
+                body1.applyImpulse(-contactPoint.normal * _accumulaterImpuls , contactPoint.r1);
+                body2.applyImpulse( contactPoint.normal * _accumulaterImpuls , contactPoint.r2);
 
 
 
@@ -464,11 +500,11 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::warmStart()
                 {
                     //------------------------ friction accumulation impulse -----------------------------//
 
-                    body1->applyImpulse(-contactPoint.frictionVector1 * _accumulaterImpulsFriction1 , ContactPointA);
-                    body2->applyImpulse( contactPoint.frictionVector1 * _accumulaterImpulsFriction1 , ContactPointB);
+                    body1.applyImpulse(-contactPoint.frictionVector1 * _accumulaterImpulsFriction1 , contactPoint.r1);
+                    body2.applyImpulse( contactPoint.frictionVector1 * _accumulaterImpulsFriction1 , contactPoint.r2);
 
-                    body1->applyImpulse(-contactPoint.frictionVector2 * _accumulaterImpulsFriction2 , ContactPointA);
-                    body2->applyImpulse( contactPoint.frictionVector2 * _accumulaterImpulsFriction2 , ContactPointB);
+                    body1.applyImpulse(-contactPoint.frictionVector2 * _accumulaterImpulsFriction2 , contactPoint.r1);
+                    body2.applyImpulse( contactPoint.frictionVector2 * _accumulaterImpulsFriction2 , contactPoint.r2);
 
 
 
@@ -476,12 +512,12 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::warmStart()
 
                     if (contactManifold.rollingResistanceFactor > 0)
                     {
-                        body1->applyImpulseAngular(-_accumulaterRollingResistanceImpulse);
-                        body2->applyImpulseAngular( _accumulaterRollingResistanceImpulse);
+                        body1.applyImpulseAngular(-_accumulaterRollingResistanceImpulse);
+                        body2.applyImpulseAngular( _accumulaterRollingResistanceImpulse);
 
 
-                        body1->applySplitImpulseAngular(-_accumulaterRollingResistanceSplitImpulse);
-                        body2->applySplitImpulseAngular( _accumulaterRollingResistanceSplitImpulse);
+                        body1.applySplitImpulseAngular(-_accumulaterRollingResistanceSplitImpulse);
+                        body2.applySplitImpulseAngular( _accumulaterRollingResistanceSplitImpulse);
 
                     }
 
@@ -535,11 +571,11 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::warmStart()
             Vector3 angularImpulseBody2 =  contactManifold.r2CrossT1 *_accumulaterImpulsFriction1;
 
 
-            body1->applyImpulseLinear(linearImpulseBody1);
-            body1->applyImpulseAngular(angularImpulseBody1);
+            body1.applyImpulseLinear(linearImpulseBody1);
+            body1.applyImpulseAngular(angularImpulseBody1);
 
-            body2->applyImpulseLinear(linearImpulseBody2);
-            body2->applyImpulseAngular(angularImpulseBody2);
+            body2.applyImpulseLinear(linearImpulseBody2);
+            body2.applyImpulseAngular(angularImpulseBody2);
 
 
             // ------ Second friction constraint at the center of the contact manifold ----- //
@@ -553,11 +589,11 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::warmStart()
 
 
 
-            body1->applyImpulseLinear(linearImpulseBody1);
-            body1->applyImpulseAngular(angularImpulseBody1);
+            body1.applyImpulseLinear(linearImpulseBody1);
+            body1.applyImpulseAngular(angularImpulseBody1);
 
-            body2->applyImpulseLinear(linearImpulseBody2);
-            body2->applyImpulseAngular(angularImpulseBody2);
+            body2.applyImpulseLinear(linearImpulseBody2);
+            body2.applyImpulseAngular(angularImpulseBody2);
 
 
 
@@ -568,8 +604,8 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::warmStart()
             angularImpulseBody2 =  contactManifold.normal * _accumulatedFrictionTwistImpulse;
 
 
-            body1->applyImpulseAngular(angularImpulseBody1);
-            body2->applyImpulseAngular(angularImpulseBody2);
+            body1.applyImpulseAngular(angularImpulseBody1);
+            body2.applyImpulseAngular(angularImpulseBody2);
 
             // ------ Rolling resistance at the center of the contact manifold ------ //
 
@@ -578,8 +614,8 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::warmStart()
             angularImpulseBody2 =  _accumulaterRollingResistanceImpulse;
 
 
-            body1->applyImpulseAngular(angularImpulseBody1);
-            body2->applyImpulseAngular(angularImpulseBody2);
+            body1.applyImpulseAngular(angularImpulseBody1);
+            body2.applyImpulseAngular(angularImpulseBody2);
 
 
 
@@ -590,8 +626,8 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::warmStart()
             Vector3 angularSplitImpulseBody2 =  _accumulaterRollingResistanceSplitImpulse;
 
 
-            body1->applySplitImpulseAngular(angularSplitImpulseBody1);
-            body2->applySplitImpulseAngular(angularSplitImpulseBody2);
+            body1.applySplitImpulseAngular(angularSplitImpulseBody1);
+            body2.applySplitImpulseAngular(angularSplitImpulseBody2);
 
         }
         else
@@ -613,16 +649,16 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::warmStart()
 
 }
 
-SIMD_INLINE void rpContactSolverSequentialImpulseObject::solveVelocityConstraint()
+SIMD_INLINE scalar rpContactSolverSequentialImpulseObject::solveVelocityConstraint()
 {
 
-    if( mIsError ) return;
+    if( mIsError ) return scalar(0.0);
 
     //-------------------------------------------------------//
 
 
-    rpRigidPhysicsBody*  body1 = (rpRigidPhysicsBody* )(mBody1);
-    rpRigidPhysicsBody*  body2 = (rpRigidPhysicsBody* )(mBody2);
+    rpSolverBody& body1 = mSolverBodies[mContactConstraints->indexBody1];
+    rpSolverBody& body2 = mSolverBodies[mContactConstraints->indexBody2];
 
 
     ContactManifoldSolver* contactManifold = mContactConstraints;
@@ -632,23 +668,28 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::solveVelocityConstraint
     scalar lambdaTemp;
 
     scalar sumPenetrationImpulse = 0.0;
+
+    // Largest change of an accumulated impulse in this iteration
+    scalar residual = 0.0;
+
     // Get the constrained velocities
-    const Vector3& v1 = body1->mLinearVelocity;
-    const Vector3& w1 = body1->mAngularVelocity;
-    const Vector3& v2 = body2->mLinearVelocity;
-    const Vector3& w2 = body2->mAngularVelocity;
+    const Vector3& v1 = body1.linearVelocity;
+    const Vector3& w1 = body1.angularVelocity;
+    const Vector3& v2 = body2.linearVelocity;
+    const Vector3& w2 = body2.angularVelocity;
+
+   // Solve the normal impulses of all the contact points together , the
+   // sequential impulses below are the fallback of a degenerate manifold
+   const bool isNormalBlockSolved = isBlockSolved() && solveNormalConstraintsBlock(body1 , body2 , residual);
 
    for (uint i = 0; i < contactManifold->nbContacts; ++i)
    {
 
         ContactPointSolver &contactPoint = contactManifold->contacts[i];
-        rpContactPoint *cp = contactPoint.externalContact;
 
 
                        // --------- Penetration --------- //
        //CContactCollision *c = &m_contacts[i];
-       Vector3 ContactPointA = (cp->getWorldPointOnBody1());
-       Vector3 ContactPointB = (cp->getWorldPointOnBody2());
 
 
        scalar  &_accumulaterImpuls                   = contactPoint.AccumulatedPenetrationImpulse;
@@ -657,44 +698,27 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::solveVelocityConstraint
        Vector3 &_accumulaterRollingResistanceImpulse = contactPoint.AccumulatedRollingResistanceImpulse;
 
 
+       Vector3 deltaV;
+       scalar  Jv;
 
-       // Compute J*v
-       Vector3 deltaV = v2 + w2.cross(contactPoint.r2) -
-                        v1 - w1.cross(contactPoint.r1);
-       scalar deltaVDotN = deltaV.dot(contactPoint.normal);
-       scalar Jv = deltaVDotN;
-
-
-
-       // Compute the bias "b" of the constraint
-       //scalar beta = mIsSplitImpulseActive ? BETA_SPLIT_IMPULSE : BETA;
-       scalar biasPenetrationDepth = 0.0;
-       if (contactPoint.penetrationDepth > SLOP)
+       if (!isNormalBlockSolved)
        {
-          // biasPenetrationDepth = -(beta/mTimeStep) * max(0.0f, scalar(contactPoint.penetrationDepth - SLOP));
-           biasPenetrationDepth = cp->getPenetrationDepth();
-       }
-
-       scalar b = biasPenetrationDepth + contactPoint.restitutionBias;
-
-       if(mIsSplitImpulseActive)
-       {
-           deltaLambda = -(Jv + contactPoint.restitutionBias) * contactPoint.inversePenetrationMass;
-       }
-       else
-       {
-           deltaLambda = -(Jv + b) * contactPoint.inversePenetrationMass;
-       }
-
+           // Compute J*v
+           deltaV = v2 + w2.cross(contactPoint.r2) -
+                    v1 - w1.cross(contactPoint.r1);
+           Jv = deltaV.dot(contactPoint.normal);
 
+           deltaLambda = -(Jv + computeNormalVelocityBias(contactPoint)) * contactPoint.inversePenetrationMass;
 
-       lambdaTemp = _accumulaterImpuls;
-       _accumulaterImpuls = Max(_accumulaterImpuls + deltaLambda, scalar(0.0));
-       deltaLambda = _accumulaterImpuls - lambdaTemp;
+           lambdaTemp = _accumulaterImpuls;
+           _accumulaterImpuls = Max(_accumulaterImpuls + deltaLambda, scalar(0.0));
+           deltaLambda = _accumulaterImpuls - lambdaTemp;
+           residual = Max(residual, Abs(deltaLambda));
 
 
-       body1->applyImpulse(-contactPoint.normal * deltaLambda , ContactPointA);
-       body2->applyImpulse( contactPoint.normal * deltaLambda , ContactPointB);
+           body1.applyImpulse(-contactPoint.normal * deltaLambda , contactPoint.r1);
+           body2.applyImpulse( contactPoint.normal * deltaLambda , contactPoint.r2);
+       }
 
 
 
@@ -721,10 +745,11 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::solveVelocityConstraint
            lambdaTemp = _accumulaterImpulsFriction1;
            _accumulaterImpulsFriction1 = Max(-frictionLimit, Min(_accumulaterImpulsFriction1 + deltaLambda, frictionLimit));
            deltaLambda = _accumulaterImpulsFriction1 - lambdaTemp;
+           residual = Max(residual, Abs(deltaLambda));
 
 
-           body1->applyImpulse(-contactPoint.frictionVector1 * deltaLambda , ContactPointA );
-           body2->applyImpulse( contactPoint.frictionVector1 * deltaLambda , ContactPointB );
+           body1.applyImpulse(-contactPoint.frictionVector1 * deltaLambda , contactPoint.r1);
+           body2.applyImpulse( contactPoint.frictionVector1 * deltaLambda , contactPoint.r2);
 
 
 
@@ -743,11 +768,12 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::solveVelocityConstraint
            lambdaTemp = _accumulaterImpulsFriction2;
            _accumulaterImpulsFriction2 = Max(-frictionLimit, Min(_accumulaterImpulsFriction2 + deltaLambda, frictionLimit));
            deltaLambda = _accumulaterImpulsFriction2 - lambdaTemp;
+           residual = Max(residual, Abs(deltaLambda));
 
 
            /// Apply impulse velocity
-           body1->applyImpulse(-contactPoint.frictionVector2 * deltaLambda , ContactPointA );
-           body2->applyImpulse( contactPoint.frictionVector2 * deltaLambda , ContactPointB );
+           body1.applyImpulse(-contactPoint.frictionVector2 * deltaLambda , contactPoint.r1);
+           body2.applyImpulse( contactPoint.frictionVector2 * deltaLambda , contactPoint.r2);
 
 
 
@@ -764,11 +790,12 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::solveVelocityConstraint
                Vector3 lambdaTempRolling = _accumulaterRollingResistanceImpulse;
                _accumulaterRollingResistanceImpulse = Vector3::clamp(_accumulaterRollingResistanceImpulse + deltaLambdaRolling, rollingLimit);
                deltaLambdaRolling = _accumulaterRollingResistanceImpulse - lambdaTempRolling;
+               residual = Max(residual, deltaLambdaRolling.length());
 
 
 
-               body1->applyImpulseAngular( (-deltaLambdaRolling));
-               body2->applyImpulseAngular( ( deltaLambdaRolling));
+               body1.applyImpulseAngular( (-deltaLambdaRolling));
+               body2.applyImpulseAngular( ( deltaLambdaRolling));
            }
 
        }
@@ -800,6 +827,7 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::solveVelocityConstraint
        lambdaTemp = _accumulaterImpulsFriction1;
        _accumulaterImpulsFriction1 = Max(-frictionLimit, Min(_accumulaterImpulsFriction1 + deltaLambda, frictionLimit));
        deltaLambda = _accumulaterImpulsFriction1 - lambdaTemp;
+       residual = Max(residual, Abs(deltaLambda));
 
        // Compute the impulse P=J^T * lambda
        Vector3 linearImpulseBody1  = -contactManifold->frictionVector1 * deltaLambda;
@@ -809,11 +837,11 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::solveVelocityConstraint
 
 
        // Apply the impulses to the bodies of the constraint
-       body1->applyImpulseLinear(linearImpulseBody1);
-       body1->applyImpulseAngular(angularImpulseBody1);
+       body1.applyImpulseLinear(linearImpulseBody1);
+       body1.applyImpulseAngular(angularImpulseBody1);
 
-       body2->applyImpulseLinear(linearImpulseBody2);
-       body2->applyImpulseAngular(angularImpulseBody2);
+       body2.applyImpulseLinear(linearImpulseBody2);
+       body2.applyImpulseAngular(angularImpulseBody2);
 
 
        // ------ Second friction constraint at the center of the contact manifol ----- //
@@ -829,6 +857,7 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::solveVelocityConstraint
        lambdaTemp = _accumulaterImpulsFriction2;
        _accumulaterImpulsFriction2 = Max(-frictionLimit, Min(_accumulaterImpulsFriction2 + deltaLambda, frictionLimit));
        deltaLambda = _accumulaterImpulsFriction2 - lambdaTemp;
+       residual = Max(residual, Abs(deltaLambda));
 
        // Compute the impulse P=J^T * lambda
        linearImpulseBody1  = -contactManifold->frictionVector2 * deltaLambda;
@@ -840,12 +869,12 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::solveVelocityConstraint
 
 
        // Apply the impulses to the body 1  of the constraint
-       body1->applyImpulseLinear(linearImpulseBody1);
-       body1->applyImpulseAngular(angularImpulseBody1);
+       body1.applyImpulseLinear(linearImpulseBody1);
+       body1.applyImpulseAngular(angularImpulseBody1);
 
        // Apply the impulses to the body 2 of the constraint
-       body2->applyImpulseLinear(linearImpulseBody2);
-       body2->applyImpulseAngular(angularImpulseBody2);
+       body2.applyImpulseLinear(linearImpulseBody2);
+       body2.applyImpulseAngular(angularImpulseBody2);
 
 
        // ------ Twist friction constraint at the center of the contact manifol ------ //
@@ -859,6 +888,7 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::solveVelocityConstraint
        lambdaTemp = _accumulatedFrictionTwistImpulse;
        _accumulatedFrictionTwistImpulse = Max(-frictionLimit, Min(_accumulatedFrictionTwistImpulse + deltaLambda, frictionLimit));
        deltaLambda = _accumulatedFrictionTwistImpulse - lambdaTemp;
+       residual = Max(residual, Abs(deltaLambda));
 
        // Compute the impulse P=J^T * lambda
        linearImpulseBody1  =  Vector3::ZERO;
@@ -869,8 +899,8 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::solveVelocityConstraint
 
 
        // Apply the impulses to the bodies of the constraint
-       body1->applyImpulseAngular(angularImpulseBody1);
-       body2->applyImpulseAngular(angularImpulseBody2);
+       body1.applyImpulseAngular(angularImpulseBody1);
+       body2.applyImpulseAngular(angularImpulseBody2);
 
 
        /**/
@@ -887,6 +917,7 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::solveVelocityConstraint
            Vector3 lambdaTempRolling = _accumulaterRollingResistanceImpulse;
            _accumulaterRollingResistanceImpulse = Vector3::clamp(_accumulaterRollingResistanceImpulse + deltaLambdaRolling, rollingLimit);
            deltaLambdaRolling = _accumulaterRollingResistanceImpulse - lambdaTempRolling;
+           residual = Max(residual, deltaLambdaRolling.length());
 
            // Compute the impulse P=J^T * lambda
            angularImpulseBody1 = -deltaLambdaRolling;
@@ -894,28 +925,28 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::solveVelocityConstraint
 
 
            // Apply the impulses to the bodies of the constraint
-           body1->applyImpulseAngular(angularImpulseBody1);
-           body2->applyImpulseAngular(angularImpulseBody2);
+           body1.applyImpulseAngular(angularImpulseBody1);
+           body2.applyImpulseAngular(angularImpulseBody2);
 
        }
        /**/
    }
 
-
+   return residual;
 }
 
 
 
-SIMD_INLINE void rpContactSolverSequentialImpulseObject::solvePositionConstraint()
+SIMD_INLINE scalar rpContactSolverSequentialImpulseObject::solvePositionConstraint()
 {
 
 
-    if( mIsError ) return;
+    if( mIsError ) return scalar(0.0);
     //-------------------------------------------------------//
 
 
-    rpRigidPhysicsBody*  body1 = (rpRigidPhysicsBody* )(mBody1);
-    rpRigidPhysicsBody*  body2 = (rpRigidPhysicsBody* )(mBody2);
+    rpSolverBody& body1 = mSolverBodies[mContactConstraints->indexBody1];
+    rpSolverBody& body2 = mSolverBodies[mContactConstraints->indexBody2];
 
 
     ContactManifoldSolver* contactManifold = mContactConstraints;
@@ -923,28 +954,32 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::solvePositionConstraint
 
 
     // Get the constrained velocities
-    const Vector3& v1Split = body1->mSplitLinearVelocity;
-    const Vector3& w1Split = body1->mSplitAngularVelocity;
-    const Vector3& v2Split = body2->mSplitLinearVelocity;
-    const Vector3& w2Split = body2->mSplitAngularVelocity;
+    const Vector3& v1Split = body1.splitLinearVelocity;
+    const Vector3& w1Split = body1.splitAngularVelocity;
+    const Vector3& v2Split = body2.splitLinearVelocity;
+    const Vector3& w2Split = body2.splitAngularVelocity;
 
 
     scalar sumPenetrationSplitImpulse = 0.0;
 
+    // Largest change of an accumulated split impulse in this iteration
+    scalar residual = 0.0;
+
     for (uint i = 0; i < contactManifold->nbContacts; ++i)
     {
 
         ContactPointSolver &contactPoint = contactManifold->contacts[i];
         rpContactPoint *cp = contactPoint.externalContact;
 
+        // The speculative contacts have no penetration to correct
+        if (contactPoint.isSpeculative) continue;
+
 
         scalar  &_accumulaterPenetrationSplit = contactPoint.AccumulatedPenetrationSplitImpulse;
         Vector3 &_accumulaterRollingResistanceSplitImpulse = contactPoint.AccumulatedRollingResistanceSplitImpulse;
 
 
         // --------- Penetration --------- //
-        Vector3 ContactPointA = (cp->getWorldPointOnBody1());
-        Vector3 ContactPointB = (cp->getWorldPointOnBody2());
 
         Vector3 deltaVSplit = v2Split + w2Split.cross(contactPoint.r2) -
                               v1Split - w1Split.cross(contactPoint.r1);
@@ -957,13 +992,14 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::solvePositionConstraint
         scalar lambdaTempSplit = _accumulaterPenetrationSplit;
         _accumulaterPenetrationSplit = Max( _accumulaterPenetrationSplit + deltaLambdaSplit, scalar(0.0));
         scalar deltaLambda = _accumulaterPenetrationSplit - lambdaTempSplit;
+        residual = Max(residual, Abs(deltaLambda));
 
 
         sumPenetrationSplitImpulse += _accumulaterPenetrationSplit;
 
 
-        body1->applySplitImpulse(-contactPoint.normal * deltaLambda , ContactPointA );
-        body2->applySplitImpulse( contactPoint.normal * deltaLambda , ContactPointB );
+        body1.applySplitImpulse(-contactPoint.normal * deltaLambda , contactPoint.r1);
+        body2.applySplitImpulse( contactPoint.normal * deltaLambda , contactPoint.r2);
 
 
         /**/
@@ -979,11 +1015,12 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::solvePositionConstraint
             Vector3 lambdaTempRolling = _accumulaterRollingResistanceSplitImpulse;
             _accumulaterRollingResistanceSplitImpulse = Vector3::clamp(_accumulaterRollingResistanceSplitImpulse + deltaLambdaRolling, rollingLimit);
             deltaLambdaRolling = _accumulaterRollingResistanceSplitImpulse - lambdaTempRolling;
+            residual = Max(residual, deltaLambdaRolling.length());
 
 
             ///Apply the pseudo impulses
-            body1->applySplitImpulseAngular(-deltaLambdaRolling);
-            body2->applySplitImpulseAngular( deltaLambdaRolling);
+            body1.applySplitImpulseAngular(-deltaLambdaRolling);
+            body2.applySplitImpulseAngular( deltaLambdaRolling);
 
 
         }
@@ -1013,16 +1050,18 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::solvePositionConstraint
             Vector3 lambdaTempRolling = _accumulaterRollingResistanceSplitImpulse;
             _accumulaterRollingResistanceSplitImpulse = Vector3::clamp(_accumulaterRollingResistanceSplitImpulse + deltaLambdaRolling, rollingLimit);
             deltaLambdaRolling = _accumulaterRollingResistanceSplitImpulse - lambdaTempRolling;
+            residual = Max(residual, deltaLambdaRolling.length());
 
 
             // Apply the impulses to the bodies of the constraint
-            body1->applySplitImpulseAngular(-deltaLambdaRolling);
-            body2->applySplitImpulseAngular( deltaLambdaRolling);
+            body1.applySplitImpulseAngular(-deltaLambdaRolling);
+            body2.applySplitImpulseAngular( deltaLambdaRolling);
 
         }
     }
     /**/
 
+    return residual;
 }
 
 /**/
@@ -1165,6 +1204,187 @@ SIMD_INLINE void rpContactSolverSequentialImpulseObject::computeFrictionVectors(
 }
 
 
+// Return the velocity bias of the normal constraint of a contact point
+SIMD_INLINE scalar rpContactSolverSequentialImpulseObject::computeNormalVelocityBias(const ContactPointSolver& contactPoint) const
+{
+    if(contactPoint.isSpeculative)
+    {
+        // Speculative contact : the bodies may approach each other by the
+        // distance between them , the clamping of the impulse keeps it zero
+        // as long as they can not touch during the step
+        return (contactPoint.restitutionBias < scalar(0.0)) ? contactPoint.restitutionBias :
+                                                              Abs(contactPoint.penetrationDepth) / mTimeStep;
+    }
+
+    if(mIsSplitImpulseActive)
+    {
+        return contactPoint.restitutionBias;
+    }
+
+    // Compute the bias "b" of the constraint
+    scalar biasPenetrationDepth = 0.0;
+    if (contactPoint.penetrationDepth > SLOP)
+    {
+        biasPenetrationDepth = contactPoint.externalContact->getPenetrationDepth();
+    }
+
+    return biasPenetrationDepth + contactPoint.restitutionBias;
+}
+
+
+// Return true if the normal impulses of the manifold are solved together
+SIMD_INLINE bool rpContactSolverSequentialImpulseObject::isBlockSolved() const
+{
+    return mIsBlockSolverActive && mContactConstraints->nbContacts >= 2 &&
+           mContactConstraints->nbContacts <= MAX_BLOCK_SOLVER_CONTACT_POINTS;
+}
+
+
+// Solve the normal impulses of all the contact points together. The accumulated
+// impulses x are the solution of the LCP
+//
+//        w = A*x + b ,  x >= 0 ,  w >= 0 ,  x_i * w_i = 0
+//
+// with A the matrix K of the normal constraints and b = J*v + bias - A*x_old.
+// The sets of active contact points are enumerated from the largest one , the
+// system of each set is solved by a Cholesky factorization and the first set
+// which satisfies the inequalities is the solution. A set of linearly dependent
+// points (the four corners of a face) is skipped , one of its subsets carries
+// the load. Return false if no set is found (the manifold is then solved sequentially).
+bool rpContactSolverSequentialImpulseObject::solveNormalConstraintsBlock(rpSolverBody& body1 , rpSolverBody& body2 , scalar& residual)
+{
+    ContactManifoldSolver* manifold = mContactConstraints;
+    const uint nbContacts = manifold->nbContacts;
+    const scalar* A = manifold->normalMass;
+
+    const Vector3& v1 = body1.linearVelocity;
+    const Vector3& w1 = body1.angularVelocity;
+    const Vector3& v2 = body2.linearVelocity;
+    const Vector3& w2 = body2.angularVelocity;
+
+    // Compute the right-hand side b of the LCP
+    scalar oldImpulses[MAX_BLOCK_SOLVER_CONTACT_POINTS];
+    scalar b[MAX_BLOCK_SOLVER_CONTACT_POINTS];
+    for (uint i = 0; i < nbContacts; ++i)
+    {
+        const ContactPointSolver &contactPoint = manifold->contacts[i];
+        Vector3 deltaV = v2 + w2.cross(contactPoint.r2) -
+                         v1 - w1.cross(contactPoint.r1);
+
+        oldImpulses[i] = contactPoint.AccumulatedPenetrationImpulse;
+        b[i] = deltaV.dot(contactPoint.normal) + computeNormalVelocityBias(contactPoint);
+    }
+
+    for (uint i = 0; i < nbContacts; ++i)
+    {
+        for (uint j = 0; j < nbContacts; ++j) b[i] -= A[i * nbContacts + j] * oldImpulses[j];
+    }
+
+
+    // Enumerate the sets of active contact points from the largest to the empty one
+    scalar x[MAX_BLOCK_SOLVER_CONTACT_POINTS];
+    bool isSolutionFound = false;
+    for (int size = nbContacts; size >= 0 && !isSolutionFound; --size)
+    {
+        for (uint set = 0; set < (1u << nbContacts) && !isSolutionFound; ++set)
+        {
+            // Indexes of the active contact points of the set
+            uint indexes[MAX_BLOCK_SOLVER_CONTACT_POINTS];
+            int nbActive = 0;
+            for (uint i = 0; i < nbContacts; ++i)
+            {
+                if (set & (1u << i)) indexes[nbActive++] = i;
+            }
+            if (nbActive != size) continue;
+
+            // Cholesky factorization L*L^T of the system of the active contact points
+            scalar L[MAX_BLOCK_SOLVER_CONTACT_POINTS * MAX_BLOCK_SOLVER_CONTACT_POINTS];
+            bool isDegenerate = false;
+            for (int j = 0; j < nbActive && !isDegenerate; ++j)
+            {
+                for (int k = 0; k <= j; ++k)
+                {
+                    scalar sum = A[indexes[j] * nbContacts + indexes[k]];
+                    for (int l = 0; l < k; ++l) sum -= L[j * MAX_BLOCK_SOLVER_CONTACT_POINTS + l] *
+                                                       L[k * MAX_BLOCK_SOLVER_CONTACT_POINTS + l];
+
+                    if (j == k)
+                    {
+                        // The points of the set are linearly dependent
+                        if (sum <= BLOCK_SOLVER_PIVOT_TOLERANCE * A[indexes[j] * nbContacts + indexes[j]])
+                        {
+                            isDegenerate = true;
+                            break;
+                        }
+                        L[j * MAX_BLOCK_SOLVER_CONTACT_POINTS + j] = Sqrt(sum);
+                    }
+                    else
+                    {
+                        L[j * MAX_BLOCK_SOLVER_CONTACT_POINTS + k] = sum / L[k * MAX_BLOCK_SOLVER_CONTACT_POINTS + k];
+                    }
+                }
+            }
+            if (isDegenerate) continue;
+
+            // Solve L*L^T * x = -b for the active contact points
+            scalar y[MAX_BLOCK_SOLVER_CONTACT_POINTS];
+            for (int j = 0; j < nbActive; ++j)
+            {
+                scalar sum = -b[indexes[j]];
+                for (int l = 0; l < j; ++l) sum -= L[j * MAX_BLOCK_SOLVER_CONTACT_POINTS + l] * y[l];
+                y[j] = sum / L[j * MAX_BLOCK_SOLVER_CONTACT_POINTS + j];
+            }
+            for (int j = nbActive - 1; j >= 0; --j)
+            {
+                scalar sum = y[j];
+                for (int l = j + 1; l < nbActive; ++l) sum -= L[l * MAX_BLOCK_SOLVER_CONTACT_POINTS + j] * y[l];
+                y[j] = sum / L[j * MAX_BLOCK_SOLVER_CONTACT_POINTS + j];
+            }
+
+            for (uint i = 0; i < nbContacts; ++i) x[i] = scalar(0.0);
+
+            // The impulses of the active contact points must push the bodies apart
+            bool isValid = true;
+            for (int j = 0; j < nbActive; ++j)
+            {
+                if (y[j] < scalar(0.0)) isValid = false;
+                x[indexes[j]] = y[j];
+            }
+
+            // The other contact points must not approach each other
+            for (uint i = 0; i < nbContacts && isValid; ++i)
+            {
+                if (set & (1u << i)) continue;
+
+                scalar w = b[i];
+                for (uint j = 0; j < nbContacts; ++j) w += A[i * nbContacts + j] * x[j];
+                if (w < scalar(0.0)) isValid = false;
+            }
+
+            isSolutionFound = isValid;
+        }
+    }
+
+    if (!isSolutionFound) return false;
+
+
+    // Apply the changes of the impulses
+    for (uint i = 0; i < nbContacts; ++i)
+    {
+        ContactPointSolver &contactPoint = manifold->contacts[i];
+
+        scalar deltaLambda = x[i] - oldImpulses[i];
+        contactPoint.AccumulatedPenetrationImpulse = x[i];
+        residual = Max(residual, Abs(deltaLambda));
+
+        body1.applyImpulse(-contactPoint.normal * deltaLambda , contactPoint.r1);
+        body2.applyImpulse( contactPoint.normal * deltaLambda , contactPoint.r2);
+    }
+
+    return true;
+}
+
+
 /**********************************************************************************************/
 
 //scalar rpContactSolverSequentialImpulseObject::CalcualteImpuls( const ContactPointSolver& contactPoint, const Vector3& normal)
@@ -12,6 +12,7 @@
 // Libraries
 #include "../../Collision/collision.h"
 #include "../../Dynamics/Solver/rpContactSolver.h"
+#include "../../Dynamics/Solver/rpSolverBody.h"
 #include "../../Body/rpRigidPhysicsBody.h"
 #include "../../config.h"
 
@@ -31,6 +32,9 @@ class rpContactSolverSequentialImpulseObject : public rpContactSolver //, public
     rpRigidPhysicsBody *mBody1 = nullptr;
     rpRigidPhysicsBody *mBody2 = nullptr;
 
+    /// Solver bodies of the island , indexed by indexBody1 and indexBody2
+    rpSolverBody* mSolverBodies = nullptr;
+
 
     // Structure ContactPointSolver
     /**
@@ -116,6 +120,9 @@ class rpContactSolverSequentialImpulseObject : public rpContactSolver //, public
         /// True if the contact was existing last time step
         bool isRestingContact;
 
+        /// True if the contact is speculative (the bodies are still separated)
+        bool isSpeculative;
+
         /// Pointer to the external contact
         rpContactPoint* externalContact;
 
@@ -127,6 +134,9 @@ class rpContactSolverSequentialImpulseObject : public rpContactSolver //, public
 
 
 
+    /// Largest number of contact points solved together by the block solver
+    static const uint MAX_BLOCK_SOLVER_CONTACT_POINTS = 4;
+
     struct ContactManifoldSolver
     {
 
@@ -151,6 +161,9 @@ class rpContactSolverSequentialImpulseObject : public rpContactSolver //, public
         /// Contact point constraints
         ContactPointSolver contacts[MAX_CONTACT_POINTS_IN_MANIFOLD];
 
+        /// Matrix K of the normal constraints of all the contact points (block solver)
+        scalar normalMass[MAX_BLOCK_SOLVER_CONTACT_POINTS * MAX_BLOCK_SOLVER_CONTACT_POINTS];
+
 
         /************************************************/
 
@@ -257,6 +270,9 @@ class rpContactSolverSequentialImpulseObject : public rpContactSolver //, public
     /// Slop distance (allowed penetration distance between bodies)
     static const scalar SLOP;
 
+    /// Relative pivot of the block solver under which the contact points are linearly dependent
+    static const scalar BLOCK_SOLVER_PIVOT_TOLERANCE;
+
 
     /// Current time step
     scalar mTimeStep;
@@ -279,6 +295,7 @@ class rpContactSolverSequentialImpulseObject : public rpContactSolver //, public
     bool mIsSplitImpulseActive;
     bool mIsStaticFriction;
     bool mIsSolveFrictionAtContactManifoldCenterActive;
+    bool mIsBlockSolverActive;
 
 
 
@@ -309,6 +326,17 @@ class rpContactSolverSequentialImpulseObject : public rpContactSolver //, public
     void computeFrictionVectors( const Vector3& deltaVelocity , ContactManifoldSolver* contact ) const;
 
 
+    /// Return the velocity bias of the normal constraint of a contact point
+    scalar computeNormalVelocityBias(const ContactPointSolver& contactPoint) const;
+
+    /// Return true if the normal impulses of the manifold are solved together
+    bool isBlockSolved() const;
+
+    /// Solve the normal impulses of all the contact points together (a small LCP solved
+    /// by the enumeration of the active contact points), return false if it is degenerate
+    bool solveNormalConstraintsBlock(rpSolverBody& body1 , rpSolverBody& body2 , scalar& residual);
+
+
     /*********************************************************/
     //         scalar CalcualteImpuls(const ContactPointSolver &contactPoint, const Vector3 &normal);
     //         scalar CalcualteSplitImpuls(const ContactPointSolver &contactPoint, const Vector3 &normal);
@@ -325,6 +353,9 @@ public:
 
     void  initManiflod( rpContactManifold * manilod );
 
+    /// Set the solver bodies of the island
+    void  setSolverBodies( rpSolverBody* solverBodies );
+
     /// Initilization solver
     void  initializeForIsland( scalar dt );
     void  initializeContactConstraints();
@@ -332,11 +363,11 @@ public:
     /// Warm start the solver.
     void warmStart();
 
-    /// Solver velocity
-    void solveVelocityConstraint();
+    /// Solver velocity , return the largest change of an accumulated impulse
+    scalar solveVelocityConstraint();
 
-    /// Solver position and orientation
-    void solvePositionConstraint();
+    /// Solver position and orientation , return the largest change of an accumulated split impulse
+    scalar solvePositionConstraint();
 
     /// Store the computed impulses to use them to
     /// warm start the solver at the next iteration
@@ -354,6 +385,12 @@ public:
     /// the contact manifold instead of solving them at each contact point
     void setIsSolveFrictionAtContactManifoldCenterActive(bool isActive);
 
+    /// Return true if the normal impulses of the manifolds of 2 to 4 contact points are solved together
+    bool isBlockSolverActive() const;
+
+    /// Activate or deactivate the block solver of the normal impulses
+    void setIsBlockSolverActive(bool isActive);
+
      /// Return true if the warmstart impulses
     bool isIsWarmStartingActive() const;
 
@@ -363,6 +400,7 @@ public:
     //-------------------- Friendship --------------------//
 
     friend class rpDynamicsWorld;
+    friend class rpContactSolverWide;
 };
 
 
@@ -389,6 +427,18 @@ SIMD_INLINE  void rpContactSolverSequentialImpulseObject::setIsSolveFrictionAtCo
     mIsSolveFrictionAtContactManifoldCenterActive = isActive;
 }
 
+// Return true if the normal impulses of the manifolds of 2 to 4 contact points are solved together
+SIMD_INLINE  bool rpContactSolverSequentialImpulseObject::isBlockSolverActive() const
+{
+    return mIsBlockSolverActive;
+}
+
+// Activate or deactivate the block solver of the normal impulses
+SIMD_INLINE  void rpContactSolverSequentialImpulseObject::setIsBlockSolverActive(bool isActive)
+{
+    mIsBlockSolverActive = isActive;
+}
+
 // /// Return true if the warmstart impulses
 SIMD_INLINE  bool rpContactSolverSequentialImpulseObject::isIsWarmStartingActive() const
 {
@@ -0,0 +1,537 @@
+/*
+ * rpContactSolverWide.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#include "../../Dynamics/Solver/rpContactSolverWide.h"
+#include "../../Dynamics/rpIsland.h"
+
+namespace real_physics
+{
+
+
+
+rpContactSolverWide::rpContactSolverWide()
+: mNbBatches(0),
+  mFirstOpenBatch(0),
+  mNbContactRows(0)
+{
+    // The dummy static body of the empty lanes
+    mSolverBodies.push_back(NULL);
+    mBodyNextBatch.push_back(0);
+    mVelocities.resize(6, scalar(0.0));
+}
+
+rpContactSolverWide::~rpContactSolverWide()
+{
+
+}
+
+
+
+bool rpContactSolverWide::initializeForIslands( rpIsland** islands , uint nbIslands )
+{
+    // The lanes only solve the friction at the center of the contact manifold and
+    // no block of normal impulses , the other manifolds need the sequential solver
+    for (uint islandIndex = 0; islandIndex < nbIslands; islandIndex++)
+    {
+        for (uint i = 0; i < islands[islandIndex]->getNbContactManifolds(); i++)
+        {
+            rpContactSolverSequentialImpulseObject* solver =
+                    static_cast<rpContactSolverSequentialImpulseObject*>(islands[islandIndex]->getContactSolver(i));
+
+            if (solver->mIsError) continue;
+
+            if (!solver->mIsSolveFrictionAtContactManifoldCenterActive || solver->mIsBlockSolverActive)
+            {
+                return false;
+            }
+        }
+    }
+
+
+    mNbBatches      = 0;
+    mFirstOpenBatch = 0;
+    mNbContactRows  = 0;
+
+    mSolverBodies.resize(1);
+    mBodyNextBatch.resize(1);
+
+
+    // Colour the contact manifolds into the batches
+    for (uint islandIndex = 0; islandIndex < nbIslands; islandIndex++)
+    {
+        rpIsland* island = islands[islandIndex];
+
+        // The solver bodies of the island follow the ones of the previous islands
+        uint firstBodyIndex = mSolverBodies.size();
+        for (uint i = 0; i < island->getNbBodies(); i++)
+        {
+            mSolverBodies.push_back(&island->getSolverBodies()[i]);
+            mBodyNextBatch.push_back(0);
+        }
+
+        for (uint i = 0; i < island->getNbContactManifolds(); i++)
+        {
+            rpContactSolverSequentialImpulseObject* solver =
+                    static_cast<rpContactSolverSequentialImpulseObject*>(island->getContactSolver(i));
+
+            // The sequential solver skips it too
+            if (solver->mIsError) continue;
+
+            addContactManifold(solver, firstBodyIndex);
+        }
+    }
+
+
+    // Copy the constraints into the lanes
+    for (uint b = 0; b < mNbBatches; b++)
+    {
+        packBatch(mBatches[b]);
+    }
+
+    mVelocities.resize(6 * mSolverBodies.size());
+    gatherVelocities();
+
+    return true;
+}
+
+
+
+void rpContactSolverWide::addContactManifold( rpContactSolverSequentialImpulseObject* solver , uint firstBodyIndex )
+{
+    uint index1 = firstBodyIndex + solver->mContactConstraints->indexBody1;
+    uint index2 = firstBodyIndex + solver->mContactConstraints->indexBody2;
+
+    bool isBody1Dynamic = solver->mBody1->mType == DYNAMIC;
+    bool isBody2Dynamic = solver->mBody2->mType == DYNAMIC;
+
+
+    // A dynamic body is in one lane of a batch at most , only the
+    // static and kinematic bodies are shared by the lanes
+    uint batchIndex = mFirstOpenBatch;
+    if (isBody1Dynamic) batchIndex = Max(batchIndex, mBodyNextBatch[index1]);
+    if (isBody2Dynamic) batchIndex = Max(batchIndex, mBodyNextBatch[index2]);
+
+    while (batchIndex < mNbBatches && mBatches[batchIndex].nbLanes == WIDE_SOLVER_NB_LANES)
+    {
+        batchIndex++;
+    }
+
+
+    // Open a new batch
+    if (batchIndex == mNbBatches)
+    {
+        if (mBatches.size() <= mNbBatches) mBatches.resize(mNbBatches + 1);
+
+        Batch& batch = mBatches[mNbBatches];
+        batch.nbLanes = 0;
+        for (uint lane = 0; lane < WIDE_SOLVER_NB_LANES; lane++)
+        {
+            batch.offsetBody1[lane] = 0;
+            batch.offsetBody2[lane] = 0;
+            batch.solvers[lane] = NULL;
+        }
+
+        mNbBatches++;
+    }
+
+
+    Batch& batch = mBatches[batchIndex];
+    uint lane = batch.nbLanes++;
+    batch.offsetBody1[lane] = 6 * index1;
+    batch.offsetBody2[lane] = 6 * index2;
+    batch.solvers[lane] = solver;
+
+    if (isBody1Dynamic) mBodyNextBatch[index1] = batchIndex + 1;
+    if (isBody2Dynamic) mBodyNextBatch[index2] = batchIndex + 1;
+
+    while (mFirstOpenBatch < mNbBatches && mBatches[mFirstOpenBatch].nbLanes == WIDE_SOLVER_NB_LANES)
+    {
+        mFirstOpenBatch++;
+    }
+}
+
+
+
+SIMD_INLINE void rpContactSolverWide::setRow( ConstraintRow& row , uint lane ,
+                                              const Vector3& linear , const Vector3& angular1 , const Vector3& angular2 ,
+                                              const Matrix3x3& inverseInertia1 , const Matrix3x3& inverseInertia2 ,
+                                              scalar bias , scalar inverseMass , scalar impulse )
+{
+    Vector3 inverseInertiaAngular1 = inverseInertia1 * angular1;
+    Vector3 inverseInertiaAngular2 = inverseInertia2 * angular2;
+
+    for (uint k = 0; k < 3; k++)
+    {
+        row.linear[k][lane]   = linear[k];
+        row.angular1[k][lane] = angular1[k];
+        row.angular2[k][lane] = angular2[k];
+        row.inverseInertiaAngular1[k][lane] = inverseInertiaAngular1[k];
+        row.inverseInertiaAngular2[k][lane] = inverseInertiaAngular2[k];
+    }
+
+    row.bias[lane]        = bias;
+    row.inverseMass[lane] = inverseMass;
+    row.impulse[lane]     = impulse;
+}
+
+
+void rpContactSolverWide::packBatch( Batch& batch )
+{
+
+    // Rows of the batch , the empty lanes keep zero rows
+    batch.nbContactRows = 0;
+    for (uint lane = 0; lane < batch.nbLanes; lane++)
+    {
+        batch.nbContactRows = Max(batch.nbContactRows, batch.solvers[lane]->mContactConstraints->nbContacts);
+    }
+
+    batch.firstContactRow = mNbContactRows;
+    mNbContactRows += batch.nbContactRows;
+    if (mContactRows.size() < mNbContactRows) mContactRows.resize(mNbContactRows);
+
+    for (uint r = 0; r < batch.nbContactRows; r++)
+    {
+        mContactRows[batch.firstContactRow + r] = ConstraintRow();
+    }
+
+    batch.friction1     = ConstraintRow();
+    batch.friction2     = ConstraintRow();
+    batch.frictionTwist = ConstraintRow();
+    batch.isRollingResistance = false;
+
+    for (uint lane = 0; lane < WIDE_SOLVER_NB_LANES; lane++)
+    {
+        batch.massInverseBody1[lane] = scalar(0.0);
+        batch.massInverseBody2[lane] = scalar(0.0);
+        batch.frictionCoefficient[lane] = scalar(0.0);
+        batch.rollingResistanceFactor[lane] = scalar(0.0);
+
+        for (uint k = 0; k < 9; k++)
+        {
+            batch.inverseRollingResistance[k][lane] = scalar(0.0);
+            batch.inverseInertiaBody1[k][lane] = scalar(0.0);
+            batch.inverseInertiaBody2[k][lane] = scalar(0.0);
+        }
+
+        for (uint k = 0; k < 3; k++)
+        {
+            batch.rollingResistanceImpulse[k][lane] = scalar(0.0);
+        }
+    }
+
+
+
+    for (uint lane = 0; lane < batch.nbLanes; lane++)
+    {
+        rpContactSolverSequentialImpulseObject* solver = batch.solvers[lane];
+        rpContactSolverSequentialImpulseObject::ContactManifoldSolver& manifold = *solver->mContactConstraints;
+
+        // The inverse mass and inertia of the static and kinematic solver bodies are zero
+        const rpSolverBody* body1 = mSolverBodies[batch.offsetBody1[lane] / 6];
+        const rpSolverBody* body2 = mSolverBodies[batch.offsetBody2[lane] / 6];
+
+        const Matrix3x3& I1 = body1->inverseInertiaTensorWorld;
+        const Matrix3x3& I2 = body2->inverseInertiaTensorWorld;
+
+        batch.massInverseBody1[lane] = body1->massInverse;
+        batch.massInverseBody2[lane] = body2->massInverse;
+        batch.frictionCoefficient[lane] = manifold.frictionCoefficient;
+
+
+        // --------- Penetration --------- //
+        for (uint c = 0; c < manifold.nbContacts; c++)
+        {
+            rpContactSolverSequentialImpulseObject::ContactPointSolver& contactPoint = manifold.contacts[c];
+
+
+            // The velocity bias as in the sequential solver
+            scalar bias;
+            if (contactPoint.isSpeculative)
+            {
+                bias = (contactPoint.restitutionBias < scalar(0.0)) ? contactPoint.restitutionBias :
+                                                                      Abs(contactPoint.penetrationDepth) / solver->mTimeStep;
+            }
+            else if (solver->mIsSplitImpulseActive)
+            {
+                bias = contactPoint.restitutionBias;
+            }
+            else
+            {
+                scalar biasPenetrationDepth = scalar(0.0);
+                if (contactPoint.penetrationDepth > rpContactSolverSequentialImpulseObject::SLOP)
+                {
+                    biasPenetrationDepth = contactPoint.externalContact->getPenetrationDepth();
+                }
+
+                bias = biasPenetrationDepth + contactPoint.restitutionBias;
+            }
+
+
+            setRow(mContactRows[batch.firstContactRow + c], lane ,
+                   contactPoint.normal , contactPoint.r1CrossN , contactPoint.r2CrossN , I1 , I2 ,
+                   bias , contactPoint.inversePenetrationMass , contactPoint.AccumulatedPenetrationImpulse);
+        }
+
+        if (manifold.nbContacts == 0) continue;
+
+
+        // --------- Friction at the center of the contact manifold --------- //
+        setRow(batch.friction1 , lane ,
+               manifold.frictionVector1 , manifold.r1CrossT1 , manifold.r2CrossT1 , I1 , I2 ,
+               scalar(0.0) , manifold.inverseFriction1Mass , manifold.AccumulatedFriction1Impulse);
+
+        setRow(batch.friction2 , lane ,
+               manifold.frictionVector2 , manifold.r1CrossT2 , manifold.r2CrossT2 , I1 , I2 ,
+               scalar(0.0) , manifold.inverseFriction2Mass , manifold.AccumulatedFriction2Impulse);
+
+        setRow(batch.frictionTwist , lane ,
+               Vector3::ZERO , manifold.normal , manifold.normal , I1 , I2 ,
+               scalar(0.0) , manifold.inverseTwistFrictionMass , manifold.AccumulatedFrictionTwistImpulse);
+
+
+        // --------- Rolling resistance --------- //
+        if (manifold.rollingResistanceFactor > 0)
+        {
+            batch.isRollingResistance = true;
+            batch.rollingResistanceFactor[lane] = manifold.rollingResistanceFactor;
+
+            for (uint i = 0; i < 3; i++)
+            {
+                for (uint j = 0; j < 3; j++)
+                {
+                    batch.inverseRollingResistance[3*i + j][lane] = manifold.inverseRollingResistance[i][j];
+                    batch.inverseInertiaBody1[3*i + j][lane] = I1[i][j];
+                    batch.inverseInertiaBody2[3*i + j][lane] = I2[i][j];
+                }
+
+                batch.rollingResistanceImpulse[i][lane] = manifold.AccumulatedRollingResistanceImpulse[i];
+            }
+        }
+    }
+}
+
+
+
+void rpContactSolverWide::gatherVelocities()
+{
+    scalar* velocities = &mVelocities[0];
+
+    for (uint i = 1; i < mSolverBodies.size(); i++)
+    {
+        const Vector3& linearVelocity  = mSolverBodies[i]->linearVelocity;
+        const Vector3& angularVelocity = mSolverBodies[i]->angularVelocity;
+
+        for (uint k = 0; k < 3; k++)
+        {
+            velocities[6*i + k]     = linearVelocity[k];
+            velocities[6*i + 3 + k] = angularVelocity[k];
+        }
+    }
+}
+
+
+void rpContactSolverWide::scatterVelocities()
+{
+    const scalar* velocities = &mVelocities[0];
+
+    for (uint i = 1; i < mSolverBodies.size(); i++)
+    {
+        mSolverBodies[i]->linearVelocity  = Vector3(velocities[6*i + 0], velocities[6*i + 1], velocities[6*i + 2]);
+        mSolverBodies[i]->angularVelocity = Vector3(velocities[6*i + 3], velocities[6*i + 4], velocities[6*i + 5]);
+    }
+}
+
+
+
+SIMD_INLINE rpWideScalar rpContactSolverWide::solveRow( ConstraintRow& row ,
+                                                        const rpWideScalar& massInverse1 , const rpWideScalar& massInverse2 ,
+                                                        const rpWideScalar& lowerLimit , const rpWideScalar& upperLimit ,
+                                                        rpWideScalar v1[3] , rpWideScalar w1[3] ,
+                                                        rpWideScalar v2[3] , rpWideScalar w2[3] )
+{
+    rpWideScalar linear[3];
+    rpWideScalar angular1[3];
+    rpWideScalar angular2[3];
+    for (uint k = 0; k < 3; k++)
+    {
+        linear[k]   = rpWideScalar::load(row.linear[k]);
+        angular1[k] = rpWideScalar::load(row.angular1[k]);
+        angular2[k] = rpWideScalar::load(row.angular2[k]);
+    }
+
+
+    // Compute J*v
+    rpWideScalar Jv = linear[0] * (v2[0] - v1[0]) + linear[1] * (v2[1] - v1[1]) + linear[2] * (v2[2] - v1[2]) +
+                      angular2[0] * w2[0] + angular2[1] * w2[1] + angular2[2] * w2[2] -
+                      angular1[0] * w1[0] - angular1[1] * w1[1] - angular1[2] * w1[2];
+
+
+    // Compute the Lagrange multiplier lambda
+    rpWideScalar deltaLambda = (rpWideScalar::splat(scalar(0.0)) - (Jv + rpWideScalar::load(row.bias))) *
+                               rpWideScalar::load(row.inverseMass);
+
+    rpWideScalar lambdaTemp = rpWideScalar::load(row.impulse);
+    rpWideScalar lambda = rpWideScalar::maximum(lowerLimit, rpWideScalar::minimum(lambdaTemp + deltaLambda, upperLimit));
+    lambda.store(row.impulse);
+    deltaLambda = lambda - lambdaTemp;
+
+
+    // Apply the impulse P = J^T * lambda
+    rpWideScalar linearImpulse1 = massInverse1 * deltaLambda;
+    rpWideScalar linearImpulse2 = massInverse2 * deltaLambda;
+    for (uint k = 0; k < 3; k++)
+    {
+        v1[k] = v1[k] - linear[k] * linearImpulse1;
+        v2[k] = v2[k] + linear[k] * linearImpulse2;
+        w1[k] = w1[k] - rpWideScalar::load(row.inverseInertiaAngular1[k]) * deltaLambda;
+        w2[k] = w2[k] + rpWideScalar::load(row.inverseInertiaAngular2[k]) * deltaLambda;
+    }
+
+    return lambda;
+}
+
+
+void rpContactSolverWide::solveBatch( Batch& batch )
+{
+    scalar* velocities = &mVelocities[0];
+
+    // Gather the velocities of the lanes
+    rpWideScalar v1[3] , w1[3] , v2[3] , w2[3];
+    for (uint k = 0; k < 3; k++)
+    {
+        v1[k] = rpWideScalar::gather(velocities + k     , batch.offsetBody1);
+        w1[k] = rpWideScalar::gather(velocities + 3 + k , batch.offsetBody1);
+        v2[k] = rpWideScalar::gather(velocities + k     , batch.offsetBody2);
+        w2[k] = rpWideScalar::gather(velocities + 3 + k , batch.offsetBody2);
+    }
+
+    const rpWideScalar massInverse1 = rpWideScalar::load(batch.massInverseBody1);
+    const rpWideScalar massInverse2 = rpWideScalar::load(batch.massInverseBody2);
+    const rpWideScalar zero = rpWideScalar::splat(scalar(0.0));
+
+
+    // --------- Penetration --------- //
+    const rpWideScalar largest = rpWideScalar::splat(SCALAR_LARGEST);
+    rpWideScalar sumPenetrationImpulse = zero;
+    for (uint r = 0; r < batch.nbContactRows; r++)
+    {
+        sumPenetrationImpulse = sumPenetrationImpulse +
+                solveRow(mContactRows[batch.firstContactRow + r], massInverse1, massInverse2, zero, largest, v1, w1, v2, w2);
+    }
+
+
+    // --------- Friction and twist friction at the center of the contact manifold --------- //
+    const rpWideScalar frictionLimit = rpWideScalar::load(batch.frictionCoefficient) * sumPenetrationImpulse;
+    const rpWideScalar frictionLimitNegative = zero - frictionLimit;
+    solveRow(batch.friction1    , massInverse1, massInverse2, frictionLimitNegative, frictionLimit, v1, w1, v2, w2);
+    solveRow(batch.friction2    , massInverse1, massInverse2, frictionLimitNegative, frictionLimit, v1, w1, v2, w2);
+    solveRow(batch.frictionTwist, massInverse1, massInverse2, frictionLimitNegative, frictionLimit, v1, w1, v2, w2);
+
+
+    // --------- Rolling resistance at the center of the contact manifold --------- //
+    if (batch.isRollingResistance)
+    {
+        // Compute J*v
+        rpWideScalar JvRolling[3];
+        for (uint k = 0; k < 3; k++) JvRolling[k] = w2[k] - w1[k];
+
+        // Compute the Lagrange multiplier lambda
+        rpWideScalar lambdaTemp[3];
+        rpWideScalar lambda[3];
+        for (uint i = 0; i < 3; i++)
+        {
+            rpWideScalar deltaLambda = zero - (rpWideScalar::load(batch.inverseRollingResistance[3*i + 0]) * JvRolling[0] +
+                                               rpWideScalar::load(batch.inverseRollingResistance[3*i + 1]) * JvRolling[1] +
+                                               rpWideScalar::load(batch.inverseRollingResistance[3*i + 2]) * JvRolling[2]);
+            lambdaTemp[i] = rpWideScalar::load(batch.rollingResistanceImpulse[i]);
+            lambda[i] = lambdaTemp[i] + deltaLambda;
+        }
+
+        // Clamp the length of the accumulated impulse
+        rpWideScalar rollingLimit = rpWideScalar::load(batch.rollingResistanceFactor) * sumPenetrationImpulse;
+        rpWideScalar lengthSquare = lambda[0] * lambda[0] + lambda[1] * lambda[1] + lambda[2] * lambda[2];
+        rpWideScalar factor = rpWideScalar::selectGreater(lengthSquare, rollingLimit * rollingLimit,
+                                                          rollingLimit / rpWideScalar::sqrt(lengthSquare),
+                                                          rpWideScalar::splat(scalar(1.0)));
+
+        rpWideScalar deltaLambda[3];
+        for (uint i = 0; i < 3; i++)
+        {
+            lambda[i] = lambda[i] * factor;
+            lambda[i].store(batch.rollingResistanceImpulse[i]);
+            deltaLambda[i] = lambda[i] - lambdaTemp[i];
+        }
+
+        // Apply the impulses to the bodies of the constraint
+        for (uint i = 0; i < 3; i++)
+        {
+            w1[i] = w1[i] - (rpWideScalar::load(batch.inverseInertiaBody1[3*i + 0]) * deltaLambda[0] +
+                             rpWideScalar::load(batch.inverseInertiaBody1[3*i + 1]) * deltaLambda[1] +
+                             rpWideScalar::load(batch.inverseInertiaBody1[3*i + 2]) * deltaLambda[2]);
+
+            w2[i] = w2[i] + (rpWideScalar::load(batch.inverseInertiaBody2[3*i + 0]) * deltaLambda[0] +
+                             rpWideScalar::load(batch.inverseInertiaBody2[3*i + 1]) * deltaLambda[1] +
+                             rpWideScalar::load(batch.inverseInertiaBody2[3*i + 2]) * deltaLambda[2]);
+        }
+    }
+
+
+    // Scatter the velocities of the lanes (the body 2 of a lane
+    // is never the body 1 of another one , but for a static body)
+    for (uint k = 0; k < 3; k++)
+    {
+        v1[k].scatter(velocities + k     , batch.offsetBody1);
+        w1[k].scatter(velocities + 3 + k , batch.offsetBody1);
+        v2[k].scatter(velocities + k     , batch.offsetBody2);
+        w2[k].scatter(velocities + 3 + k , batch.offsetBody2);
+    }
+}
+
+
+void rpContactSolverWide::solveVelocityConstraint()
+{
+    for (uint b = 0; b < mNbBatches; b++)
+    {
+        solveBatch(mBatches[b]);
+    }
+}
+
+
+
+void rpContactSolverWide::storeImpulses()
+{
+    for (uint b = 0; b < mNbBatches; b++)
+    {
+        Batch& batch = mBatches[b];
+
+        for (uint lane = 0; lane < batch.nbLanes; lane++)
+        {
+            rpContactSolverSequentialImpulseObject::ContactManifoldSolver& manifold = *batch.solvers[lane]->mContactConstraints;
+
+            for (uint c = 0; c < manifold.nbContacts; c++)
+            {
+                manifold.contacts[c].AccumulatedPenetrationImpulse = mContactRows[batch.firstContactRow + c].impulse[lane];
+            }
+
+            if (manifold.nbContacts == 0) continue;
+
+            manifold.AccumulatedFriction1Impulse     = batch.friction1.impulse[lane];
+            manifold.AccumulatedFriction2Impulse     = batch.friction2.impulse[lane];
+            manifold.AccumulatedFrictionTwistImpulse = batch.frictionTwist.impulse[lane];
+
+            if (manifold.rollingResistanceFactor > 0)
+            {
+                manifold.AccumulatedRollingResistanceImpulse = Vector3(batch.rollingResistanceImpulse[0][lane],
+                                                                       batch.rollingResistanceImpulse[1][lane],
+                                                                       batch.rollingResistanceImpulse[2][lane]);
+            }
+        }
+    }
+}
+
+
+} /* namespace real_physics */
@@ -0,0 +1,415 @@
+/*
+ * rpContactSolverWide.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SOURCE_ENGIE_KINEMATICPHYSICS_SOLVER_RPCONTACTSOLVERWIDE_H_
+#define SOURCE_ENGIE_KINEMATICPHYSICS_SOLVER_RPCONTACTSOLVERWIDE_H_
+
+// Libraries
+#include "../../Dynamics/Solver/rpContactSolverSequentialImpulseObject.h"
+#include "../../LinearMaths/rpSimd.h"
+#include "../../config.h"
+#include <vector>
+
+
+#if defined(RP_SIMD_ENABLED) && !defined(IS_DOUBLE_PRECISION_ENABLED)
+    #define RP_WIDE_SOLVER_SIMD
+#endif
+
+
+namespace real_physics
+{
+
+class rpIsland;
+
+
+/// Number of the contact manifolds solved together in a batch
+const uint WIDE_SOLVER_NB_LANES = 4;
+
+
+
+/**********************************************
+ *  One scalar by lane of a batch. It is a SIMD register
+ *  in single precision , the lanes are a plain array else.
+ **********************************************/
+struct rpWideScalar
+{
+
+#if defined(RP_WIDE_SOLVER_SIMD)
+    rpSimdFloat4 v;
+#else
+    scalar v[WIDE_SOLVER_NB_LANES];
+#endif
+
+    static rpWideScalar load(const scalar* p);
+    static rpWideScalar splat(scalar value);
+
+    /// Load the scalar at the offset of each lane
+    static rpWideScalar gather(const scalar* base , const uint* offsets);
+
+    void store(scalar* p) const;
+
+    /// Store the lanes at their offset
+    void scatter(scalar* base , const uint* offsets) const;
+
+    friend rpWideScalar operator+(const rpWideScalar& a , const rpWideScalar& b);
+    friend rpWideScalar operator-(const rpWideScalar& a , const rpWideScalar& b);
+    friend rpWideScalar operator*(const rpWideScalar& a , const rpWideScalar& b);
+    friend rpWideScalar operator/(const rpWideScalar& a , const rpWideScalar& b);
+
+    static rpWideScalar minimum(const rpWideScalar& a , const rpWideScalar& b);
+    static rpWideScalar maximum(const rpWideScalar& a , const rpWideScalar& b);
+    static rpWideScalar sqrt(const rpWideScalar& a);
+
+    /// Return by lane (a > b) ? x : y
+    static rpWideScalar selectGreater(const rpWideScalar& a , const rpWideScalar& b ,
+                                      const rpWideScalar& x , const rpWideScalar& y);
+};
+
+
+
+
+/**********************************************
+ *  Contact solver of the velocity constraints working on
+ *  batches of contact manifolds (AoSoA layout). The manifolds
+ *  of a batch have no common dynamic body , so their normal ,
+ *  friction , twist and rolling resistance rows are solved
+ *  together in the lanes against a gathered array with the
+ *  velocities of the bodies.
+ *
+ *  The constraints are initialized and warm started by the
+ *  sequential impulse solvers of the manifolds , this solver
+ *  only replaces the velocity iterations and gives back the
+ *  accumulated impulses to them.
+ **********************************************/
+class rpContactSolverWide
+{
+
+    /// Jacobian row of one constraint for the lanes of a batch
+    struct ConstraintRow
+    {
+        /// Direction of the linear impulse (zero for the twist friction)
+        scalar linear[3][WIDE_SOLVER_NB_LANES];
+
+        /// Angular Jacobian of the body 1 and of the body 2
+        scalar angular1[3][WIDE_SOLVER_NB_LANES];
+        scalar angular2[3][WIDE_SOLVER_NB_LANES];
+
+        /// Inverse inertia tensor times the angular Jacobian (zero for a not dynamic body)
+        scalar inverseInertiaAngular1[3][WIDE_SOLVER_NB_LANES];
+        scalar inverseInertiaAngular2[3][WIDE_SOLVER_NB_LANES];
+
+        /// Velocity bias of the row
+        scalar bias[WIDE_SOLVER_NB_LANES];
+
+        /// Inverse of the matrix K of the row
+        scalar inverseMass[WIDE_SOLVER_NB_LANES];
+
+        /// Accumulated impulse
+        scalar impulse[WIDE_SOLVER_NB_LANES];
+    };
+
+
+    /// Batch of contact manifolds without a common dynamic body
+    struct Batch
+    {
+        /// Number of the used lanes
+        uint nbLanes;
+
+        /// Offset of the velocities of the bodies in the velocity array
+        uint offsetBody1[WIDE_SOLVER_NB_LANES];
+        uint offsetBody2[WIDE_SOLVER_NB_LANES];
+
+        /// Inverse mass of the bodies (zero for a not dynamic body)
+        scalar massInverseBody1[WIDE_SOLVER_NB_LANES];
+        scalar massInverseBody2[WIDE_SOLVER_NB_LANES];
+
+        /// First penetration row of the batch and the largest number of contacts of its manifolds
+        uint firstContactRow;
+        uint nbContactRows;
+
+        /// Mix friction coefficient for the two bodies
+        scalar frictionCoefficient[WIDE_SOLVER_NB_LANES];
+
+        /// Friction rows at the center of the contact manifolds
+        ConstraintRow friction1;
+        ConstraintRow friction2;
+        ConstraintRow frictionTwist;
+
+        /// True if one of the manifolds has a rolling resistance
+        bool isRollingResistance;
+
+        /// Rolling resistance factor between the two bodies
+        scalar rollingResistanceFactor[WIDE_SOLVER_NB_LANES];
+
+        /// Matrix K of the rolling resistance and the inverse inertia tensors (row-major)
+        scalar inverseRollingResistance[9][WIDE_SOLVER_NB_LANES];
+        scalar inverseInertiaBody1[9][WIDE_SOLVER_NB_LANES];
+        scalar inverseInertiaBody2[9][WIDE_SOLVER_NB_LANES];
+
+        /// Accumulated rolling resistance impulse
+        scalar rollingResistanceImpulse[3][WIDE_SOLVER_NB_LANES];
+
+        /// Solvers of the manifolds of the lanes
+        rpContactSolverSequentialImpulseObject* solvers[WIDE_SOLVER_NB_LANES];
+    };
+
+
+    //------------------- Attributes -----------------------//
+
+    /// Batches of the contact manifolds
+    std::vector<Batch> mBatches;
+    uint               mNbBatches;
+
+    /// First batch with an empty lane
+    uint mFirstOpenBatch;
+
+    /// Penetration rows of the batches
+    std::vector<ConstraintRow> mContactRows;
+    uint                       mNbContactRows;
+
+    /// Solver bodies of the velocity array (the first one is a static dummy body for the empty lanes)
+    std::vector<rpSolverBody*> mSolverBodies;
+
+    /// Linear and angular velocity of each body
+    std::vector<scalar> mVelocities;
+
+    /// Index after the last batch with a manifold of each body
+    std::vector<uint> mBodyNextBatch;
+
+
+    //------------------- Methods -----------------------//
+
+    /// Add the contact manifold of a solver to the first batch without its dynamic bodies ,
+    /// the solver bodies of its island start at "firstBodyIndex" in the velocity array
+    void addContactManifold( rpContactSolverSequentialImpulseObject* solver , uint firstBodyIndex );
+
+    /// Copy the constraints of the manifolds of a batch into its lanes
+    void packBatch( Batch& batch );
+
+    /// Set a lane of a row
+    static void setRow( ConstraintRow& row , uint lane ,
+                        const Vector3& linear , const Vector3& angular1 , const Vector3& angular2 ,
+                        const Matrix3x3& inverseInertia1 , const Matrix3x3& inverseInertia2 ,
+                        scalar bias , scalar inverseMass , scalar impulse );
+
+    /// Solve a row for the lanes , the accumulated impulse is clamped into [lowerLimit , upperLimit]
+    static rpWideScalar solveRow( ConstraintRow& row ,
+                                  const rpWideScalar& massInverse1 , const rpWideScalar& massInverse2 ,
+                                  const rpWideScalar& lowerLimit , const rpWideScalar& upperLimit ,
+                                  rpWideScalar v1[3] , rpWideScalar w1[3] ,
+                                  rpWideScalar v2[3] , rpWideScalar w2[3] );
+
+    /// Solve the velocity constraints of a batch
+    void solveBatch( Batch& batch );
+
+
+    /// Private copy-constructor
+    rpContactSolverWide(const rpContactSolverWide& solver);
+
+    /// Private assignment operator
+    rpContactSolverWide& operator=(const rpContactSolverWide& solver);
+
+public:
+
+     rpContactSolverWide();
+    ~rpContactSolverWide();
+
+    /// Pack the warm started contact manifolds of the islands into the batches , return false
+    /// (nothing packed) if a manifold solves its friction at the contact points or blocks its normal impulses
+    bool initializeForIslands( rpIsland** islands , uint nbIslands );
+
+    /// Copy the velocities of the solver bodies into the velocity array
+    void gatherVelocities();
+
+    /// Solve the velocity constraints of all the batches
+    void solveVelocityConstraint();
+
+    /// Copy the velocity array back into the solver bodies
+    void scatterVelocities();
+
+    /// Give the accumulated impulses back to the solvers of the manifolds
+    void storeImpulses();
+
+    /// Return the number of batches
+    uint getNbBatches() const;
+};
+
+
+/********************************************************************************************************/
+
+#if defined(RP_WIDE_SOLVER_SIMD)
+
+SIMD_INLINE rpWideScalar rpWideScalar::load(const scalar* p)
+{
+    rpWideScalar r; r.v = rpSimdLoad4(p); return r;
+}
+
+SIMD_INLINE rpWideScalar rpWideScalar::splat(scalar value)
+{
+    rpWideScalar r; r.v = rpSimdSplat(value); return r;
+}
+
+SIMD_INLINE rpWideScalar rpWideScalar::gather(const scalar* base , const uint* offsets)
+{
+    rpWideScalar r; r.v = rpSimdSet4(base[offsets[0]], base[offsets[1]], base[offsets[2]], base[offsets[3]]); return r;
+}
+
+SIMD_INLINE void rpWideScalar::store(scalar* p) const
+{
+    rpSimdStore4(p, v);
+}
+
+SIMD_INLINE void rpWideScalar::scatter(scalar* base , const uint* offsets) const
+{
+    scalar f[WIDE_SOLVER_NB_LANES];
+    rpSimdStore4(f, v);
+    base[offsets[0]] = f[0]; base[offsets[1]] = f[1]; base[offsets[2]] = f[2]; base[offsets[3]] = f[3];
+}
+
+SIMD_INLINE rpWideScalar operator+(const rpWideScalar& a , const rpWideScalar& b)
+{
+    rpWideScalar r; r.v = rpSimdAdd(a.v, b.v); return r;
+}
+
+SIMD_INLINE rpWideScalar operator-(const rpWideScalar& a , const rpWideScalar& b)
+{
+    rpWideScalar r; r.v = rpSimdSub(a.v, b.v); return r;
+}
+
+SIMD_INLINE rpWideScalar operator*(const rpWideScalar& a , const rpWideScalar& b)
+{
+    rpWideScalar r; r.v = rpSimdMul(a.v, b.v); return r;
+}
+
+SIMD_INLINE rpWideScalar operator/(const rpWideScalar& a , const rpWideScalar& b)
+{
+    rpWideScalar r; r.v = rpSimdDiv(a.v, b.v); return r;
+}
+
+SIMD_INLINE rpWideScalar rpWideScalar::minimum(const rpWideScalar& a , const rpWideScalar& b)
+{
+    rpWideScalar r; r.v = rpSimdMin(a.v, b.v); return r;
+}
+
+SIMD_INLINE rpWideScalar rpWideScalar::maximum(const rpWideScalar& a , const rpWideScalar& b)
+{
+    rpWideScalar r; r.v = rpSimdMax(a.v, b.v); return r;
+}
+
+SIMD_INLINE rpWideScalar rpWideScalar::sqrt(const rpWideScalar& a)
+{
+    rpWideScalar r; r.v = rpSimdSqrt(a.v); return r;
+}
+
+SIMD_INLINE rpWideScalar rpWideScalar::selectGreater(const rpWideScalar& a , const rpWideScalar& b ,
+                                                     const rpWideScalar& x , const rpWideScalar& y)
+{
+    rpWideScalar r; r.v = rpSimdSelectGreater(a.v, b.v, x.v, y.v); return r;
+}
+
+#else
+
+SIMD_INLINE rpWideScalar rpWideScalar::load(const scalar* p)
+{
+    rpWideScalar r;
+    for (uint i = 0; i < WIDE_SOLVER_NB_LANES; ++i) r.v[i] = p[i];
+    return r;
+}
+
+SIMD_INLINE rpWideScalar rpWideScalar::splat(scalar value)
+{
+    rpWideScalar r;
+    for (uint i = 0; i < WIDE_SOLVER_NB_LANES; ++i) r.v[i] = value;
+    return r;
+}
+
+SIMD_INLINE rpWideScalar rpWideScalar::gather(const scalar* base , const uint* offsets)
+{
+    rpWideScalar r;
+    for (uint i = 0; i < WIDE_SOLVER_NB_LANES; ++i) r.v[i] = base[offsets[i]];
+    return r;
+}
+
+SIMD_INLINE void rpWideScalar::store(scalar* p) const
+{
+    for (uint i = 0; i < WIDE_SOLVER_NB_LANES; ++i) p[i] = v[i];
+}
+
+SIMD_INLINE void rpWideScalar::scatter(scalar* base , const uint* offsets) const
+{
+    for (uint i = 0; i < WIDE_SOLVER_NB_LANES; ++i) base[offsets[i]] = v[i];
+}
+
+SIMD_INLINE rpWideScalar operator+(const rpWideScalar& a , const rpWideScalar& b)
+{
+    rpWideScalar r;
+    for (uint i = 0; i < WIDE_SOLVER_NB_LANES; ++i) r.v[i] = a.v[i] + b.v[i];
+    return r;
+}
+
+SIMD_INLINE rpWideScalar operator-(const rpWideScalar& a , const rpWideScalar& b)
+{
+    rpWideScalar r;
+    for (uint i = 0; i < WIDE_SOLVER_NB_LANES; ++i) r.v[i] = a.v[i] - b.v[i];
+    return r;
+}
+
+SIMD_INLINE rpWideScalar operator*(const rpWideScalar& a , const rpWideScalar& b)
+{
+    rpWideScalar r;
+    for (uint i = 0; i < WIDE_SOLVER_NB_LANES; ++i) r.v[i] = a.v[i] * b.v[i];
+    return r;
+}
+
+SIMD_INLINE rpWideScalar operator/(const rpWideScalar& a , const rpWideScalar& b)
+{
+    rpWideScalar r;
+    for (uint i = 0; i < WIDE_SOLVER_NB_LANES; ++i) r.v[i] = a.v[i] / b.v[i];
+    return r;
+}
+
+SIMD_INLINE rpWideScalar rpWideScalar::minimum(const rpWideScalar& a , const rpWideScalar& b)
+{
+    rpWideScalar r;
+    for (uint i = 0; i < WIDE_SOLVER_NB_LANES; ++i) r.v[i] = Min(a.v[i], b.v[i]);
+    return r;
+}
+
+SIMD_INLINE rpWideScalar rpWideScalar::maximum(const rpWideScalar& a , const rpWideScalar& b)
+{
+    rpWideScalar r;
+    for (uint i = 0; i < WIDE_SOLVER_NB_LANES; ++i) r.v[i] = Max(a.v[i], b.v[i]);
+    return r;
+}
+
+SIMD_INLINE rpWideScalar rpWideScalar::sqrt(const rpWideScalar& a)
+{
+    rpWideScalar r;
+    for (uint i = 0; i < WIDE_SOLVER_NB_LANES; ++i) r.v[i] = SquareRoot(a.v[i]);
+    return r;
+}
+
+SIMD_INLINE rpWideScalar rpWideScalar::selectGreater(const rpWideScalar& a , const rpWideScalar& b ,
+                                                     const rpWideScalar& x , const rpWideScalar& y)
+{
+    rpWideScalar r;
+    for (uint i = 0; i < WIDE_SOLVER_NB_LANES; ++i) r.v[i] = (a.v[i] > b.v[i]) ? x.v[i] : y.v[i];
+    return r;
+}
+
+#endif
+
+
+
+SIMD_INLINE uint rpContactSolverWide::getNbBatches() const
+{
+    return mNbBatches;
+}
+
+} /* namespace real_physics */
+
+#endif /* SOURCE_ENGIE_KINEMATICPHYSICS_SOLVER_RPCONTACTSOLVERWIDE_H_ */
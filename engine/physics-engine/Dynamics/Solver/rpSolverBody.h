@@ -0,0 +1,139 @@
+/*
+ * rpSolverBody.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SOURCE_ENGIE_KINEMATICPHYSICS_SOLVER_RPSOLVERBODY_H_
+#define SOURCE_ENGIE_KINEMATICPHYSICS_SOLVER_RPSOLVERBODY_H_
+
+#include "../../Body/rpRigidPhysicsBody.h"
+
+namespace real_physics
+{
+
+
+/**********************************************
+ *  Compact copy of a rigid body for the constraint solver.
+ *  The island gathers its bodies into an array of solver bodies
+ *  before the warm start and scatters the velocities back after
+ *  the impulses are stored , the constraints reference the bodies
+ *  by their index in the array.
+ *
+ *  The inverse mass and inertia tensor of a static or kinematic
+ *  body are zero , so the impulses do not change its velocities.
+ **********************************************/
+struct rpSolverBody
+{
+    /// Linear velocity
+    Vector3 linearVelocity;
+
+    /// Angular velocity
+    Vector3 angularVelocity;
+
+    /// Split linear velocity (position correction of the contacts)
+    Vector3 splitLinearVelocity;
+
+    /// Split angular velocity (position correction of the contacts)
+    Vector3 splitAngularVelocity;
+
+    /// Inverse of the inertia tensor in world-space
+    Matrix3x3 inverseInertiaTensorWorld;
+
+    /// Inverse of the mass
+    scalar massInverse;
+
+    /// Rigid body of the solver body
+    rpRigidPhysicsBody* body;
+
+
+    /// Copy the rigid body
+    void gather(rpRigidPhysicsBody* rigidBody);
+
+    /// Copy the velocities back into a dynamic rigid body
+    void scatter() const;
+
+
+    /// Apply an impulse at the point "r" from the center of mass
+    void applyImpulse(const Vector3& impulse , const Vector3& r);
+    void applyImpulseLinear(const Vector3& impulse);
+    void applyImpulseAngular(const Vector3& impulse);
+
+    /// Apply a pseudo impulse at the point "r" from the center of mass
+    void applySplitImpulse(const Vector3& impulse , const Vector3& r);
+    void applySplitImpulseLinear(const Vector3& impulse);
+    void applySplitImpulseAngular(const Vector3& impulse);
+};
+
+
+/********************************************************************************************************/
+
+SIMD_INLINE void rpSolverBody::gather(rpRigidPhysicsBody* rigidBody)
+{
+    body = rigidBody;
+    linearVelocity       = rigidBody->mLinearVelocity;
+    angularVelocity      = rigidBody->mAngularVelocity;
+    splitLinearVelocity  = rigidBody->mSplitLinearVelocity;
+    splitAngularVelocity = rigidBody->mSplitAngularVelocity;
+
+    if (rigidBody->getType() == DYNAMIC)
+    {
+        massInverse = rigidBody->mMassInverse;
+        inverseInertiaTensorWorld = rigidBody->getInertiaTensorInverseWorld();
+    }
+    else
+    {
+        massInverse = scalar(0.0);
+        inverseInertiaTensorWorld.setToZero();
+    }
+}
+
+SIMD_INLINE void rpSolverBody::scatter() const
+{
+    if (body->getType() != DYNAMIC) return;
+
+    body->mLinearVelocity       = linearVelocity;
+    body->mAngularVelocity      = angularVelocity;
+    body->mSplitLinearVelocity  = splitLinearVelocity;
+    body->mSplitAngularVelocity = splitAngularVelocity;
+}
+
+
+SIMD_INLINE void rpSolverBody::applyImpulse(const Vector3& impulse , const Vector3& r)
+{
+    applyImpulseLinear(impulse);
+    applyImpulseAngular(r.cross(impulse));
+}
+
+SIMD_INLINE void rpSolverBody::applyImpulseLinear(const Vector3& impulse)
+{
+    linearVelocity += massInverse * impulse;
+}
+
+SIMD_INLINE void rpSolverBody::applyImpulseAngular(const Vector3& impulse)
+{
+    angularVelocity += inverseInertiaTensorWorld * impulse;
+}
+
+
+SIMD_INLINE void rpSolverBody::applySplitImpulse(const Vector3& impulse , const Vector3& r)
+{
+    applySplitImpulseLinear(impulse);
+    applySplitImpulseAngular(r.cross(impulse));
+}
+
+SIMD_INLINE void rpSolverBody::applySplitImpulseLinear(const Vector3& impulse)
+{
+    splitLinearVelocity += massInverse * impulse;
+}
+
+SIMD_INLINE void rpSolverBody::applySplitImpulseAngular(const Vector3& impulse)
+{
+    splitAngularVelocity += inverseInertiaTensorWorld * impulse;
+}
+
+
+} /* namespace real_physics */
+
+#endif /* SOURCE_ENGIE_KINEMATICPHYSICS_SOLVER_RPSOLVERBODY_H_ */
@@ -21,6 +21,11 @@ rpDynamicsWorld::rpDynamicsWorld(const Vector3& gravity)
 : mGravity(gravity),
   mNbVelocitySolverIterations(DEFAULT_VELOCITY_SOLVER_NB_ITERATIONS),
   mNbPositionSolverIterations(DEFAULT_POSITION_SOLVER_NB_ITERATIONS),
+  mNbMinSolverIterations(DEFAULT_SOLVER_MIN_NB_ITERATIONS),
+  mSolverResidualTolerance(DEFAULT_SOLVER_RESIDUAL_TOLERANCE),
+  mContactSolverType(SEQUENTIAL_IMPULSE_CONTACTS),
+  mContactSolverWide(NULL),
+  mIsBlockSolverActive(false),
   mTimer( scalar(1.0) ) ,
   mIsSleepingEnabled(SLEEPING_ENABLED) ,
   mNbIslands(0),
@@ -49,6 +54,14 @@ void rpDynamicsWorld::destroy()
     mTimer.stop();
 
 
+    // Destroy all the articulations that have not been removed
+    for (auto itArticulations = mArticulations.begin(); itArticulations != mArticulations.end();)
+    {
+        std::set<rpArticulation*>::iterator itToRemove = itArticulations;
+        ++itArticulations;
+        destroyArticulation(*itToRemove);
+    }
+
     // Destroy all the joints that have not been removed
     for (auto itJoints = mPhysicsJoints.begin(); itJoints != mPhysicsJoints.end();)
     {
@@ -92,6 +105,26 @@ void rpDynamicsWorld::destroy()
         mCollisionDetection.mContactOverlappingPairs.clear();
     }
 
+    // Destroy the islands of the last step
+    for (uint i = 0; i < mNbIslands; i++)
+    {
+        delete mIslands[i];
+    }
+    mNbIslands = 0;
+
+    if (mIslands != NULL)
+    {
+        delete[] mIslands;
+        mIslands = NULL;
+        mNbIslandsCapacity = 0;
+    }
+
+    if (mContactSolverWide != NULL)
+    {
+        delete mContactSolverWide;
+        mContactSolverWide = NULL;
+    }
+
     assert(mPhysicsJoints.size() == 0);
     assert(mPhysicsBodies.size() == 0);
     assert(mContactSolvers.empty());
@@ -109,9 +142,12 @@ void rpDynamicsWorld::update(scalar timeStep)
   {
      mTimer.update();
 
+     // The sensor events of all the fixed steps of the update are read together
+     mCollisionDetection.clearSensorEvents();
+
      while( mTimer.isPossibleToTakeStep() )
      {
-         updateFixedTime(timeStep);
+         computeStep(timeStep);
 
          // next step simulation
          mTimer.nextStep();
@@ -122,9 +158,18 @@ void rpDynamicsWorld::update(scalar timeStep)
 
 void rpDynamicsWorld::updateFixedTime(scalar timeStep)
 {
+    mCollisionDetection.clearSensorEvents();
+    computeStep(timeStep);
+}
 
-    // Reset all the contact manifolds lists of each body
-    resetContactManifoldListsOfBodies();
+void rpDynamicsWorld::computeStep(scalar timeStep)
+{
+
+    // Update the partitions of the awake and the sleeping bodies
+    updateSleepingPartitions();
+
+    // Reset all the contact manifolds lists of each awake body
+    resetContactManifoldListsOfAwakeBodies();
 
     //Integrate all bodies
     integrateGravity(timeStep);
@@ -142,15 +187,24 @@ void rpDynamicsWorld::updateFixedTime(scalar timeStep)
     // Compute the islands (separate groups of bodies with constraints between each others)
     computeIslands();
 
+    // Add the bodies woken up by the contacts and the joints to the awake partition
+    updateSleepingPartitions();
+
 
     // Solve the contacts and constraints joint
     solve(timeStep);
 
     /****************************/
 
+    // Save the start of the sweeps of the fast bodies
+    initContinuousSweeps();
+
     // Integrate the position and orientation of each body
     integrateBodiesVelocities(timeStep);
 
+    // Sub-step the fast bodies which have tunneled through other bodies
+    solveContinuousCollisions(timeStep);
+
 
     // Sleeping for all bodies
     if(mIsSleepingEnabled)
@@ -201,12 +255,16 @@ void rpDynamicsWorld::updateFindContacts()
     }
 
     /// delete overlapping pairs collision
-    for( auto pair : mContactSolvers )
+    for( auto it = mContactSolvers.begin(); it != mContactSolvers.end(); )
     {
-        if( !pair.second->isCandidateInDelete )
+        if( !it->second->isCandidateInDelete )
         {
-            delete pair.second;
-            mContactSolvers.erase(pair.first);
+            delete it->second;
+            it = mContactSolvers.erase(it);
+        }
+        else
+        {
+            ++it;
         }
     }
 }
@@ -216,12 +274,11 @@ void rpDynamicsWorld::updateFindContacts()
 void rpDynamicsWorld::solve( scalar timeStep )
 {
 
-    //---------------------------------------------------------------------//
-
-    for( auto it = mPhysicsJoints.begin(); it != mPhysicsJoints.end(); ++it )
+    // Copy the bodies of each island into its solver bodies , the
+    // constraints read and write the velocities there until the scatter
+    for (uint islandIndex = 0; islandIndex < mNbIslands; islandIndex++)
     {
-        (*it)->initBeforeSolve(timeStep);
-        (*it)->warmstart();
+        mIslands[islandIndex]->gatherSolverBodies();
     }
 
     //---------------------------------------------------------------------//
@@ -233,53 +290,98 @@ void rpDynamicsWorld::solve( scalar timeStep )
 //    }
 
 
-    // For each island of the world
+    // For each island of the world (the joints of the sleeping bodies are in no island)
+    bool isAnyIslandWithJoints = false;
     for (uint islandIndex = 0; islandIndex < mNbIslands; islandIndex++)
     {
         mIslands[islandIndex]->warmStart( timeStep );
+        if (mIslands[islandIndex]->getNbJoints() > 0) isAnyIslandWithJoints = true;
+    }
+
+    // Pack the warm started contacts of all the islands into the batches , the step
+    // falls back to the sequential solver if the batches cannot solve the manifolds
+    bool isWideContactSolver = (mContactSolverType == WIDE_CONTACTS && !mIsBlockSolverActive);
+    if (isWideContactSolver)
+    {
+        if (mContactSolverWide == NULL) mContactSolverWide = new rpContactSolverWide();
+        isWideContactSolver = mContactSolverWide->initializeForIslands( mIslands , mNbIslands );
     }
 
 
 	//---------------------------------------------------------------------//
 
 
-    for( uint i = 0; i < mNbVelocitySolverIterations; ++i)
+    // Each island iterates until its residual is below its tolerance (at least its
+    // minimum number of iterations and at most mNbVelocitySolverIterations iterations)
+    bool isSolving = true;
+    for( uint i = 0; i < mNbVelocitySolverIterations && isSolving; ++i)
     {
-        for( auto it = mPhysicsJoints.begin(); it != mPhysicsJoints.end(); ++it )
-        {
-            (*it)->solveVelocityConstraint();
-        }
-
 //        for( auto pair : mContactSolvers )
 //        {
 //            pair.second->solveVelocityConstraint();
 //        }
 
+        if (isWideContactSolver)
+        {
+            // The joints change the velocities of the bodies between the iterations
+            if (isAnyIslandWithJoints)
+            {
+                for (uint islandIndex = 0; islandIndex < mNbIslands; islandIndex++)
+                {
+                    mIslands[islandIndex]->solveJointsVelocityConstraint();
+                }
+
+                mContactSolverWide->gatherVelocities();
+            }
+
+            mContactSolverWide->solveVelocityConstraint();
+
+            if (i + 1 == mNbVelocitySolverIterations || isAnyIslandWithJoints) mContactSolverWide->scatterVelocities();
+
+            continue;
+        }
+
         // For each island of the world
+        isSolving = false;
         for (uint islandIndex = 0; islandIndex < mNbIslands; islandIndex++)
         {
-            mIslands[islandIndex]->solveVelocityConstraint();
+            if (mIslands[islandIndex]->solveVelocityConstraint())
+            {
+                isSolving = true;
+            }
         }
     }
 
-    //---------------------------------------------------------------------//
-
-    for( uint i = 0; i < mNbPositionSolverIterations; ++i)
+    // Give the accumulated impulses back to the solvers of the manifolds
+    if (isWideContactSolver)
     {
-        for( auto it = mPhysicsJoints.begin(); it != mPhysicsJoints.end(); ++it )
+        mContactSolverWide->storeImpulses();
+
+        // The batches mix the islands , so all the islands run all the iterations
+        for (uint islandIndex = 0; islandIndex < mNbIslands; islandIndex++)
         {
-            (*it)->solvePositionConstraint();
+            mIslands[islandIndex]->mNbVelocityIterations = mNbVelocitySolverIterations;
         }
+    }
 
+    //---------------------------------------------------------------------//
+
+    isSolving = true;
+    for( uint i = 0; i < mNbPositionSolverIterations && isSolving; ++i)
+    {
 //        for( auto pair : mContactSolvers )
 //        {
 //            pair.second->solvePositionConstraint();
 //        }
 
         // For each island of the world
+        isSolving = false;
         for (uint islandIndex = 0; islandIndex < mNbIslands; islandIndex++)
         {
-            mIslands[islandIndex]->solvePositionConstraint();
+            if (mIslands[islandIndex]->solvePositionConstraint())
+            {
+                isSolving = true;
+            }
         }
     }
 
@@ -296,13 +398,19 @@ void rpDynamicsWorld::solve( scalar timeStep )
         mIslands[islandIndex]->storeImpulses();
     }
 
+    // Copy the velocities of the solver bodies back into the bodies
+    for (uint islandIndex = 0; islandIndex < mNbIslands; islandIndex++)
+    {
+        mIslands[islandIndex]->scatterSolverBodies();
+    }
+
 }
 
 
 
 void rpDynamicsWorld::integrateGravity(scalar timeStep)
 {
-	for( auto it = mPhysicsBodies.begin(); it != mPhysicsBodies.end(); ++it )
+	for( auto it = mAwakePhysicsBodies.begin(); it != mAwakePhysicsBodies.end(); ++it )
 	{
 		(*it)->applyGravity(mGravity * timeStep);
 	}
@@ -311,7 +419,7 @@ void rpDynamicsWorld::integrateGravity(scalar timeStep)
 void rpDynamicsWorld::integrateBodiesVelocities(scalar timeStep)
 {
 
-	for( auto it = mPhysicsBodies.begin(); it != mPhysicsBodies.end(); ++it )
+	for( auto it = mAwakePhysicsBodies.begin(); it != mAwakePhysicsBodies.end(); ++it )
 	{
 		(*it)->Integrate(timeStep);
 
@@ -323,10 +431,10 @@ void rpDynamicsWorld::integrateBodiesVelocities(scalar timeStep)
 void rpDynamicsWorld::updateBodiesState(scalar timeStep)
 {
 
-	for( auto it = mPhysicsBodies.begin(); it != mPhysicsBodies.end(); ++it )
+	for( auto it = mAwakePhysicsBodies.begin(); it != mAwakePhysicsBodies.end(); ++it )
 	{
-        (*it)->updateBroadPhaseState();
         (*it)->updateTransformWithCenterOfMass();
+        (*it)->updateBroadPhaseState();
 	}
 }
 
@@ -437,13 +545,27 @@ void rpDynamicsWorld::computeIslands()
     }
 
     mNbIslands = 0;
-    int nbContactManifolds = 0;
 
     // Reset all the isAlreadyInIsland variables of bodies, joints and contact manifolds
-    for (auto it = mPhysicsBodies.begin(); it != mPhysicsBodies.end(); ++it)
+    // (the sleeping bodies are reset when they are put to sleep)
+    for (auto it = mAwakePhysicsBodies.begin(); it != mAwakePhysicsBodies.end(); ++it)
     {
-        int nbBodyManifolds = (*it)->resetIsAlreadyInIslandAndCountManifolds();
-        nbContactManifolds += nbBodyManifolds;
+        (*it)->resetIsAlreadyInIslandAndCountManifolds();
+    }
+
+    // An island can reach the manifolds of the sleeping bodies , so it can contain
+    // any manifold of the pairs in contact. The manifolds between two sleeping bodies
+    // are kept from the step the bodies were put to sleep and are reset here too
+    int nbContactManifolds = 0;
+    for (auto it = mCollisionDetection.mContactOverlappingPairs.begin();
+              it != mCollisionDetection.mContactOverlappingPairs.end(); ++it)
+    {
+        const rpContactManifoldSet& manifoldSet = it->second->getContactManifoldSet();
+        for (int i = 0; i < manifoldSet.getNbContactManifolds(); ++i)
+        {
+            manifoldSet.getContactManifold(i)->mIsAlreadyInIsland = false;
+        }
+        nbContactManifolds += manifoldSet.getNbContactManifolds();
     }
 
     for (auto it = mPhysicsJoints.begin(); it !=  mPhysicsJoints.end(); ++it)
@@ -453,16 +575,10 @@ void rpDynamicsWorld::computeIslands()
 
 
     rpRigidPhysicsBody** stackBodiesToVisit = new rpRigidPhysicsBody*[nbBodies];
-    int i=0;
-    for (auto it = mPhysicsBodies.begin(); it != mPhysicsBodies.end(); ++it )
-    {
-        rpPhysicsBody* body = *it;
-        stackBodiesToVisit[i++] =    static_cast<rpRigidPhysicsBody*>(body);
-    }
 
 
-    // For each rigid body of the world
-    for (auto it = mPhysicsBodies.begin(); it != mPhysicsBodies.end(); ++it)
+    // For each awake rigid body of the world
+    for (auto it = mAwakePhysicsBodies.begin(); it != mAwakePhysicsBodies.end(); ++it)
     {
 
         rpPhysicsBody* body = *it;
@@ -485,7 +601,8 @@ void rpDynamicsWorld::computeIslands()
 
 
         // Create the new island
-        mIslands[mNbIslands] = new rpIsland( nbBodies , nbContactManifolds , mContactSolvers );
+        mIslands[mNbIslands] = new rpIsland( nbBodies , nbContactManifolds , mPhysicsJoints.size() , mContactSolvers ,
+                                           mNbMinSolverIterations , mSolverResidualTolerance );
 
 
 
@@ -551,7 +668,7 @@ void rpDynamicsWorld::computeIslands()
                 if (joint->isAlreadyInIsland()) continue;
 
                 // Add the joint into the island
-                //mIslands[mNbIslands]->addJoint(joint);
+                mIslands[mNbIslands]->addJoint(joint);
                 joint->mIsAlreadyInIsland = true;
 
                 // Get the other body of the contact manifold
@@ -597,12 +714,226 @@ void rpDynamicsWorld::computeIslands()
 
 
 
+// Move the bodies put to sleep or woken up between the awake and the sleeping partitions.
+/// The bodies notify the collision detection when their sleeping state changes, so the
+/// update only touches these bodies and never walks over the sleeping ones.
+void rpDynamicsWorld::updateSleepingPartitions()
+{
+    std::set<rpCollisionBody*>& changedBodies = mCollisionDetection.mSleepingStateChangedBodies;
+
+    for (auto it = changedBodies.begin(); it != changedBodies.end(); ++it)
+    {
+        rpPhysicsBody* body = dynamic_cast<rpPhysicsBody*>(*it);
+        if (body == NULL || mPhysicsBodies.find(body) == mPhysicsBodies.end()) continue;
+
+        if (body->isSleeping())
+        {
+            mAwakePhysicsBodies.erase(body);
+
+            // The sleeping body is skipped by the resets of the next steps
+            body->resetContactManifoldsList();
+            body->mIsAlreadyInIsland = false;
+        }
+        else
+        {
+            mAwakePhysicsBodies.insert(body);
+        }
+    }
+
+    changedBodies.clear();
+}
+
+
+// Reset the contact manifolds lists of the awake bodies
+void rpDynamicsWorld::resetContactManifoldListsOfAwakeBodies()
+{
+    for (auto it = mAwakePhysicsBodies.begin(); it != mAwakePhysicsBodies.end(); ++it)
+    {
+        (*it)->resetContactManifoldsList();
+    }
+}
+
+
+// Save the start of the sweeps of the awake bodies with continuous collision detection
+void rpDynamicsWorld::initContinuousSweeps()
+{
+    mContinuousSweeps.clear();
+
+    for (auto it = mAwakePhysicsBodies.begin(); it != mAwakePhysicsBodies.end(); ++it)
+    {
+        rpRigidPhysicsBody* body = static_cast<rpRigidPhysicsBody*>(*it);
+        if (body->getType() != DYNAMIC || !body->isCCDEnabled()) continue;
+
+        mContinuousSweeps[body] = rpSweep(body->getTransform(), body->getTransform());
+    }
+}
+
+
+// Find the first time of impact of the body during the rest of its sweep
+bool rpDynamicsWorld::computeTimeOfImpactEvent( rpRigidPhysicsBody* body , rpTimeOfImpactEvent& event )
+{
+    const rpSweep& sweep = mContinuousSweeps[body];
+
+    bool isImpact = false;
+    event.time = scalar(1.0);
+
+    std::vector<rpProxyShape*> overlappingShapes;
+    for (rpProxyShape* shape = body->getProxyShapesList(); shape != NULL; shape = shape->getNext())
+    {
+        // Swept AABB of the shape during the rest of the step
+        rpAABB sweptAABB;
+        shape->getCollisionShape()->computeSweptAABB(sweptAABB, sweep.transform0, sweep.transform1, shape->getLocalToBodyTransform());
+
+        overlappingShapes.clear();
+        mCollisionDetection.reportShapesOverlappingWithAABB(shape, sweptAABB, overlappingShapes);
+
+        for (uint i = 0; i < overlappingShapes.size(); ++i)
+        {
+            rpProxyShape* otherShape = overlappingShapes[i];
+            rpRigidPhysicsBody* otherBody = static_cast<rpRigidPhysicsBody*>(otherShape->getBody());
+
+            // The bodies without sweep stay at their position of the end of the step
+            auto itSweep = mContinuousSweeps.find(otherBody);
+            rpSweep otherSweep = (itSweep != mContinuousSweeps.end()) ? itSweep->second :
+                                  rpSweep(otherBody->getTransform(), otherBody->getTransform());
+
+            scalar toi;
+            Vector3 normal;
+            if (rpTimeOfImpact::computeTimeOfImpact(shape, sweep, otherShape, otherSweep, sweep.alpha0, toi, normal) &&
+                toi < event.time)
+            {
+                event.shape1 = shape;
+                event.shape2 = otherShape;
+                event.time = toi;
+                event.normal = normal;
+                isImpact = true;
+            }
+        }
+    }
+
+    return isImpact;
+}
+
+
+// Solve the impacts missed by the discrete collision detection of the fast bodies
+void rpDynamicsWorld::solveContinuousCollisions( scalar timeStep )
+{
+    // End of the sweeps , the bodies moving slowly compared to their size are left
+    // to the discrete collision detection
+    for (auto it = mContinuousSweeps.begin(); it != mContinuousSweeps.end();)
+    {
+        rpRigidPhysicsBody* body = it->first;
+        it->second.transform1 = body->getTransform();
+
+        scalar motion = (it->second.transform1.getPosition() - it->second.transform0.getPosition()).length();
+
+        bool isFastMoving = false;
+        for (const rpProxyShape* shape = body->getProxyShapesList(); shape != NULL; shape = shape->getNext())
+        {
+            Vector3 minBounds(0,0,0);
+            Vector3 maxBounds(0,0,0);
+            shape->getCollisionShape()->getLocalBounds(minBounds, maxBounds);
+            Vector3 size = maxBounds - minBounds;
+
+            if (motion > CCD_MOTION_THRESHOLD * Min(size.x, size.y, size.z)) isFastMoving = true;
+        }
+
+        if (isFastMoving) ++it;
+        else it = mContinuousSweeps.erase(it);
+    }
+
+    if (mContinuousSweeps.empty()) return;
+
+
+    // First time of impact of each body
+    std::map<rpRigidPhysicsBody* , rpTimeOfImpactEvent> events;
+    for (auto it = mContinuousSweeps.begin(); it != mContinuousSweeps.end(); ++it)
+    {
+        rpTimeOfImpactEvent event;
+        if (computeTimeOfImpactEvent(it->first, event)) events[it->first] = event;
+    }
+
+
+    // Solve the impacts in the order of time , only the bodies involved are sub-stepped
+    std::map<rpRigidPhysicsBody* , uint> nbSubSteps;
+    while (!events.empty())
+    {
+        auto first = events.begin();
+        for (auto it = events.begin(); it != events.end(); ++it)
+        {
+            if (it->second.time < first->second.time) first = it;
+        }
+
+        rpTimeOfImpactEvent event = first->second;
+        rpRigidPhysicsBody* body1 = first->first;
+        rpRigidPhysicsBody* body2 = static_cast<rpRigidPhysicsBody*>(event.shape2->getBody());
+
+        // Move the bodies with sweep back to the time of impact
+        std::set<rpRigidPhysicsBody*> subSteppedBodies;
+        subSteppedBodies.insert(body1);
+        if (mContinuousSweeps.find(body2) != mContinuousSweeps.end()) subSteppedBodies.insert(body2);
+
+        for (auto it = subSteppedBodies.begin(); it != subSteppedBodies.end(); ++it)
+        {
+            mContinuousSweeps[*it].advance(event.time);
+        }
+
+        // Impulse removing the approach velocity along the normal of the impact
+        scalar inverseMass1 = (body1->getType() == DYNAMIC) ? body1->getInverseMass() : scalar(0.0);
+        scalar inverseMass2 = (body2->getType() == DYNAMIC) ? body2->getInverseMass() : scalar(0.0);
+        scalar normalVelocity = (body1->getLinearVelocity() - body2->getLinearVelocity()).dot(event.normal);
+
+        if (normalVelocity < scalar(0.0) && inverseMass1 + inverseMass2 > scalar(0.0))
+        {
+            scalar restitution = Max(body1->getMaterial().getBounciness(),
+                                     body2->getMaterial().getBounciness());
+            scalar impulse = -(scalar(1.0) + restitution) * normalVelocity / (inverseMass1 + inverseMass2);
+
+            if (inverseMass1 > scalar(0.0)) body1->applyImpulseLinear( event.normal *  impulse);
+            if (inverseMass2 > scalar(0.0)) body2->applyImpulseLinear( event.normal * -impulse);
+        }
+
+        // Integrate the rest of the step with the new velocities
+        for (auto it = subSteppedBodies.begin(); it != subSteppedBodies.end(); ++it)
+        {
+            rpRigidPhysicsBody* body = *it;
+            rpSweep& sweep = mContinuousSweeps[body];
+            nbSubSteps[body]++;
+
+            sweep.transform1 = TransformUtil::integrateTransform(sweep.transform0, body->mLinearVelocity,
+                                                                 body->mAngularVelocity,
+                                                                 (scalar(1.0) - event.time) * timeStep);
+            body->setWorldTransform(sweep.transform1);
+            body->UpdateMatrices();
+        }
+
+        // Find again the impacts of the sub-stepped bodies and of the bodies hitting them
+        std::set<rpRigidPhysicsBody*> bodiesToUpdate(subSteppedBodies);
+        for (auto it = events.begin(); it != events.end(); ++it)
+        {
+            rpRigidPhysicsBody* otherBody = static_cast<rpRigidPhysicsBody*>(it->second.shape2->getBody());
+            if (subSteppedBodies.count(otherBody) > 0) bodiesToUpdate.insert(it->first);
+        }
+
+        for (auto it = bodiesToUpdate.begin(); it != bodiesToUpdate.end(); ++it)
+        {
+            // The bodies sub-stepped too many times are left to the discrete collision detection
+            rpTimeOfImpactEvent newEvent;
+            if (nbSubSteps[*it] < CCD_MAX_SUB_STEPS && computeTimeOfImpactEvent(*it, newEvent)) events[*it] = newEvent;
+            else events.erase(*it);
+        }
+    }
+
+    mContinuousSweeps.clear();
+}
+
+
+
 ///add colision check pairs
 void rpDynamicsWorld::addChekCollisionPair( rpContactManifold* manifold )
 {
 
-    overlappingpairid keyPair = rpOverlappingPair::computeID( manifold->mShape1 ,
-                                                              manifold->mShape2 );
+    contactmanifoldid keyPair = rpOverlappingPair::computeManifoldID( manifold );
 
     if(mContactSolvers.find(keyPair) == mContactSolvers.end())
 	{
@@ -617,6 +948,7 @@ void rpDynamicsWorld::addChekCollisionPair( rpContactManifold* manifold )
 
 
     mContactSolvers[keyPair]->initManiflod(manifold);
+    static_cast<rpContactSolverSequentialImpulseObject*>(mContactSolvers[keyPair])->setIsBlockSolverActive(mIsBlockSolverActive);
     mContactSolvers[keyPair]->isCandidateInDelete = true;
 
 }
@@ -639,6 +971,7 @@ rpRigidPhysicsBody* rpDynamicsWorld::createRigidBody(const Transform& transform)
 	// Add the rigid body to the physics world
 	mBodies.insert(rigidBody);
 	mPhysicsBodies.insert(rigidBody);
+	mAwakePhysicsBodies.insert(rigidBody);
 
 
 	// Return the pointer to the rigid body
@@ -657,16 +990,11 @@ void rpDynamicsWorld::destroyBody(rpPhysicsBody* rigidBody)
 
 
     // Destroy all the joints in which the rigid body to be destroyed is involved
-    JointListElement* element;
-    if(rigidBody->mJointsList != NULL )
+    // (destroyJoint() removes the first element of the list)
+    while (rigidBody->mJointsList != NULL)
     {
-      for (element = rigidBody->mJointsList; element != NULL; element = element->getNext() )
-      {
-           destroyJoint(element->getPointer());
-           element = NULL;
-      }
+        destroyJoint(rigidBody->mJointsList->getPointer());
     }
-    rigidBody->mJointsList = NULL;
 
 
     // Reset the contact manifold list of the body
@@ -676,6 +1004,8 @@ void rpDynamicsWorld::destroyBody(rpPhysicsBody* rigidBody)
     // Remove the rigid body from the list of rigid bodies
     mBodies.erase(rigidBody);
     mPhysicsBodies.erase(rigidBody);
+    mAwakePhysicsBodies.erase(rigidBody);
+    mCollisionDetection.removeSleepingStateChanged(rigidBody);
 
 
     // Call the destructor of the rigid body
@@ -750,6 +1080,10 @@ rpJoint* rpDynamicsWorld::createJoint(const rpJointInfo& jointInfo)
 	        mCollisionDetection.addNoCollisionPair(jointInfo.body1, jointInfo.body2);
 	    }
 
+	    // Wake up the two bodies of the joint
+	    jointInfo.body1->setIsSleeping(false);
+	    jointInfo.body2->setIsSleeping(false);
+
 	    // Add the joint into the world
 	      mPhysicsJoints.insert(newJoint);
 
@@ -777,6 +1111,12 @@ void rpDynamicsWorld::destroyJoint(rpJoint* joint)
 	joint->getBody1()->setIsSleeping(false);
 	joint->getBody2()->setIsSleeping(false);
 
+	// Remove the joint from its articulation
+	if (joint->mArticulation != NULL)
+	{
+		joint->mArticulation->removeJoint(joint);
+	}
+
 	// Remove the joint from the world
 	mPhysicsJoints.erase(joint);
 
@@ -792,6 +1132,21 @@ void rpDynamicsWorld::destroyJoint(rpJoint* joint)
 
 }
 
+rpArticulation* rpDynamicsWorld::createArticulation()
+{
+    rpArticulation* articulation = new rpArticulation();
+    mArticulations.insert(articulation);
+    return articulation;
+}
+
+void rpDynamicsWorld::destroyArticulation(rpArticulation* articulation)
+{
+    assert(articulation != NULL);
+
+    mArticulations.erase(articulation);
+    delete articulation;
+}
+
 void rpDynamicsWorld::addJointToBody(rpJoint *joint)
 {
     assert(joint != NULL);
@@ -829,6 +1184,57 @@ void rpDynamicsWorld::setNbIterationsPositionSolver(uint nbIterations)
 	 mNbPositionSolverIterations = nbIterations;
 }
 
+uint rpDynamicsWorld::getNbMinIterationsSolver() const
+{
+	return mNbMinSolverIterations;
+}
+
+void rpDynamicsWorld::setNbMinIterationsSolver(uint nbIterations)
+{
+	mNbMinSolverIterations = nbIterations;
+}
+
+scalar rpDynamicsWorld::getSolverResidualTolerance() const
+{
+	return mSolverResidualTolerance;
+}
+
+void rpDynamicsWorld::setSolverResidualTolerance(scalar tolerance)
+{
+	mSolverResidualTolerance = tolerance;
+}
+
+uint rpDynamicsWorld::getNbIslands() const
+{
+	return mNbIslands;
+}
+
+const rpIsland* rpDynamicsWorld::getIsland(uint index) const
+{
+	assert(index < mNbIslands);
+	return mIslands[index];
+}
+
+ContactSolverType rpDynamicsWorld::getContactSolverType() const
+{
+	return mContactSolverType;
+}
+
+void rpDynamicsWorld::setContactSolverType(ContactSolverType type)
+{
+	mContactSolverType = type;
+}
+
+bool rpDynamicsWorld::isBlockSolverActive() const
+{
+	return mIsBlockSolverActive;
+}
+
+void rpDynamicsWorld::setIsBlockSolverActive(bool isActive)
+{
+	mIsBlockSolverActive = isActive;
+}
+
 
 } /* namespace real_physics */
 
@@ -15,6 +15,7 @@
 #include "../Memory/memory.h"
 
 #include "../Dynamics/Solver/rpContactSolverSequentialImpulseObject.h"
+#include "../Dynamics/Solver/rpContactSolverWide.h"
 #include "../Body/rpPhysicsBody.h"
 #include "../Body/rpPhysicsObject.h"
 #include "../Body/rpRigidPhysicsBody.h"
@@ -25,11 +26,13 @@
 #include "Joint/rpFixedJoint.h"
 #include "Joint/rpHingeJoint.h"
 #include "Joint/rpSliderJoint.h"
+#include "Joint/rpArticulation.h"
 
 #include "rpTimer.h"
 #include "rpIsland.h"
 
 #include "../Memory/MemoryAllocator.h"
+#include "../Collision/NarrowPhase/rpTimeOfImpact.h"
 
 using namespace std;
 
@@ -109,6 +112,23 @@ class rpDynamicsWorld : public rpCollisionWorld
 	/// Number of iterations for the position solver of the Sequential Impulses technique
 	uint mNbPositionSolverIterations;
 
+	/// Number of iterations an island runs before it can stop on convergence (default of the islands ,
+	/// the bodies of an island can ask for more)
+	uint mNbMinSolverIterations;
+
+	/// Residual (largest change of an accumulated impulse) under which an island stops iterating
+	/// (default of the islands , the bodies of an island can ask for a smaller one)
+	scalar mSolverResidualTolerance;
+
+	/// Solver of the velocity constraints of the contacts
+	ContactSolverType mContactSolverType;
+
+	/// Batched contact solver (used with the WIDE_CONTACTS solver type)
+	rpContactSolverWide* mContactSolverWide;
+
+	/// True if the normal impulses of the manifolds of 2 to 4 contact points are solved together
+	bool mIsBlockSolverActive;
+
     /// Gravity vector3
 	Vector3 mGravity;
 
@@ -116,9 +136,19 @@ class rpDynamicsWorld : public rpCollisionWorld
 	std::set<rpJoint*>       mPhysicsJoints;
     std::set<rpPhysicsBody*> mPhysicsBodies;
 
+    /// Articulations of the world (trees of joints solved exactly)
+    std::set<rpArticulation*> mArticulations;
+
+    /// Partition of the awake bodies (the static bodies included), the per-body
+    /// passes of the step only run over it and skip the sleeping bodies
+    std::set<rpPhysicsBody*> mAwakePhysicsBodies;
+
+    /// Sweeps during the step of the awake bodies with continuous collision detection
+    std::map<rpRigidPhysicsBody* , rpSweep> mContinuousSweeps;
+
 
     /// array map contacts solver
-    std::map< overlappingpairid , rpContactSolver* > mContactSolvers;
+    std::map< contactmanifoldid , rpContactSolver* > mContactSolvers;
 
 
     /// Current allocated capacity for the bodies
@@ -154,6 +184,9 @@ class rpDynamicsWorld : public rpCollisionWorld
     /// Compute physics for all collision pairs
     void solve( scalar timeStep );
 
+    /// Compute one fixed step of the simulation
+    void computeStep( scalar timeStep );
+
 	/// Integrate the garvity
 	void integrateGravity( scalar timeStep );
 
@@ -169,6 +202,22 @@ class rpDynamicsWorld : public rpCollisionWorld
     //// Compute the islands of awake bodies.
     void computeIslands();
 
+    /// Move the bodies put to sleep or woken up between the awake and the sleeping partitions
+    void updateSleepingPartitions();
+
+    /// Reset the contact manifolds lists of the awake bodies
+    void resetContactManifoldListsOfAwakeBodies();
+
+    /// Save the start of the sweeps of the awake bodies with continuous collision detection
+    void initContinuousSweeps();
+
+    /// Find the first time of impact of the body during the rest of its sweep
+    bool computeTimeOfImpactEvent( rpRigidPhysicsBody* body , rpTimeOfImpactEvent& event );
+
+    /// Solve the impacts missed by the discrete collision detection of the fast
+    /// bodies by sub-stepping the bodies involved only
+    void solveContinuousCollisions( scalar timeStep );
+
 
 
 	//// Add Collision New contact Solver
@@ -207,6 +256,13 @@ class rpDynamicsWorld : public rpCollisionWorld
     /// Add the joint to the list of joints of the two bodies involved in the joint
     void addJointToBody(rpJoint* joint);
 
+
+    /// Create an articulation , its ball-and-socket joints are added with rpArticulation::addJoint()
+    rpArticulation* createArticulation();
+
+    /// Destroy an articulation (its joints are solved alone again)
+    void destroyArticulation(rpArticulation* articulation);
+
 	//***************************************************//
 
 
@@ -228,6 +284,37 @@ class rpDynamicsWorld : public rpCollisionWorld
     /// Set the number of iterations for the position constraint solver
     void setNbIterationsPositionSolver(uint nbIterations);
 
+    /// Get the number of iterations an island runs before it can stop on convergence
+    uint getNbMinIterationsSolver() const;
+
+    /// Set the number of iterations an island runs before it can stop on convergence
+    void setNbMinIterationsSolver(uint nbIterations);
+
+    /// Get the residual under which an island stops iterating
+    scalar getSolverResidualTolerance() const;
+
+    /// Set the residual under which an island stops iterating (zero always runs all the iterations)
+    void setSolverResidualTolerance(scalar tolerance);
+
+    /// Get the number of islands of the last step
+    uint getNbIslands() const;
+
+    /// Get an island of the last step (bodies , contacts and solver iteration counts)
+    const rpIsland* getIsland(uint index) const;
+
+    /// Get the solver of the velocity constraints of the contacts
+    ContactSolverType getContactSolverType() const;
+
+    /// Set the solver of the velocity constraints of the contacts (WIDE_CONTACTS falls back to
+    /// SEQUENTIAL_IMPULSE_CONTACTS with the block solver or the friction at the contact points)
+    void setContactSolverType(ContactSolverType type);
+
+    /// Return true if the normal impulses of the manifolds of 2 to 4 contact points are solved together
+    bool isBlockSolverActive() const;
+
+    /// Activate or deactivate the block solver of the normal impulses (the steps use the sequential impulse solver)
+    void setIsBlockSolverActive(bool isActive);
+
 };
 
 
@@ -4,25 +4,38 @@ namespace real_physics
 {
 
 
-rpIsland::rpIsland(uint nbMaxBodies, uint nbMaxContactManifolds, std::map< overlappingpairid , rpContactSolver* > &_ContactSolvers)
+rpIsland::rpIsland(uint nbMaxBodies, uint nbMaxContactManifolds, uint nbMaxJoints, std::map< contactmanifoldid , rpContactSolver* > &_ContactSolvers,
+                   uint nbMinIterations, scalar residualTolerance)
     : mBodies(NULL),
+      mSolverBodies(NULL),
+      mJoints(NULL),
       mContactManifolds(NULL),
       mNbBodies(0),
       mNbContactManifolds(0),
+      mNbJoints(0),
+      mNbVelocityIterations(0),
+      mNbPositionIterations(0),
+      mNbMinIterations(nbMinIterations),
+      mResidualTolerance(residualTolerance),
+      mIsVelocityConverged(false),
+      mIsPositionConverged(false),
       mContactSolvers(_ContactSolvers)
 {
 
      mBodies                = new rpRigidPhysicsBody*[nbMaxBodies];
+     mJoints                = new rpJoint*[nbMaxJoints];
      mContactManifolds      = new rpContactManifold*[nbMaxContactManifolds];
-     mContactMapIndexesPair = new overlappingpairid[nbMaxContactManifolds];
+     mContactMapIndexesPair = new contactmanifoldid[nbMaxContactManifolds];
 
 }
 
 rpIsland::~rpIsland()
 {
     delete[] mBodies;
+    delete[] mSolverBodies;
+    delete[] mJoints;
     delete[] mContactManifolds;
-    delete   mContactMapIndexesPair;
+    delete[] mContactMapIndexesPair;
 }
 
 
@@ -4,10 +4,12 @@
 #include "../Body/rpPhysicsBody.h"
 #include "../Body/rpRigidPhysicsBody.h"
 #include "Solver/rpContactSolverSequentialImpulseObject.h"
+#include "Solver/rpSolverBody.h"
 #include "../Collision/Manifold/rpContactManifold.h"
 
 #include "Joint/rpJoint.h"
 #include "Joint/rpBallAndSocketJoint.h"
+#include "Joint/rpJointStore.h"
 
 namespace real_physics
 {
@@ -21,9 +23,18 @@ namespace real_physics
          /// Array with all the bodies of the island
          rpRigidPhysicsBody** mBodies;
 
+         /// Solver bodies of the island (velocities of the bodies during the solve)
+         rpSolverBody* mSolverBodies;
+
+         /// Array with all the joints between bodies of the island
+         rpJoint** mJoints;
+
+         /// Joints of the island grouped by their type for the solver
+         rpJointStore mJointStore;
+
          /// Array with all the contact manifolds between bodies of the island
          rpContactManifold** mContactManifolds;
-         overlappingpairid*  mContactMapIndexesPair;
+         contactmanifoldid*  mContactMapIndexesPair;
 
          /// Current number of bodies in the island
          uint mNbBodies;
@@ -31,8 +42,24 @@ namespace real_physics
          /// Current number of contact manifold in the island
          uint mNbContactManifolds;
 
+         /// Current number of joints in the island
+         uint mNbJoints;
+
+         /// Number of iterations run by the velocity and the position solvers
+         uint mNbVelocityIterations;
+         uint mNbPositionIterations;
+
+         /// Number of iterations run before the island can stop on convergence , and the
+         /// residual under which it stops (the values of the world made stricter by its bodies)
+         uint   mNbMinIterations;
+         scalar mResidualTolerance;
+
+         /// True when the velocity or the position constraints have converged
+         bool mIsVelocityConverged;
+         bool mIsPositionConverged;
+
          /// array map contacts solver
-         std::map< overlappingpairid , rpContactSolver* > &mContactSolvers;
+         std::map< contactmanifoldid , rpContactSolver* > &mContactSolvers;
 
 
          //-------------------- Methods -------------------//
@@ -50,8 +77,9 @@ namespace real_physics
         //-------------------- Methods --------------------//
 
          /// Constructor
-          rpIsland(uint nbMaxBodies , uint nbMaxContactManifolds ,
-                   std::map<overlappingpairid, rpContactSolver* > &_ContactSolvers );
+          rpIsland(uint nbMaxBodies , uint nbMaxContactManifolds , uint nbMaxJoints ,
+                   std::map<contactmanifoldid, rpContactSolver* > &_ContactSolvers ,
+                   uint nbMinIterations , scalar residualTolerance );
 
          /// Destructor
          ~rpIsland();
@@ -64,6 +92,9 @@ namespace real_physics
          /// Add a contact manifold into the island
          void addContactManifold(rpContactManifold* contactManifold);
 
+         /// Add a joint into the island
+         void addJoint(rpJoint* joint);
+
 
 
          /// Return the number of bodies in the island
@@ -72,6 +103,21 @@ namespace real_physics
          /// Return the number of contact manifolds in the island
          uint getNbContactManifolds() const;
 
+         /// Return the number of joints in the island
+         uint getNbJoints() const;
+
+         /// Return the number of iterations run by the velocity solver in the last step
+         uint getNbVelocityIterations() const;
+
+         /// Return the number of iterations run by the position solver in the last step
+         uint getNbPositionIterations() const;
+
+         /// Return the number of iterations run before the island can stop on convergence
+         uint getNbMinIterations() const;
+
+         /// Return the residual under which the island stops iterating
+         scalar getResidualTolerance() const;
+
 
 
          /// Return a pointer to the array of bodies
@@ -80,12 +126,62 @@ namespace real_physics
          /// Return a pointer to the array of contact manifolds
          rpContactManifold** getContactManifold();
 
+         /// Return a pointer to the array of joints
+         rpJoint** getJoints();
+
+         /// Return a pointer to the array of solver bodies
+         rpSolverBody* getSolverBodies();
+
+         /// Return the contact solver of a contact manifold of the island
+         rpContactSolver* getContactSolver(uint index);
+
+
+
+
+         ///-----------------------------------------------------///
+         void gatherSolverBodies()
+         {
+             // The island is complete , allocate its solver bodies once
+             if (mSolverBodies == NULL) mSolverBodies = new rpSolverBody[mNbBodies];
+
+             // Copy the bodies into the solver bodies
+             for( uint i = 0; i < mNbBodies; i++ )
+             {
+                 mBodies[i]->mSolverBodyIndex = i;
+                 mSolverBodies[i].gather(mBodies[i]);
+             }
+
+             // A static body can be in several islands , so the constraints
+             // read the indexes of their bodies before the next island is gathered
+             for( uint i = 0; i < mNbContactManifolds; i++ )
+             {
+                 mContactSolvers[mContactMapIndexesPair[i]]->setSolverBodies(mSolverBodies);
+             }
 
+             mJointStore.setSolverBodies(mSolverBodies);
+             for( uint i = 0; i < mNbJoints; i++ )
+             {
+                 mJoints[i]->mSolverBodies = mSolverBodies;
+                 mJoints[i]->mIndexBody1 = static_cast<rpRigidPhysicsBody*>(mJoints[i]->mBody1)->mSolverBodyIndex;
+                 mJoints[i]->mIndexBody2 = static_cast<rpRigidPhysicsBody*>(mJoints[i]->mBody2)->mSolverBodyIndex;
+                 mJointStore.addJoint(mJoints[i]);
+             }
+         }
 
+         ///-----------------------------------------------------///
+         void scatterSolverBodies()
+         {
+             for( uint i = 0; i < mNbBodies; i++ )
+             {
+                 mSolverBodies[i].scatter();
+             }
+         }
 
          ///-----------------------------------------------------///
          void warmStart( scalar timeStep )
          {
+             mJointStore.warmStart(timeStep);
+
              for( uint i = 0; i < mNbContactManifolds; i++ )
              {
                  mContactSolvers[mContactMapIndexesPair[i]]->initializeForIsland(timeStep);
@@ -94,27 +190,61 @@ namespace real_physics
          }
 
          ///-----------------------------------------------------///
-         void solveVelocityConstraint()
+         void solveJointsVelocityConstraint()
          {
+             mJointStore.solveVelocityConstraint();
+         }
+
+         ///-----------------------------------------------------///
+         /// Run one iteration unless the island has converged ,
+         /// return true while the island needs more iterations
+         bool solveVelocityConstraint()
+         {
+             if (mIsVelocityConverged) return false;
+
+             solveJointsVelocityConstraint();
+
+             scalar residual = 0.0;
              for( uint i = 0; i < mNbContactManifolds; i++ )
              {
-                 mContactSolvers[mContactMapIndexesPair[i]]->solveVelocityConstraint();
+                 residual = Max(residual, mContactSolvers[mContactMapIndexesPair[i]]->solveVelocityConstraint());
              }
+             mNbVelocityIterations++;
+
+             // The iterative joints do not report their residual , so an island with such joints
+             // runs all the iterations (an articulation is solved exactly at each iteration)
+             mIsVelocityConverged = (!mJointStore.hasIterativeJoints() && mNbVelocityIterations >= mNbMinIterations &&
+                                     residual < mResidualTolerance);
+             return !mIsVelocityConverged;
          }
 
          ///-----------------------------------------------------///
-         void solvePositionConstraint()
+         /// Run one iteration unless the island has converged ,
+         /// return true while the island needs more iterations
+         bool solvePositionConstraint()
          {
+             if (mIsPositionConverged) return false;
+
+             mJointStore.solvePositionConstraint();
+
+             scalar residual = 0.0;
              for( uint i = 0; i < mNbContactManifolds; i++ )
              {
-                 mContactSolvers[mContactMapIndexesPair[i]]->solvePositionConstraint();
+                 residual = Max(residual, mContactSolvers[mContactMapIndexesPair[i]]->solvePositionConstraint());
              }
+             mNbPositionIterations++;
+
+             mIsPositionConverged = (!mJointStore.hasIterativeJoints() && mNbPositionIterations >= mNbMinIterations &&
+                                     residual < mResidualTolerance);
+             return !mIsPositionConverged;
          }
 
 
          ///-----------------------------------------------------///
          void storeImpulses()
          {
+             mJointStore.storeImpulses();
+
              for( uint i = 0; i < mNbContactManifolds; i++ )
              {
                  mContactSolvers[mContactMapIndexesPair[i]]->storeImpulses();
@@ -133,13 +263,16 @@ namespace real_physics
         assert(!body->isSleeping());
         mBodies[mNbBodies] = body;
         mNbBodies++;
+
+        // A body can ask its island for a more accurate solve
+        mNbMinIterations   = Max(mNbMinIterations   , body->getNbMinSolverIterations());
+        mResidualTolerance = Min(mResidualTolerance , body->getSolverResidualTolerance());
     }
 
     // Add a contact manifold into the island
     SIMD_INLINE void rpIsland::addContactManifold(rpContactManifold* contactManifold)
     {
-        overlappingpairid ContactKeyPairManifold = rpOverlappingPair::computeID( contactManifold->mShape1 ,
-                                                                                 contactManifold->mShape2 );
+        contactmanifoldid ContactKeyPairManifold = rpOverlappingPair::computeManifoldID( contactManifold );
 
         mContactMapIndexesPair[mNbContactManifolds] = ContactKeyPairManifold;
         mContactManifolds[mNbContactManifolds] = contactManifold;
@@ -147,6 +280,14 @@ namespace real_physics
     }
 
 
+    // Add a joint into the island
+    SIMD_INLINE void rpIsland::addJoint(rpJoint* joint)
+    {
+        mJoints[mNbJoints] = joint;
+        mNbJoints++;
+    }
+
+
     // Return the number of bodies in the island
     SIMD_INLINE uint rpIsland::getNbBodies() const
     {
@@ -160,6 +301,38 @@ namespace real_physics
     }
 
 
+    // Return the number of joints in the island
+    SIMD_INLINE uint rpIsland::getNbJoints() const
+    {
+        return mNbJoints;
+    }
+
+
+    // Return the number of iterations run by the velocity solver in the last step
+    SIMD_INLINE uint rpIsland::getNbVelocityIterations() const
+    {
+        return mNbVelocityIterations;
+    }
+
+    // Return the number of iterations run by the position solver in the last step
+    SIMD_INLINE uint rpIsland::getNbPositionIterations() const
+    {
+        return mNbPositionIterations;
+    }
+
+    // Return the number of iterations run before the island can stop on convergence
+    SIMD_INLINE uint rpIsland::getNbMinIterations() const
+    {
+        return mNbMinIterations;
+    }
+
+    // Return the residual under which the island stops iterating
+    SIMD_INLINE scalar rpIsland::getResidualTolerance() const
+    {
+        return mResidualTolerance;
+    }
+
+
     // Return a pointer to the array of bodies
     SIMD_INLINE rpRigidPhysicsBody** rpIsland::getBodies()
     {
@@ -172,6 +345,25 @@ namespace real_physics
         return mContactManifolds;
     }
 
+    // Return a pointer to the array of joints
+    SIMD_INLINE rpJoint** rpIsland::getJoints()
+    {
+        return mJoints;
+    }
+
+    // Return a pointer to the array of solver bodies
+    SIMD_INLINE rpSolverBody* rpIsland::getSolverBodies()
+    {
+        return mSolverBodies;
+    }
+
+    // Return the contact solver of a contact manifold of the island
+    SIMD_INLINE rpContactSolver* rpIsland::getContactSolver(uint index)
+    {
+        assert(index < mNbContactManifolds);
+        return mContactSolvers[mContactMapIndexesPair[index]];
+    }
+
 
 
 }
@@ -0,0 +1,557 @@
+/*
+ * rpConvexDecomposition.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+// Libraries
+#include "rpConvexDecomposition.h"
+#include "../HullSimplification/rpConvexHullSimplifier.h"
+
+#include <cstdio>
+#include <cmath>
+
+namespace real_physics
+{
+
+namespace
+{
+
+    /// Identifier of the files of convex pieces ("PHCD")
+    const uint32 CONVEX_DECOMPOSITION_FILE_MAGIC = 0x44434850;
+
+    /// Version of the files of convex pieces
+    const uint32 CONVEX_DECOMPOSITION_FILE_VERSION = 1;
+
+    /// Maximal number of cutting planes tried along an axis of a part
+    const int MAX_NB_CUTS_PER_AXIS = 16;
+
+    /// Weight of the difference of volume between the two halves of a cut
+    const scalar CUT_BALANCE_WEIGHT = scalar(0.05);
+
+    /// State of a voxel
+    enum VoxelState { VOXEL_UNKNOWN , VOXEL_OUTSIDE , VOXEL_SURFACE , VOXEL_INSIDE };
+
+
+    // Voxels of the mesh , with one voxel outside the mesh on every side
+    struct rpVoxelGrid
+    {
+        int     size[3];
+        Vector3 origin;
+        scalar  voxelSize;
+        std::vector<unsigned char> states;
+
+        uint32 getIndex(int i, int j, int k) const
+        {
+            return uint32(i + size[0] * (j + size[1] * k));
+        }
+
+        void getCoordinates(uint32 index, int coordinates[3]) const
+        {
+            coordinates[0] = int(index % uint32(size[0]));
+            coordinates[1] = int((index / uint32(size[0])) % uint32(size[1]));
+            coordinates[2] = int(index / uint32(size[0] * size[1]));
+        }
+
+        Vector3 getCorner(int i, int j, int k) const
+        {
+            return origin + Vector3(scalar(i), scalar(j), scalar(k)) * voxelSize;
+        }
+    };
+
+
+    // Part of the voxels , a piece of the decomposition
+    struct rpVoxelPart
+    {
+        std::vector<uint32> voxels;
+        scalar concavity;
+        bool   isSplittable;
+    };
+
+
+    // Cut of a part by the plane at a voxel coordinate along an axis
+    struct rpVoxelCut
+    {
+        int    axis;
+        int    coordinate;
+        scalar cost;
+    };
+
+
+    // Memory of a thread computing the hulls of parts
+    struct rpHullScratch
+    {
+        quickhull::QuickHull<scalar> quickHull;
+        std::vector<int>    rowMin;
+        std::vector<int>    rowMax;
+        std::vector<uint32> rowStamps;
+        uint32              stamp;
+
+        rpHullScratch() : stamp(0) {}
+    };
+
+
+    // Voxelize the triangles of the mesh and fill its inside
+    /// The surface voxels are found by sampling the triangles every half voxel ,
+    /// the voxels reached by a flood fill from the border are outside , the others
+    /// are inside (an open mesh has only surface voxels)
+    void voxelize(const Vector3* vertices, uint nbVertices, const uint* indices, uint nbIndices,
+                  uint resolution, rpVoxelGrid& grid)
+    {
+        Vector3 minBounds = vertices[0];
+        Vector3 maxBounds = vertices[0];
+        for (uint i = 1; i < nbVertices; i++)
+        {
+            minBounds = Vector3::min(minBounds, vertices[i]);
+            maxBounds = Vector3::max(maxBounds, vertices[i]);
+        }
+
+        const Vector3 extent = maxBounds - minBounds;
+        const scalar longestSide = Max(extent.x, Max(extent.y, extent.z));
+        grid.voxelSize = Max(longestSide / scalar(Max(resolution, uint(1))), MACHINE_EPSILON);
+        grid.origin = minBounds - Vector3(grid.voxelSize, grid.voxelSize, grid.voxelSize);
+        grid.size[0] = int(std::ceil(extent.x / grid.voxelSize)) + 2;
+        grid.size[1] = int(std::ceil(extent.y / grid.voxelSize)) + 2;
+        grid.size[2] = int(std::ceil(extent.z / grid.voxelSize)) + 2;
+        grid.states.assign(size_t(grid.size[0]) * grid.size[1] * grid.size[2], VOXEL_UNKNOWN);
+
+        const scalar invVoxelSize = scalar(1.0) / grid.voxelSize;
+        for (uint t = 0; t + 2 < nbIndices; t += 3)
+        {
+            const Vector3 a = (vertices[indices[t]]     - grid.origin) * invVoxelSize;
+            const Vector3 b = (vertices[indices[t + 1]] - grid.origin) * invVoxelSize;
+            const Vector3 c = (vertices[indices[t + 2]] - grid.origin) * invVoxelSize;
+
+            const scalar longestEdge = Max((b - a).length(), Max((c - b).length(), (a - c).length()));
+            const int nbSteps = int(std::ceil(longestEdge * scalar(2.0))) + 1;
+
+            for (int u = 0; u <= nbSteps; u++)
+            {
+                for (int v = 0; u + v <= nbSteps; v++)
+                {
+                    const Vector3 p = a + (b - a) * (scalar(u) / nbSteps) + (c - a) * (scalar(v) / nbSteps);
+                    const int i = Clamp(int(p.x), 0, grid.size[0] - 1);
+                    const int j = Clamp(int(p.y), 0, grid.size[1] - 1);
+                    const int k = Clamp(int(p.z), 0, grid.size[2] - 1);
+                    grid.states[grid.getIndex(i, j, k)] = VOXEL_SURFACE;
+                }
+            }
+        }
+
+        // Flood fill of the outside from a corner of the border
+        std::vector<uint32> stack;
+        stack.push_back(0);
+        grid.states[0] = VOXEL_OUTSIDE;
+        while (!stack.empty())
+        {
+            const uint32 index = stack.back();
+            stack.pop_back();
+
+            int coordinates[3];
+            grid.getCoordinates(index, coordinates);
+
+            for (int axis = 0; axis < 3; axis++)
+            {
+                for (int side = -1; side <= 1; side += 2)
+                {
+                    int neighbour[3] = { coordinates[0] , coordinates[1] , coordinates[2] };
+                    neighbour[axis] += side;
+                    if (neighbour[axis] < 0 || neighbour[axis] >= grid.size[axis]) continue;
+
+                    const uint32 neighbourIndex = grid.getIndex(neighbour[0], neighbour[1], neighbour[2]);
+                    if (grid.states[neighbourIndex] != VOXEL_UNKNOWN) continue;
+
+                    grid.states[neighbourIndex] = VOXEL_OUTSIDE;
+                    stack.push_back(neighbourIndex);
+                }
+            }
+        }
+
+        for (size_t i = 0; i < grid.states.size(); i++)
+        {
+            if (grid.states[i] == VOXEL_UNKNOWN) grid.states[i] = VOXEL_INSIDE;
+        }
+    }
+
+
+    // Compute the points whose hull is the hull of the voxels of a part on a side of a cut
+    /// The hull of voxels is the hull of the first and the last voxel of every row
+    /// along x , only their outer corners are kept (side : 0 the whole part , -1 the
+    /// voxels below the cut , 1 the voxels above it)
+    uint computeHullPoints(const rpVoxelGrid& grid, const std::vector<uint32>& voxels,
+                           int axis, int coordinate, int side,
+                           rpHullScratch& scratch, std::vector<Vector3>& points)
+    {
+        const size_t nbRows = size_t(grid.size[1]) * grid.size[2];
+        if (scratch.rowStamps.size() != nbRows)
+        {
+            scratch.rowMin.assign(nbRows, 0);
+            scratch.rowMax.assign(nbRows, 0);
+            scratch.rowStamps.assign(nbRows, 0);
+            scratch.stamp = 0;
+        }
+        scratch.stamp++;
+
+        std::vector<uint32> rows;
+        uint nbVoxels = 0;
+        for (size_t v = 0; v < voxels.size(); v++)
+        {
+            int coordinates[3];
+            grid.getCoordinates(voxels[v], coordinates);
+            if (side < 0 && coordinates[axis] >= coordinate) continue;
+            if (side > 0 && coordinates[axis] <  coordinate) continue;
+
+            nbVoxels++;
+            const uint32 row = uint32(coordinates[1] + grid.size[1] * coordinates[2]);
+            if (scratch.rowStamps[row] != scratch.stamp)
+            {
+                scratch.rowStamps[row] = scratch.stamp;
+                scratch.rowMin[row] = coordinates[0];
+                scratch.rowMax[row] = coordinates[0];
+                rows.push_back(row);
+            }
+            else
+            {
+                scratch.rowMin[row] = Min(scratch.rowMin[row], coordinates[0]);
+                scratch.rowMax[row] = Max(scratch.rowMax[row], coordinates[0]);
+            }
+        }
+
+        points.clear();
+        points.reserve(rows.size() * 8);
+        for (size_t r = 0; r < rows.size(); r++)
+        {
+            const int j = int(rows[r] % uint32(grid.size[1]));
+            const int k = int(rows[r] / uint32(grid.size[1]));
+            const int iMin = scratch.rowMin[rows[r]];
+            const int iMax = scratch.rowMax[rows[r]] + 1;
+
+            for (int dj = 0; dj <= 1; dj++)
+            {
+                for (int dk = 0; dk <= 1; dk++)
+                {
+                    points.push_back(grid.getCorner(iMin, j + dj, k + dk));
+                    points.push_back(grid.getCorner(iMax, j + dj, k + dk));
+                }
+            }
+        }
+
+        return nbVoxels;
+    }
+
+
+    // Return the concavity of the voxels of a part on a side of a cut
+    /// Volume of the hull not filled by the voxels , as a fraction of the volume of the mesh
+    scalar computeConcavity(const rpVoxelGrid& grid, const std::vector<uint32>& voxels,
+                            int axis, int coordinate, int side, scalar meshVolume,
+                            rpHullScratch& scratch, uint* nbVoxels = NULL)
+    {
+        std::vector<Vector3> points;
+        const uint nbPartVoxels = computeHullPoints(grid, voxels, axis, coordinate, side, scratch, points);
+        if (nbVoxels != NULL) *nbVoxels = nbPartVoxels;
+        if (nbPartVoxels == 0) return scalar(0.0);
+
+        const scalar voxelVolume = grid.voxelSize * grid.voxelSize * grid.voxelSize;
+        const quickhull::ConvexHull<scalar> hull = scratch.quickHull.getConvexHull(points, true, false);
+        const scalar hullVolume = rpConvexHullSimplifier::computeVolume(hull);
+
+        return Max(hullVolume - nbPartVoxels * voxelVolume, scalar(0.0)) / meshVolume;
+    }
+
+}
+
+
+// Constructor
+/**
+ * @param parameters The parameters of the decomposition
+ */
+rpConvexDecomposition::rpConvexDecomposition(const rpConvexDecompositionParameters& parameters)
+: mParameters(parameters),
+  mIsLoaded(false)
+{
+
+}
+
+// Decompose the mesh , return the number of pieces
+/**
+ * @param vertices The vertices of the triangle mesh
+ * @param nbVertices Number of vertices
+ * @param indices The three vertex indices of every triangle
+ * @param nbIndices Number of indices (three times the number of triangles)
+ */
+uint rpConvexDecomposition::compute(const Vector3* vertices, uint nbVertices, const uint* indices, uint nbIndices)
+{
+    mPieces.clear();
+    mPieceVolumes.clear();
+    mIsLoaded = false;
+
+    if (nbVertices == 0 || nbIndices < 3) return 0;
+
+    rpVoxelGrid grid;
+    voxelize(vertices, nbVertices, indices, nbIndices, mParameters.resolution, grid);
+
+    // The first part has all the voxels of the mesh
+    std::vector<rpVoxelPart> parts(1);
+    for (uint32 i = 0; i < grid.states.size(); i++)
+    {
+        if (grid.states[i] != VOXEL_OUTSIDE) parts[0].voxels.push_back(i);
+    }
+    if (parts[0].voxels.empty()) return 0;
+
+    rpThreadPool threadPool(mParameters.nbThreads);
+    std::vector<rpHullScratch> scratches(threadPool.getNbThreads());
+
+    const scalar voxelVolume = grid.voxelSize * grid.voxelSize * grid.voxelSize;
+    const scalar meshVolume = parts[0].voxels.size() * voxelVolume;
+
+    parts[0].concavity = computeConcavity(grid, parts[0].voxels, 0, 0, 0, meshVolume, scratches[0]);
+    parts[0].isSplittable = true;
+
+    // Cut the most concave part until there are enough pieces
+    while (parts.size() < mParameters.maxNbPieces)
+    {
+        int worstPart = -1;
+        for (size_t p = 0; p < parts.size(); p++)
+        {
+            if (!parts[p].isSplittable || parts[p].concavity <= mParameters.maxConcavity) continue;
+            if (worstPart < 0 || parts[p].concavity > parts[worstPart].concavity) worstPart = int(p);
+        }
+        if (worstPart < 0) break;
+
+        rpVoxelPart& part = parts[worstPart];
+
+        // Cutting planes at regular voxel coordinates along the three axes
+        int minCoordinates[3] = { grid.size[0] , grid.size[1] , grid.size[2] };
+        int maxCoordinates[3] = { 0 , 0 , 0 };
+        for (size_t v = 0; v < part.voxels.size(); v++)
+        {
+            int coordinates[3];
+            grid.getCoordinates(part.voxels[v], coordinates);
+            for (int axis = 0; axis < 3; axis++)
+            {
+                minCoordinates[axis] = Min(minCoordinates[axis], coordinates[axis]);
+                maxCoordinates[axis] = Max(maxCoordinates[axis], coordinates[axis] + 1);
+            }
+        }
+
+        std::vector<rpVoxelCut> cuts;
+        for (int axis = 0; axis < 3; axis++)
+        {
+            const int length = maxCoordinates[axis] - minCoordinates[axis];
+            const int step = Max(length / MAX_NB_CUTS_PER_AXIS, 1);
+            for (int c = minCoordinates[axis] + step; c < maxCoordinates[axis]; c += step)
+            {
+                rpVoxelCut cut;
+                cut.axis = axis;
+                cut.coordinate = c;
+                cut.cost = DECIMAL_LARGEST;
+                cuts.push_back(cut);
+            }
+        }
+
+        if (cuts.empty())
+        {
+            part.isSplittable = false;
+            continue;
+        }
+
+        // The cost of a cut is the concavity of its two halves
+        threadPool.parallelFor(uint(cuts.size()), [&](uint c, uint thread)
+        {
+            rpVoxelCut& cut = cuts[c];
+            uint nbBelow = 0;
+            uint nbAbove = 0;
+            const scalar concavityBelow = computeConcavity(grid, part.voxels, cut.axis, cut.coordinate, -1,
+                                                           meshVolume, scratches[thread], &nbBelow);
+            const scalar concavityAbove = computeConcavity(grid, part.voxels, cut.axis, cut.coordinate,  1,
+                                                           meshVolume, scratches[thread], &nbAbove);
+            if (nbBelow == 0 || nbAbove == 0) return;
+
+            const scalar balance = Abs(scalar(nbBelow) - scalar(nbAbove)) * voxelVolume / meshVolume;
+            cut.cost = concavityBelow + concavityAbove + CUT_BALANCE_WEIGHT * balance;
+        });
+
+        int bestCut = 0;
+        for (size_t c = 1; c < cuts.size(); c++)
+        {
+            if (cuts[c].cost < cuts[bestCut].cost) bestCut = int(c);
+        }
+
+        if (cuts[bestCut].cost == DECIMAL_LARGEST)
+        {
+            part.isSplittable = false;
+            continue;
+        }
+
+        // Replace the part by its two halves
+        const int axis = cuts[bestCut].axis;
+        const int coordinate = cuts[bestCut].coordinate;
+        rpVoxelPart below;
+        rpVoxelPart above;
+        for (size_t v = 0; v < part.voxels.size(); v++)
+        {
+            int coordinates[3];
+            grid.getCoordinates(part.voxels[v], coordinates);
+            if (coordinates[axis] < coordinate) below.voxels.push_back(part.voxels[v]);
+            else                                above.voxels.push_back(part.voxels[v]);
+        }
+
+        below.concavity = computeConcavity(grid, below.voxels, 0, 0, 0, meshVolume, scratches[0]);
+        above.concavity = computeConcavity(grid, above.voxels, 0, 0, 0, meshVolume, scratches[0]);
+        below.isSplittable = true;
+        above.isSplittable = true;
+
+        parts[worstPart] = below;
+        parts.push_back(above);
+    }
+
+    // Hulls of the pieces , simplified to the vertex budget
+    mPieces.resize(parts.size());
+    mPieceVolumes.resize(parts.size());
+    const rpConvexHullSimplification simplification(scalar(2.0) * PI / scalar(180.0),
+                                                    mParameters.maxNbVerticesPerPiece, scalar(1.0));
+    threadPool.parallelFor(uint(parts.size()), [&](uint p, uint thread)
+    {
+        std::vector<Vector3> points;
+        computeHullPoints(grid, parts[p].voxels, 0, 0, 0, scratches[thread], points);
+
+        rpConvexHullSimplifier simplifier;
+        const quickhull::ConvexHull<scalar> hull =
+                simplifier.simplify(scratches[thread].quickHull.getConvexHull(points, true, false), simplification);
+
+        mPieces[p].assign(hull.getVertexBuffer().begin(), hull.getVertexBuffer().begin() + hull.getVertexBuffer().size());
+        mPieceVolumes[p] = rpConvexHullSimplifier::computeVolume(hull);
+    });
+
+    return getNbPieces();
+}
+
+// Read the pieces from the file or decompose the mesh and write the pieces to the file
+/**
+ * @param cacheFileName The file of the pieces , it is written again when it was
+ *                      made for another mesh or with other parameters
+ */
+uint rpConvexDecomposition::compute(const Vector3* vertices, uint nbVertices, const uint* indices, uint nbIndices,
+                                    const char* cacheFileName)
+{
+    const uint64 key = computeKey(vertices, nbVertices, indices, nbIndices);
+    if (cacheFileName != NULL && load(cacheFileName, key)) return getNbPieces();
+
+    compute(vertices, nbVertices, indices, nbIndices);
+    if (cacheFileName != NULL) save(cacheFileName, key);
+
+    return getNbPieces();
+}
+
+// Write the pieces to a file with the key of the mesh
+/// The file has the header (magic , version , key , number of pieces) then for
+/// every piece its number of vertices , its vertices and its volume
+bool rpConvexDecomposition::save(const char* fileName, uint64 key) const
+{
+    FILE* file = fopen( fileName , "wb" );
+    if( file == NULL ) return false;
+
+    const uint32 header[3] = { CONVEX_DECOMPOSITION_FILE_MAGIC , CONVEX_DECOMPOSITION_FILE_VERSION , uint32(mPieces.size()) };
+    bool isWritten = fwrite( header , sizeof(header) , 1 , file ) == 1 &&
+                     fwrite( &key , sizeof(key) , 1 , file ) == 1;
+
+    for( size_t p = 0; p < mPieces.size() && isWritten; ++p )
+    {
+        const uint32 nbVertices = uint32(mPieces[p].size());
+        isWritten = fwrite( &nbVertices , sizeof(nbVertices) , 1 , file ) == 1;
+
+        for( uint32 v = 0; v < nbVertices && isWritten; ++v )
+        {
+            const scalar coordinates[3] = { mPieces[p][v].x , mPieces[p][v].y , mPieces[p][v].z };
+            isWritten = fwrite( coordinates , sizeof(coordinates) , 1 , file ) == 1;
+        }
+
+        isWritten = isWritten && fwrite( &mPieceVolumes[p] , sizeof(scalar) , 1 , file ) == 1;
+    }
+
+    fclose(file);
+    return isWritten;
+}
+
+// Read the pieces from a file , false if the file does not have the key of the mesh
+bool rpConvexDecomposition::load(const char* fileName, uint64 key)
+{
+    FILE* file = fopen( fileName , "rb" );
+    if( file == NULL ) return false;
+
+    uint32 header[3];
+    uint64 fileKey = 0;
+    if( fread( header , sizeof(header) , 1 , file ) != 1 || fread( &fileKey , sizeof(fileKey) , 1 , file ) != 1 ||
+        header[0] != CONVEX_DECOMPOSITION_FILE_MAGIC || header[1] != CONVEX_DECOMPOSITION_FILE_VERSION || fileKey != key )
+    {
+        fclose(file);
+        return false;
+    }
+
+    /// The counts of the file are checked against the bytes left before anything is allocated
+    const long position = ftell(file);
+    fseek( file , 0 , SEEK_END );
+    const long end = ftell(file);
+    fseek( file , position , SEEK_SET );
+
+    const uint64 vertexSize   = 3 * sizeof(scalar);
+    const uint64 minPieceSize = sizeof(uint32) + 4 * vertexSize + sizeof(scalar);
+    uint64 remaining = (position >= 0 && end >= position) ? uint64(end - position) : 0;
+    if( header[2] > remaining / minPieceSize )
+    {
+        fclose(file);
+        return false;
+    }
+
+    std::vector< std::vector<Vector3> > pieces(header[2]);
+    std::vector<scalar> volumes(header[2]);
+    bool isRead = true;
+    for( uint32 p = 0; p < header[2] && isRead; ++p )
+    {
+        uint32 nbVertices = 0;
+        isRead = fread( &nbVertices , sizeof(nbVertices) , 1 , file ) == 1 && nbVertices >= 4;
+
+        /// The read header leaves at least its own bytes in the count
+        remaining -= isRead ? sizeof(uint32) : 0;
+        isRead = isRead && remaining >= sizeof(scalar) && nbVertices <= (remaining - sizeof(scalar)) / vertexSize;
+        if( isRead ) remaining -= nbVertices * vertexSize + sizeof(scalar);
+
+        pieces[p].reserve( isRead ? nbVertices : 0 );
+        for( uint32 v = 0; v < nbVertices && isRead; ++v )
+        {
+            scalar coordinates[3];
+            isRead = fread( coordinates , sizeof(coordinates) , 1 , file ) == 1;
+            pieces[p].push_back( Vector3( coordinates[0] , coordinates[1] , coordinates[2] ) );
+        }
+
+        isRead = isRead && fread( &volumes[p] , sizeof(scalar) , 1 , file ) == 1;
+    }
+
+    fclose(file);
+    if( !isRead ) return false;
+
+    mPieces.swap(pieces);
+    mPieceVolumes.swap(volumes);
+    mIsLoaded = true;
+    return true;
+}
+
+// Return the key of a mesh decomposed with the parameters
+/// FNV-1a hash of the mesh and of the parameters changing the pieces
+uint64 rpConvexDecomposition::computeKey(const Vector3* vertices, uint nbVertices, const uint* indices, uint nbIndices) const
+{
+    uint64 hash = VERTEX_HASH_OFFSET_BASIS;
+
+    rpHashVertices(hash, vertices, nbVertices);
+    rpHashBytes(hash, indices, nbIndices * sizeof(uint));
+
+    rpHashBytes(hash, &mParameters.resolution, sizeof(mParameters.resolution));
+    rpHashBytes(hash, &mParameters.maxNbPieces, sizeof(mParameters.maxNbPieces));
+    rpHashBytes(hash, &mParameters.maxNbVerticesPerPiece, sizeof(mParameters.maxNbVerticesPerPiece));
+    rpHashBytes(hash, &mParameters.maxConcavity, sizeof(mParameters.maxConcavity));
+
+    return hash;
+}
+
+} /* namespace real_physics */
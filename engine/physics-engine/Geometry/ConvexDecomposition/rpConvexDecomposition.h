@@ -0,0 +1,166 @@
+/*
+ * rpConvexDecomposition.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SOURCE_ENGIE_GEOMETRY_RPCONVEXDECOMPOSITION_H_
+#define SOURCE_ENGIE_GEOMETRY_RPCONVEXDECOMPOSITION_H_
+
+// Libraries
+#include <vector>
+
+#include "../../LinearMaths/mathematics.h"
+#include "../rpVertexHash.h"
+#include "../QuickHull/QuickHull.hpp"
+#include "../../Parallel/rpThreadPool.h"
+
+namespace real_physics
+{
+
+// Structure rpConvexDecompositionParameters
+/**
+ * Parameters of the convex decomposition of a concave mesh
+ */
+struct rpConvexDecompositionParameters
+{
+    /// Number of voxels along the longest side of the mesh
+    uint   resolution;
+
+    /// Maximal number of convex pieces
+    uint   maxNbPieces;
+
+    /// Maximal number of vertices of a piece
+    uint   maxNbVerticesPerPiece;
+
+    /// A piece is not split when the volume between its hull and its voxels is
+    /// smaller than this fraction of the volume of the mesh
+    scalar maxConcavity;
+
+    /// Number of threads computing the cuts and the pieces (zero : one per core)
+    uint   nbThreads;
+
+    /// Constructor
+    rpConvexDecompositionParameters(uint   resolution            = 32 ,
+                                    uint   maxNbPieces           = 16 ,
+                                    uint   maxNbVerticesPerPiece = 32 ,
+                                    scalar maxConcavity          = scalar(0.01) ,
+                                    uint   nbThreads             = 0)
+    : resolution(resolution),
+      maxNbPieces(maxNbPieces),
+      maxNbVerticesPerPiece(maxNbVerticesPerPiece),
+      maxConcavity(maxConcavity),
+      nbThreads(nbThreads)
+    {
+
+    }
+};
+
+
+// Class rpConvexDecomposition
+/**
+ * This class computes an approximate convex decomposition of a concave
+ * triangle mesh , in the way of V-HACD :
+ *  - the mesh is voxelized : the voxels crossed by the triangles are on the
+ *    surface , the voxels not reached by a flood fill from outside are inside ;
+ *  - the part with the largest concavity (volume of its hull not filled by its
+ *    voxels) is cut in two by the axis-aligned plane giving the two least
+ *    concave halves , until there are enough pieces or they are all convex enough ;
+ *  - the hull of every piece is simplified to the vertex budget.
+ * The candidate cuts and the hulls of the pieces are computed on a rpThreadPool.
+ * The pieces can be saved to a file with the hash of the mesh and of the
+ * parameters , a level load then reads them instead of decomposing the mesh again.
+ */
+class rpConvexDecomposition
+{
+
+    private :
+
+        // -------------------- Attributes -------------------- //
+
+        /// Parameters of the decomposition
+        rpConvexDecompositionParameters mParameters;
+
+        /// Hull vertices of the pieces
+        std::vector< std::vector<Vector3> > mPieces;
+
+        /// Volume of the hulls of the pieces
+        std::vector<scalar> mPieceVolumes;
+
+        /// True if the pieces were read from a file
+        bool mIsLoaded;
+
+        // -------------------- Methods -------------------- //
+
+        /// Private copy-constructor
+        rpConvexDecomposition(const rpConvexDecomposition& decomposition);
+
+        /// Private assignment operator
+        rpConvexDecomposition& operator=(const rpConvexDecomposition& decomposition);
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        rpConvexDecomposition(const rpConvexDecompositionParameters& parameters = rpConvexDecompositionParameters());
+
+        /// Decompose the mesh , return the number of pieces
+        uint compute(const Vector3* vertices, uint nbVertices, const uint* indices, uint nbIndices);
+
+        /// Read the pieces from the file or decompose the mesh and write the pieces to the file
+        uint compute(const Vector3* vertices, uint nbVertices, const uint* indices, uint nbIndices,
+                     const char* cacheFileName);
+
+        /// Write the pieces to a file with the key of the mesh
+        bool save(const char* fileName, uint64 key) const;
+
+        /// Read the pieces from a file , false if the file does not have the key of the mesh
+        bool load(const char* fileName, uint64 key);
+
+        /// Return the number of pieces
+        uint getNbPieces() const;
+
+        /// Return the hull vertices of a piece
+        const std::vector<Vector3>& getPieceVertices(uint index) const;
+
+        /// Return the volume of the hull of a piece
+        scalar getPieceVolume(uint index) const;
+
+        /// Return true if the pieces were read from a file
+        bool isLoaded() const;
+
+        /// Return the key of a mesh decomposed with the parameters
+        uint64 computeKey(const Vector3* vertices, uint nbVertices, const uint* indices, uint nbIndices) const;
+};
+
+// Return the number of pieces
+SIMD_INLINE uint rpConvexDecomposition::getNbPieces() const
+{
+    return uint(mPieces.size());
+}
+
+// Return the hull vertices of a piece
+SIMD_INLINE const std::vector<Vector3>& rpConvexDecomposition::getPieceVertices(uint index) const
+{
+    assert(index < mPieces.size());
+    return mPieces[index];
+}
+
+// Return the volume of the hull of a piece
+SIMD_INLINE scalar rpConvexDecomposition::getPieceVolume(uint index) const
+{
+    assert(index < mPieceVolumes.size());
+    return mPieceVolumes[index];
+}
+
+// Return true if the pieces were read from a file
+SIMD_INLINE bool rpConvexDecomposition::isLoaded() const
+{
+    return mIsLoaded;
+}
+
+} /* namespace real_physics */
+
+#endif /* SOURCE_ENGIE_GEOMETRY_RPCONVEXDECOMPOSITION_H_ */
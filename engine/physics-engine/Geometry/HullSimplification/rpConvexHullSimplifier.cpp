@@ -0,0 +1,268 @@
+/*
+ * rpConvexHullSimplifier.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+// Libraries
+#include "rpConvexHullSimplifier.h"
+
+#include <algorithm>
+
+namespace real_physics
+{
+
+namespace
+{
+
+    // Vertex of the hull with the volume of its cap
+    struct rpDecimationCandidate
+    {
+        uint   index;
+        scalar capVolume;
+
+        bool operator < (const rpDecimationCandidate& candidate) const
+        {
+            return capVolume < candidate.capVolume;
+        }
+    };
+
+}
+
+
+// Constructor
+rpConvexHullSimplifier::rpConvexHullSimplifier()
+: mInitialVolume(0),
+  mMaxVolumeLost(0)
+{
+
+}
+
+// Return the simplified hull
+/**
+ * @param hull The hull to simplify (a closed triangle mesh with CCW faces)
+ * @param simplification The parameters of the simplification
+ * @param[out] report The number of vertices and faces before and after the
+ *                    simplification and the volume error , if not NULL
+ */
+quickhull::ConvexHull<scalar> rpConvexHullSimplifier::simplify(const quickhull::ConvexHull<scalar>& hull ,
+                                                              const rpConvexHullSimplification& simplification ,
+                                                              rpConvexHullSimplificationReport* report)
+{
+    mHull = hull;
+    mInitialVolume = computeVolume(hull);
+    mMaxVolumeLost = simplification.maxVolumeError * mInitialVolume;
+
+    // Merge the vertices inside planar regions , half of them at a time
+    // when removing all of them loses too much volume
+    if (simplification.planeMergeAngle > scalar(0.0))
+    {
+        std::vector<uint> vertices = findPlanarVertices(simplification.planeMergeAngle);
+        while (!vertices.empty() && !removeVertices(vertices))
+        {
+            vertices.resize(vertices.size() / 2);
+        }
+    }
+
+    // Decimate the vertices with the smallest cap volume down to the target
+    // number of vertices , a tetrahedron is the smallest hull
+    const uint targetNbVertices = Max(simplification.maxNbVertices , uint(4));
+    while (simplification.maxNbVertices > 0 && mHull.getVertexBuffer().size() > targetNbVertices)
+    {
+        const uint nbExcessVertices = uint(mHull.getVertexBuffer().size()) - targetNbVertices;
+        const uint nbBatchVertices  = Max(Min(nbExcessVertices , uint(mHull.getVertexBuffer().size() / 4)) , uint(1));
+
+        std::vector<uint> vertices = findDecimationVertices(nbBatchVertices);
+        while (!vertices.empty() && !removeVertices(vertices))
+        {
+            vertices.resize(vertices.size() / 2);
+        }
+
+        // Removing the next vertex loses too much volume
+        if (vertices.empty()) break;
+    }
+
+    if (report != NULL)
+    {
+        report->nbVerticesBefore = uint(hull.getVertexBuffer().size());
+        report->nbFacesBefore    = uint(hull.getIndexBuffer().size() / 3);
+        report->nbVertices       = uint(mHull.getVertexBuffer().size());
+        report->nbFaces          = uint(mHull.getIndexBuffer().size() / 3);
+        report->volumeError      = (mInitialVolume > MACHINE_EPSILON) ?
+                                   (mInitialVolume - computeVolume(mHull)) / mInitialVolume : scalar(0.0);
+    }
+
+    return mHull;
+}
+
+// Return the volume of a closed hull
+/// Sum of the signed volumes of the tetrahedra between the origin and the faces
+scalar rpConvexHullSimplifier::computeVolume(const quickhull::ConvexHull<scalar>& hull)
+{
+    const std::vector<size_t>& indices = hull.getIndexBuffer();
+
+    scalar volume = 0;
+    for (size_t i = 0; i + 2 < indices.size(); i += 3)
+    {
+        const Vector3& a = hull.getVertexBuffer()[indices[i]];
+        const Vector3& b = hull.getVertexBuffer()[indices[i + 1]];
+        const Vector3& c = hull.getVertexBuffer()[indices[i + 2]];
+        volume += a.dot(b.cross(c));
+    }
+
+    return Abs(volume) / scalar(6.0);
+}
+
+// Compute the faces around each vertex of the current hull
+void rpConvexHullSimplifier::computeVertexFaces(std::vector< std::vector<uint> >& vertexFaces) const
+{
+    const std::vector<size_t>& indices = mHull.getIndexBuffer();
+
+    vertexFaces.assign(mHull.getVertexBuffer().size(), std::vector<uint>());
+    for (size_t i = 0; i < indices.size(); i++)
+    {
+        vertexFaces[indices[i]].push_back(uint(i / 3));
+    }
+}
+
+// Return the indices of the vertices whose faces are in the same plane
+/// The normals of the faces around the vertex are all within the merge
+/// angle of their mean normal
+std::vector<uint> rpConvexHullSimplifier::findPlanarVertices(scalar planeMergeAngle) const
+{
+    const std::vector<size_t>& indices = mHull.getIndexBuffer();
+    const scalar cosMergeAngle = Cos(planeMergeAngle);
+
+    std::vector< std::vector<uint> > vertexFaces;
+    computeVertexFaces(vertexFaces);
+
+    std::vector<Vector3> faceNormals(indices.size() / 3);
+    for (size_t f = 0; f < faceNormals.size(); f++)
+    {
+        const Vector3& a = mHull.getVertexBuffer()[indices[3 * f]];
+        const Vector3& b = mHull.getVertexBuffer()[indices[3 * f + 1]];
+        const Vector3& c = mHull.getVertexBuffer()[indices[3 * f + 2]];
+        faceNormals[f] = (b - a).cross(c - a);
+        if (faceNormals[f].lengthSquare() > MACHINE_EPSILON) faceNormals[f].normalize();
+    }
+
+    std::vector<uint> vertices;
+    for (uint v = 0; v < vertexFaces.size(); v++)
+    {
+        if (vertexFaces[v].empty()) continue;
+
+        Vector3 meanNormal(0, 0, 0);
+        for (size_t i = 0; i < vertexFaces[v].size(); i++) meanNormal += faceNormals[vertexFaces[v][i]];
+        if (meanNormal.lengthSquare() < MACHINE_EPSILON) continue;
+        meanNormal.normalize();
+
+        bool isPlanar = true;
+        for (size_t i = 0; i < vertexFaces[v].size() && isPlanar; i++)
+        {
+            isPlanar = (faceNormals[vertexFaces[v][i]].dot(meanNormal) >= cosMergeAngle);
+        }
+
+        if (isPlanar) vertices.push_back(v);
+    }
+
+    return vertices;
+}
+
+// Return the indices of independent vertices to decimate , smallest cap volume first
+/// The cap volume of a vertex is the volume of the fan of tetrahedra between the
+/// vertex , its faces and the centroid of its neighbours. No two vertices of the
+/// batch share an edge , so their caps do not overlap.
+std::vector<uint> rpConvexHullSimplifier::findDecimationVertices(uint nbVertices) const
+{
+    const std::vector<size_t>& indices = mHull.getIndexBuffer();
+
+    std::vector< std::vector<uint> > vertexFaces;
+    computeVertexFaces(vertexFaces);
+
+    std::vector<rpDecimationCandidate> candidates;
+    candidates.reserve(vertexFaces.size());
+    for (uint v = 0; v < vertexFaces.size(); v++)
+    {
+        if (vertexFaces[v].empty()) continue;
+
+        // Centroid of the neighbours , each of them is in two faces of the vertex
+        Vector3 centroid(0, 0, 0);
+        for (size_t i = 0; i < vertexFaces[v].size(); i++)
+        {
+            const uint f = vertexFaces[v][i];
+            for (uint k = 0; k < 3; k++)
+            {
+                if (indices[3 * f + k] != v) centroid += mHull.getVertexBuffer()[indices[3 * f + k]];
+            }
+        }
+        centroid /= scalar(2 * vertexFaces[v].size());
+
+        const Vector3 apex = mHull.getVertexBuffer()[v] - centroid;
+        scalar capVolume = 0;
+        for (size_t i = 0; i < vertexFaces[v].size(); i++)
+        {
+            const uint f = vertexFaces[v][i];
+            uint k = 0;
+            while (indices[3 * f + k] != v) k++;
+
+            const Vector3 a = mHull.getVertexBuffer()[indices[3 * f + (k + 1) % 3]] - centroid;
+            const Vector3 b = mHull.getVertexBuffer()[indices[3 * f + (k + 2) % 3]] - centroid;
+            capVolume += Abs(a.cross(b).dot(apex));
+        }
+
+        rpDecimationCandidate candidate;
+        candidate.index = v;
+        candidate.capVolume = capVolume / scalar(6.0);
+        candidates.push_back(candidate);
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+
+    std::vector<bool> isLocked(vertexFaces.size(), false);
+    std::vector<uint> vertices;
+    for (size_t i = 0; i < candidates.size() && vertices.size() < nbVertices; i++)
+    {
+        const uint v = candidates[i].index;
+        if (isLocked[v]) continue;
+
+        vertices.push_back(v);
+        for (size_t j = 0; j < vertexFaces[v].size(); j++)
+        {
+            const uint f = vertexFaces[v][j];
+            isLocked[indices[3 * f]]     = true;
+            isLocked[indices[3 * f + 1]] = true;
+            isLocked[indices[3 * f + 2]] = true;
+        }
+    }
+
+    return vertices;
+}
+
+// Remove the vertices from the current hull if the volume error stays allowed
+/// The hull of the remaining vertices is computed again , the vertices made
+/// interior by the removal disappear with it
+bool rpConvexHullSimplifier::removeVertices(const std::vector<uint>& vertices)
+{
+    std::vector<bool> isRemoved(mHull.getVertexBuffer().size(), false);
+    for (size_t i = 0; i < vertices.size(); i++) isRemoved[vertices[i]] = true;
+
+    std::vector<Vector3> points;
+    points.reserve(mHull.getVertexBuffer().size());
+    for (size_t v = 0; v < mHull.getVertexBuffer().size(); v++)
+    {
+        if (!isRemoved[v]) points.push_back(mHull.getVertexBuffer()[v]);
+    }
+
+    if (points.size() < 4) return false;
+
+    quickhull::ConvexHull<scalar> hull = mQuickHull.getConvexHull(points, true, false);
+    if (hull.getIndexBuffer().size() < 12) return false;
+
+    if (mInitialVolume - computeVolume(hull) > mMaxVolumeLost) return false;
+
+    mHull = hull;
+    return true;
+}
+
+} /* namespace real_physics */
@@ -0,0 +1,148 @@
+/*
+ * rpConvexHullSimplifier.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SOURCE_ENGIE_GEOMETRY_RPCONVEXHULLSIMPLIFIER_H_
+#define SOURCE_ENGIE_GEOMETRY_RPCONVEXHULLSIMPLIFIER_H_
+
+// Libraries
+#include <vector>
+
+#include "../../LinearMaths/mathematics.h"
+#include "../QuickHull/ConvexHull.hpp"
+#include "../QuickHull/QuickHull.hpp"
+
+namespace real_physics
+{
+
+// Structure rpConvexHullSimplification
+/**
+ * Parameters of the simplification of a convex hull. The support queries of
+ * the narrow-phase are linear in the number of vertices of the hull , so the
+ * hulls of scanned or high-poly meshes are reduced before they are used.
+ */
+struct rpConvexHullSimplification
+{
+    /// Maximal angle (in radians) between the faces around a vertex for the vertex
+    /// to be merged into their plane (zero : no plane merging)
+    scalar planeMergeAngle;
+
+    /// Number of vertices the vertex decimation reduces the hull to (zero : no decimation)
+    uint   maxNbVertices;
+
+    /// Maximal volume the simplification can remove , as a fraction of the volume of the hull
+    scalar maxVolumeError;
+
+    /// Constructor
+    rpConvexHullSimplification(scalar planeMergeAngle = scalar(2.0) * PI / scalar(180.0) ,
+                               uint   maxNbVertices   = 32 ,
+                               scalar maxVolumeError  = scalar(0.02))
+    : planeMergeAngle(planeMergeAngle),
+      maxNbVertices(maxNbVertices),
+      maxVolumeError(maxVolumeError)
+    {
+
+    }
+};
+
+
+// Structure rpConvexHullSimplificationReport
+/**
+ * Result of the simplification of a convex hull
+ */
+struct rpConvexHullSimplificationReport
+{
+    /// Number of vertices and faces of the hull before the simplification
+    uint nbVerticesBefore;
+    uint nbFacesBefore;
+
+    /// Number of vertices and faces of the simplified hull
+    uint nbVertices;
+    uint nbFaces;
+
+    /// Volume removed by the simplification , as a fraction of the volume of the hull
+    scalar volumeError;
+
+    /// Constructor
+    rpConvexHullSimplificationReport()
+    : nbVerticesBefore(0), nbFacesBefore(0), nbVertices(0), nbFaces(0), volumeError(0)
+    {
+
+    }
+};
+
+
+// Class rpConvexHullSimplifier
+/**
+ * This class simplifies a convex hull in two passes :
+ *  - plane merging : the vertices whose faces are in the same plane up to the
+ *    merge angle do not give any support point , they are removed all at once ;
+ *  - vertex decimation : until the hull has the target number of vertices ,
+ *    the vertices with the smallest cap volume (the volume between the vertex
+ *    and the polygon of its neighbours) are removed.
+ * After each removal the hull of the remaining vertices is computed again with
+ * QuickHull , so the result is always convex and inside the original hull. A
+ * removal which would make the hull lose more than the maximal volume error is
+ * undone , and the simplification stops with the hull it has.
+ */
+class rpConvexHullSimplifier
+{
+
+    private :
+
+        // -------------------- Attributes -------------------- //
+
+        /// QuickHull algorithm computing the hull of the remaining vertices
+        quickhull::QuickHull<scalar> mQuickHull;
+
+        /// Current simplified hull
+        quickhull::ConvexHull<scalar> mHull;
+
+        /// Volume of the hull before the simplification
+        scalar mInitialVolume;
+
+        /// Maximal volume the simplification can remove
+        scalar mMaxVolumeLost;
+
+        // -------------------- Methods -------------------- //
+
+        /// Private copy-constructor
+        rpConvexHullSimplifier(const rpConvexHullSimplifier& simplifier);
+
+        /// Private assignment operator
+        rpConvexHullSimplifier& operator=(const rpConvexHullSimplifier& simplifier);
+
+        /// Compute the faces around each vertex of the current hull
+        void computeVertexFaces(std::vector< std::vector<uint> >& vertexFaces) const;
+
+        /// Return the indices of the vertices whose faces are in the same plane
+        std::vector<uint> findPlanarVertices(scalar planeMergeAngle) const;
+
+        /// Return the indices of independent vertices to decimate , smallest cap volume first
+        std::vector<uint> findDecimationVertices(uint nbVertices) const;
+
+        /// Remove the vertices from the current hull if the volume error stays allowed
+        bool removeVertices(const std::vector<uint>& vertices);
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        rpConvexHullSimplifier();
+
+        /// Return the simplified hull
+        quickhull::ConvexHull<scalar> simplify(const quickhull::ConvexHull<scalar>& hull ,
+                                               const rpConvexHullSimplification& simplification ,
+                                               rpConvexHullSimplificationReport* report = NULL);
+
+        /// Return the volume of a closed hull
+        static scalar computeVolume(const quickhull::ConvexHull<scalar>& hull);
+};
+
+} /* namespace real_physics */
+
+#endif /* SOURCE_ENGIE_GEOMETRY_RPCONVEXHULLSIMPLIFIER_H_ */
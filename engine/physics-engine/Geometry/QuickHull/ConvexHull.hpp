@@ -197,16 +197,33 @@ namespace real_physics
 				}
 			}
 
+			// Construct a hull from prebuilt vertex and index buffers (for example a hull loaded from a scene file).
+			// The vertex buffer is referenced, not copied, so it must outlive the hull.
+			ConvexHull(const Vector3<T>* vertices, size_t vertexCount, const unsigned int* indices, size_t indexCount)
+			: m_vertices(vertices, vertexCount), m_indices(indices, indices + indexCount)
+			{
+			}
+
 			std::vector<size_t>& getIndexBuffer()
 			{
 				return m_indices;
 			}
 
+			const std::vector<size_t>& getIndexBuffer() const
+			{
+				return m_indices;
+			}
+
 			VertexDataSource<T>& getVertexBuffer()
 			{
 				return m_vertices;
 			}
 
+			const VertexDataSource<T>& getVertexBuffer() const
+			{
+				return m_vertices;
+			}
+
 			// Export the mesh to a Waveform OBJ file
 			void writeWaveformOBJ(const std::string& filename, const std::string& objectName = "quickhull")
 			{
@@ -167,7 +167,7 @@ namespace real_physics
 				visibleFaces.clear();
 				possiblyVisibleFaces.emplace_back(topFaceIndex,std::numeric_limits<size_t>::max());
 				while (possiblyVisibleFaces.size()) {
-					const auto& faceData = possiblyVisibleFaces.back();
+					const auto faceData = possiblyVisibleFaces.back();
 					possiblyVisibleFaces.pop_back();
 					auto& pvf = m_mesh.m_faces[faceData.m_faceIndex];
 					assert(!pvf.isDisabled());
@@ -356,10 +356,42 @@ namespace real_physics
 		template <typename T>
 		std::array<IndexType,6> QuickHull<T>::getExtremeValues()
 		{
-			std::array<IndexType,6> outIndices{0,0,0,0,0,0};
-			T extremeVals[6] = {m_vertexData[0].x,m_vertexData[0].x,m_vertexData[0].y,m_vertexData[0].y,m_vertexData[0].z,m_vertexData[0].z};
 			const size_t vCount = m_vertexData.size();
-			for (size_t i=1;i<vCount;i++)
+			const size_t nbChunks = getNbChunks(vCount);
+			if (nbChunks == 1)
+			{
+				return getExtremeValues(0,vCount);
+			}
+
+			// Merge the extreme values of the chunks in order, the first index wins in ties as in the serial pass
+			std::vector<std::array<IndexType,6>> chunkIndices(nbChunks);
+			forEachChunk(nbChunks, vCount, [&](size_t chunk, size_t begin, size_t end)
+			{
+				chunkIndices[chunk] = getExtremeValues(begin,end);
+			});
+
+			std::array<IndexType,6> outIndices = chunkIndices[0];
+			for (size_t c=1;c<nbChunks;c++)
+			{
+				for (size_t i=0;i<6;i++)
+				{
+					const T value = ((const T*)(&m_vertexData[chunkIndices[c][i]]))[i/2];
+					const T extremeValue = ((const T*)(&m_vertexData[outIndices[i]]))[i/2];
+					if ((i%2==0 && value>extremeValue) || (i%2==1 && value<extremeValue))
+					{
+						outIndices[i] = chunkIndices[c][i];
+					}
+				}
+			}
+			return outIndices;
+		}
+
+		template <typename T>
+		std::array<IndexType,6> QuickHull<T>::getExtremeValues(size_t begin, size_t end)
+		{
+			std::array<IndexType,6> outIndices{begin,begin,begin,begin,begin,begin};
+			T extremeVals[6] = {m_vertexData[begin].x,m_vertexData[begin].x,m_vertexData[begin].y,m_vertexData[begin].y,m_vertexData[begin].z,m_vertexData[begin].z};
+			for (size_t i=begin+1;i<end;i++)
 			{
 				const Vector3<T>& pos = m_vertexData[i];
 				if (pos.x>extremeVals[0])
@@ -396,6 +428,61 @@ namespace real_physics
 			return outIndices;
 		}
 
+		template <typename T>
+		size_t QuickHull<T>::getNbChunks(size_t count) const
+		{
+			if (!m_threadPool || m_threadPool->getNbThreads()<=1 || count<ParallelMinPointCount)
+			{
+				return 1;
+			}
+			// A few chunks per thread, so a slow thread does not hold the others
+			return 4*m_threadPool->getNbThreads();
+		}
+
+		template <typename T>
+		void QuickHull<T>::forEachChunk(size_t nbChunks, size_t count, const std::function<void(size_t,size_t,size_t)>& f)
+		{
+			if (nbChunks == 1)
+			{
+				f(0,0,count);
+				return;
+			}
+			m_threadPool->parallelFor((uint)nbChunks, [&](uint chunk, uint)
+			{
+				f(chunk, count*chunk/nbChunks, count*(chunk+1)/nbChunks);
+			});
+		}
+
+		template <typename T>
+		template <typename DistanceFunction>
+		void QuickHull<T>::findMostDistantPoint(const DistanceFunction& distance, T& maxD, size_t& maxI)
+		{
+			const size_t vCount = m_vertexData.size();
+			const size_t nbChunks = getNbChunks(vCount);
+			std::vector<T> chunkMaxD(nbChunks,maxD);
+			std::vector<size_t> chunkMaxI(nbChunks,maxI);
+			forEachChunk(nbChunks, vCount, [&](size_t chunk, size_t begin, size_t end)
+			{
+				for (size_t i=begin;i<end;i++)
+				{
+					const T d = distance(m_vertexData[i]);
+					if (d > chunkMaxD[chunk])
+					{
+						chunkMaxD[chunk]=d;
+						chunkMaxI[chunk]=i;
+					}
+				}
+			});
+			for (size_t c=0;c<nbChunks;c++)
+			{
+				if (chunkMaxD[c] > maxD)
+				{
+					maxD=chunkMaxD[c];
+					maxI=chunkMaxI[c];
+				}
+			}
+		}
+
 		template<typename T>
 		bool QuickHull<T>::reorderHorizonEdges(std::vector<IndexType>& horizonEdges)
 		{
@@ -484,15 +571,7 @@ namespace real_physics
 			maxD = m_epsilonSquared;
 			size_t maxI=std::numeric_limits<size_t>::max();
 			const size_t vCount = m_vertexData.size();
-			for (size_t i=0;i<vCount;i++)
-			{
-				const T distToRay = mathutils::getSquaredDistanceBetweenPointAndRay(m_vertexData[i],r);
-				if (distToRay > maxD)
-				{
-					maxD=distToRay;
-					maxI=i;
-				}
-			}
+			findMostDistantPoint([&r](const vec3& v) { return mathutils::getSquaredDistanceBetweenPointAndRay(v,r); }, maxD, maxI);
 			if (maxD == m_epsilonSquared)
 			{
 				// It appears that the point cloud belongs to a 1 dimensional subspace of R^3: convex hull has no volume => return a thin triangle
@@ -519,15 +598,7 @@ namespace real_physics
 			maxI=0;
 			const Vector3<T> N = mathutils::getTriangleNormal(baseTriangleVertices[0],baseTriangleVertices[1],baseTriangleVertices[2]);
 			Plane<T> trianglePlane(N,baseTriangleVertices[0]);
-			for (size_t i=0;i<vCount;i++)
-			{
-                const T d = Abs(scalar(mathutils::getSignedDistanceToPlane(m_vertexData[i],trianglePlane)));
-				if (d>maxD)
-				{
-					maxD=d;
-					maxI=i;
-				}
-			}
+			findMostDistantPoint([&trianglePlane](const vec3& v) { return T(Abs(scalar(mathutils::getSignedDistanceToPlane(v,trianglePlane)))); }, maxD, maxI);
 			if (maxD == m_epsilon)
 			{
 				// All the points seem to lie on a 2D subspace of R^3. How to handle this? Well, let's add one extra point to the point cloud so that the convex hull will have volume.
@@ -562,13 +633,73 @@ namespace real_physics
 			}
 
 			// Finally we assign a face for each vertex outside the tetrahedron (vertices inside the tetrahedron have no role anymore)
-			for (size_t i=0;i<vCount;i++)
+			const size_t nbChunks = getNbChunks(vCount);
+			if (nbChunks == 1)
 			{
-				for (auto& face : mesh.m_faces)
+				for (size_t i=0;i<vCount;i++)
 				{
-					if (addPointToFace(face, i))
+					for (auto& face : mesh.m_faces)
 					{
-						break;
+						if (addPointToFace(face, i))
+						{
+							break;
+						}
+					}
+				}
+				return mesh;
+			}
+
+			// Every chunk collects its points of each face, they are appended to the faces in chunk order
+			struct ChunkPoints
+			{
+				std::array<std::vector<IndexType>,4> m_points;
+				std::array<T,4> m_mostDistantPointDist;
+				std::array<IndexType,4> m_mostDistantPoint;
+			};
+			std::vector<ChunkPoints> chunkPoints(nbChunks);
+			forEachChunk(nbChunks, vCount, [&](size_t chunk, size_t begin, size_t end)
+			{
+				ChunkPoints& cp = chunkPoints[chunk];
+				cp.m_mostDistantPointDist.fill(0);
+				cp.m_mostDistantPoint.fill(0);
+				for (size_t i=begin;i<end;i++)
+				{
+					for (size_t f=0;f<4;f++)
+					{
+						const auto& face = mesh.m_faces[f];
+						const T D = mathutils::getSignedDistanceToPlane(m_vertexData[i],face.m_P);
+						if (D>0 && D*D > m_epsilonSquared*face.m_P.m_sqrNLength)
+						{
+							cp.m_points[f].push_back((IndexType)i);
+							if (D > cp.m_mostDistantPointDist[f])
+							{
+								cp.m_mostDistantPointDist[f] = D;
+								cp.m_mostDistantPoint[f] = (IndexType)i;
+							}
+							break;
+						}
+					}
+				}
+			});
+			for (size_t f=0;f<4;f++)
+			{
+				auto& face = mesh.m_faces[f];
+				for (size_t c=0;c<nbChunks;c++)
+				{
+					const ChunkPoints& cp = chunkPoints[c];
+					if (cp.m_points[f].empty())
+					{
+						continue;
+					}
+					if (!face.m_pointsOnPositiveSide)
+					{
+						face.m_pointsOnPositiveSide = std::move(getIndexVectorFromPool());
+					}
+					face.m_pointsOnPositiveSide->insert(face.m_pointsOnPositiveSide->end(),cp.m_points[f].begin(),cp.m_points[f].end());
+					if (cp.m_mostDistantPointDist[f] > face.m_mostDistantPointDist)
+					{
+						face.m_mostDistantPointDist = cp.m_mostDistantPointDist[f];
+						face.m_mostDistantPoint = cp.m_mostDistantPoint[f];
 					}
 				}
 			}
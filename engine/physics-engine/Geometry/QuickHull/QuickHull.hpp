@@ -11,6 +11,7 @@
 #include <vector>
 #include <array>
 #include <limits>
+#include <functional>
 
 #include "engine/physics-engine/Geometry/QuickHull/ConvexHull.hpp"
 #include "engine/physics-engine/Geometry/QuickHull/HalfEdgeMesh.hpp"
@@ -19,6 +20,7 @@
 #include "engine/physics-engine/Geometry/QuickHull/Structs/Plane.hpp"
 #include "engine/physics-engine/Geometry/QuickHull/Structs/Pool.hpp"
 #include "engine/physics-engine/Geometry/QuickHull/Structs/Vector3.hpp"
+#include "engine/physics-engine/Parallel/rpThreadPool.h"
 
 
 
@@ -38,6 +40,10 @@
  *
  * The implementation is thread-safe if each thread is using its own QuickHull object.
  *
+ * With a thread pool (setThreadPool), the passes over the whole point cloud (extreme values, farthest points of the
+ * initial tetrahedron and assignment of the points to its faces) of a large cloud are split in chunks run by the
+ * threads of the pool. The chunks are merged in order, so the hull is the same as with one thread.
+ *
  *
  * SUMMARY OF THE ALGORITHM:
  *         - Create initial simplex (tetrahedron) using extreme points. We have four faces now and they form a convex mesh M.
@@ -82,6 +88,9 @@ namespace real_physics
 
 			static const FloatType Epsilon;
 
+			// Smallest point cloud whose passes are split between the threads of the pool
+			static const size_t ParallelMinPointCount = 16384;
+
 
 		public:
 
@@ -92,6 +101,7 @@ namespace real_physics
 			MeshBuilder<FloatType> m_mesh;
 			std::array<IndexType,6> m_extremeValues;
 			DiagnosticsData m_diagnostics;
+			rpThreadPool* m_threadPool;
 
 			// Temporary variables used during iteration process
 			std::vector<IndexType> m_newFaceIndices;
@@ -107,6 +117,19 @@ namespace real_physics
 			// Find indices of extreme values (max x, min x, max y, min y, max z, min z) for the given point cloud
 			std::array<IndexType,6> getExtremeValues();
 
+			// Find indices of extreme values for the points [begin,end) of the point cloud
+			std::array<IndexType,6> getExtremeValues(size_t begin, size_t end);
+
+			// Number of chunks the passes over a point cloud of this size are split in (one without a thread pool or for a small cloud)
+			size_t getNbChunks(size_t count) const;
+
+			// Call f(chunk, begin, end) for the chunks of [0,count), on the threads of the pool if there are several chunks
+			void forEachChunk(size_t nbChunks, size_t count, const std::function<void(size_t,size_t,size_t)>& f);
+
+			// Find the point with the largest distance above maxD, maxI is left unchanged if there is none. Ties go to the smallest index.
+			template<typename DistanceFunction>
+			void findMostDistantPoint(const DistanceFunction& distance, FloatType& maxD, size_t& maxI);
+
 			// Compute scale of the vertex data.
 			FloatType getScale(const std::array<IndexType,6>& extremeValues);
 
@@ -130,6 +153,14 @@ namespace real_physics
 			// The public getConvexHull functions will setup a VertexDataSource object and call this
 			ConvexHull<FloatType> getConvexHull(const VertexDataSource<FloatType>& pointCloud, bool CCW, bool useOriginalIndices, FloatType eps);
 		public:
+			QuickHull() : m_threadPool(nullptr) { }
+
+			// Run the passes over large point clouds on the threads of the pool (nullptr: on the calling thread only).
+			// The pool must outlive the QuickHull object, or be reset before it is destroyed.
+			void setThreadPool(rpThreadPool* threadPool) {
+				m_threadPool = threadPool;
+			}
+
 			// Computes convex hull for a given point cloud.
 			// Params:
 			//   pointCloud: a vector of of 3D points
@@ -0,0 +1,71 @@
+/*
+ * rpQuickHullBatch.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+// Libraries
+#include "rpQuickHullBatch.h"
+
+namespace real_physics
+{
+
+// Constructor
+/**
+ * @param threadPool The threads cooking the hulls , it must outlive the batch
+ */
+rpQuickHullBatch::rpQuickHullBatch(rpThreadPool& threadPool)
+: mThreadPool(threadPool)
+{
+    for (uint i = 0; i < mThreadPool.getNbThreads(); i++)
+    {
+        mQuickHulls.push_back(new quickhull::QuickHull<scalar>());
+    }
+}
+
+// Destructor
+rpQuickHullBatch::~rpQuickHullBatch()
+{
+    for (size_t i = 0; i < mQuickHulls.size(); i++)
+    {
+        delete mQuickHulls[i];
+    }
+}
+
+// Compute the hulls of the point clouds , in the order of the clouds
+/**
+ * @param pointClouds The point clouds
+ * @param[out] hulls The hull of every point cloud , with its own vertex buffer
+ * @param CCW True for counter-clockwise faces
+ */
+void rpQuickHullBatch::compute(const std::vector< std::vector<Vector3> >& pointClouds,
+                               std::vector< quickhull::ConvexHull<scalar> >& hulls, bool CCW)
+{
+    hulls.clear();
+    hulls.resize(pointClouds.size());
+
+    mThreadPool.parallelFor(uint(pointClouds.size()), [&](uint i, uint slot)
+    {
+        if (pointClouds[i].empty()) return;
+        hulls[i] = mQuickHulls[slot]->getConvexHull(pointClouds[i], CCW, false);
+    });
+}
+
+// Compute the hull of one large point cloud with all the threads
+/// The initial passes over the points (extreme values , initial tetrahedron ,
+/// assignment of the points to its faces) are split between the threads , the
+/// expansion of the hull stays on the calling thread
+quickhull::ConvexHull<scalar> rpQuickHullBatch::compute(const std::vector<Vector3>& pointCloud, bool CCW)
+{
+    if (pointCloud.empty()) return quickhull::ConvexHull<scalar>();
+
+    quickhull::QuickHull<scalar>* quickHull = mQuickHulls[0];
+    quickHull->setThreadPool(&mThreadPool);
+    quickhull::ConvexHull<scalar> hull = quickHull->getConvexHull(pointCloud, CCW, false);
+    quickHull->setThreadPool(NULL);
+
+    return hull;
+}
+
+} /* namespace real_physics */
@@ -0,0 +1,70 @@
+/*
+ * rpQuickHullBatch.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SOURCE_ENGIE_GEOMETRY_RPQUICKHULLBATCH_H_
+#define SOURCE_ENGIE_GEOMETRY_RPQUICKHULLBATCH_H_
+
+// Libraries
+#include <vector>
+
+#include "../../LinearMaths/mathematics.h"
+#include "../../Parallel/rpThreadPool.h"
+#include "QuickHull.hpp"
+
+namespace real_physics
+{
+
+// Class rpQuickHullBatch
+/**
+ * This class cooks the convex hulls of many point clouds at once on the
+ * threads of a pool , every thread with its own QuickHull object , instead of
+ * one hull after the other while the scene is built. A single large point
+ * cloud is cooked by one QuickHull whose passes over the points are split
+ * between the threads.
+ */
+class rpQuickHullBatch
+{
+
+    private :
+
+        // -------------------- Attributes -------------------- //
+
+        /// Threads cooking the hulls
+        rpThreadPool& mThreadPool;
+
+        /// QuickHull object of every thread of the pool
+        std::vector< quickhull::QuickHull<scalar>* > mQuickHulls;
+
+        // -------------------- Methods -------------------- //
+
+        /// Private copy-constructor
+        rpQuickHullBatch(const rpQuickHullBatch& batch);
+
+        /// Private assignment operator
+        rpQuickHullBatch& operator=(const rpQuickHullBatch& batch);
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        explicit rpQuickHullBatch(rpThreadPool& threadPool);
+
+        /// Destructor
+        ~rpQuickHullBatch();
+
+        /// Compute the hulls of the point clouds , in the order of the clouds
+        void compute(const std::vector< std::vector<Vector3> >& pointClouds,
+                     std::vector< quickhull::ConvexHull<scalar> >& hulls, bool CCW = true);
+
+        /// Compute the hull of one large point cloud with all the threads
+        quickhull::ConvexHull<scalar> compute(const std::vector<Vector3>& pointCloud, bool CCW = true);
+};
+
+} /* namespace real_physics */
+
+#endif /* SOURCE_ENGIE_GEOMETRY_RPQUICKHULLBATCH_H_ */
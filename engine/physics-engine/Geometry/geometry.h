@@ -12,7 +12,11 @@
 
 #include "../Geometry/QuickHull/ConvexHull.hpp"
 #include "../Geometry/QuickHull/QuickHull.hpp"
+#include "../Geometry/QuickHull/rpQuickHullBatch.h"
 #include "../Geometry/QuickClipping/rpQuickClippingPolygons.h"
+#include "../Geometry/HullSimplification/rpConvexHullSimplifier.h"
+#include "../Geometry/ConvexDecomposition/rpConvexDecomposition.h"
+#include "../Geometry/rpVertexHash.h"
 
 namespace  real_physics
 {
@@ -0,0 +1,48 @@
+/*
+ * rpVertexHash.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SOURCE_ENGIE_GEOMETRY_RPVERTEXHASH_H_
+#define SOURCE_ENGIE_GEOMETRY_RPVERTEXHASH_H_
+
+#include <cstddef>
+
+#include "../LinearMaths/mathematics.h"
+
+namespace real_physics
+{
+
+/// Start value of the FNV-1a hash
+const uint64 VERTEX_HASH_OFFSET_BASIS = 14695981039346656037ULL;
+
+/// Multiplier of the FNV-1a hash
+const uint64 VERTEX_HASH_PRIME = 1099511628211ULL;
+
+
+/// Continue the FNV-1a hash with the bytes of the data
+SIMD_INLINE void rpHashBytes(uint64& hash, const void* data, size_t size)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= VERTEX_HASH_PRIME;
+    }
+}
+
+/// Continue the FNV-1a hash with the bytes of the coordinates of the vertices
+SIMD_INLINE void rpHashVertices(uint64& hash, const Vector3* vertices, uint nbVertices)
+{
+    for (uint i = 0; i < nbVertices; i++)
+    {
+        const scalar coordinates[3] = { vertices[i].x , vertices[i].y , vertices[i].z };
+        rpHashBytes(hash, coordinates, sizeof(coordinates));
+    }
+}
+
+} /* namespace real_physics */
+
+#endif /* SOURCE_ENGIE_GEOMETRY_RPVERTEXHASH_H_ */
@@ -31,13 +31,16 @@ template<class T> class rpLorentzContraction
 	            T  mLorentzFactor;
 	rpMatrix3x3<T> mLorentzLengthTransform;
 
+	/// True if the boost is the identity (the body is at rest or moves as in Newtonian mechanics)
+	bool           mIsIdentityBoost;
 
 
   public:
 
 	rpLorentzContraction()
     :mLorentzLengthTransform(rpMatrix3x3<T>::identity()) ,
-     mLorentzFactor(1.0)
+     mLorentzFactor(1.0),
+     mIsIdentityBoost(true)
 	{
 
 	}
@@ -78,10 +81,28 @@ template<class T> class rpLorentzContraction
 		/// Push
 		mLorentzFactor          =                inversLoretzFactor;
 		mLorentzLengthTransform = rpMatrix3x3<T>(inversBoostMatrix);
+		mIsIdentityBoost        = (gamma == T(0.0));
 
 	}
 
 
+	/// Reset the boost to the identity without computing the Lorentz factor
+	void setIdentityBoost()
+	{
+		if (mIsIdentityBoost) return;
+
+		mLorentzFactor          = T(1.0);
+		mLorentzLengthTransform = rpMatrix3x3<T>::identity();
+		mIsIdentityBoost        = true;
+	}
+
+
+	bool isIdentityBoost() const
+	{
+		return mIsIdentityBoost;
+	}
+
+
 	T getLorentzFactor() const
 	{
 		return mLorentzFactor;
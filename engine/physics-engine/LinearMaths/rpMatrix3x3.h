@@ -12,6 +12,7 @@
 // Libraries
 #include <cassert>
 #include "rpVector3D.h"
+#include "rpSimd.h"
 #include "../config.h"
 
 
@@ -189,6 +190,9 @@ template<class T> class rpMatrix3x3
       /// Return the 3x3 zero matrix
       static rpMatrix3x3<T> zero();
 
+      /// Return the product of two matrices (4-lane rows for float)
+      static rpMatrix3x3<T> multiply(const rpMatrix3x3<T>& matrix1, const rpMatrix3x3<T>& matrix2);
+
 
 
       /// Return a skew-symmetric matrix using a given vector that can be used
@@ -255,28 +259,7 @@ template<class T> class rpMatrix3x3
       /// Overloaded operator for matrix multiplication
       friend rpMatrix3x3<T>  operator * (const rpMatrix3x3<T>& matrix1, const rpMatrix3x3<T>& matrix2)
       {
-
-    	  rpMatrix3x3<T> result;
-    	  result.setAllValues(    matrix1.mRows[0][0]*  matrix2.mRows[0][0] + matrix1.mRows[0][1] *
-								  matrix2.mRows[1][0] + matrix1.mRows[0][2]*  matrix2.mRows[2][0],
-								  matrix1.mRows[0][0]*  matrix2.mRows[0][1] + matrix1.mRows[0][1] *
-								  matrix2.mRows[1][1] + matrix1.mRows[0][2]*  matrix2.mRows[2][1],
-								  matrix1.mRows[0][0]*  matrix2.mRows[0][2] + matrix1.mRows[0][1] *
-								  matrix2.mRows[1][2] + matrix1.mRows[0][2]*  matrix2.mRows[2][2],
-								  matrix1.mRows[1][0]*  matrix2.mRows[0][0] + matrix1.mRows[1][1] *
-								  matrix2.mRows[1][0] + matrix1.mRows[1][2]*  matrix2.mRows[2][0],
-								  matrix1.mRows[1][0]*  matrix2.mRows[0][1] + matrix1.mRows[1][1] *
-								  matrix2.mRows[1][1] + matrix1.mRows[1][2]*  matrix2.mRows[2][1],
-								  matrix1.mRows[1][0]*  matrix2.mRows[0][2] + matrix1.mRows[1][1] *
-								  matrix2.mRows[1][2] + matrix1.mRows[1][2]*  matrix2.mRows[2][2],
-								  matrix1.mRows[2][0]*  matrix2.mRows[0][0] + matrix1.mRows[2][1] *
-								  matrix2.mRows[1][0] + matrix1.mRows[2][2]*  matrix2.mRows[2][0],
-								  matrix1.mRows[2][0]*  matrix2.mRows[0][1] + matrix1.mRows[2][1] *
-								  matrix2.mRows[1][1] + matrix1.mRows[2][2]*  matrix2.mRows[2][1],
-								  matrix1.mRows[2][0]*  matrix2.mRows[0][2] + matrix1.mRows[2][1] *
-								  matrix2.mRows[1][2] + matrix1.mRows[2][2]*  matrix2.mRows[2][2]);
-
-    	  return result;
+    	  return multiply(matrix1, matrix2);
       }
 
 
@@ -438,6 +421,62 @@ SIMD_INLINE rpMatrix3x3<T> real_physics::rpMatrix3x3<T>::zero()
 }
 
 
+template<class T>
+SIMD_INLINE rpMatrix3x3<T> real_physics::rpMatrix3x3<T>::multiply(const rpMatrix3x3<T>& matrix1, const rpMatrix3x3<T>& matrix2)
+{
+  rpMatrix3x3<T> result;
+  result.setAllValues(    matrix1.mRows[0][0]*  matrix2.mRows[0][0] + matrix1.mRows[0][1] *
+								  matrix2.mRows[1][0] + matrix1.mRows[0][2]*  matrix2.mRows[2][0],
+								  matrix1.mRows[0][0]*  matrix2.mRows[0][1] + matrix1.mRows[0][1] *
+								  matrix2.mRows[1][1] + matrix1.mRows[0][2]*  matrix2.mRows[2][1],
+								  matrix1.mRows[0][0]*  matrix2.mRows[0][2] + matrix1.mRows[0][1] *
+								  matrix2.mRows[1][2] + matrix1.mRows[0][2]*  matrix2.mRows[2][2],
+								  matrix1.mRows[1][0]*  matrix2.mRows[0][0] + matrix1.mRows[1][1] *
+								  matrix2.mRows[1][0] + matrix1.mRows[1][2]*  matrix2.mRows[2][0],
+								  matrix1.mRows[1][0]*  matrix2.mRows[0][1] + matrix1.mRows[1][1] *
+								  matrix2.mRows[1][1] + matrix1.mRows[1][2]*  matrix2.mRows[2][1],
+								  matrix1.mRows[1][0]*  matrix2.mRows[0][2] + matrix1.mRows[1][1] *
+								  matrix2.mRows[1][2] + matrix1.mRows[1][2]*  matrix2.mRows[2][2],
+								  matrix1.mRows[2][0]*  matrix2.mRows[0][0] + matrix1.mRows[2][1] *
+								  matrix2.mRows[1][0] + matrix1.mRows[2][2]*  matrix2.mRows[2][0],
+								  matrix1.mRows[2][0]*  matrix2.mRows[0][1] + matrix1.mRows[2][1] *
+								  matrix2.mRows[1][1] + matrix1.mRows[2][2]*  matrix2.mRows[2][1],
+								  matrix1.mRows[2][0]*  matrix2.mRows[0][2] + matrix1.mRows[2][1] *
+								  matrix2.mRows[1][2] + matrix1.mRows[2][2]*  matrix2.mRows[2][2]);
+
+  return result;
+}
+
+
+#if defined(RP_SIMD_ENABLED)
+
+// Each row of the product is a combination of the rows of the second matrix ,
+// the lanes are added in the order of the scalar code so the results are identical
+template<>
+SIMD_INLINE rpMatrix3x3<float> real_physics::rpMatrix3x3<float>::multiply(const rpMatrix3x3<float>& matrix1, const rpMatrix3x3<float>& matrix2)
+{
+  static_assert(sizeof(rpVector3D<float>) == 3 * sizeof(float), "The rows of the matrix must be packed");
+
+  const float* m1 = &matrix1.mRows[0].x;
+  const float* m2 = &matrix2.mRows[0].x;
+
+  // The loads of the first two rows overlap the next row
+  const rpSimdFloat4 row0 = rpSimdLoad4(m2);
+  const rpSimdFloat4 row1 = rpSimdLoad4(m2 + 3);
+  const rpSimdFloat4 row2 = rpSimdLoad3(m2 + 6);
+
+  const rpSimdFloat4 result0 = rpSimdDot3Lanes(rpSimdSplat(m1[0]), row0, rpSimdSplat(m1[1]), row1, rpSimdSplat(m1[2]), row2);
+  const rpSimdFloat4 result1 = rpSimdDot3Lanes(rpSimdSplat(m1[3]), row0, rpSimdSplat(m1[4]), row1, rpSimdSplat(m1[5]), row2);
+  const rpSimdFloat4 result2 = rpSimdDot3Lanes(rpSimdSplat(m1[6]), row0, rpSimdSplat(m1[7]), row1, rpSimdSplat(m1[8]), row2);
+
+  rpMatrix3x3<float> result;
+  rpSimdStore3x3(&result.mRows[0].x, result0, result1, result2);
+  return result;
+}
+
+#endif
+
+
 // Return a skew-symmetric matrix using a given vector that can be used
 // to compute cross product with another vector using matrix multiplication
 template<class T>
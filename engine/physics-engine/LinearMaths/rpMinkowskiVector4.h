@@ -11,6 +11,7 @@
 #include "../config.h"
 #include "rpLinearMtah.h"
 #include "rpVector3D.h"
+#include "rpSimd.h"
 
 
 #include <iostream>
@@ -174,18 +175,12 @@ template<class T> class  rpMinkowskiVector4
 
 	friend rpMinkowskiVector4<T> operator + (const rpMinkowskiVector4<T>& vector1, const rpMinkowskiVector4<T>& vector2)
 	{
-		return rpMinkowskiVector4<T>(vector1.t + vector2.t,
-				                     vector1.x + vector2.x,
-				                     vector1.y + vector2.y,
-				                     vector1.z + vector2.z);
+		return add(vector1, vector2);
 	}
 
 	friend rpMinkowskiVector4<T> operator - (const rpMinkowskiVector4<T>& vector1, const rpMinkowskiVector4<T>& vector2)
 	{
-		return rpMinkowskiVector4<T>(vector1.t - vector2.t,
-				                     vector1.x - vector2.x,
-				                     vector1.y - vector2.y,
-				                     vector1.z - vector2.z);
+		return subtract(vector1, vector2);
 	}
 
 	friend rpMinkowskiVector4<T> operator -(const rpMinkowskiVector4<T>& vector)
@@ -195,10 +190,7 @@ template<class T> class  rpMinkowskiVector4
 
 	friend rpMinkowskiVector4<T> operator*(const rpMinkowskiVector4<T>& vector, T number)
 	{
-		return rpMinkowskiVector4<T>(number * vector.t,
-				                     number * vector.x,
-				                     number * vector.y,
-				                     number * vector.z);
+		return multiply(rpMinkowskiVector4<T>(number, number, number, number), vector);
 	}
 
 	friend rpMinkowskiVector4<T> operator*(T number, const rpMinkowskiVector4<T>& vector)
@@ -208,19 +200,13 @@ template<class T> class  rpMinkowskiVector4
 
 	friend rpMinkowskiVector4<T> operator*(const rpMinkowskiVector4<T>& vector1, const rpMinkowskiVector4<T>& vector2)
 	{
-		return rpMinkowskiVector4<T>(vector1.t * vector2.t,
-				                     vector1.x * vector2.x,
-				                     vector1.y * vector2.y,
-				                     vector1.z * vector2.z);
+		return multiply(vector1, vector2);
 	}
 
 	friend rpMinkowskiVector4<T> operator/(const rpMinkowskiVector4<T>& vector, T number)
 	{
 		assert(number > MACHINE_EPSILON);
-		return rpMinkowskiVector4<T>(vector.t / number,
-				                     vector.x / number,
-				                     vector.y / number,
-				                     vector.z / number);
+		return divide(vector, rpMinkowskiVector4<T>(number, number, number, number));
 	}
 
 	friend rpMinkowskiVector4<T> operator/(const rpMinkowskiVector4<T>& vector1, const rpMinkowskiVector4<T>& vector2)
@@ -228,16 +214,98 @@ template<class T> class  rpMinkowskiVector4
 		assert(vector2.x > MACHINE_EPSILON);
 		assert(vector2.y > MACHINE_EPSILON);
 		assert(vector2.z > MACHINE_EPSILON);
-		return rpMinkowskiVector4<T>(vector1.t / vector2.t,
-				                     vector1.x / vector2.x,
-				                     vector1.y / vector2.y,
-				                     vector1.z / vector2.z);
+		return divide(vector1, vector2);
 	}
 
+
+	// -------------------- Lanes operations -------------------- //
+
+	/// Component-wise operations , one register for float
+	static rpMinkowskiVector4<T> add(const rpMinkowskiVector4<T>& vector1, const rpMinkowskiVector4<T>& vector2);
+	static rpMinkowskiVector4<T> subtract(const rpMinkowskiVector4<T>& vector1, const rpMinkowskiVector4<T>& vector2);
+	static rpMinkowskiVector4<T> multiply(const rpMinkowskiVector4<T>& vector1, const rpMinkowskiVector4<T>& vector2);
+	static rpMinkowskiVector4<T> divide(const rpMinkowskiVector4<T>& vector1, const rpMinkowskiVector4<T>& vector2);
+
 };
 
 
 
+template<class T>
+SIMD_INLINE rpMinkowskiVector4<T> rpMinkowskiVector4<T>::add(const rpMinkowskiVector4<T>& vector1, const rpMinkowskiVector4<T>& vector2)
+{
+	return rpMinkowskiVector4<T>(vector1.t + vector2.t,
+			                     vector1.x + vector2.x,
+			                     vector1.y + vector2.y,
+			                     vector1.z + vector2.z);
+}
+
+template<class T>
+SIMD_INLINE rpMinkowskiVector4<T> rpMinkowskiVector4<T>::subtract(const rpMinkowskiVector4<T>& vector1, const rpMinkowskiVector4<T>& vector2)
+{
+	return rpMinkowskiVector4<T>(vector1.t - vector2.t,
+			                     vector1.x - vector2.x,
+			                     vector1.y - vector2.y,
+			                     vector1.z - vector2.z);
+}
+
+template<class T>
+SIMD_INLINE rpMinkowskiVector4<T> rpMinkowskiVector4<T>::multiply(const rpMinkowskiVector4<T>& vector1, const rpMinkowskiVector4<T>& vector2)
+{
+	return rpMinkowskiVector4<T>(vector1.t * vector2.t,
+			                     vector1.x * vector2.x,
+			                     vector1.y * vector2.y,
+			                     vector1.z * vector2.z);
+}
+
+template<class T>
+SIMD_INLINE rpMinkowskiVector4<T> rpMinkowskiVector4<T>::divide(const rpMinkowskiVector4<T>& vector1, const rpMinkowskiVector4<T>& vector2)
+{
+	return rpMinkowskiVector4<T>(vector1.t / vector2.t,
+			                     vector1.x / vector2.x,
+			                     vector1.y / vector2.y,
+			                     vector1.z / vector2.z);
+}
+
+
+#if defined(RP_SIMD_ENABLED)
+
+// The components t , x , y , z follow each other and fill one register
+template<>
+SIMD_INLINE rpMinkowskiVector4<float> rpMinkowskiVector4<float>::add(const rpMinkowskiVector4<float>& vector1, const rpMinkowskiVector4<float>& vector2)
+{
+	rpMinkowskiVector4<float> result;
+	rpSimdStore4(&result.t, rpSimdAdd(rpSimdLoad4(&vector1.t), rpSimdLoad4(&vector2.t)));
+	return result;
+}
+
+template<>
+SIMD_INLINE rpMinkowskiVector4<float> rpMinkowskiVector4<float>::subtract(const rpMinkowskiVector4<float>& vector1, const rpMinkowskiVector4<float>& vector2)
+{
+	rpMinkowskiVector4<float> result;
+	rpSimdStore4(&result.t, rpSimdSub(rpSimdLoad4(&vector1.t), rpSimdLoad4(&vector2.t)));
+	return result;
+}
+
+template<>
+SIMD_INLINE rpMinkowskiVector4<float> rpMinkowskiVector4<float>::multiply(const rpMinkowskiVector4<float>& vector1, const rpMinkowskiVector4<float>& vector2)
+{
+	rpMinkowskiVector4<float> result;
+	rpSimdStore4(&result.t, rpSimdMul(rpSimdLoad4(&vector1.t), rpSimdLoad4(&vector2.t)));
+	return result;
+}
+
+template<>
+SIMD_INLINE rpMinkowskiVector4<float> rpMinkowskiVector4<float>::divide(const rpMinkowskiVector4<float>& vector1, const rpMinkowskiVector4<float>& vector2)
+{
+	rpMinkowskiVector4<float> result;
+	rpSimdStore4(&result.t, rpSimdDiv(rpSimdLoad4(&vector1.t), rpSimdLoad4(&vector2.t)));
+	return result;
+}
+
+#endif
+
+
+
 } /* namespace real_physics */
 
 
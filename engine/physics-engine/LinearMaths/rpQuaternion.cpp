@@ -124,47 +124,6 @@ SIMD_INLINE void real_physics::rpQuaternion<T>::getRotationAngleAxis(T& angle, r
 
 
 
-template<class T>
-SIMD_INLINE rpQuaternion<T> real_physics::rpQuaternion<T>::slerp( const rpQuaternion<T>& quaternion1,
-		                                                          const rpQuaternion<T>& quaternion2,
-								 T t)
-{
-	assert(t >= 0.0 && t <= 1.0);
-
-	T invert = 1.0;
-
-	// Compute cos(theta) using the quaternion scalar product
-	T cosineTheta = quaternion1.dot(quaternion2);
-
-	// Take care of the sign of cosineTheta
-	if (cosineTheta < 0.0)
-	{
-		cosineTheta = -cosineTheta;
-		invert = -1.0;
-	}
-
-	// Because of precision, if cos(theta) is nearly 1,
-	// therefore theta is nearly 0 and we can write
-	// sin((1-t)*theta) as (1-t) and sin(t*theta) as t
-	const T epsilon = T(0.00001);
-	if(1-cosineTheta < epsilon)
-	{
-		return quaternion1 * (T(1.0)-t) + quaternion2 * (t * invert);
-	}
-
-	// Compute the theta angle
-	T theta = acos(cosineTheta);
-
-	// Compute sin(theta)
-	T sineTheta = sin(theta);
-
-	// Compute the two coefficients that are in the spherical linear interpolation formula
-	T coeff1 = sin((T(1.0)-t)*theta) / sineTheta;
-	T coeff2 = sin(t*theta) / sineTheta * invert;
-
-	// Compute and return the interpolated quaternion
-	return quaternion1 * coeff1 + quaternion2 * coeff2;
-}
 
 
 
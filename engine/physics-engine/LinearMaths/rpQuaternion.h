@@ -13,6 +13,7 @@
 #include <cmath>
 #include "rpVector3D.h"
 #include "rpMatrix3x3.h"
+#include "rpSimd.h"
 
 
 namespace real_physics
@@ -533,6 +534,48 @@ namespace real_physics
     return rpQuaternion<T>(0.0, 0.0, 0.0, 1.0);
   }
 
+  template<class T>
+  SIMD_INLINE rpQuaternion<T> real_physics::rpQuaternion<T>::slerp( const rpQuaternion<T>& quaternion1,
+                                                                    const rpQuaternion<T>& quaternion2,
+                                                                    T t)
+  {
+      assert(t >= 0.0 && t <= 1.0);
+
+      T invert = 1.0;
+
+      // Compute cos(theta) using the quaternion scalar product
+      T cosineTheta = quaternion1.dot(quaternion2);
+
+      // Take care of the sign of cosineTheta
+      if (cosineTheta < 0.0)
+      {
+          cosineTheta = -cosineTheta;
+          invert = -1.0;
+      }
+
+      // Because of precision, if cos(theta) is nearly 1,
+      // therefore theta is nearly 0 and we can write
+      // sin((1-t)*theta) as (1-t) and sin(t*theta) as t
+      const T epsilon = T(0.00001);
+      if(1-cosineTheta < epsilon)
+      {
+          return quaternion1 * (T(1.0)-t) + quaternion2 * (t * invert);
+      }
+
+      // Compute the theta angle
+      T theta = acos(cosineTheta);
+
+      // Compute sin(theta)
+      T sineTheta = sin(theta);
+
+      // Compute the two coefficients that are in the spherical linear interpolation formula
+      T coeff1 = sin((T(1.0)-t)*theta) / sineTheta;
+      T coeff2 = sin(t*theta) / sineTheta * invert;
+
+      // Compute and return the interpolated quaternion
+      return quaternion1 * coeff1 + quaternion2 * coeff2;
+  }
+
   template<class T>
   SIMD_INLINE T real_physics::rpQuaternion<T>::dot(const rpQuaternion<T>& quaternion) const
   {
@@ -605,6 +648,61 @@ namespace real_physics
     return (((*this) * p) * getConjugate()).getVectorV();
   }
 
+
+#if defined(RP_SIMD_ENABLED)
+
+  // Vector part of the product of two quaternions held in registers (x , y , z , w) ,
+  // computed in the order of the scalar code so the results are identical
+  SIMD_INLINE rpSimdFloat4 rpSimdQuaternionVectorProduct(rpSimdFloat4 a, rpSimdFloat4 b)
+  {
+	  const rpSimdFloat4 cross = rpSimdSub(rpSimdMul(rpSimdRotateYZX(a), rpSimdRotateZXY(b)),
+			                               rpSimdMul(rpSimdRotateZXY(a), rpSimdRotateYZX(b)));
+
+	  return rpSimdAdd(rpSimdAdd(rpSimdMul(rpSimdSplatLane<3>(a), b),
+			                     rpSimdMul(rpSimdSplatLane<3>(b), a)), cross);
+  }
+
+  // Product of two quaternions held in registers
+  SIMD_INLINE rpSimdFloat4 rpSimdQuaternionMultiply(rpSimdFloat4 a, rpSimdFloat4 b)
+  {
+	  const rpSimdFloat4 products = rpSimdMul(a, b);
+	  const float realW = rpSimdGetLane<3>(products) - ((rpSimdGetLane<0>(products) +
+			                                             rpSimdGetLane<1>(products)) +
+			                                             rpSimdGetLane<2>(products));
+
+	  return rpSimdSetW(rpSimdQuaternionVectorProduct(a, b), realW);
+  }
+
+  template<>
+  SIMD_INLINE rpQuaternion<float> real_physics::rpQuaternion<float>::operator *(const rpQuaternion<float>& quaternion) const
+  {
+	  static_assert(sizeof(rpQuaternion<float>) == 4 * sizeof(float), "The quaternion must be packed");
+
+	  // The real part is computed from the members , it is cheaper than from the lanes
+	  const float realW = w * quaternion.w - (x * quaternion.x + y * quaternion.y + z * quaternion.z);
+	  const rpSimdFloat4 vectorV = rpSimdQuaternionVectorProduct(rpSimdLoad4(&x), rpSimdLoad4(&quaternion.x));
+
+	  rpQuaternion<float> result;
+	  rpSimdStore4(&result.x, rpSimdSetW(vectorV, realW));
+	  return result;
+  }
+
+  // The rotation q * p * q^-1 stays in the registers between the two products
+  template<>
+  SIMD_INLINE rpVector3D<float> real_physics::rpQuaternion<float>::operator *(const rpVector3D<float>& point) const
+  {
+	  const rpSimdFloat4 q = rpSimdLoad4(&x);
+	  const rpSimdFloat4 p = rpSimdLoad3(&point.x);
+
+	  const rpSimdFloat4 rotated = rpSimdQuaternionMultiply(rpSimdQuaternionMultiply(q, p), rpSimdNegateXYZ(q));
+
+	  rpVector3D<float> result;
+	  rpSimdStore3(&result.x, rotated);
+	  return result;
+  }
+
+#endif
+
   template<class T>
   SIMD_INLINE rpQuaternion<T>& real_physics::rpQuaternion<T>::operator =(const rpQuaternion<T>& quaternion)
   {
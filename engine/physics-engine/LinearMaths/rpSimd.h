@@ -0,0 +1,292 @@
+/*
+ * rpSimd.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SOURCE_ENGIE_LINEARMATHS_RPSIMD_H_
+#define SOURCE_ENGIE_LINEARMATHS_RPSIMD_H_
+
+
+/**********************************************
+ *  Thin wrapper over the 4-lane float intrinsics (SSE2 or NEON).
+ *  The float specialisations of the linear maths use it , the
+ *  other types keep the scalar templates. Define RP_NO_SIMD to
+ *  compile the scalar code only.
+ **********************************************/
+
+#if !defined(RP_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define RP_SIMD_SSE
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define RP_SIMD_NEON
+    #endif
+#endif
+
+
+#if defined(RP_SIMD_SSE)
+    #include <emmintrin.h>
+    #define RP_SIMD_ENABLED
+#elif defined(RP_SIMD_NEON)
+    #include <arm_neon.h>
+    #define RP_SIMD_ENABLED
+#endif
+
+
+#if defined(RP_SIMD_ENABLED)
+
+#include "rpLinearMtah.h"
+
+namespace real_physics
+{
+
+
+#if defined(RP_SIMD_SSE)
+
+    typedef __m128 rpSimdFloat4;
+
+    /// Load four floats (no alignment required)
+    SIMD_INLINE rpSimdFloat4 rpSimdLoad4(const float* p)
+    {
+        return _mm_loadu_ps(p);
+    }
+
+    /// Load three floats , the last lane is zero
+    SIMD_INLINE rpSimdFloat4 rpSimdLoad3(const float* p)
+    {
+        // __m64 may alias the floats , a double pointer would break the strict aliasing
+        return _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(p)), _mm_load_ss(p + 2));
+    }
+
+    /// Store four floats (no alignment required)
+    SIMD_INLINE void rpSimdStore4(float* p, rpSimdFloat4 v)
+    {
+        _mm_storeu_ps(p, v);
+    }
+
+    /// Store the first three lanes
+    SIMD_INLINE void rpSimdStore3(float* p, rpSimdFloat4 v)
+    {
+        _mm_storel_pi(reinterpret_cast<__m64*>(p), v);
+        _mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+    }
+
+    /// Store the first three lanes of three rows as nine packed floats , the stores do not
+    /// overlap so a later copy of the floats is forwarded from them
+    SIMD_INLINE void rpSimdStore3x3(float* p, rpSimdFloat4 a, rpSimdFloat4 b, rpSimdFloat4 c)
+    {
+        // (a2 , a2 , b0 , b0)
+        const rpSimdFloat4 join = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 2, 2));
+        _mm_storeu_ps(p    , _mm_shuffle_ps(a, join, _MM_SHUFFLE(2, 0, 1, 0)));
+        _mm_storeu_ps(p + 4, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 2, 1)));
+        _mm_store_ss(p + 8, _mm_movehl_ps(c, c));
+    }
+
+    SIMD_INLINE rpSimdFloat4 rpSimdSplat(float value)
+    {
+        return _mm_set1_ps(value);
+    }
+
+    SIMD_INLINE rpSimdFloat4 rpSimdAdd(rpSimdFloat4 a, rpSimdFloat4 b) { return _mm_add_ps(a, b); }
+    SIMD_INLINE rpSimdFloat4 rpSimdSub(rpSimdFloat4 a, rpSimdFloat4 b) { return _mm_sub_ps(a, b); }
+    SIMD_INLINE rpSimdFloat4 rpSimdMul(rpSimdFloat4 a, rpSimdFloat4 b) { return _mm_mul_ps(a, b); }
+    SIMD_INLINE rpSimdFloat4 rpSimdDiv(rpSimdFloat4 a, rpSimdFloat4 b) { return _mm_div_ps(a, b); }
+
+    /// Return (x , y , z , w) with the last lane replaced by w
+    SIMD_INLINE rpSimdFloat4 rpSimdSetW(rpSimdFloat4 v, float w)
+    {
+        const __m128 zw = _mm_unpacklo_ps(_mm_movehl_ps(v, v), _mm_set_ss(w));
+        return _mm_shuffle_ps(v, zw, _MM_SHUFFLE(1, 0, 1, 0));
+    }
+
+    /// Return the lane of the register
+    template<int lane> SIMD_INLINE float rpSimdGetLane(rpSimdFloat4 v)
+    {
+        return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(lane, lane, lane, lane)));
+    }
+
+    /// Return the lane of the register copied in the four lanes
+    template<int lane> SIMD_INLINE rpSimdFloat4 rpSimdSplatLane(rpSimdFloat4 v)
+    {
+        return _mm_shuffle_ps(v, v, _MM_SHUFFLE(lane, lane, lane, lane));
+    }
+
+    /// Return (a , b , c , d)
+    SIMD_INLINE rpSimdFloat4 rpSimdSet4(float a, float b, float c, float d)
+    {
+        return _mm_setr_ps(a, b, c, d);
+    }
+
+    SIMD_INLINE rpSimdFloat4 rpSimdMin(rpSimdFloat4 a, rpSimdFloat4 b) { return _mm_min_ps(a, b); }
+    SIMD_INLINE rpSimdFloat4 rpSimdMax(rpSimdFloat4 a, rpSimdFloat4 b) { return _mm_max_ps(a, b); }
+    SIMD_INLINE rpSimdFloat4 rpSimdSqrt(rpSimdFloat4 v) { return _mm_sqrt_ps(v); }
+
+    /// Return by lane (a > b) ? x : y
+    SIMD_INLINE rpSimdFloat4 rpSimdSelectGreater(rpSimdFloat4 a, rpSimdFloat4 b, rpSimdFloat4 x, rpSimdFloat4 y)
+    {
+        const __m128 mask = _mm_cmpgt_ps(a, b);
+        return _mm_or_ps(_mm_and_ps(mask, x), _mm_andnot_ps(mask, y));
+    }
+
+    /// Return (-x , -y , -z , w)
+    SIMD_INLINE rpSimdFloat4 rpSimdNegateXYZ(rpSimdFloat4 v)
+    {
+        return _mm_xor_ps(v, _mm_set_ps(0.0f, -0.0f, -0.0f, -0.0f));
+    }
+
+    /// Return (y , z , x , w)
+    SIMD_INLINE rpSimdFloat4 rpSimdRotateYZX(rpSimdFloat4 v)
+    {
+        return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 0, 2, 1));
+    }
+
+    /// Return (z , x , y , w)
+    SIMD_INLINE rpSimdFloat4 rpSimdRotateZXY(rpSimdFloat4 v)
+    {
+        return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 1, 0, 2));
+    }
+
+#elif defined(RP_SIMD_NEON)
+
+    typedef float32x4_t rpSimdFloat4;
+
+    /// Load four floats (no alignment required)
+    SIMD_INLINE rpSimdFloat4 rpSimdLoad4(const float* p)
+    {
+        return vld1q_f32(p);
+    }
+
+    /// Load three floats , the last lane is zero
+    SIMD_INLINE rpSimdFloat4 rpSimdLoad3(const float* p)
+    {
+        return vcombine_f32(vld1_f32(p), vld1_lane_f32(p + 2, vdup_n_f32(0.0f), 0));
+    }
+
+    /// Store four floats (no alignment required)
+    SIMD_INLINE void rpSimdStore4(float* p, rpSimdFloat4 v)
+    {
+        vst1q_f32(p, v);
+    }
+
+    /// Store the first three lanes
+    SIMD_INLINE void rpSimdStore3(float* p, rpSimdFloat4 v)
+    {
+        vst1_f32(p, vget_low_f32(v));
+        vst1q_lane_f32(p + 2, v, 2);
+    }
+
+    /// Store the first three lanes of three rows as nine packed floats , the stores do not
+    /// overlap so a later copy of the floats is forwarded from them
+    SIMD_INLINE void rpSimdStore3x3(float* p, rpSimdFloat4 a, rpSimdFloat4 b, rpSimdFloat4 c)
+    {
+        vst1q_f32(p    , vsetq_lane_f32(vgetq_lane_f32(b, 0), a, 3));
+        vst1q_f32(p + 4, vcombine_f32(vget_low_f32(vextq_f32(b, b, 1)), vget_low_f32(c)));
+        vst1q_lane_f32(p + 8, c, 2);
+    }
+
+    SIMD_INLINE rpSimdFloat4 rpSimdSplat(float value)
+    {
+        return vdupq_n_f32(value);
+    }
+
+    SIMD_INLINE rpSimdFloat4 rpSimdAdd(rpSimdFloat4 a, rpSimdFloat4 b) { return vaddq_f32(a, b); }
+    SIMD_INLINE rpSimdFloat4 rpSimdSub(rpSimdFloat4 a, rpSimdFloat4 b) { return vsubq_f32(a, b); }
+    SIMD_INLINE rpSimdFloat4 rpSimdMul(rpSimdFloat4 a, rpSimdFloat4 b) { return vmulq_f32(a, b); }
+
+    SIMD_INLINE rpSimdFloat4 rpSimdDiv(rpSimdFloat4 a, rpSimdFloat4 b)
+    {
+    #if defined(__aarch64__)
+        return vdivq_f32(a, b);
+    #else
+        // ARMv7 has no exact vector division
+        float fa[4], fb[4];
+        vst1q_f32(fa, a);
+        vst1q_f32(fb, b);
+        fa[0] /= fb[0]; fa[1] /= fb[1]; fa[2] /= fb[2]; fa[3] /= fb[3];
+        return vld1q_f32(fa);
+    #endif
+    }
+
+    /// Return (x , y , z , w) with the last lane replaced by w
+    SIMD_INLINE rpSimdFloat4 rpSimdSetW(rpSimdFloat4 v, float w)
+    {
+        return vsetq_lane_f32(w, v, 3);
+    }
+
+    /// Return the lane of the register
+    template<int lane> SIMD_INLINE float rpSimdGetLane(rpSimdFloat4 v)
+    {
+        return vgetq_lane_f32(v, lane);
+    }
+
+    /// Return the lane of the register copied in the four lanes
+    template<int lane> SIMD_INLINE rpSimdFloat4 rpSimdSplatLane(rpSimdFloat4 v)
+    {
+        return vdupq_n_f32(vgetq_lane_f32(v, lane));
+    }
+
+    /// Return (a , b , c , d)
+    SIMD_INLINE rpSimdFloat4 rpSimdSet4(float a, float b, float c, float d)
+    {
+        const float f[4] = {a, b, c, d};
+        return vld1q_f32(f);
+    }
+
+    SIMD_INLINE rpSimdFloat4 rpSimdMin(rpSimdFloat4 a, rpSimdFloat4 b) { return vminq_f32(a, b); }
+    SIMD_INLINE rpSimdFloat4 rpSimdMax(rpSimdFloat4 a, rpSimdFloat4 b) { return vmaxq_f32(a, b); }
+
+    SIMD_INLINE rpSimdFloat4 rpSimdSqrt(rpSimdFloat4 v)
+    {
+    #if defined(__aarch64__)
+        return vsqrtq_f32(v);
+    #else
+        // ARMv7 has no exact vector square root
+        float f[4];
+        vst1q_f32(f, v);
+        f[0] = sqrtf(f[0]); f[1] = sqrtf(f[1]); f[2] = sqrtf(f[2]); f[3] = sqrtf(f[3]);
+        return vld1q_f32(f);
+    #endif
+    }
+
+    /// Return by lane (a > b) ? x : y
+    SIMD_INLINE rpSimdFloat4 rpSimdSelectGreater(rpSimdFloat4 a, rpSimdFloat4 b, rpSimdFloat4 x, rpSimdFloat4 y)
+    {
+        return vbslq_f32(vcgtq_f32(a, b), x, y);
+    }
+
+    /// Return (-x , -y , -z , w)
+    SIMD_INLINE rpSimdFloat4 rpSimdNegateXYZ(rpSimdFloat4 v)
+    {
+        return vsetq_lane_f32(vgetq_lane_f32(v, 3), vnegq_f32(v), 3);
+    }
+
+    /// Return (y , z , x , w) , the last lane is not kept
+    SIMD_INLINE rpSimdFloat4 rpSimdRotateYZX(rpSimdFloat4 v)
+    {
+        return vsetq_lane_f32(vgetq_lane_f32(v, 0), vextq_f32(v, v, 1), 2);
+    }
+
+    /// Return (z , x , y , w) , the last lane is not kept
+    SIMD_INLINE rpSimdFloat4 rpSimdRotateZXY(rpSimdFloat4 v)
+    {
+        return vsetq_lane_f32(vgetq_lane_f32(v, 2), vextq_f32(v, v, 3), 0);
+    }
+
+#endif
+
+
+    /// Return a*b + c*d + e*f , added from left to right as the scalar code does
+    SIMD_INLINE rpSimdFloat4 rpSimdDot3Lanes(rpSimdFloat4 a, rpSimdFloat4 b,
+                                             rpSimdFloat4 c, rpSimdFloat4 d,
+                                             rpSimdFloat4 e, rpSimdFloat4 f)
+    {
+        return rpSimdAdd(rpSimdAdd(rpSimdMul(a, b), rpSimdMul(c, d)), rpSimdMul(e, f));
+    }
+
+
+} /* namespace real_physics */
+
+#endif /* RP_SIMD_ENABLED */
+
+#endif /* SOURCE_ENGIE_LINEARMATHS_RPSIMD_H_ */
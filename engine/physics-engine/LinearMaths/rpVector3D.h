@@ -58,7 +58,7 @@ namespace real_physics
     }
 
     // Destructor
-    virtual ~rpVector3D();
+    ~rpVector3D();
 
 
 
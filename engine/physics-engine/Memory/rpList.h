@@ -34,6 +34,8 @@ class  rpListElement
     rpListElement *getNext() const { return m_next; }
     rpListElement *getPrev() const { return m_prev; }
 
+    void setNext(rpListElement *next) { m_next = next; }
+
 
     bool isHead() const { return m_prev == 0; }
     bool isTail() const { return m_next == 0; }
@@ -0,0 +1,13 @@
+/*
+ * parallel.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SRC_PHYSICS_ENGINE_PARALLEL_PARALLEL_H_
+#define SRC_PHYSICS_ENGINE_PARALLEL_PARALLEL_H_
+
+#include "rpThreadPool.h"
+
+#endif /* SRC_PHYSICS_ENGINE_PARALLEL_PARALLEL_H_ */
@@ -0,0 +1,106 @@
+/*
+ * rpThreadPool.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+// Libraries
+#include "rpThreadPool.h"
+
+#include <atomic>
+
+namespace real_physics
+{
+
+// Constructor
+/**
+ * @param nbThreads Number of threads running the loops , the calling thread
+ *                  included (zero : one per core)
+ */
+rpThreadPool::rpThreadPool(uint nbThreads)
+: mNbFinishedTasks(0),
+  mIsStopped(false)
+{
+    if (nbThreads == 0) nbThreads = Max(uint(std::thread::hardware_concurrency()), uint(1));
+
+    mThreads.reserve(nbThreads - 1);
+    for (uint i = 1; i < nbThreads; i++)
+    {
+        mThreads.push_back(std::thread(&rpThreadPool::runWorker, this));
+    }
+}
+
+// Destructor
+rpThreadPool::~rpThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mIsStopped = true;
+    }
+    mTaskCondition.notify_all();
+
+    for (size_t i = 0; i < mThreads.size(); i++) mThreads[i].join();
+}
+
+// Run the tasks until the pool is stopped
+void rpThreadPool::runWorker()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mTaskCondition.wait(lock, [this]() { return mIsStopped || !mTasks.empty(); });
+            if (mTasks.empty()) return;
+
+            task = mTasks.front();
+            mTasks.pop_front();
+        }
+
+        task();
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mNbFinishedTasks++;
+        }
+        mFinishedCondition.notify_all();
+    }
+}
+
+// Call function(item , slot) for every item
+/// The items are taken one by one from a shared counter , so a thread done
+/// with a cheap item takes the next one (the costs of the hulls of a batch
+/// are very different)
+void rpThreadPool::parallelFor(uint nbItems, const std::function<void(uint, uint)>& function)
+{
+    const uint nbSlots = Min(getNbThreads(), nbItems);
+    if (nbSlots <= 1)
+    {
+        for (uint i = 0; i < nbItems; i++) function(i, 0);
+        return;
+    }
+
+    std::atomic<uint> nextItem(0);
+    const auto runSlot = [&nextItem, nbItems, &function](uint slot)
+    {
+        for (uint i = nextItem++; i < nbItems; i = nextItem++) function(i, slot);
+    };
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mNbFinishedTasks = 0;
+        for (uint slot = 1; slot < nbSlots; slot++)
+        {
+            mTasks.push_back([&runSlot, slot]() { runSlot(slot); });
+        }
+    }
+    mTaskCondition.notify_all();
+
+    runSlot(0);
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mFinishedCondition.wait(lock, [this, nbSlots]() { return mNbFinishedTasks == nbSlots - 1; });
+}
+
+} /* namespace real_physics */
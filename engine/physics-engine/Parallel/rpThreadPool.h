@@ -0,0 +1,98 @@
+/*
+ * rpThreadPool.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SRC_PHYSICS_ENGINE_PARALLEL_RPTHREADPOOL_H_
+#define SRC_PHYSICS_ENGINE_PARALLEL_RPTHREADPOOL_H_
+
+// Libraries
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../LinearMaths/mathematics.h"
+
+namespace real_physics
+{
+
+// Class rpThreadPool
+/**
+ * This class keeps worker threads alive between the parallel loops of the
+ * geometry passes (hull cooking , convex decomposition) , so that a loop does
+ * not pay the creation of its threads. The thread calling parallelFor works
+ * too : a pool of N threads has N - 1 workers , a pool of one thread runs the
+ * loops on the calling thread only. The loops must be started from one thread
+ * at a time and never from inside a loop.
+ */
+class rpThreadPool
+{
+
+    private :
+
+        // -------------------- Attributes -------------------- //
+
+        /// Worker threads
+        std::vector<std::thread> mThreads;
+
+        /// Tasks waiting for a worker
+        std::deque< std::function<void()> > mTasks;
+
+        /// Mutex of the tasks and of the finished counter
+        std::mutex mMutex;
+
+        /// Signaled when a task is added or the pool is stopped
+        std::condition_variable mTaskCondition;
+
+        /// Signaled when a task is finished
+        std::condition_variable mFinishedCondition;
+
+        /// Number of finished tasks of the current loop
+        uint mNbFinishedTasks;
+
+        /// True when the workers must exit
+        bool mIsStopped;
+
+        // -------------------- Methods -------------------- //
+
+        /// Private copy-constructor
+        rpThreadPool(const rpThreadPool& pool);
+
+        /// Private assignment operator
+        rpThreadPool& operator=(const rpThreadPool& pool);
+
+        /// Run the tasks until the pool is stopped
+        void runWorker();
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor (zero threads : one per core)
+        explicit rpThreadPool(uint nbThreads = 0);
+
+        /// Destructor
+        ~rpThreadPool();
+
+        /// Return the number of threads running the loops , the calling thread included
+        uint getNbThreads() const;
+
+        /// Call function(item , slot) for every item , the slot (smaller than
+        /// getNbThreads()) is the same for all the items run by one thread
+        void parallelFor(uint nbItems, const std::function<void(uint, uint)>& function);
+};
+
+// Return the number of threads running the loops , the calling thread included
+SIMD_INLINE uint rpThreadPool::getNbThreads() const
+{
+    return uint(mThreads.size()) + 1;
+}
+
+} /* namespace real_physics */
+
+#endif /* SRC_PHYSICS_ENGINE_PARALLEL_RPTHREADPOOL_H_ */
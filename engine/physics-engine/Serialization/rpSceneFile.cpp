@@ -0,0 +1,472 @@
+/*
+ * rpSceneFile.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#include "rpSceneFile.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(LINUX_OS) || defined(APPLE_OS)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "../Dynamics/rpDynamicsWorld.h"
+#include "../Collision/Shapes/rpCapsuleShape.h"
+#include "../Collision/Shapes/rpCylinderShape.h"
+#include "../Collision/Shapes/rpConeShape.h"
+#include "../Collision/Shapes/rpConcaveMeshShape.h"
+#include "../Dynamics/Joint/rpBallAndSocketJoint.h"
+#include "../Dynamics/Joint/rpDistanceJoint.h"
+#include "../Dynamics/Joint/rpFixedJoint.h"
+#include "../Dynamics/Joint/rpHingeJoint.h"
+#include "../Dynamics/Joint/rpSliderJoint.h"
+#include "rpSceneWriter.h"
+
+namespace real_physics
+{
+
+namespace
+{
+
+    SIMD_INLINE Vector3 sceneVector3( const scalar* v )
+    {
+        return Vector3( v[0] , v[1] , v[2] );
+    }
+
+    SIMD_INLINE Transform sceneTransform( const scalar* position , const scalar* orientation )
+    {
+        return Transform( sceneVector3(position) ,
+                          Quaternion( orientation[0] , orientation[1] , orientation[2] , orientation[3] ));
+    }
+
+    /// Check a section [offset , offset + count * size) of the file
+    SIMD_INLINE bool isSectionInside( uint64 offset , uint64 count , uint64 size , uint64 fileSize )
+    {
+        if( count == 0 ) return true;
+        if( offset % sizeof(uint32) != 0 ) return false;
+        return offset <= fileSize && count <= (fileSize - offset) / size;
+    }
+
+    /// Check that a pointer of the file was fixed up by the relocation table (its
+    /// position is listed in the sorted table) and points to an aligned address of the file
+    template<class T> bool isRelocated( const rpScenePointer<T>& pointer , const char* data , uint64 size ,
+                                        const std::vector<uint64>& positions )
+    {
+        const uint64 position = uint64( reinterpret_cast<const char*>(&pointer) - data );
+        if( !std::binary_search( positions.begin() , positions.end() , position ) ) return false;
+        if( pointer.pointer == NULL ) return true;
+
+        const uint64 offset = uint64( reinterpret_cast<const char*>(pointer.pointer) - data );
+        return offset <= size && offset % alignof(T) == 0;
+    }
+
+    /// Check a relocated array of records , it has its records if it is not empty
+    template<class T> bool isRelocated( const rpSceneArray<T>& array , const char* data , uint64 size ,
+                                        const std::vector<uint64>& positions )
+    {
+        return isRelocated( array.data , data , size , positions ) && (array.count == 0 || array.data.pointer != NULL);
+    }
+}
+
+
+rpSceneFile::rpSceneFile()
+: mData(NULL) , mSize(0) , mIsMapped(false) , mHeader(NULL)
+{
+
+}
+
+
+rpSceneFile::~rpSceneFile()
+{
+    close();
+}
+
+
+
+bool rpSceneFile::open(const char* fileName)
+{
+    close();
+
+#if defined(LINUX_OS) || defined(APPLE_OS)
+
+    int fd = ::open( fileName , O_RDONLY );
+    if( fd < 0 ) return false;
+
+    struct stat info;
+    if( fstat( fd , &info ) != 0 || size_t(info.st_size) < sizeof(rpSceneHeader) )
+    {
+        ::close(fd);
+        return false;
+    }
+
+    mSize = size_t(info.st_size);
+
+    /// Private writable mapping : the pointer fix-up is copy-on-write and only
+    /// touches the pages of the records , the bulk data stays shared
+    void* data = mmap( NULL , mSize , PROT_READ | PROT_WRITE , MAP_PRIVATE , fd , 0 );
+    ::close(fd);
+
+    if( data == MAP_FAILED )
+    {
+        mSize = 0;
+        return false;
+    }
+
+    mData = static_cast<char*>(data);
+    mIsMapped = true;
+
+#else
+
+    /// No mmap on this platform : read the whole file into a single block
+    FILE* file = fopen( fileName , "rb" );
+    if( file == NULL ) return false;
+
+    fseek( file , 0 , SEEK_END );
+    long size = ftell( file );
+    fseek( file , 0 , SEEK_SET );
+
+    if( size < long(sizeof(rpSceneHeader)) )
+    {
+        fclose(file);
+        return false;
+    }
+
+    mSize = size_t(size);
+    mData = static_cast<char*>(malloc(mSize));
+    if( mData == NULL || fread( mData , 1 , mSize , file ) != mSize )
+    {
+        fclose(file);
+        close();
+        return false;
+    }
+    fclose(file);
+    mIsMapped = false;
+
+#endif
+
+    mHeader = reinterpret_cast<rpSceneHeader*>(mData);
+
+    if( !validate() || !relocate() )
+    {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+
+void rpSceneFile::close()
+{
+    if( mData != NULL )
+    {
+#if defined(LINUX_OS) || defined(APPLE_OS)
+        if( mIsMapped ) munmap( mData , mSize );
+        else free( mData );
+#else
+        free( mData );
+#endif
+    }
+
+    mData     = NULL;
+    mSize     = 0;
+    mIsMapped = false;
+    mHeader   = NULL;
+}
+
+
+
+bool rpSceneFile::validate() const
+{
+    const rpSceneHeader& header = *mHeader;
+
+    if( header.magic != SCENE_FILE_MAGIC ) return false;
+    if( header.versionMajor != SCENE_FILE_VERSION_MAJOR ) return false;
+    if( header.scalarSize != sizeof(scalar) ) return false;
+    if( header.headerSize < sizeof(rpSceneHeader) ) return false;
+    if( header.fileSize != mSize ) return false;
+
+    return isSectionInside( header.hulls.data.offset       , header.hulls.count       , sizeof(rpSceneHull)  , mSize ) &&
+           isSectionInside( header.shapes.data.offset      , header.shapes.count      , sizeof(rpSceneShape) , mSize ) &&
+           isSectionInside( header.proxies.data.offset     , header.proxies.count     , sizeof(rpSceneProxy) , mSize ) &&
+           isSectionInside( header.bodies.data.offset      , header.bodies.count      , sizeof(rpSceneBody)  , mSize ) &&
+           isSectionInside( header.joints.data.offset      , header.joints.count      , sizeof(rpSceneJoint) , mSize ) &&
+           isSectionInside( header.relocations.data.offset , header.relocations.count , sizeof(uint64)       , mSize );
+}
+
+
+
+bool rpSceneFile::relocate()
+{
+    /// Copy the table before the pointers are fixed up , an entry could point into the table.
+    /// Sorted , it lists every pointer of the file once
+    const uint64* relocations = reinterpret_cast<const uint64*>(mData + mHeader->relocations.data.offset);
+    std::vector<uint64> positions( relocations , relocations + mHeader->relocations.count );
+    std::sort( positions.begin() , positions.end() );
+
+    for( size_t i = 0; i < positions.size(); ++i )
+    {
+        const uint64 position = positions[i];
+        if( position % sizeof(uint64) != 0 || position + sizeof(uint64) > mSize ) return false;
+        if( i > 0 && position == positions[i - 1] ) return false;
+
+        rpScenePointer<char>* pointer = reinterpret_cast<rpScenePointer<char>*>(mData + position);
+        const uint64 offset = pointer->offset;
+        if( offset > mSize ) return false;
+
+        pointer->pointer = (offset != 0) ? mData + offset : NULL;
+    }
+
+    /// A pointer missing from the table would keep the raw bits of its offset
+    if( !isRelocated( mHeader->hulls       , mData , mSize , positions ) ||
+        !isRelocated( mHeader->shapes      , mData , mSize , positions ) ||
+        !isRelocated( mHeader->proxies     , mData , mSize , positions ) ||
+        !isRelocated( mHeader->bodies      , mData , mSize , positions ) ||
+        !isRelocated( mHeader->joints      , mData , mSize , positions ) ||
+        !isRelocated( mHeader->relocations , mData , mSize , positions ) ) return false;
+
+    /// The bulk data of the hulls must be inside the file too
+    for( uint32 i = 0; i < mHeader->hulls.count; ++i )
+    {
+        const rpSceneHull& hull = mHeader->hulls.data.pointer[i];
+        const char* end = mData + mSize;
+
+        if( !isRelocated( hull.vertices  , mData , mSize , positions ) ||
+            !isRelocated( hull.indices   , mData , mSize , positions ) ||
+            !isRelocated( hull.adjacency , mData , mSize , positions ) ) return false;
+
+        if( hull.nbVertices == 0 || hull.vertices.pointer == NULL || hull.indices.pointer == NULL ) return false;
+        if( (end - reinterpret_cast<const char*>(hull.vertices.pointer))  / (3 * sizeof(scalar)) < hull.nbVertices  ) return false;
+        if( (end - reinterpret_cast<const char*>(hull.indices.pointer))   / (3 * sizeof(uint32)) < hull.nbTriangles ) return false;
+        if( hull.adjacency.pointer != NULL &&
+            (end - reinterpret_cast<const char*>(hull.adjacency.pointer)) / (3 * sizeof(uint32)) < hull.nbTriangles ) return false;
+
+        /// The indices are read by the hull and the support queries without any check
+        for( uint32 j = 0; j < hull.nbTriangles * 3; ++j )
+        {
+            if( hull.indices.pointer[j] >= hull.nbVertices ) return false;
+            if( hull.adjacency.pointer != NULL && hull.adjacency.pointer[j] >= hull.nbTriangles &&
+                hull.adjacency.pointer[j] != SCENE_NULL_INDEX ) return false;
+        }
+    }
+
+    return true;
+}
+
+
+
+rpModelConvexHull* rpSceneFile::createModelHull(uint index) const
+{
+    const rpSceneHull& hull = getHull(index);
+
+    /// The file vertex layout is three packed scalars , exactly the Vector3 layout
+    static_assert( sizeof(Vector3) == 3 * sizeof(scalar) , "Vector3 layout mismatch with the scene file" );
+
+    rpModelConvexHull* model = new rpModelConvexHull( reinterpret_cast<const Vector3*>(hull.vertices.pointer) , hull.nbVertices ,
+                                                      hull.indices.pointer , hull.nbTriangles * 3 );
+
+    /// The exact inertia of the hull is computed by the exporter
+    const scalar* I = hull.inertiaTensor;
+    model->setMassProperties( hull.volume , sceneVector3(hull.centerOfMass) ,
+                              Matrix3x3( I[0] , I[1] , I[2] , I[3] , I[4] , I[5] , I[6] , I[7] , I[8] ));
+    return model;
+}
+
+
+
+rpCollisionShape* rpSceneFile::createShape( uint index , std::vector<rpModelConvexHull*>& hulls ) const
+{
+    const rpSceneShape& shape = getShape(index);
+
+    switch (shape.type)
+    {
+        case BOX:             return new rpBoxShape( sceneVector3(shape.extent) , shape.margin );
+        case SPHERE:          return new rpSphereShape( shape.extent[0] );
+        case CAPSULE:         return new rpCapsuleShape( shape.extent[0] , shape.extent[1] );
+        case CYLINDER:        return new rpCylinderShape( shape.extent[0] , shape.extent[1] , shape.margin );
+        case CONE:            return new rpConeShape( shape.extent[0] , shape.extent[1] , shape.margin );
+        case CONVEX_HULL_MESH:
+        {
+            if( shape.hull >= getNbHulls() ) return NULL;
+
+            /// The shapes of the same hull share its model
+            if( hulls[shape.hull] == NULL ) hulls[shape.hull] = createModelHull(shape.hull);
+            rpConvexHullShape* hullShape = new rpConvexHullShape( hulls[shape.hull] , shape.margin );
+            hullShape->setLocalScaling( sceneVector3(shape.scaling) );
+            return hullShape;
+        }
+
+        case CONCAVE_MESH:
+        {
+            if( shape.hull >= getNbHulls() ) return NULL;
+
+            /// The mesh shape copies the triangles and builds its tree
+            const rpSceneHull& mesh = getHull(shape.hull);
+            rpConcaveMeshShape* meshShape = new rpConcaveMeshShape( reinterpret_cast<const Vector3*>(mesh.vertices.pointer) ,
+                                                                    mesh.nbVertices , mesh.indices.pointer , mesh.nbTriangles );
+            /// The mesh builds its tree again with a new scaling
+            const Vector3 scaling = sceneVector3(shape.scaling);
+            if( scaling != Vector3(1,1,1) ) meshShape->setLocalScaling( scaling );
+            return meshShape;
+        }
+
+        default: return NULL;
+    }
+}
+
+
+
+void rpSceneFile::instantiate( rpDynamicsWorld* world ,
+                               std::vector<rpRigidPhysicsBody*>* bodies ,
+                               std::vector<rpJoint*>* joints ,
+                               std::vector<rpSceneJointRecord>* jointRecords ) const
+{
+    assert(isOpen() && world != NULL);
+
+    std::vector<rpRigidPhysicsBody*> createdBodies;
+    createdBodies.reserve(getNbBodies());
+
+    /// Models of the hulls , created with their first shape
+    std::vector<rpModelConvexHull*> hulls( getNbHulls() , NULL );
+
+    for( uint i = 0; i < getNbBodies(); ++i )
+    {
+        const rpSceneBody& record = getBody(i);
+
+        rpRigidPhysicsBody* body = world->createRigidBody( sceneTransform( record.position , record.orientation ));
+
+        for( uint p = record.firstProxy; p < record.firstProxy + record.nbProxies && p < mHeader->proxies.count; ++p )
+        {
+            const rpSceneProxy& proxy = getProxy(p);
+            if( proxy.shape >= getNbShapes() ) continue;
+
+            /// Every body owns its collision shapes
+            rpCollisionShape* shape = createShape( proxy.shape , hulls );
+            if( shape != NULL )
+            {
+                body->addCollisionShape( shape , proxy.mass , sceneTransform( proxy.position , proxy.orientation ));
+            }
+        }
+
+        rpPhysicsMaterial material;
+        material.setBounciness(record.bounciness);
+        material.setFrictionCoefficient(record.frictionCoefficient);
+        material.setRollingResistance(record.rollingResistance);
+        body->setMaterial(material);
+
+        /// Recompute the mass information with all the proxies
+        body->setType( BodyType(record.type) );
+
+        if( record.type != STATIC )
+        {
+            body->setLinearVelocity( sceneVector3(record.linearVelocity) );
+            body->setAngularVelocity( sceneVector3(record.angularVelocity) );
+        }
+
+        createdBodies.push_back(body);
+    }
+
+
+    for( uint i = 0; i < getNbJoints(); ++i )
+    {
+        const rpSceneJoint& record = getJoint(i);
+        if( record.body1 >= createdBodies.size() || record.body2 >= createdBodies.size() ) continue;
+
+        rpPhysicsBody* body1 = createdBodies[record.body1];
+        rpPhysicsBody* body2 = createdBodies[record.body2];
+
+        const bool isLimitEnabled = (record.flags & SCENE_JOINT_LIMIT_ENABLED) != 0;
+        const bool isMotorEnabled = (record.flags & SCENE_JOINT_MOTOR_ENABLED) != 0;
+
+        rpJointInfo* info = NULL;
+
+        switch (record.type)
+        {
+            case DISTANCEJOINT:
+            {
+                info = new rpDistanceJointInfo( body1 , body2 , record.distance );
+                break;
+            }
+
+            case BALLSOCKETJOINT:
+            {
+                info = new rpBallAndSocketJointInfo( body1 , body2 , sceneVector3(record.anchor) );
+                break;
+            }
+
+            case FIXEDJOINT:
+            {
+                info = new rpFixedJointInfo( body1 , body2 , sceneVector3(record.anchor) );
+                break;
+            }
+
+            case HINGEJOINT:
+            {
+                rpHingeJointInfo* hinge = new rpHingeJointInfo( body1 , body2 , sceneVector3(record.anchor) , sceneVector3(record.axis) );
+                hinge->isLimitEnabled = isLimitEnabled;
+                hinge->isMotorEnabled = isMotorEnabled;
+                hinge->minAngleLimit  = record.minLimit;
+                hinge->maxAngleLimit  = record.maxLimit;
+                hinge->motorSpeed     = record.motorSpeed;
+                hinge->maxMotorTorque = record.maxMotorForce;
+                info = hinge;
+                break;
+            }
+
+            case SLIDERJOINT:
+            {
+                rpSliderJointInfo* slider = new rpSliderJointInfo( body1 , body2 , sceneVector3(record.anchor) , sceneVector3(record.axis) );
+                slider->isLimitEnabled      = isLimitEnabled;
+                slider->isMotorEnabled      = isMotorEnabled;
+                slider->minTranslationLimit = record.minLimit;
+                slider->maxTranslationLimit = record.maxLimit;
+                slider->motorSpeed          = record.motorSpeed;
+                slider->maxMotorForce       = record.maxMotorForce;
+                info = slider;
+                break;
+            }
+
+            default: break;
+        }
+
+        if( info == NULL ) continue;
+
+        info->isCollisionEnabled = (record.flags & SCENE_JOINT_COLLISION_ENABLED) != 0;
+        info->positionCorrectionTechnique = JointsPositionCorrectionTechnique(record.positionCorrectionTechnique);
+
+        rpJoint* joint = world->createJoint(*info);
+        delete info;
+
+        if( joint == NULL ) continue;
+
+        if( joints != NULL ) joints->push_back(joint);
+
+        /// The record of the joint lets the world export it again
+        if( jointRecords != NULL )
+        {
+            rpSceneJointRecord jointRecord;
+            jointRecord.joint = record;
+            jointRecord.body1 = body1;
+            jointRecord.body2 = body2;
+            jointRecords->push_back(jointRecord);
+        }
+    }
+
+
+    if( bodies != NULL )
+    {
+        bodies->insert( bodies->end() , createdBodies.begin() , createdBodies.end() );
+    }
+}
+
+
+} /* namespace real_physics */
@@ -0,0 +1,169 @@
+/*
+ * rpSceneFile.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SOURCE_ENGIE_SERIALIZATION_RPSCENEFILE_H_
+#define SOURCE_ENGIE_SERIALIZATION_RPSCENEFILE_H_
+
+#include <vector>
+#include "rpSceneFormat.h"
+#include "../Collision/Shapes/rpConvexHullShape.h"
+
+namespace real_physics
+{
+
+class rpDynamicsWorld;
+class rpRigidPhysicsBody;
+class rpJoint;
+struct rpSceneJointRecord;
+
+
+// Class rpSceneFile
+/**
+ * Loader of the binary scene file (*.rps). The file is memory-mapped
+ * and the pointers are fixed up in place , so the hulls are used
+ * straight from the mapping without any QuickHull pass or copy of the vertices.
+ * The scene file must outlive every body instantiated from it.
+ */
+class rpSceneFile
+{
+
+   private:
+
+      //-------------------- Attributes --------------------//
+
+      /// Start of the file in memory
+      char*   mData;
+
+      /// Size of the file
+      size_t  mSize;
+
+      /// True if the file is memory-mapped (false : read into the heap)
+      bool    mIsMapped;
+
+      /// Header of the file
+      rpSceneHeader* mHeader;
+
+
+      //-------------------- Methods --------------------//
+
+      /// Private copy-constructor
+      rpSceneFile(const rpSceneFile& file);
+
+      /// Private assignment operator
+      rpSceneFile& operator=(const rpSceneFile& file);
+
+      /// Check the header and the sections of the file
+      bool validate() const;
+
+      /// Rewrite the offsets of the relocation table to the pointers
+      bool relocate();
+
+      /// Create a new collision shape , the shapes of the same hull share its model
+      rpCollisionShape* createShape( uint index , std::vector<rpModelConvexHull*>& hulls ) const;
+
+
+   public:
+
+      rpSceneFile();
+     ~rpSceneFile();
+
+
+      /// Map the file , return false if the file is not a valid scene
+      bool open( const char* fileName );
+
+      /// Unmap the file
+      void close();
+
+      /// Return true if a file is open
+      bool isOpen() const;
+
+
+      /// Create the model of a prebuilt hull (the vertices are not copied)
+      rpModelConvexHull* createModelHull( uint index ) const;
+
+      /// Create the bodies and the joints of the scene into the world , with the
+      /// records of the created joints (in the same order) to export them again
+      void instantiate( rpDynamicsWorld* world ,
+                        std::vector<rpRigidPhysicsBody*>* bodies       = NULL ,
+                        std::vector<rpJoint*>*            joints       = NULL ,
+                        std::vector<rpSceneJointRecord>*  jointRecords = NULL ) const;
+
+
+      //-------------------- Value --------------------//
+
+      uint getNbHulls()   const;
+      uint getNbShapes()  const;
+      uint getNbBodies()  const;
+      uint getNbJoints()  const;
+
+      const rpSceneHull&  getHull ( uint index ) const;
+      const rpSceneShape& getShape( uint index ) const;
+      const rpSceneBody&  getBody ( uint index ) const;
+      const rpSceneJoint& getJoint( uint index ) const;
+      const rpSceneProxy& getProxy( uint index ) const;
+};
+
+
+
+SIMD_INLINE bool rpSceneFile::isOpen() const
+{
+    return mHeader != NULL;
+}
+
+SIMD_INLINE uint rpSceneFile::getNbHulls() const
+{
+    return mHeader->hulls.count;
+}
+
+SIMD_INLINE uint rpSceneFile::getNbShapes() const
+{
+    return mHeader->shapes.count;
+}
+
+SIMD_INLINE uint rpSceneFile::getNbBodies() const
+{
+    return mHeader->bodies.count;
+}
+
+SIMD_INLINE uint rpSceneFile::getNbJoints() const
+{
+    return mHeader->joints.count;
+}
+
+SIMD_INLINE const rpSceneHull& rpSceneFile::getHull(uint index) const
+{
+    assert(index < mHeader->hulls.count);
+    return mHeader->hulls.data.pointer[index];
+}
+
+SIMD_INLINE const rpSceneShape& rpSceneFile::getShape(uint index) const
+{
+    assert(index < mHeader->shapes.count);
+    return mHeader->shapes.data.pointer[index];
+}
+
+SIMD_INLINE const rpSceneBody& rpSceneFile::getBody(uint index) const
+{
+    assert(index < mHeader->bodies.count);
+    return mHeader->bodies.data.pointer[index];
+}
+
+SIMD_INLINE const rpSceneJoint& rpSceneFile::getJoint(uint index) const
+{
+    assert(index < mHeader->joints.count);
+    return mHeader->joints.data.pointer[index];
+}
+
+SIMD_INLINE const rpSceneProxy& rpSceneFile::getProxy(uint index) const
+{
+    assert(index < mHeader->proxies.count);
+    return mHeader->proxies.data.pointer[index];
+}
+
+} /* namespace real_physics */
+
+#endif /* SOURCE_ENGIE_SERIALIZATION_RPSCENEFILE_H_ */
@@ -0,0 +1,211 @@
+/*
+ * rpSceneFormat.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SOURCE_ENGIE_SERIALIZATION_RPSCENEFORMAT_H_
+#define SOURCE_ENGIE_SERIALIZATION_RPSCENEFORMAT_H_
+
+#include "../config.h"
+#include "../LinearMaths/mathematics.h"
+
+namespace real_physics
+{
+
+
+/// Binary scene file layout (*.rps)
+///
+///  [ rpSceneHeader ]
+///  [ hulls | shapes | proxies | bodies | joints ]  <- records, contain pointers
+///  [ relocation table ]
+///  [ vertices | indices | adjacency ]              <- bulk read-only data
+///
+/// Every pointer is stored on the disk as an offset from the start of the file,
+/// and the relocation table lists the file offset of each of those pointers.
+/// After the file is mapped into memory the loader walks the relocation table once
+/// and rewrites every offset to an absolute address in place. The records are
+/// grouped at the head of the file so a private mapping only dirties a few pages,
+/// the bulk hull data is never touched and stays shared with the page cache.
+
+
+/// Magic number "RPSN"
+const uint32 SCENE_FILE_MAGIC = 0x4E535052;
+
+/// Version of the format, the major version change breaks the compatibility
+const uint16 SCENE_FILE_VERSION_MAJOR = 4;
+const uint16 SCENE_FILE_VERSION_MINOR = 0;
+
+/// Alignment of every section inside the file
+const uint32 SCENE_FILE_ALIGNMENT = 16;
+
+/// Null index (hull of a primitive shape)
+const uint32 SCENE_NULL_INDEX = 0xFFFFFFFF;
+
+
+
+/// Pointer stored on the disk as an offset and fixed up in place after the loading
+template<class T> union rpScenePointer
+{
+    uint64  offset;
+    T*      pointer;
+};
+
+
+/// Array of records
+template<class T> struct rpSceneArray
+{
+    rpScenePointer<T> data;
+    uint32            count;
+    uint32            padding;
+};
+
+
+
+/// Convex hull prebuilt with the QuickHull algorithm , or the triangles of a concave mesh
+struct rpSceneHull
+{
+    /// Vertex buffer (x,y,z) , it can be used directly as a Vector3 array
+    rpScenePointer<scalar> vertices;
+
+    /// Index buffer , three indices per triangle (CCW)
+    rpScenePointer<uint32> indices;
+
+    /// Adjacency : for every triangle edge (i , i+1) the index of the neighbour triangle
+    rpScenePointer<uint32> adjacency;
+
+    uint32 nbVertices;
+    uint32 nbTriangles;
+
+    /// Mass properties of the hull for a unit density (zero for a concave mesh) , they
+    /// give the exact inertia tensor of the convex hull shapes of the file
+    scalar volume;
+    scalar centerOfMass[3];
+
+    /// Inertia tensor (row major) relative to the center of mass for a unit density
+    scalar inertiaTensor[9];
+};
+
+
+/// Collision shape
+struct rpSceneShape
+{
+    /// CollisionShapeType of the shape
+    uint32 type;
+
+    /// Index of the hull (CONVEX_HULL_MESH) or of the triangles (CONCAVE_MESH)
+    uint32 hull;
+
+    scalar margin;
+
+    /// Half extent of the box , the radius of the sphere is stored in extent[0] ,
+    /// the radius and the height of the capsule , cylinder and cone in extent[0] and extent[1]
+    scalar extent[3];
+
+    /// Local scaling of the shape instance , the shapes of a shared hull or mesh
+    /// keep their own one (the dimensions of the primitives are stored already scaled)
+    scalar scaling[3];
+};
+
+
+/// Collision shape attached to a body
+struct rpSceneProxy
+{
+    uint32 shape;
+    scalar mass;
+    scalar position[3];
+    scalar orientation[4];
+};
+
+
+/// Rigid body
+struct rpSceneBody
+{
+    /// BodyType of the body
+    uint32 type;
+
+    /// Range of the proxies of the body
+    uint32 firstProxy;
+    uint32 nbProxies;
+
+    uint32 padding;
+
+    scalar position[3];
+    scalar orientation[4];
+
+    scalar linearVelocity[3];
+    scalar angularVelocity[3];
+
+    /// Material
+    scalar bounciness;
+    scalar frictionCoefficient;
+    scalar rollingResistance;
+};
+
+
+/// Joint flags
+enum SceneJointFlags { SCENE_JOINT_COLLISION_ENABLED = 1,
+                       SCENE_JOINT_LIMIT_ENABLED     = 2,
+                       SCENE_JOINT_MOTOR_ENABLED     = 4 };
+
+
+/// Constraint-joint
+struct rpSceneJoint
+{
+    /// JointType of the joint
+    uint32 type;
+
+    uint32 body1;
+    uint32 body2;
+
+    /// SceneJointFlags
+    uint32 flags;
+
+    /// JointsPositionCorrectionTechnique
+    uint32 positionCorrectionTechnique;
+
+    /// Anchor point and axis (hinge , slider) in world-space
+    scalar anchor[3];
+    scalar axis[3];
+
+    /// Distance of the distance joint
+    scalar distance;
+
+    /// Limits and motor (hinge , slider)
+    scalar minLimit;
+    scalar maxLimit;
+    scalar motorSpeed;
+    scalar maxMotorForce;
+};
+
+
+/// Header of the file
+struct rpSceneHeader
+{
+    uint32 magic;
+    uint16 versionMajor;
+    uint16 versionMinor;
+
+    /// sizeof(scalar) of the exporter , the file is only loadable with the same precision
+    uint32 scalarSize;
+
+    /// Size of the header , to skip unknown fields of the newer minor versions
+    uint32 headerSize;
+
+    uint64 fileSize;
+
+    rpSceneArray<rpSceneHull>  hulls;
+    rpSceneArray<rpSceneShape> shapes;
+    rpSceneArray<rpSceneProxy> proxies;
+    rpSceneArray<rpSceneBody>  bodies;
+    rpSceneArray<rpSceneJoint> joints;
+
+    /// File offsets of every rpScenePointer of the file
+    rpSceneArray<uint64>       relocations;
+};
+
+
+} /* namespace real_physics */
+
+#endif /* SOURCE_ENGIE_SERIALIZATION_RPSCENEFORMAT_H_ */
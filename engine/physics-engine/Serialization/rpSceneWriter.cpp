@@ -0,0 +1,602 @@
+/*
+ * rpSceneWriter.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#include "rpSceneWriter.h"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+#include "../Body/rpRigidPhysicsBody.h"
+#include "../Collision/Shapes/rpBoxShape.h"
+#include "../Collision/Shapes/rpSphereShape.h"
+#include "../Collision/Shapes/rpCapsuleShape.h"
+#include "../Collision/Shapes/rpCylinderShape.h"
+#include "../Collision/Shapes/rpConeShape.h"
+#include "../Dynamics/Joint/rpBallAndSocketJoint.h"
+#include "../Dynamics/Joint/rpDistanceJoint.h"
+#include "../Dynamics/Joint/rpFixedJoint.h"
+#include "../Dynamics/Joint/rpHingeJoint.h"
+#include "../Dynamics/Joint/rpSliderJoint.h"
+
+namespace real_physics
+{
+
+namespace
+{
+
+    SIMD_INLINE void sceneStore( scalar* out , const Vector3& v )
+    {
+        out[0] = v.x;
+        out[1] = v.y;
+        out[2] = v.z;
+    }
+
+    SIMD_INLINE void sceneStore( scalar* out , const Quaternion& q )
+    {
+        out[0] = q.x;
+        out[1] = q.y;
+        out[2] = q.z;
+        out[3] = q.w;
+    }
+
+    SIMD_INLINE uint64 sceneAlign( uint64 offset )
+    {
+        return (offset + SCENE_FILE_ALIGNMENT - 1) & ~uint64(SCENE_FILE_ALIGNMENT - 1);
+    }
+}
+
+
+rpSceneWriter::rpSceneWriter()
+{
+
+}
+
+rpSceneWriter::~rpSceneWriter()
+{
+    clear();
+}
+
+
+void rpSceneWriter::clear()
+{
+    mHulls.clear();
+    mHullVertices.clear();
+    mHullIndices.clear();
+    mHullAdjacency.clear();
+    mShapes.clear();
+    mProxies.clear();
+    mBodies.clear();
+    mJoints.clear();
+    mHullIndexes.clear();
+    mMeshIndexes.clear();
+    mBodyIndexes.clear();
+}
+
+
+
+uint32 rpSceneWriter::addHull(const rpModelConvexHull* hull)
+{
+    assert(hull != NULL);
+
+    std::map<const rpModelConvexHull*, uint32>::const_iterator it = mHullIndexes.find(hull);
+    if( it != mHullIndexes.end() ) return it->second;
+
+    const rpConvexHull<scalar>& convexHull = hull->mConvexHull;
+
+    std::vector<scalar> vertices;
+    vertices.reserve( convexHull.getVertexBuffer().size() * 3 );
+    for( size_t i = 0; i < convexHull.getVertexBuffer().size(); ++i )
+    {
+        const Vector3& v = convexHull.getVertexBuffer()[i];
+        vertices.push_back(v.x);
+        vertices.push_back(v.y);
+        vertices.push_back(v.z);
+    }
+
+    std::vector<uint32> indices( convexHull.getIndexBuffer().begin() , convexHull.getIndexBuffer().end() );
+
+    const uint32 index = addTriangles( vertices , indices );
+    computeMassProperties( mHullVertices[index] , mHullIndices[index] , mHulls[index] );
+    mHullIndexes[hull] = index;
+
+    return index;
+}
+
+
+uint32 rpSceneWriter::addMesh(const rpConcaveMeshShape* mesh)
+{
+    std::map<const rpConcaveMeshShape*, uint32>::const_iterator it = mMeshIndexes.find(mesh);
+    if( it != mMeshIndexes.end() ) return it->second;
+
+    std::vector<scalar> vertices;
+    vertices.reserve( mesh->getVertices().size() * 3 );
+    for( size_t i = 0; i < mesh->getVertices().size(); ++i )
+    {
+        const Vector3& v = mesh->getVertices()[i];
+        vertices.push_back(v.x);
+        vertices.push_back(v.y);
+        vertices.push_back(v.z);
+    }
+
+    std::vector<uint32> indices( mesh->getIndices().begin() , mesh->getIndices().end() );
+
+    const uint32 index = addTriangles( vertices , indices );
+    mMeshIndexes[mesh] = index;
+
+    return index;
+}
+
+
+uint32 rpSceneWriter::addTriangles(std::vector<scalar>& vertices, std::vector<uint32>& indices)
+{
+    rpSceneHull record;
+    memset( &record , 0 , sizeof(rpSceneHull) );
+    record.nbVertices  = uint32( vertices.size() / 3 );
+    record.nbTriangles = uint32( indices.size() / 3 );
+
+    std::vector<uint32> adjacency;
+    computeAdjacency( indices , adjacency );
+
+    const uint32 index = uint32(mHulls.size());
+    mHulls.push_back(record);
+    mHullVertices.push_back(std::vector<scalar>());
+    mHullIndices.push_back(std::vector<uint32>());
+    mHullAdjacency.push_back(std::vector<uint32>());
+    mHullVertices.back().swap(vertices);
+    mHullIndices.back().swap(indices);
+    mHullAdjacency.back().swap(adjacency);
+
+    return index;
+}
+
+
+
+uint32 rpSceneWriter::addShape(const rpCollisionShape* shape)
+{
+    rpSceneShape record;
+    memset( &record , 0 , sizeof(rpSceneShape) );
+    record.type = shape->getType();
+    record.hull = SCENE_NULL_INDEX;
+    sceneStore( record.scaling , shape->getScaling() );
+
+    switch (shape->getType())
+    {
+        case BOX:
+        {
+            const rpBoxShape* box = static_cast<const rpBoxShape*>(shape);
+            sceneStore( record.extent , box->getExtent() );
+            record.margin = box->getMargin();
+            break;
+        }
+
+        case SPHERE:
+        {
+            const rpSphereShape* sphere = static_cast<const rpSphereShape*>(shape);
+            record.extent[0] = sphere->getRadius();
+            record.margin = sphere->getMargin();
+            break;
+        }
+
+        case CAPSULE:
+        {
+            const rpCapsuleShape* capsule = static_cast<const rpCapsuleShape*>(shape);
+            record.extent[0] = capsule->getRadius();
+            record.extent[1] = capsule->getHeight();
+            record.margin = capsule->getMargin();
+            break;
+        }
+
+        case CYLINDER:
+        {
+            const rpCylinderShape* cylinder = static_cast<const rpCylinderShape*>(shape);
+            record.extent[0] = cylinder->getRadius();
+            record.extent[1] = cylinder->getHeight();
+            record.margin = cylinder->getMargin();
+            break;
+        }
+
+        case CONE:
+        {
+            const rpConeShape* cone = static_cast<const rpConeShape*>(shape);
+            record.extent[0] = cone->getRadius();
+            record.extent[1] = cone->getHeight();
+            record.margin = cone->getMargin();
+            break;
+        }
+
+        case CONVEX_HULL_MESH:
+        {
+            const rpConvexHullShape* hull = static_cast<const rpConvexHullShape*>(shape);
+            record.hull = addHull( hull->getModelHull() );
+            record.margin = hull->getMargin();
+            break;
+        }
+
+        case CONCAVE_MESH:
+        {
+            const rpConcaveMeshShape* mesh = static_cast<const rpConcaveMeshShape*>(shape);
+            record.hull = addMesh( mesh );
+            break;
+        }
+
+        default: assert(false); break;
+    }
+
+    mShapes.push_back(record);
+    return uint32(mShapes.size() - 1);
+}
+
+
+
+bool rpSceneWriter::isShapeSupported(const rpCollisionShape* shape)
+{
+    switch (shape->getType())
+    {
+        case BOX:
+        case SPHERE:
+        case CAPSULE:
+        case CYLINDER:
+        case CONE:
+        case CONVEX_HULL_MESH:
+        case CONCAVE_MESH:
+            return true;
+
+        /// The height field has no record in the format
+        default:
+            return false;
+    }
+}
+
+
+uint32 rpSceneWriter::addBody(const rpRigidPhysicsBody* body)
+{
+    assert(body != NULL);
+
+    std::map<const rpPhysicsBody*, uint32>::const_iterator it = mBodyIndexes.find(body);
+    if( it != mBodyIndexes.end() ) return it->second;
+
+    /// Reject the whole body before any of its shapes is added
+    for( const rpProxyShape* proxy = body->getProxyShapesList(); proxy != NULL; proxy = proxy->getNext() )
+    {
+        if( !isShapeSupported( proxy->getCollisionShape() ) ) return SCENE_NULL_INDEX;
+    }
+
+    rpSceneBody record;
+    memset( &record , 0 , sizeof(rpSceneBody) );
+
+    record.type = body->getType();
+    record.firstProxy = uint32(mProxies.size());
+
+    for( const rpProxyShape* proxy = body->getProxyShapesList(); proxy != NULL; proxy = proxy->getNext() )
+    {
+        rpSceneProxy proxyRecord;
+        proxyRecord.shape = addShape( proxy->getCollisionShape() );
+        proxyRecord.mass  = proxy->getMass();
+        sceneStore( proxyRecord.position    , proxy->getLocalToBodyTransform().getPosition() );
+        sceneStore( proxyRecord.orientation , proxy->getLocalToBodyTransform().getOrientation() );
+        mProxies.push_back(proxyRecord);
+    }
+
+    record.nbProxies = uint32(mProxies.size()) - record.firstProxy;
+
+    sceneStore( record.position        , body->getTransform().getPosition() );
+    sceneStore( record.orientation     , body->getTransform().getOrientation() );
+    sceneStore( record.linearVelocity  , body->getLinearVelocity() );
+    sceneStore( record.angularVelocity , body->getAngularVelocity() );
+
+    record.bounciness          = body->getMaterial().getBounciness();
+    record.frictionCoefficient = body->getMaterial().getFrictionCoefficient();
+    record.rollingResistance   = body->getMaterial().getRollingResistance();
+
+    const uint32 index = uint32(mBodies.size());
+    mBodies.push_back(record);
+    mBodyIndexes[body] = index;
+
+    return index;
+}
+
+
+
+rpSceneJointRecord rpSceneWriter::recordJoint(const rpJointInfo& jointInfo)
+{
+    rpSceneJointRecord record;
+    memset( &record.joint , 0 , sizeof(rpSceneJoint) );
+
+    rpSceneJoint& joint = record.joint;
+    joint.type  = jointInfo.type;
+    joint.body1 = SCENE_NULL_INDEX;
+    joint.body2 = SCENE_NULL_INDEX;
+    joint.flags = jointInfo.isCollisionEnabled ? SCENE_JOINT_COLLISION_ENABLED : 0;
+    joint.positionCorrectionTechnique = jointInfo.positionCorrectionTechnique;
+
+    record.body1 = jointInfo.body1;
+    record.body2 = jointInfo.body2;
+
+    switch (jointInfo.type)
+    {
+        case DISTANCEJOINT:
+        {
+            const rpDistanceJointInfo& info = static_cast<const rpDistanceJointInfo&>(jointInfo);
+            joint.distance = info.distanceWorldSpace;
+            break;
+        }
+
+        case BALLSOCKETJOINT:
+        {
+            const rpBallAndSocketJointInfo& info = static_cast<const rpBallAndSocketJointInfo&>(jointInfo);
+            sceneStore( joint.anchor , info.anchorPointWorldSpace );
+            break;
+        }
+
+        case FIXEDJOINT:
+        {
+            const rpFixedJointInfo& info = static_cast<const rpFixedJointInfo&>(jointInfo);
+            sceneStore( joint.anchor , info.anchorPointWorldSpace );
+            break;
+        }
+
+        case HINGEJOINT:
+        {
+            const rpHingeJointInfo& info = static_cast<const rpHingeJointInfo&>(jointInfo);
+            sceneStore( joint.anchor , info.anchorPointWorldSpace );
+            sceneStore( joint.axis   , info.rotationAxisWorld );
+            if( info.isLimitEnabled ) joint.flags |= SCENE_JOINT_LIMIT_ENABLED;
+            if( info.isMotorEnabled ) joint.flags |= SCENE_JOINT_MOTOR_ENABLED;
+            joint.minLimit      = info.minAngleLimit;
+            joint.maxLimit      = info.maxAngleLimit;
+            joint.motorSpeed    = info.motorSpeed;
+            joint.maxMotorForce = info.maxMotorTorque;
+            break;
+        }
+
+        case SLIDERJOINT:
+        {
+            const rpSliderJointInfo& info = static_cast<const rpSliderJointInfo&>(jointInfo);
+            sceneStore( joint.anchor , info.anchorPointWorldSpace );
+            sceneStore( joint.axis   , info.sliderAxisWorldSpace );
+            if( info.isLimitEnabled ) joint.flags |= SCENE_JOINT_LIMIT_ENABLED;
+            if( info.isMotorEnabled ) joint.flags |= SCENE_JOINT_MOTOR_ENABLED;
+            joint.minLimit      = info.minTranslationLimit;
+            joint.maxLimit      = info.maxTranslationLimit;
+            joint.motorSpeed    = info.motorSpeed;
+            joint.maxMotorForce = info.maxMotorForce;
+            break;
+        }
+
+        default: break;
+    }
+
+    return record;
+}
+
+
+void rpSceneWriter::addJoint(const rpSceneJointRecord& record)
+{
+    mJoints.push_back(record);
+}
+
+
+void rpSceneWriter::addJoint(const rpJointInfo& jointInfo)
+{
+    mJoints.push_back( recordJoint(jointInfo) );
+}
+
+
+
+void rpSceneWriter::computeAdjacency(const std::vector<uint32>& indices, std::vector<uint32>& adjacency)
+{
+    const uint32 nbTriangles = uint32(indices.size() / 3);
+    adjacency.assign( nbTriangles * 3 , SCENE_NULL_INDEX );
+
+    /// Directed edge (a , b) -> triangle , the neighbour owns the opposite edge (b , a)
+    std::map< std::pair<uint32,uint32> , uint32 > edges;
+    for( uint32 t = 0; t < nbTriangles; ++t )
+    {
+        for( uint32 e = 0; e < 3; ++e )
+        {
+            edges[ std::make_pair( indices[t*3 + e] , indices[t*3 + (e+1)%3] ) ] = t;
+        }
+    }
+
+    for( uint32 t = 0; t < nbTriangles; ++t )
+    {
+        for( uint32 e = 0; e < 3; ++e )
+        {
+            std::map< std::pair<uint32,uint32> , uint32 >::const_iterator it =
+                     edges.find( std::make_pair( indices[t*3 + (e+1)%3] , indices[t*3 + e] ) );
+
+            if( it != edges.end() ) adjacency[t*3 + e] = it->second;
+        }
+    }
+}
+
+
+
+void rpSceneWriter::computeMassProperties(const std::vector<scalar>& vertices,
+                                          const std::vector<uint32>& indices, rpSceneHull& hull)
+{
+    /// Sum of the signed tetrahedrons (origin , a , b , c) with the covariance
+    /// of the canonical tetrahedron : C = det(A) * A * C' * A^T
+    double volume = 0.0;
+    double center[3] = { 0.0 , 0.0 , 0.0 };
+    double covariance[3][3] = { {0,0,0} , {0,0,0} , {0,0,0} };
+
+    const size_t nbTriangles = indices.size() / 3;
+    for( size_t t = 0; t < nbTriangles; ++t )
+    {
+        const scalar* a = &vertices[ indices[t*3 + 0] * 3 ];
+        const scalar* b = &vertices[ indices[t*3 + 1] * 3 ];
+        const scalar* c = &vertices[ indices[t*3 + 2] * 3 ];
+
+        const double det = a[0] * (b[1]*c[2] - b[2]*c[1]) -
+                           a[1] * (b[0]*c[2] - b[2]*c[0]) +
+                           a[2] * (b[0]*c[1] - b[1]*c[0]);
+
+        volume += det / 6.0;
+
+        for( int i = 0; i < 3; ++i )
+        {
+            center[i] += det / 6.0 * (a[i] + b[i] + c[i]) / 4.0;
+
+            for( int j = 0; j < 3; ++j )
+            {
+                covariance[i][j] += det / 120.0 * ( 2.0 * (a[i]*a[j] + b[i]*b[j] + c[i]*c[j]) +
+                                                    a[i]*b[j] + b[i]*a[j] + a[i]*c[j] +
+                                                    c[i]*a[j] + b[i]*c[j] + c[i]*b[j] );
+            }
+        }
+    }
+
+    /// The winding of the hull can be reversed
+    if( volume < 0.0 )
+    {
+        volume = -volume;
+        for( int i = 0; i < 3; ++i )
+        {
+            center[i] = -center[i];
+            for( int j = 0; j < 3; ++j ) covariance[i][j] = -covariance[i][j];
+        }
+    }
+
+    hull.volume = scalar(volume);
+    if( volume <= MACHINE_EPSILON ) return;
+
+    for( int i = 0; i < 3; ++i ) center[i] /= volume;
+
+    /// Translate the covariance to the center of mass and convert it to the inertia tensor
+    for( int i = 0; i < 3; ++i )
+    {
+        for( int j = 0; j < 3; ++j )
+        {
+            covariance[i][j] -= volume * center[i] * center[j];
+        }
+    }
+
+    const double trace = covariance[0][0] + covariance[1][1] + covariance[2][2];
+    for( int i = 0; i < 3; ++i )
+    {
+        hull.centerOfMass[i] = scalar(center[i]);
+        for( int j = 0; j < 3; ++j )
+        {
+            hull.inertiaTensor[i*3 + j] = scalar( (i == j ? trace : 0.0) - covariance[i][j] );
+        }
+    }
+}
+
+
+
+bool rpSceneWriter::write(const char* fileName) const
+{
+    //------------------- Layout -------------------//
+
+    uint64 offset = sceneAlign( sizeof(rpSceneHeader) );
+
+    const uint64 hullsOffset   = offset; offset = sceneAlign( offset + mHulls.size()   * sizeof(rpSceneHull)  );
+    const uint64 shapesOffset  = offset; offset = sceneAlign( offset + mShapes.size()  * sizeof(rpSceneShape) );
+    const uint64 proxiesOffset = offset; offset = sceneAlign( offset + mProxies.size() * sizeof(rpSceneProxy) );
+    const uint64 bodiesOffset  = offset; offset = sceneAlign( offset + mBodies.size()  * sizeof(rpSceneBody)  );
+    const uint64 jointsOffset  = offset; offset = sceneAlign( offset + mJoints.size()  * sizeof(rpSceneJoint) );
+
+    /// Six pointers in the header and three per hull
+    const size_t nbRelocations = 6 + mHulls.size() * 3;
+    const uint64 relocationsOffset = offset; offset = sceneAlign( offset + nbRelocations * sizeof(uint64) );
+
+    std::vector<rpSceneHull> hulls(mHulls);
+    std::vector<uint64> relocations;
+    relocations.reserve(nbRelocations);
+
+    for( size_t i = 0; i < hulls.size(); ++i )
+    {
+        hulls[i].vertices.offset  = offset; offset = sceneAlign( offset + mHullVertices[i].size()  * sizeof(scalar) );
+        hulls[i].indices.offset   = offset; offset = sceneAlign( offset + mHullIndices[i].size()   * sizeof(uint32) );
+        hulls[i].adjacency.offset = offset; offset = sceneAlign( offset + mHullAdjacency[i].size() * sizeof(uint32) );
+
+        const uint64 record = hullsOffset + i * sizeof(rpSceneHull);
+        relocations.push_back( record + offsetof(rpSceneHull , vertices)  );
+        relocations.push_back( record + offsetof(rpSceneHull , indices)   );
+        relocations.push_back( record + offsetof(rpSceneHull , adjacency) );
+    }
+
+    const uint64 fileSize = offset;
+
+
+    //------------------- Header -------------------//
+
+    rpSceneHeader header;
+    memset( &header , 0 , sizeof(rpSceneHeader) );
+    header.magic        = SCENE_FILE_MAGIC;
+    header.versionMajor = SCENE_FILE_VERSION_MAJOR;
+    header.versionMinor = SCENE_FILE_VERSION_MINOR;
+    header.scalarSize   = sizeof(scalar);
+    header.headerSize   = sizeof(rpSceneHeader);
+    header.fileSize     = fileSize;
+
+    header.hulls.data.offset       = hullsOffset;       header.hulls.count       = uint32(mHulls.size());
+    header.shapes.data.offset      = shapesOffset;      header.shapes.count      = uint32(mShapes.size());
+    header.proxies.data.offset     = proxiesOffset;     header.proxies.count     = uint32(mProxies.size());
+    header.bodies.data.offset      = bodiesOffset;      header.bodies.count      = uint32(mBodies.size());
+    header.joints.data.offset      = jointsOffset;      header.joints.count      = uint32(mJoints.size());
+    header.relocations.data.offset = relocationsOffset; header.relocations.count = uint32(nbRelocations);
+
+    relocations.push_back( offsetof(rpSceneHeader , hulls)       + offsetof(rpSceneArray<rpSceneHull>  , data) );
+    relocations.push_back( offsetof(rpSceneHeader , shapes)      + offsetof(rpSceneArray<rpSceneShape> , data) );
+    relocations.push_back( offsetof(rpSceneHeader , proxies)     + offsetof(rpSceneArray<rpSceneProxy> , data) );
+    relocations.push_back( offsetof(rpSceneHeader , bodies)      + offsetof(rpSceneArray<rpSceneBody>  , data) );
+    relocations.push_back( offsetof(rpSceneHeader , joints)      + offsetof(rpSceneArray<rpSceneJoint> , data) );
+    relocations.push_back( offsetof(rpSceneHeader , relocations) + offsetof(rpSceneArray<uint64>       , data) );
+
+
+    //------------------- Joints -------------------//
+
+    std::vector<rpSceneJoint> joints;
+    joints.reserve(mJoints.size());
+    for( size_t i = 0; i < mJoints.size(); ++i )
+    {
+        rpSceneJoint joint = mJoints[i].joint;
+
+        std::map<const rpPhysicsBody*, uint32>::const_iterator body1 = mBodyIndexes.find(mJoints[i].body1);
+        std::map<const rpPhysicsBody*, uint32>::const_iterator body2 = mBodyIndexes.find(mJoints[i].body2);
+        if( body1 != mBodyIndexes.end() ) joint.body1 = body1->second;
+        if( body2 != mBodyIndexes.end() ) joint.body2 = body2->second;
+
+        joints.push_back(joint);
+    }
+
+
+    //------------------- Image -------------------//
+
+    std::vector<char> image( size_t(fileSize) , 0 );
+    char* data = &image[0];
+
+    memcpy( data , &header , sizeof(rpSceneHeader) );
+    if( !hulls.empty()    ) memcpy( data + hullsOffset   , &hulls[0]    , hulls.size()    * sizeof(rpSceneHull)  );
+    if( !mShapes.empty()  ) memcpy( data + shapesOffset  , &mShapes[0]  , mShapes.size()  * sizeof(rpSceneShape) );
+    if( !mProxies.empty() ) memcpy( data + proxiesOffset , &mProxies[0] , mProxies.size() * sizeof(rpSceneProxy) );
+    if( !mBodies.empty()  ) memcpy( data + bodiesOffset  , &mBodies[0]  , mBodies.size()  * sizeof(rpSceneBody)  );
+    if( !joints.empty()   ) memcpy( data + jointsOffset  , &joints[0]   , joints.size()   * sizeof(rpSceneJoint) );
+    memcpy( data + relocationsOffset , &relocations[0] , relocations.size() * sizeof(uint64) );
+
+    for( size_t i = 0; i < hulls.size(); ++i )
+    {
+        if( !mHullVertices[i].empty()  ) memcpy( data + hulls[i].vertices.offset  , &mHullVertices[i][0]  , mHullVertices[i].size()  * sizeof(scalar) );
+        if( !mHullIndices[i].empty()   ) memcpy( data + hulls[i].indices.offset   , &mHullIndices[i][0]   , mHullIndices[i].size()   * sizeof(uint32) );
+        if( !mHullAdjacency[i].empty() ) memcpy( data + hulls[i].adjacency.offset , &mHullAdjacency[i][0] , mHullAdjacency[i].size() * sizeof(uint32) );
+    }
+
+
+    FILE* file = fopen( fileName , "wb" );
+    if( file == NULL ) return false;
+
+    const bool isWritten = fwrite( data , 1 , image.size() , file ) == image.size();
+    fclose(file);
+
+    return isWritten;
+}
+
+
+} /* namespace real_physics */
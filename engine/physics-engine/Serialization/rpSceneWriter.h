@@ -0,0 +1,125 @@
+/*
+ * rpSceneWriter.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SOURCE_ENGIE_SERIALIZATION_RPSCENEWRITER_H_
+#define SOURCE_ENGIE_SERIALIZATION_RPSCENEWRITER_H_
+
+#include <map>
+#include <vector>
+#include "rpSceneFormat.h"
+#include "../Collision/Shapes/rpConvexHullShape.h"
+#include "../Collision/Shapes/rpConcaveMeshShape.h"
+
+namespace real_physics
+{
+
+class rpPhysicsBody;
+class rpRigidPhysicsBody;
+struct rpJointInfo;
+
+
+/// Joint recorded before the export (the bodies are resolved to indices at the writing)
+struct rpSceneJointRecord
+{
+    rpSceneJoint         joint;
+    const rpPhysicsBody* body1;
+    const rpPhysicsBody* body2;
+};
+
+
+// Class rpSceneWriter
+/**
+ * Builder of the binary scene file (*.rps). It collects the bodies of a
+ * world with their collision shapes , the prebuilt convex hulls (with
+ * adjacency) , the triangles of the concave meshes and the joints , and writes them in the
+ * layout of rpSceneFormat.h , ready to be memory-mapped by rpSceneFile.
+ */
+class rpSceneWriter
+{
+
+   private:
+
+      //-------------------- Attributes --------------------//
+
+      /// Hulls with their buffers
+      std::vector<rpSceneHull>             mHulls;
+      std::vector< std::vector<scalar> >   mHullVertices;
+      std::vector< std::vector<uint32> >   mHullIndices;
+      std::vector< std::vector<uint32> >   mHullAdjacency;
+
+      std::vector<rpSceneShape>  mShapes;
+      std::vector<rpSceneProxy>  mProxies;
+      std::vector<rpSceneBody>   mBodies;
+      std::vector<rpSceneJointRecord> mJoints;
+
+      /// Index of the already exported hulls , meshes and bodies
+      std::map<const rpModelConvexHull*  , uint32> mHullIndexes;
+      std::map<const rpConcaveMeshShape* , uint32> mMeshIndexes;
+      std::map<const rpPhysicsBody*      , uint32> mBodyIndexes;
+
+
+      //-------------------- Methods --------------------//
+
+      /// Private copy-constructor
+      rpSceneWriter(const rpSceneWriter& writer);
+
+      /// Private assignment operator
+      rpSceneWriter& operator=(const rpSceneWriter& writer);
+
+      /// Add a collision shape , return its index
+      uint32 addShape( const rpCollisionShape* shape );
+
+      /// Add the buffers of a hull or of a mesh , return the index of its record
+      uint32 addTriangles( std::vector<scalar>& vertices , std::vector<uint32>& indices );
+
+      /// Add the triangles of a concave mesh , return the index of its record
+      uint32 addMesh( const rpConcaveMeshShape* mesh );
+
+      /// Compute the triangle adjacency of the hull
+      static void computeAdjacency( const std::vector<uint32>& indices , std::vector<uint32>& adjacency );
+
+      /// Compute the volume , center of mass and inertia tensor of the hull (unit density)
+      static void computeMassProperties( const std::vector<scalar>& vertices ,
+                                         const std::vector<uint32>& indices , rpSceneHull& hull );
+
+
+   public:
+
+      rpSceneWriter();
+     ~rpSceneWriter();
+
+
+      /// Add a prebuilt hull , return its index
+      uint32 addHull( const rpModelConvexHull* hull );
+
+      /// Return true if the collision shape can be written to the scene file
+      static bool isShapeSupported( const rpCollisionShape* shape );
+
+      /// Add a body with all its collision shapes , return its index , or
+      /// SCENE_NULL_INDEX (and nothing is added) if one of its shapes is not supported
+      uint32 addBody( const rpRigidPhysicsBody* body );
+
+      /// Add a joint recorded with recordJoint()
+      void addJoint( const rpSceneJointRecord& record );
+
+      /// Add a joint from its construction info
+      void addJoint( const rpJointInfo& jointInfo );
+
+      /// Convert the construction info of a joint to a record
+      static rpSceneJointRecord recordJoint( const rpJointInfo& jointInfo );
+
+      /// Write the scene to the file , return false on failure
+      bool write( const char* fileName ) const;
+
+      /// Remove all the records
+      void clear();
+};
+
+
+} /* namespace real_physics */
+
+#endif /* SOURCE_ENGIE_SERIALIZATION_RPSCENEWRITER_H_ */
@@ -0,0 +1,17 @@
+/*
+ * serialization.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef SOURCE_ENGIE_SERIALIZATION_SERIALIZATION_H_
+#define SOURCE_ENGIE_SERIALIZATION_SERIALIZATION_H_
+
+
+#include "rpSceneFormat.h"
+#include "rpSceneFile.h"
+#include "rpSceneWriter.h"
+
+
+#endif /* SOURCE_ENGIE_SERIALIZATION_SERIALIZATION_H_ */
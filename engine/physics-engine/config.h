@@ -11,6 +11,7 @@
 // Libraries
 #include <limits>
 #include <cfloat>
+#include <cmath>
 #include <utility>
 
 #include "scalar.h"
@@ -40,6 +41,8 @@ typedef unsigned int   uint;
 typedef signed short   int16;
 typedef signed int     int32;
 typedef unsigned short uint16;
+typedef unsigned int   uint32;
+typedef unsigned long long uint64;
 
 
 // ------------------- Enumerations ------------------- //
@@ -57,6 +60,12 @@ enum JointsPositionCorrectionTechnique {BAUMGARTE_JOINTS, NON_LINEAR_GAUSS_SEIDE
 ///                 bodies momentum. This is the option used by default.
 enum ContactsPositionCorrectionTechnique {BAUMGARTE_CONTACTS, SPLIT_IMPULSES};
 
+/// Solver of the velocity constraints of the contacts
+/// SEQUENTIAL_IMPULSE_CONTACTS : One contact manifold after the other. This is the option used by default.
+/// WIDE_CONTACTS : Batches of contact manifolds without a common dynamic body, the
+///                 manifolds of a batch are solved together in the lanes of the SIMD registers.
+enum ContactSolverType {SEQUENTIAL_IMPULSE_CONTACTS, WIDE_CONTACTS};
+
 
 
 /// Pi constant
@@ -108,6 +117,13 @@ const uint DEFAULT_VELOCITY_SOLVER_NB_ITERATIONS = 10;
 /// Number of iterations when solving the position constraints of the Sequential Impulse technique
 const uint DEFAULT_POSITION_SOLVER_NB_ITERATIONS = 10;
 
+/// Number of iterations an island always runs before it can stop on convergence
+const uint DEFAULT_SOLVER_MIN_NB_ITERATIONS = 2;
+
+/// An island stops iterating when no accumulated impulse of its contacts
+/// changed more than this residual during an iteration
+const scalar DEFAULT_SOLVER_RESIDUAL_TOLERANCE = scalar(1e-4);
+
 
 
 
@@ -121,6 +137,11 @@ const scalar DYNAMIC_TREE_AABB_GAP = scalar(0.1);
 /// followin constant with the linear velocity and the elapsed time between two frames.
 const scalar DYNAMIC_TREE_AABB_LIN_GAP_MULTIPLIER = scalar(1.7);
 
+/// The collision shapes of a compound body are in the local AABB tree of the body
+/// and not in the broad-phase tree. Their broad-phase IDs (used as keys of the
+/// overlapping pairs) start at this value to never be a node ID of the broad-phase tree
+const int COMPOUND_SHAPE_ID_OFFSET = 1 << 30;
+
 
 
 
@@ -131,7 +152,7 @@ const int NB_MAX_CONTACT_MANIFOLDS_CONVEX_SHAPE = 1;
 
 /// Maximum number of contact manifolds in an overlapping pair that involves at
 /// least one concave collision shape.
-const int NB_MAX_CONTACT_MANIFOLDS_CONCAVE_SHAPE = 3;
+const int NB_MAX_CONTACT_MANIFOLDS_CONCAVE_SHAPE = 8;
 
 
 /// Maximum Collison Shape Type
@@ -174,6 +195,46 @@ const bool   INTERPOLATION_CONTACT_POINTS = false;
 
 
 
+/// Distance (in meters) under which the conservative advancement reports a time of impact
+const scalar CCD_TIME_OF_IMPACT_TOLERANCE = scalar(0.005);
+
+/// Maximal number of iterations of the conservative advancement
+const uint CCD_MAX_TIME_OF_IMPACT_ITERATIONS = 32;
+
+/// Maximal number of time of impact sub-steps of a body during one step
+const uint CCD_MAX_SUB_STEPS = 8;
+
+/// Fraction of the size of a shape it must move during a step before
+/// the continuous collision detection is done for it
+const scalar CCD_MOTION_THRESHOLD = scalar(0.5);
+
+
+
+/// Distance (in meters) added to the approach of two separated shapes during a step
+/// under which a speculative contact is created between them
+const scalar SPECULATIVE_CONTACT_MARGIN = scalar(0.02);
+
+
+
+/// Distance (in meters) one shape of a pair can move relative to the other since
+/// the contacts of the pair were computed before they are computed again
+const scalar DEFAULT_TEMPORAL_COHERENCE_LINEAR_TOLERANCE = scalar(0.002);
+
+/// Angle (in radians) one shape of a pair can turn relative to the other , or the
+/// pair can turn in world-space , since the contacts of the pair were computed
+/// before they are computed again
+const scalar DEFAULT_TEMPORAL_COHERENCE_ANGULAR_TOLERANCE = scalar(0.5 * (PI / 180.0));
+
+
+
+/// Fraction of the light velocity under which a body is integrated as in
+/// Newtonian mechanics. Its Lorentz factor differs from one by about beta^2 / 2 ,
+/// the threshold keeps it under the epsilon of the scalar (beta ~ 0.0005 in float) ,
+/// so the Newtonian motion is the relativistic motion rounded to the precision
+const scalar NEWTONIAN_VELOCITY_THRESHOLD = std::sqrt(scalar(2.0) * std::numeric_limits<scalar>::epsilon());
+
+
+
 }  // namespace
 
 #endif /* SOURCE_ENGIE_CONFIG_H_ */
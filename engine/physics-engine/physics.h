@@ -14,6 +14,8 @@
 #include "../physics-engine/Geometry/geometry.h"
 #include "../physics-engine/LinearMaths/mathematics.h"
 #include "../physics-engine/Memory/memory.h"
+#include "../physics-engine/Parallel/parallel.h"
+#include "../physics-engine/Serialization/serialization.h"
 
 
 #endif /* SRC_PHYSICS_ENGINE_PHYSICS_H_ */
@@ -14,6 +14,7 @@
 #include "Collision/collision.h"
 #include "Dynamics/dynamics.h"
 #include "Geometry/geometry.h"
+#include "Serialization/serialization.h"
 
 
 #endif /* SOURCE_ENGIE_REALPHYSICS_H_ */
@@ -0,0 +1,121 @@
+/*
+ * rpArticulationBenchmark.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+/**********************************************
+ *  Benchmark of the articulations (rpArticulation) against the
+ *  iterative solver of the joints. A chain of boxes linked by
+ *  ball-and-socket joints hangs from a static anchor and swings
+ *  under the gravity :
+ *
+ *    g++ -std=c++11 -O2 -pthread rpArticulationBenchmark.cpp \
+ *        $(find ../../engine/physics-engine -name '*.cpp') -o articulation
+ *    ./articulation [number of steps]
+ *
+ *  It prints the time of a step and the largest distance between
+ *  the two anchor points of a joint over the steps , for chains of
+ *  10 , 100 and 1000 links.
+ **********************************************/
+
+#include "../../engine/physics-engine/realphysics.h"
+#include "../Benchmark/rpBenchmark.h"
+
+#include <cstdlib>
+
+using namespace real_physics;
+
+
+namespace
+{
+
+    const scalar TIME_STEP   = scalar(1.0 / 60.0);
+    const scalar HALF_LENGTH = scalar(0.25);
+
+    struct rpChainResult
+    {
+        double milliseconds;
+        scalar maxJointError;
+    };
+
+
+    /// Simulate a chain of "nbLinks" links , solved by an articulation or by the iterative solver
+    rpChainResult simulate(bool isArticulation, uint nbLinks, uint nbSteps)
+    {
+        rpDynamicsWorld world(Vector3(0, -10, 0));
+
+        rpRigidPhysicsBody* anchor = world.createRigidBody(Transform(Vector3(0, 0, 0), Quaternion::identity()));
+        anchor->addCollisionShape(new rpBoxShape(Vector3(0.1, 0.1, 0.1)), 1);
+        anchor->setType(STATIC);
+
+        rpArticulation* articulation = isArticulation ? world.createArticulation() : NULL;
+
+        std::vector<rpRigidPhysicsBody*> links;
+        rpRigidPhysicsBody* previous = anchor;
+        for (uint i = 0; i < nbLinks; ++i)
+        {
+            const Vector3 position(2 * HALF_LENGTH * scalar(i + 1), 0, 0);
+            rpRigidPhysicsBody* link = world.createRigidBody(Transform(position, Quaternion::identity()));
+            link->addCollisionShape(new rpBoxShape(Vector3(HALF_LENGTH, 0.05, 0.05)), 1);
+            link->setType(DYNAMIC);
+            links.push_back(link);
+
+            rpBallAndSocketJointInfo jointInfo(previous, link, Vector3(2 * HALF_LENGTH * scalar(i) + HALF_LENGTH, 0, 0));
+            jointInfo.isCollisionEnabled = false;
+            rpJoint* joint = world.createJoint(jointInfo);
+            if (articulation != NULL) articulation->addJoint(joint);
+
+            previous = link;
+        }
+
+        rpChainResult result;
+        result.milliseconds  = 0;
+        result.maxJointError = 0;
+        for (uint step = 0; step < nbSteps; ++step)
+        {
+            rpBenchmarkTimer timer;
+            world.updateFixedTime(TIME_STEP);
+            result.milliseconds += timer.elapsedMilliseconds();
+
+            // Distance between the end of a link and the start of the next one
+            Vector3 previousEnd(HALF_LENGTH, 0, 0);
+            for (uint i = 0; i < links.size(); ++i)
+            {
+                const Transform& transform = links[i]->getTransform();
+                result.maxJointError = Max(result.maxJointError, (transform * Vector3(-HALF_LENGTH, 0, 0) - previousEnd).length());
+                previousEnd = transform * Vector3(HALF_LENGTH, 0, 0);
+            }
+        }
+
+        result.milliseconds /= nbSteps;
+        return result;
+    }
+
+}
+
+
+int main(int argc, char** argv)
+{
+    const uint nbSteps = (argc > 1) ? uint(atoi(argv[1])) : 120;
+
+    const uint nbLinks[3] = { 10, 100, 1000 };
+    for (uint k = 0; k < 3; ++k)
+    {
+        const rpChainResult iterative    = simulate(false, nbLinks[k], nbSteps);
+        const rpChainResult articulation = simulate(true , nbLinks[k], nbSteps);
+
+        char name[64];
+        snprintf(name, sizeof(name), "%u links , iterative , step", nbLinks[k]);
+        rpBenchmarkPrint(name, iterative.milliseconds, "ms");
+        snprintf(name, sizeof(name), "%u links , iterative , joint error", nbLinks[k]);
+        rpBenchmarkPrint(name, iterative.maxJointError, "m");
+        snprintf(name, sizeof(name), "%u links , articulation , step", nbLinks[k]);
+        rpBenchmarkPrint(name, articulation.milliseconds, "ms");
+        snprintf(name, sizeof(name), "%u links , articulation , joint error", nbLinks[k]);
+        rpBenchmarkPrint(name, articulation.maxJointError, "m");
+    }
+
+    return 0;
+}
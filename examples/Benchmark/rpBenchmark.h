@@ -0,0 +1,117 @@
+/*
+ * rpBenchmark.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+#ifndef EXAMPLES_BENCHMARK_RPBENCHMARK_H_
+#define EXAMPLES_BENCHMARK_RPBENCHMARK_H_
+
+
+/**********************************************
+ *  Small harness shared by the benchmark programs of the examples
+ *  (examples/<Name>Benchmark). Each program is one file built with
+ *  the sources of the engine :
+ *
+ *    g++ -std=c++11 -O2 -pthread rpNameBenchmark.cpp \
+ *        $(find ../../engine/physics-engine -name '*.cpp') -o name
+ *
+ *  A measure runs its function a few times and keeps the median ,
+ *  the first run warms the caches and the allocators. The random
+ *  inputs come from a seeded generator , so every run and every
+ *  platform gets the same scene.
+ **********************************************/
+
+#include "../../engine/physics-engine/config.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+
+namespace real_physics
+{
+
+
+/// Wall clock time of a measure
+class rpBenchmarkTimer
+{
+    private:
+
+        std::chrono::steady_clock::time_point mStart;
+
+    public:
+
+        rpBenchmarkTimer()
+         : mStart(std::chrono::steady_clock::now())
+        {
+
+        }
+
+        /// Restart the timer
+        void start()
+        {
+            mStart = std::chrono::steady_clock::now();
+        }
+
+        /// Milliseconds since the start
+        double elapsedMilliseconds() const
+        {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - mStart).count();
+        }
+};
+
+
+/// Linear congruential generator , the same sequence on every platform
+class rpBenchmarkRandom
+{
+    private:
+
+        uint32 mSeed;
+
+    public:
+
+        explicit rpBenchmarkRandom(uint32 seed = 12345u)
+         : mSeed(seed)
+        {
+
+        }
+
+        /// Random scalar in [min , max]
+        scalar next(scalar min, scalar max)
+        {
+            mSeed = mSeed * 1664525u + 1013904223u;
+            return min + (max - min) * (scalar(mSeed >> 8) / scalar(1u << 24));
+        }
+};
+
+
+/// Run the function "nbRuns" times and return the median time of a run in milliseconds
+template<class Function>
+double rpBenchmarkMedian(uint nbRuns, Function function)
+{
+    std::vector<double> times;
+    for (uint i = 0; i < nbRuns; ++i)
+    {
+        rpBenchmarkTimer timer;
+        function();
+        times.push_back(timer.elapsedMilliseconds());
+    }
+
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+
+/// Print one line of the results : name of the case , value and unit
+inline void rpBenchmarkPrint(const char* name, double value, const char* unit)
+{
+    printf("%-40s %12.4f %s\n", name, value, unit);
+}
+
+
+} /* namespace real_physics */
+
+#endif /* EXAMPLES_BENCHMARK_RPBENCHMARK_H_ */
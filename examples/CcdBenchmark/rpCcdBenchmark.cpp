@@ -0,0 +1,108 @@
+/*
+ * rpCcdBenchmark.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+/**********************************************
+ *  Benchmark of the continuous collision detection
+ *  (rpRigidPhysicsBody::setIsCCDEnabled). Spheres fall at 150 m/s
+ *  onto a ground thinner than their motion in one step , with no
+ *  body , a few or all of them using the continuous detection :
+ *
+ *    g++ -std=c++11 -O2 -pthread rpCcdBenchmark.cpp \
+ *        $(find ../../engine/physics-engine -name '*.cpp') -o ccd
+ *    ./ccd [number of spheres]
+ *
+ *  It prints the time of a step and the number of the spheres
+ *  under the ground , and returns 1 if one of them went through it.
+ *  The speculative contacts already stop these straight falls , so
+ *  the benchmark gives the cost of the sweeps and of the times of
+ *  impact over the discrete detection.
+ **********************************************/
+
+#include "../../engine/physics-engine/realphysics.h"
+#include "../Benchmark/rpBenchmark.h"
+
+#include <cstdlib>
+
+using namespace real_physics;
+
+
+namespace
+{
+
+    const uint   NB_STEPS  = 60;
+    const scalar TIME_STEP = scalar(1.0 / 60.0);
+    const scalar SPEED     = scalar(150.0);
+
+    struct rpCcdResult
+    {
+        double milliseconds;
+        uint   nbTunneled;
+    };
+
+
+    /// Simulate the fall of the spheres , the first "nbCCDBodies" of them with the continuous detection
+    rpCcdResult simulate(uint nbBodies, uint nbCCDBodies)
+    {
+        rpDynamicsWorld world(Vector3(0, -10, 0));
+
+        rpRigidPhysicsBody* ground = world.createRigidBody(Transform(Vector3(0, -0.05, 0), Quaternion::identity()));
+        ground->addCollisionShape(new rpBoxShape(Vector3(500, 0.05, 500)), 10);
+        ground->setType(STATIC);
+
+        std::vector<rpRigidPhysicsBody*> bodies;
+        for (uint i = 0; i < nbBodies; ++i)
+        {
+            const Vector3 position(scalar(i % 32) * 3 - 48, 5, scalar(i / 32) * 3 - 48);
+            rpRigidPhysicsBody* body = world.createRigidBody(Transform(position, Quaternion::identity()));
+            body->addCollisionShape(new rpSphereShape(0.5), 1);
+            body->setType(DYNAMIC);
+            body->setIsCCDEnabled(i < nbCCDBodies);
+            body->setLinearVelocity(Vector3(0, -SPEED, 0));
+            bodies.push_back(body);
+        }
+
+        rpBenchmarkTimer timer;
+        for (uint step = 0; step < NB_STEPS; ++step)
+        {
+            world.updateFixedTime(TIME_STEP);
+        }
+
+        rpCcdResult result;
+        result.milliseconds = timer.elapsedMilliseconds() / NB_STEPS;
+        result.nbTunneled   = 0;
+        for (uint i = 0; i < nbBodies; ++i)
+        {
+            if (bodies[i]->getTransform().getPosition().y < scalar(-0.2)) result.nbTunneled++;
+        }
+
+        return result;
+    }
+
+}
+
+
+int main(int argc, char** argv)
+{
+    const uint nbBodies = (argc > 1) ? uint(atoi(argv[1])) : 1000;
+
+    const double fractions[4] = { 0.0, 0.01, 0.1, 1.0 };
+    bool isTunneling = false;
+    for (uint k = 0; k < 4; ++k)
+    {
+        const uint nbCCDBodies = uint(nbBodies * fractions[k]);
+        const rpCcdResult result = simulate(nbBodies, nbCCDBodies);
+
+        char name[64];
+        snprintf(name, sizeof(name), "%u spheres , %5.1f%% CCD , step", nbBodies, fractions[k] * 100);
+        rpBenchmarkPrint(name, result.milliseconds, "ms");
+        printf("    under the ground : %u\n", result.nbTunneled);
+
+        if (result.nbTunneled > 0) isTunneling = true;
+    }
+
+    return isTunneling ? 1 : 0;
+}
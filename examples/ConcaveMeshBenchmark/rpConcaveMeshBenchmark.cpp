@@ -0,0 +1,156 @@
+/*
+ * rpConcaveMeshBenchmark.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+/**********************************************
+ *  Benchmark of the concave triangle meshes (rpConcaveMeshShape)
+ *  against one static body by triangle. Boxes fall on a wavy grid
+ *  of triangles :
+ *
+ *    g++ -std=c++11 -O2 -pthread rpConcaveMeshBenchmark.cpp \
+ *        $(find ../../engine/physics-engine -name '*.cpp') -o mesh
+ *    ./mesh [number of cells of a side of the grid] [number of steps]
+ *
+ *  It prints the time to create the ground , the time of a step and
+ *  the range of the heights of the boxes for the two grounds. The
+ *  boxes must rest at the same heights.
+ **********************************************/
+
+#include "../../engine/physics-engine/realphysics.h"
+#include "../Benchmark/rpBenchmark.h"
+
+#include <cmath>
+#include <cstdlib>
+
+using namespace real_physics;
+
+
+namespace
+{
+
+    const uint   NB_BOXES_SIDE = 10;
+    const scalar TIME_STEP     = scalar(1.0 / 60.0);
+
+    struct rpGroundResult
+    {
+        double setupMilliseconds;
+        double stepMilliseconds;
+        scalar minHeight;
+        scalar maxHeight;
+    };
+
+
+    /// Simulate the boxes on the grid , one concave mesh or one body by triangle
+    rpGroundResult simulate(bool isMesh, const std::vector<Vector3>& vertices,
+                            const std::vector<uint>& indices, uint nbSteps)
+    {
+        rpDynamicsWorld world(Vector3(0, -10, 0));
+        rpGroundResult result;
+
+        rpBenchmarkTimer timer;
+        if (isMesh)
+        {
+            rpRigidPhysicsBody* ground = world.createRigidBody(Transform(Vector3(0, 0, 0), Quaternion::identity()));
+            ground->addCollisionShape(new rpConcaveMeshShape(vertices, indices), 10);
+            ground->setType(STATIC);
+        }
+        else
+        {
+            for (uint i = 0; i < indices.size(); i += 3)
+            {
+                rpRigidPhysicsBody* ground = world.createRigidBody(Transform(Vector3(0, 0, 0), Quaternion::identity()));
+                ground->addCollisionShape(new rpTriangleShape(vertices[indices[i]], vertices[indices[i + 1]],
+                                                              vertices[indices[i + 2]]), 10);
+                ground->setType(STATIC);
+            }
+        }
+        result.setupMilliseconds = timer.elapsedMilliseconds();
+
+        std::vector<rpRigidPhysicsBody*> boxes;
+        for (uint i = 0; i < NB_BOXES_SIDE; ++i)
+        {
+            for (uint j = 0; j < NB_BOXES_SIDE; ++j)
+            {
+                const Vector3 position(scalar(i) * 3 - scalar(NB_BOXES_SIDE) * scalar(1.5), scalar(1.5),
+                                       scalar(j) * 3 - scalar(NB_BOXES_SIDE) * scalar(1.5));
+                rpRigidPhysicsBody* box = world.createRigidBody(Transform(position, Quaternion::identity()));
+                box->addCollisionShape(new rpBoxShape(Vector3(0.5, 0.5, 0.5)), 1);
+                box->setType(DYNAMIC);
+                boxes.push_back(box);
+            }
+        }
+
+        // The first step creates the pairs of the broad phase
+        world.updateFixedTime(TIME_STEP);
+
+        timer.start();
+        for (uint step = 0; step < nbSteps; ++step)
+        {
+            world.updateFixedTime(TIME_STEP);
+        }
+        result.stepMilliseconds = timer.elapsedMilliseconds() / nbSteps;
+
+        result.minHeight = DECIMAL_LARGEST;
+        result.maxHeight = DECIMAL_SMALLEST;
+        for (uint i = 0; i < boxes.size(); ++i)
+        {
+            const scalar height = boxes[i]->getTransform().getPosition().y;
+            result.minHeight = Min(result.minHeight, height);
+            result.maxHeight = Max(result.maxHeight, height);
+        }
+
+        return result;
+    }
+
+
+    void print(const char* ground, const rpGroundResult& result)
+    {
+        char name[64];
+        snprintf(name, sizeof(name), "%s , setup", ground);
+        rpBenchmarkPrint(name, result.setupMilliseconds, "ms");
+        snprintf(name, sizeof(name), "%s , step", ground);
+        rpBenchmarkPrint(name, result.stepMilliseconds, "ms");
+        printf("    heights of the boxes [%.3f , %.3f]\n", double(result.minHeight), double(result.maxHeight));
+    }
+
+}
+
+
+int main(int argc, char** argv)
+{
+    const uint nbCells = (argc > 1) ? uint(atoi(argv[1])) : 64;
+    const uint nbSteps = (argc > 2) ? uint(atoi(argv[2])) : 120;
+
+    // Wavy grid of "nbCells" x "nbCells" cells of two triangles
+    std::vector<Vector3> vertices;
+    std::vector<uint>    indices;
+    const scalar start = -scalar(nbCells) * scalar(0.5);
+    for (uint z = 0; z <= nbCells; ++z)
+    {
+        for (uint x = 0; x <= nbCells; ++x)
+        {
+            const scalar X = start + scalar(x);
+            const scalar Z = start + scalar(z);
+            vertices.push_back(Vector3(X, scalar(0.3) * std::sin(X * scalar(0.3)) * std::cos(Z * scalar(0.3)), Z));
+        }
+    }
+    for (uint z = 0; z < nbCells; ++z)
+    {
+        for (uint x = 0; x < nbCells; ++x)
+        {
+            const uint a = z * (nbCells + 1) + x;
+            const uint c = a + nbCells + 1;
+            const uint triangles[6] = { a, c, a + 1, a + 1, c, c + 1 };
+            indices.insert(indices.end(), triangles, triangles + 6);
+        }
+    }
+
+    printf("%u triangles , %u boxes , %u steps\n", uint(indices.size() / 3), NB_BOXES_SIDE * NB_BOXES_SIDE, nbSteps);
+    print("concave mesh", simulate(true , vertices, indices, nbSteps));
+    print("body by triangle", simulate(false, vertices, indices, nbSteps));
+
+    return 0;
+}
@@ -0,0 +1,181 @@
+/*
+ * rpHeightFieldBenchmark.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+/**********************************************
+ *  Benchmark of the height-field terrains (rpHeightFieldShape)
+ *  against a concave mesh of the same triangles :
+ *
+ *    g++ -std=c++11 -O2 -pthread rpHeightFieldBenchmark.cpp \
+ *        $(find ../../engine/physics-engine -name '*.cpp') -o heightfield
+ *    ./heightfield [number of samples of a side] [number of rays]
+ *
+ *  It prints the setup time of the field , the time of a raycast
+ *  (vertical and oblique rays) and the time of a step with boxes and
+ *  spheres resting on it. Up to 256 samples a side , the same rays
+ *  and bodies run on the concave mesh too , and the program returns 1
+ *  if a ray hits one ground and not the other.
+ **********************************************/
+
+#include "../../engine/physics-engine/realphysics.h"
+#include "../Benchmark/rpBenchmark.h"
+
+#include <cmath>
+#include <cstdlib>
+
+using namespace real_physics;
+
+
+namespace
+{
+
+    const uint   NB_MAX_SAMPLES_MESH = 256;
+    const uint   NB_BODIES_SIDE      = 10;
+    const uint   NB_STEPS            = 120;
+    const scalar TIME_STEP           = scalar(1.0 / 60.0);
+    const scalar HEIGHT_SCALE        = scalar(0.001);
+
+
+    /// Time of a step of the bodies resting on the ground of the world
+    double simulate(rpDynamicsWorld& world)
+    {
+        for (uint i = 0; i < NB_BODIES_SIDE; ++i)
+        {
+            for (uint j = 0; j < NB_BODIES_SIDE; ++j)
+            {
+                const Vector3 position(scalar(i) * 3 - scalar(NB_BODIES_SIDE) * scalar(1.5) + scalar(0.3), 2,
+                                       scalar(j) * 3 - scalar(NB_BODIES_SIDE) * scalar(1.5) + scalar(0.2));
+                rpRigidPhysicsBody* body = world.createRigidBody(Transform(position, Quaternion::identity()));
+                if ((i + j) % 2) body->addCollisionShape(new rpSphereShape(0.5), 1);
+                else             body->addCollisionShape(new rpBoxShape(Vector3(0.5, 0.5, 0.5)), 1);
+                body->setType(DYNAMIC);
+            }
+        }
+
+        rpBenchmarkTimer timer;
+        for (uint step = 0; step < NB_STEPS; ++step)
+        {
+            world.updateFixedTime(TIME_STEP);
+        }
+        return timer.elapsedMilliseconds() / NB_STEPS;
+    }
+
+}
+
+
+int main(int argc, char** argv)
+{
+    const uint nbSamples = (argc > 1) ? uint(atoi(argv[1])) : 1024;
+    const uint nbRays    = (argc > 2) ? uint(atoi(argv[2])) : 100000;
+    const bool isMesh    = (nbSamples <= NB_MAX_SAMPLES_MESH);
+
+    // Two waves of integer heights
+    std::vector<int16> heights(size_t(nbSamples) * nbSamples);
+    scalar minHeight = DECIMAL_LARGEST;
+    scalar maxHeight = DECIMAL_SMALLEST;
+    for (uint z = 0; z < nbSamples; ++z)
+    {
+        for (uint x = 0; x < nbSamples; ++x)
+        {
+            const int16 height = int16(300 * std::sin(x * 0.3f) * std::cos(z * 0.3f) + 200 * std::sin(x * 0.01f + z * 0.013f));
+            heights[size_t(z) * nbSamples + x] = height;
+            minHeight = Min(minHeight, height * HEIGHT_SCALE);
+            maxHeight = Max(maxHeight, height * HEIGHT_SCALE);
+        }
+    }
+
+    printf("field of %u x %u samples , %u bytes of heights\n", nbSamples, nbSamples, uint(heights.size() * sizeof(int16)));
+
+    rpDynamicsWorld fieldWorld(Vector3(0, -10, 0));
+    rpBenchmarkTimer timer;
+    rpRigidPhysicsBody* field = fieldWorld.createRigidBody(Transform(Vector3(0, 0, 0), Quaternion::identity()));
+    field->addCollisionShape(new rpHeightFieldShape(nbSamples, nbSamples, minHeight, maxHeight, &heights[0],
+                                                    HEIGHT_SHORT_TYPE, HEIGHT_SCALE), 10);
+    field->setType(STATIC);
+    rpBenchmarkPrint("height field , setup", timer.elapsedMilliseconds(), "ms");
+
+
+    // The same triangles in a concave mesh , the field is centred in height
+    rpDynamicsWorld meshWorld(Vector3(0, -10, 0));
+    rpRigidPhysicsBody* mesh = NULL;
+    if (isMesh)
+    {
+        const scalar half   = scalar(nbSamples - 1) * scalar(0.5);
+        const scalar offset = (minHeight + maxHeight) * scalar(0.5);
+        std::vector<Vector3> vertices;
+        std::vector<uint>    indices;
+        for (uint z = 0; z < nbSamples; ++z)
+        {
+            for (uint x = 0; x < nbSamples; ++x)
+            {
+                vertices.push_back(Vector3(scalar(x) - half, heights[z * nbSamples + x] * HEIGHT_SCALE - offset, scalar(z) - half));
+            }
+        }
+        for (uint z = 0; z + 1 < nbSamples; ++z)
+        {
+            for (uint x = 0; x + 1 < nbSamples; ++x)
+            {
+                const uint a = z * nbSamples + x;
+                const uint c = a + nbSamples;
+                const uint triangles[6] = { a, c, a + 1, a + 1, c, c + 1 };
+                indices.insert(indices.end(), triangles, triangles + 6);
+            }
+        }
+
+        timer.start();
+        mesh = meshWorld.createRigidBody(Transform(Vector3(0, 0, 0), Quaternion::identity()));
+        mesh->addCollisionShape(new rpConcaveMeshShape(vertices, indices), 10);
+        mesh->setType(STATIC);
+        rpBenchmarkPrint("concave mesh , setup", timer.elapsedMilliseconds(), "ms");
+    }
+
+
+    // Every other ray is vertical , the others are oblique
+    rpBenchmarkRandom random;
+    const scalar half = scalar(nbSamples - 1) * scalar(0.5);
+    std::vector<Ray> rays;
+    for (uint i = 0; i < nbRays; ++i)
+    {
+        const Vector3 start(random.next(-half, half), 5, random.next(-half, half));
+        const Vector3 end = (i % 2 == 0) ? Vector3(start.x, -5, start.z) :
+                            start + Vector3(random.next(-30, 30), random.next(-9, -3), random.next(-30, 30));
+        rays.push_back(Ray(start, end));
+    }
+
+    std::vector<bool> fieldHits(nbRays);
+    timer.start();
+    for (uint i = 0; i < nbRays; ++i)
+    {
+        RaycastInfo info;
+        fieldHits[i] = field->raycast(rays[i], info);
+    }
+    rpBenchmarkPrint("height field , raycast", timer.elapsedMilliseconds() * 1000.0 / nbRays, "us");
+
+    uint nbMismatches = 0;
+    if (isMesh)
+    {
+        std::vector<bool> meshHits(nbRays);
+        timer.start();
+        for (uint i = 0; i < nbRays; ++i)
+        {
+            RaycastInfo info;
+            meshHits[i] = mesh->raycast(rays[i], info);
+        }
+        rpBenchmarkPrint("concave mesh , raycast", timer.elapsedMilliseconds() * 1000.0 / nbRays, "us");
+
+        for (uint i = 0; i < nbRays; ++i)
+        {
+            if (fieldHits[i] != meshHits[i]) nbMismatches++;
+        }
+        printf("    rays hitting one ground only : %u\n", nbMismatches);
+    }
+
+
+    rpBenchmarkPrint("height field , step", simulate(fieldWorld), "ms");
+    if (isMesh) rpBenchmarkPrint("concave mesh , step", simulate(meshWorld), "ms");
+
+    return (nbMismatches == 0) ? 0 : 1;
+}
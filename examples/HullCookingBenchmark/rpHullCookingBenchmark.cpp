@@ -0,0 +1,189 @@
+/*
+ * rpHullCookingBenchmark.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+/**********************************************
+ *  Benchmark of the cooking of the convex hulls on a thread pool
+ *  (rpQuickHullBatch , rpConvexHullCache::cookHulls) against the
+ *  serial QuickHull::getConvexHull path :
+ *
+ *    g++ -std=c++11 -O2 -pthread rpHullCookingBenchmark.cpp \
+ *        $(find ../../engine/physics-engine -name '*.cpp') -o cooking
+ *    ./cooking [number of threads] [number of clouds]
+ *
+ *  Three cases : the hulls of many small clouds (a level of meshes) ,
+ *  the same clouds cooked into a hull cache before the shapes are
+ *  created , and the hull of one large cloud. Zero threads use one
+ *  thread per core. The program fails if a hull of the pool differs
+ *  from the serial hull.
+ **********************************************/
+
+#include "../../engine/physics-engine/realphysics.h"
+#include "../Benchmark/rpBenchmark.h"
+
+#include <cmath>
+#include <cstdlib>
+
+using namespace real_physics;
+
+
+namespace
+{
+
+    const uint NB_RUNS = 3;
+
+    /// Random points in a ball , most of the points are inside the hull
+    std::vector<Vector3> createBall(rpBenchmarkRandom& random, uint nbPoints)
+    {
+        std::vector<Vector3> points;
+        while (points.size() < nbPoints)
+        {
+            const Vector3 point(random.next(-1, 1), random.next(-1, 1), random.next(-1, 1));
+            if (point.lengthSquare() <= 1) points.push_back(point);
+        }
+        return points;
+    }
+
+    /// True if the two hulls have the same vertices and the same faces
+    bool isSameHull(const quickhull::ConvexHull<scalar>& hull1, const quickhull::ConvexHull<scalar>& hull2)
+    {
+        if (hull1.getIndexBuffer() != hull2.getIndexBuffer()) return false;
+        if (hull1.getVertexBuffer().size() != hull2.getVertexBuffer().size()) return false;
+
+        for (size_t i = 0; i < hull1.getVertexBuffer().size(); ++i)
+        {
+            if (hull1.getVertexBuffer()[i] != hull2.getVertexBuffer()[i]) return false;
+        }
+        return true;
+    }
+
+
+    /// Hulls of many clouds : one QuickHull object against the batch
+    bool benchmarkClouds(rpThreadPool& threadPool, const std::vector< std::vector<Vector3> >& clouds)
+    {
+        quickhull::QuickHull<scalar> quickHull;
+        std::vector< quickhull::ConvexHull<scalar> > serialHulls(clouds.size());
+        const double serialMilliseconds = rpBenchmarkMedian(NB_RUNS, [&]()
+        {
+            for (uint i = 0; i < clouds.size(); ++i)
+            {
+                serialHulls[i] = quickHull.getConvexHull(clouds[i], true, false);
+            }
+        });
+
+        rpQuickHullBatch batch(threadPool);
+        std::vector< quickhull::ConvexHull<scalar> > batchHulls;
+        const double batchMilliseconds = rpBenchmarkMedian(NB_RUNS, [&]()
+        {
+            batch.compute(clouds, batchHulls);
+        });
+
+        printf("%u clouds :\n", uint(clouds.size()));
+        rpBenchmarkPrint("    serial getConvexHull", serialMilliseconds, "ms");
+        rpBenchmarkPrint("    rpQuickHullBatch", batchMilliseconds, "ms");
+
+        for (uint i = 0; i < clouds.size(); ++i)
+        {
+            if (!isSameHull(serialHulls[i], batchHulls[i]))
+            {
+                printf("    the hull of the cloud %u differs\n", i);
+                return false;
+            }
+        }
+        return true;
+    }
+
+
+    /// Shapes of the clouds from a hull cache : computed on demand against cooked first
+    bool benchmarkCache(rpThreadPool& threadPool, const std::vector< std::vector<Vector3> >& clouds)
+    {
+        uint nbSerialMisses = 0;
+        const double serialMilliseconds = rpBenchmarkMedian(NB_RUNS, [&]()
+        {
+            rpConvexHullCache cache;
+            for (uint i = 0; i < clouds.size(); ++i) delete cache.createShape(clouds[i]);
+            nbSerialMisses = cache.getNbMisses();
+        });
+
+        uint nbCooked = 0;
+        uint nbCookedHits = 0;
+        const double cookedMilliseconds = rpBenchmarkMedian(NB_RUNS, [&]()
+        {
+            rpConvexHullCache cache;
+            nbCooked = cache.cookHulls(clouds, threadPool);
+            for (uint i = 0; i < clouds.size(); ++i) delete cache.createShape(clouds[i]);
+            nbCookedHits = cache.getNbHits();
+        });
+
+        printf("hull cache , %u shapes :\n", uint(clouds.size()));
+        rpBenchmarkPrint("    createShape only", serialMilliseconds, "ms");
+        rpBenchmarkPrint("    cookHulls + createShape", cookedMilliseconds, "ms");
+
+        if (nbCooked != nbSerialMisses || nbCookedHits != clouds.size())
+        {
+            printf("    %u hulls cooked , %u computed on demand , %u shapes found their hull\n",
+                   nbCooked, nbSerialMisses, nbCookedHits);
+            return false;
+        }
+        return true;
+    }
+
+
+    /// Hull of one large cloud : one thread against all the threads of the pool
+    bool benchmarkLargeCloud(rpThreadPool& threadPool, const std::vector<Vector3>& cloud)
+    {
+        quickhull::QuickHull<scalar> quickHull;
+        quickhull::ConvexHull<scalar> serialHull;
+        const double serialMilliseconds = rpBenchmarkMedian(NB_RUNS, [&]()
+        {
+            serialHull = quickHull.getConvexHull(cloud, true, false);
+        });
+
+        rpQuickHullBatch batch(threadPool);
+        quickhull::ConvexHull<scalar> batchHull;
+        const double batchMilliseconds = rpBenchmarkMedian(NB_RUNS, [&]()
+        {
+            batchHull = batch.compute(cloud);
+        });
+
+        printf("cloud of %u points , %u hull vertices :\n", uint(cloud.size()),
+               uint(serialHull.getVertexBuffer().size()));
+        rpBenchmarkPrint("    serial getConvexHull", serialMilliseconds, "ms");
+        rpBenchmarkPrint("    rpQuickHullBatch", batchMilliseconds, "ms");
+
+        if (!isSameHull(serialHull, batchHull))
+        {
+            printf("    the hulls differ\n");
+            return false;
+        }
+        return true;
+    }
+
+}
+
+
+int main(int argc, char** argv)
+{
+    const uint nbThreads = (argc > 1) ? uint(atoi(argv[1])) : 0;
+    const uint nbClouds  = (argc > 2) ? uint(atoi(argv[2])) : 300;
+
+    rpThreadPool threadPool(nbThreads);
+    printf("%u threads\n", threadPool.getNbThreads());
+
+    rpBenchmarkRandom random;
+    std::vector< std::vector<Vector3> > clouds;
+    for (uint i = 0; i < nbClouds; ++i)
+    {
+        clouds.push_back(createBall(random, 1000 + uint(random.next(0, 2000))));
+    }
+
+    bool isSame = benchmarkClouds(threadPool, clouds);
+    isSame = benchmarkCache(threadPool, clouds) && isSame;
+    isSame = benchmarkLargeCloud(threadPool, createBall(random, 200000)) && isSame;
+    isSame = benchmarkLargeCloud(threadPool, createBall(random, 1000000)) && isSame;
+
+    return isSame ? 0 : 1;
+}
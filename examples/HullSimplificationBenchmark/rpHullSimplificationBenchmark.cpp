@@ -0,0 +1,167 @@
+/*
+ * rpHullSimplificationBenchmark.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+/**********************************************
+ *  Benchmark of the simplification of the convex hulls
+ *  (rpModelConvexHull::simplify). Bodies of one hull settle on the
+ *  ground , once with the hull given by QuickHull and once with the
+ *  simplified hull (2 degrees of plane merging , 32 vertices , 2% of
+ *  volume error) :
+ *
+ *    g++ -std=c++11 -O2 -pthread rpHullSimplificationBenchmark.cpp \
+ *        $(find ../../engine/physics-engine -name '*.cpp') -o simplification
+ *    ./simplification [number of bodies]
+ *
+ *  It prints the size of the hulls , the volume error , the time of
+ *  the simplification , the time of a step and the range of the rest
+ *  heights of the bodies for each cloud of points.
+ **********************************************/
+
+#include "../../engine/physics-engine/realphysics.h"
+#include "../Benchmark/rpBenchmark.h"
+
+#include <cmath>
+#include <cstdlib>
+
+using namespace real_physics;
+
+
+namespace
+{
+
+    const uint   NB_SETTLE_STEPS = 30;
+    const uint   NB_STEPS        = 90;
+    const scalar TIME_STEP       = scalar(1.0 / 60.0);
+
+    struct rpSettleResult
+    {
+        double stepMilliseconds;
+        scalar minHeight;
+        scalar maxHeight;
+    };
+
+
+    /// Points on an ellipsoid (Fibonacci sphere)
+    std::vector<Vector3> createEllipsoid(uint nbPoints)
+    {
+        std::vector<Vector3> points;
+        for (uint i = 0; i < nbPoints; ++i)
+        {
+            const scalar angle  = scalar(i) * scalar(2.399963);
+            const scalar z      = 1 - 2 * (scalar(i) + scalar(0.5)) / scalar(nbPoints);
+            const scalar radius = std::sqrt(1 - z * z);
+            points.push_back(Vector3(scalar(0.6) * radius * std::cos(angle), scalar(0.4) * z,
+                                     scalar(0.5) * radius * std::sin(angle)));
+        }
+        return points;
+    }
+
+    /// Points on the faces of a unit box , with a noise of 1 mm off the faces
+    std::vector<Vector3> createNoisyBox(uint nbPoints)
+    {
+        rpBenchmarkRandom random;
+        std::vector<Vector3> points;
+        for (uint i = 0; i < nbPoints; ++i)
+        {
+            const scalar u     = random.next(-0.5, 0.5);
+            const scalar w     = random.next(-0.5, 0.5);
+            const scalar side  = ((i / 6) % 2 == 0) ? scalar(0.5) : scalar(-0.5);
+            const scalar plane = side + random.next(-0.001, 0.001);
+            switch (i % 3)
+            {
+                case 0:  points.push_back(Vector3(plane, u, w)); break;
+                case 1:  points.push_back(Vector3(u, plane, w)); break;
+                default: points.push_back(Vector3(u, w, plane)); break;
+            }
+        }
+        return points;
+    }
+
+
+    /// Let the bodies of the hull settle on the ground (the shapes delete the hull)
+    rpSettleResult simulate(rpModelConvexHull* hull, uint nbBodies)
+    {
+        rpDynamicsWorld world(Vector3(0, -10, 0));
+
+        rpRigidPhysicsBody* ground = world.createRigidBody(Transform(Vector3(0, -3, 0), Quaternion::identity()));
+        ground->addCollisionShape(new rpBoxShape(Vector3(500, 3, 500)), 10);
+        ground->setType(STATIC);
+
+        std::vector<rpRigidPhysicsBody*> bodies;
+        for (uint i = 0; i < nbBodies; ++i)
+        {
+            const Vector3 position(scalar(i % 10) * scalar(1.05), scalar(0.6) + scalar((i / 10) % 2),
+                                   scalar(i / 20) * scalar(1.05));
+            rpRigidPhysicsBody* body = world.createRigidBody(Transform(position, Quaternion::identity()));
+            body->addCollisionShape(new rpConvexHullShape(hull), 1, Transform::identity());
+            body->setType(DYNAMIC);
+            bodies.push_back(body);
+        }
+
+        for (uint step = 0; step < NB_SETTLE_STEPS; ++step)
+        {
+            world.updateFixedTime(TIME_STEP);
+        }
+
+        rpBenchmarkTimer timer;
+        for (uint step = 0; step < NB_STEPS; ++step)
+        {
+            world.updateFixedTime(TIME_STEP);
+        }
+
+        rpSettleResult result;
+        result.stepMilliseconds = timer.elapsedMilliseconds() / NB_STEPS;
+        result.minHeight = DECIMAL_LARGEST;
+        result.maxHeight = DECIMAL_SMALLEST;
+        for (uint i = 0; i < bodies.size(); ++i)
+        {
+            const scalar height = bodies[i]->getTransform().getPosition().y;
+            result.minHeight = Min(result.minHeight, height);
+            result.maxHeight = Max(result.maxHeight, height);
+        }
+
+        return result;
+    }
+
+
+    void benchmark(const char* cloudName, const std::vector<Vector3>& points, uint nbBodies)
+    {
+        const rpConvexHullSimplification simplification(scalar(2.0) * PI / scalar(180.0), 32, scalar(0.02));
+
+        rpModelConvexHull* hull = new rpModelConvexHull(points);
+        rpModelConvexHull* simplifiedHull = new rpModelConvexHull(points);
+
+        rpBenchmarkTimer timer;
+        const rpConvexHullSimplificationReport report = simplifiedHull->simplify(simplification);
+        const double simplifyMilliseconds = timer.elapsedMilliseconds();
+
+        printf("%s : %u vertices / %u faces -> %u vertices / %u faces , volume error %.2f%%\n", cloudName,
+               report.nbVerticesBefore, report.nbFacesBefore, report.nbVertices, report.nbFaces,
+               double(report.volumeError) * 100);
+        rpBenchmarkPrint("    simplify", simplifyMilliseconds, "ms");
+
+        const rpSettleResult original   = simulate(hull, nbBodies);
+        const rpSettleResult simplified = simulate(simplifiedHull, nbBodies);
+        rpBenchmarkPrint("    original hull , step", original.stepMilliseconds, "ms");
+        rpBenchmarkPrint("    simplified hull , step", simplified.stepMilliseconds, "ms");
+        printf("    rest heights [%.3f , %.3f] -> [%.3f , %.3f]\n", double(original.minHeight), double(original.maxHeight),
+               double(simplified.minHeight), double(simplified.maxHeight));
+    }
+
+}
+
+
+int main(int argc, char** argv)
+{
+    const uint nbBodies = (argc > 1) ? uint(atoi(argv[1])) : 100;
+
+    benchmark("ellipsoid , 2000 points", createEllipsoid(2000), nbBodies);
+    benchmark("ellipsoid , 300 points" , createEllipsoid(300) , nbBodies);
+    benchmark("noisy box , 2000 points", createNoisyBox(2000) , nbBodies);
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+/*
+ * rpSimdBenchmark.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+/**********************************************
+ *  Micro-benchmark of the SIMD specialisations of the linear
+ *  maths (rpSimd.h). It prints the time of one operation in
+ *  nanoseconds , build it twice to compare the SIMD path with
+ *  the scalar templates :
+ *
+ *    g++ -std=c++11 -O2 rpSimdBenchmark.cpp -o simd_bench
+ *    g++ -std=c++11 -O2 -DRP_NO_SIMD rpSimdBenchmark.cpp -o scalar_bench
+ *    ./simd_bench && ./scalar_bench
+ *
+ *  Each operation runs over arrays of seeded random operands and
+ *  writes an array of results , a checksum of the results keeps
+ *  the compiler from dropping them.
+ **********************************************/
+
+#include "../../engine/physics-engine/LinearMaths/rpMatrix3x3.h"
+#include "../../engine/physics-engine/LinearMaths/rpMinkowskiVector4.h"
+#include "../../engine/physics-engine/LinearMaths/rpQuaternion.h"
+#include "../Benchmark/rpBenchmark.h"
+
+using namespace real_physics;
+
+
+namespace
+{
+
+    const uint NB_OPERANDS = 4096;
+    const uint NB_PASSES   = 2000;
+    const uint NB_RUNS     = 5;
+
+    /// Keeps the results alive
+    volatile float sink = 0.0f;
+
+
+    /// Nanoseconds of one operation from the median time of a run
+    template<class Function>
+    void measure(const char* name, Function function)
+    {
+        const double milliseconds = rpBenchmarkMedian(NB_RUNS, function);
+        rpBenchmarkPrint(name, milliseconds * 1e6 / (double(NB_OPERANDS) * NB_PASSES), "ns");
+    }
+
+}
+
+
+int main()
+{
+#if defined(RP_SIMD_SSE)
+    printf("path: SSE2\n");
+#elif defined(RP_SIMD_NEON)
+    printf("path: NEON\n");
+#else
+    printf("path: scalar\n");
+#endif
+
+    rpBenchmarkRandom random;
+    std::vector< rpQuaternion<float> >       quaternions;
+    std::vector< rpVector3D<float> >         vectors;
+    std::vector< rpMatrix3x3<float> >        matrices;
+    std::vector< rpMinkowskiVector4<float> > fourVectors;
+    for (uint i = 0; i < NB_OPERANDS + 1; ++i)
+    {
+        const rpQuaternion<float> q(float(random.next(-1, 1)), float(random.next(-1, 1)),
+                                    float(random.next(-1, 1)), float(random.next(-1, 1)));
+        quaternions.push_back(q.getUnit());
+        vectors.push_back(rpVector3D<float>(float(random.next(-10, 10)), float(random.next(-10, 10)),
+                                            float(random.next(-10, 10))));
+        matrices.push_back(quaternions.back().getMatrix());
+        // Positive components , the division asserts them
+        fourVectors.push_back(rpMinkowskiVector4<float>(float(random.next(1, 2)), float(random.next(1, 2)),
+                                                        float(random.next(1, 2)), float(random.next(1, 2))));
+    }
+
+    std::vector< rpQuaternion<float> >       quaternionResults(NB_OPERANDS);
+    std::vector< rpVector3D<float> >         vectorResults(NB_OPERANDS);
+    std::vector< rpMatrix3x3<float> >        matrixResults(NB_OPERANDS);
+    std::vector< rpMinkowskiVector4<float> > fourVectorResults(NB_OPERANDS);
+
+
+    measure("quaternion * quaternion", [&]()
+    {
+        for (uint pass = 0; pass < NB_PASSES; ++pass)
+        {
+            for (uint i = 0; i < NB_OPERANDS; ++i) quaternionResults[i] = quaternions[i] * quaternions[i + 1];
+            sink = sink + quaternionResults[pass % NB_OPERANDS].w;
+        }
+    });
+
+    measure("quaternion * vector3", [&]()
+    {
+        for (uint pass = 0; pass < NB_PASSES; ++pass)
+        {
+            for (uint i = 0; i < NB_OPERANDS; ++i) vectorResults[i] = quaternions[i] * vectors[i];
+            sink = sink + vectorResults[pass % NB_OPERANDS].x;
+        }
+    });
+
+    measure("matrix3x3 * matrix3x3", [&]()
+    {
+        for (uint pass = 0; pass < NB_PASSES; ++pass)
+        {
+            for (uint i = 0; i < NB_OPERANDS; ++i) matrixResults[i] = matrices[i] * matrices[i + 1];
+            sink = sink + matrixResults[pass % NB_OPERANDS][0][0];
+        }
+    });
+
+    measure("minkowski4 +", [&]()
+    {
+        for (uint pass = 0; pass < NB_PASSES; ++pass)
+        {
+            for (uint i = 0; i < NB_OPERANDS; ++i) fourVectorResults[i] = fourVectors[i] + fourVectors[i + 1];
+            sink = sink + fourVectorResults[pass % NB_OPERANDS].t;
+        }
+    });
+
+    measure("minkowski4 /", [&]()
+    {
+        for (uint pass = 0; pass < NB_PASSES; ++pass)
+        {
+            for (uint i = 0; i < NB_OPERANDS; ++i) fourVectorResults[i] = fourVectors[i] / fourVectors[i + 1];
+            sink = sink + fourVectorResults[pass % NB_OPERANDS].t;
+        }
+    });
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*
+ * rpSimdCheck.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+/**********************************************
+ *  Standalone check of the SIMD specialisations of the linear
+ *  maths (rpSimd.h). It runs the same seeded inputs through every
+ *  specialised operation and prints one hash of the result bits by
+ *  operation. The SIMD build and the RP_NO_SIMD build must print
+ *  the same lines :
+ *
+ *    g++ -std=c++11 -O2 -ffp-contract=off rpSimdCheck.cpp -o simd
+ *    g++ -std=c++11 -O2 -ffp-contract=off -DRP_NO_SIMD rpSimdCheck.cpp -o scalar
+ *    ./simd > simd.txt && ./scalar > scalar.txt && diff simd.txt scalar.txt
+ *
+ *  Build on an ARM target the same way to check the NEON path.
+ *  "./simd dump" prints every result instead of the hashes , the
+ *  diff of two dumps gives the first input that differs.
+ *  -ffp-contract=off keeps the compiler from fusing the scalar
+ *  multiply-adds , the specialisations are not fused either.
+ **********************************************/
+
+#include "../../engine/physics-engine/LinearMaths/rpMatrix3x3.h"
+#include "../../engine/physics-engine/LinearMaths/rpMinkowskiVector4.h"
+#include "../../engine/physics-engine/LinearMaths/rpQuaternion.h"
+
+#include <cstdio>
+#include <cstring>
+
+using namespace real_physics;
+
+
+namespace
+{
+
+    const uint NB_ITERATIONS = 100000;
+
+    bool  isDump = false;
+    uint  seed   = 12345u;
+
+
+    /// Linear congruential generator , the same sequence on every platform
+    float randomFloat(float min, float max)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return min + (max - min) * (float(seed >> 8) / float(1u << 24));
+    }
+
+    /// Random float of random sign and magnitude in [minMagnitude , maxMagnitude]
+    float randomNonZero(float minMagnitude, float maxMagnitude)
+    {
+        const float value = randomFloat(minMagnitude, maxMagnitude);
+        return (randomFloat(0.0f, 1.0f) < 0.5f) ? -value : value;
+    }
+
+
+    /// FNV-1a hash of the bits of the results of one operation
+    struct rpResultHash
+    {
+        const char* name;
+        uint64      hash;
+        uint        nbValues;
+
+        explicit rpResultHash(const char* operationName)
+         : name(operationName), hash(14695981039346656037ull), nbValues(0)
+        {
+
+        }
+
+        void add(float value)
+        {
+            uint32 bits;
+            memcpy(&bits, &value, sizeof(bits));
+
+            if (isDump) printf("%s %u %08x\n", name, nbValues, bits);
+
+            for (uint i = 0; i < 4; ++i)
+            {
+                hash ^= (bits >> (8 * i)) & 0xFFu;
+                hash *= 1099511628211ull;
+            }
+            nbValues++;
+        }
+
+        void print() const
+        {
+            if (!isDump) printf("%-24s %8u %016llx\n", name, nbValues, (unsigned long long)hash);
+        }
+    };
+
+
+    rpMatrix3x3<float> randomMatrix()
+    {
+        return rpMatrix3x3<float>(randomFloat(-10.0f, 10.0f), randomFloat(-10.0f, 10.0f), randomFloat(-10.0f, 10.0f),
+                                  randomFloat(-10.0f, 10.0f), randomFloat(-10.0f, 10.0f), randomFloat(-10.0f, 10.0f),
+                                  randomFloat(-10.0f, 10.0f), randomFloat(-10.0f, 10.0f), randomFloat(-10.0f, 10.0f));
+    }
+
+    rpMinkowskiVector4<float> randomMinkowskiVector(float minMagnitude, float maxMagnitude)
+    {
+        return rpMinkowskiVector4<float>(randomNonZero(minMagnitude, maxMagnitude), randomNonZero(minMagnitude, maxMagnitude),
+                                         randomNonZero(minMagnitude, maxMagnitude), randomNonZero(minMagnitude, maxMagnitude));
+    }
+
+    rpQuaternion<float> randomQuaternion()
+    {
+        return rpQuaternion<float>(randomFloat(-1.0f, 1.0f), randomFloat(-1.0f, 1.0f),
+                                   randomFloat(-1.0f, 1.0f), randomFloat(-1.0f, 1.0f));
+    }
+
+    rpVector3D<float> randomVector()
+    {
+        return rpVector3D<float>(randomFloat(-100.0f, 100.0f), randomFloat(-100.0f, 100.0f), randomFloat(-100.0f, 100.0f));
+    }
+
+
+    void checkMatrix3x3()
+    {
+        rpResultHash result("matrix3x3 * matrix3x3");
+        for (uint i = 0; i < NB_ITERATIONS; ++i)
+        {
+            const rpMatrix3x3<float> m1 = randomMatrix();
+            const rpMatrix3x3<float> m2 = randomMatrix();
+            const rpMatrix3x3<float> product = m1 * m2;
+            for (uint row = 0; row < 3; ++row)
+            {
+                for (uint column = 0; column < 3; ++column) result.add(product[row][column]);
+            }
+        }
+        result.print();
+    }
+
+
+    void checkMinkowskiVector4()
+    {
+        rpResultHash add("minkowski4 +");
+        rpResultHash subtract("minkowski4 -");
+        rpResultHash multiply("minkowski4 *");
+        rpResultHash divide("minkowski4 /");
+        for (uint i = 0; i < NB_ITERATIONS; ++i)
+        {
+            const rpMinkowskiVector4<float> a = randomMinkowskiVector(1e-3f, 1e3f);
+            const rpMinkowskiVector4<float> b = randomMinkowskiVector(1e-3f, 1e3f);
+            // The division asserts positive components of the divisor
+            const rpMinkowskiVector4<float> c(randomFloat(1e-3f, 1e3f), randomFloat(1e-3f, 1e3f),
+                                              randomFloat(1e-3f, 1e3f), randomFloat(1e-3f, 1e3f));
+            const rpMinkowskiVector4<float> results[4] = { a + b, a - b, a * b, a / c };
+            rpResultHash* hashes[4] = { &add, &subtract, &multiply, &divide };
+            for (uint k = 0; k < 4; ++k)
+            {
+                hashes[k]->add(results[k].t);
+                hashes[k]->add(results[k].x);
+                hashes[k]->add(results[k].y);
+                hashes[k]->add(results[k].z);
+            }
+        }
+        add.print();
+        subtract.print();
+        multiply.print();
+        divide.print();
+    }
+
+
+    void checkQuaternion()
+    {
+        rpResultHash product("quaternion * quaternion");
+        rpResultHash rotation("quaternion * vector3");
+        for (uint i = 0; i < NB_ITERATIONS; ++i)
+        {
+            const rpQuaternion<float> q1 = randomQuaternion();
+            const rpQuaternion<float> q2 = randomQuaternion();
+            const rpQuaternion<float> q = q1 * q2;
+            product.add(q.x);
+            product.add(q.y);
+            product.add(q.z);
+            product.add(q.w);
+
+            const rpVector3D<float> v = q1 * randomVector();
+            rotation.add(v.x);
+            rotation.add(v.y);
+            rotation.add(v.z);
+        }
+        product.print();
+        rotation.print();
+    }
+
+}
+
+
+int main(int argc, char** argv)
+{
+    isDump = (argc > 1 && strcmp(argv[1], "dump") == 0);
+
+    // On the error output , so the two builds print the same lines
+#if defined(RP_SIMD_SSE)
+    fprintf(stderr, "path: SSE2\n");
+#elif defined(RP_SIMD_NEON)
+    fprintf(stderr, "path: NEON\n");
+#else
+    fprintf(stderr, "path: scalar\n");
+#endif
+
+    checkMatrix3x3();
+    checkMinkowskiVector4();
+    checkQuaternion();
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+/*
+ * rpSleepCheck.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+/**********************************************
+ *  Standalone check of the waking up of a sleeping stack.
+ *  A stack of boxes falls asleep on a static ground , then
+ *  only the bottom box is woken up. The contacts between the
+ *  sleeping boxes are kept , so the islands reach the whole
+ *  stack and every box must be awake after the next step :
+ *
+ *    g++ -std=c++11 -O2 -pthread rpSleepCheck.cpp \
+ *        $(find ../../engine/physics-engine -name '*.cpp') -o sleep
+ *    ./sleep
+ *
+ *  It prints the number of boxes still sleeping and returns 1
+ *  if the stack is not fully awake.
+ **********************************************/
+
+#include "../../engine/physics-engine/realphysics.h"
+
+#include <cstdio>
+#include <vector>
+
+using namespace real_physics;
+
+
+namespace
+{
+
+    const uint   NB_BOXES     = 10;
+    const uint   NB_STEPS     = 600;
+    const scalar TIME_STEP    = scalar(1.0 / 60.0);
+
+}
+
+
+int main()
+{
+    rpDynamicsWorld world(Vector3(0, -10, 0));
+
+    rpRigidPhysicsBody* ground = world.createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+    ground->addCollisionShape(new rpBoxShape(Vector3(50, 1, 50)), 10);
+    ground->setType(STATIC);
+
+    std::vector<rpRigidPhysicsBody*> boxes;
+    for (uint i = 0; i < NB_BOXES; ++i)
+    {
+        rpRigidPhysicsBody* box = world.createRigidBody(Transform(Vector3(0, scalar(0.5) + i, 0), Quaternion::identity()));
+        box->addCollisionShape(new rpBoxShape(Vector3(0.5, 0.5, 0.5)), 1);
+        box->setType(DYNAMIC);
+        boxes.push_back(box);
+    }
+
+    for (uint step = 0; step < NB_STEPS; ++step)
+    {
+        world.updateFixedTime(TIME_STEP);
+    }
+
+    uint nbSleeping = 0;
+    for (uint i = 0; i < NB_BOXES; ++i) nbSleeping += boxes[i]->isSleeping();
+    if (nbSleeping != NB_BOXES)
+    {
+        printf("the stack is not asleep : %u / %u boxes sleeping\n", nbSleeping, NB_BOXES);
+        return 1;
+    }
+
+    // Wake up the bottom box only
+    boxes[0]->setIsSleeping(false);
+    world.updateFixedTime(TIME_STEP);
+
+    nbSleeping = 0;
+    for (uint i = 0; i < NB_BOXES; ++i) nbSleeping += boxes[i]->isSleeping();
+
+    printf("boxes still sleeping one step after waking the bottom box : %u / %u\n", nbSleeping, NB_BOXES);
+    return (nbSleeping == 0) ? 0 : 1;
+}
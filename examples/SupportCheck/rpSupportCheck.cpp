@@ -0,0 +1,99 @@
+/*
+ * rpSupportCheck.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+/**********************************************
+ *  Standalone check of the support points of the proxy shapes
+ *  of a body moving near the light velocity. The support point
+ *  given by the cached matrices of the proxy shape must be the
+ *  corner of the boosted box furthest in the direction , found
+ *  with the full world transform (Lorentz boost * rotation of the
+ *  body * local transform of the shape) :
+ *
+ *    g++ -std=c++11 -O2 -pthread rpSupportCheck.cpp \
+ *        $(find ../../engine/physics-engine -name '*.cpp') -o support
+ *    ./support
+ *
+ *  It prints the largest error and returns 1 above the tolerance.
+ **********************************************/
+
+#include "../../engine/physics-engine/realphysics.h"
+
+#include <cstdio>
+
+using namespace real_physics;
+
+
+namespace
+{
+
+    const uint   NB_DIRECTIONS = 10000;
+    const scalar TOLERANCE     = scalar(1e-6);
+
+    uint seed = 12345u;
+
+    /// Linear congruential generator , the same sequence on every platform
+    scalar randomScalar(scalar min, scalar max)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return min + (max - min) * (scalar(seed >> 8) / scalar(1u << 24));
+    }
+
+}
+
+
+int main()
+{
+    rpDynamicsWorld world(Vector3(0, 0, 0));
+
+    const Vector3 extent(1.0, 2.0, 0.5);
+    rpRigidPhysicsBody* body = world.createRigidBody(Transform(Vector3(3, 1, -2),
+                                                     Quaternion(scalar(0.3), scalar(0.5), scalar(0.7))));
+    rpProxyShape* proxy = body->addCollisionShape(new rpBoxShape(extent, scalar(0.0)), 1,
+                                                  Transform(Vector3(0.5, 0, 0), Quaternion(scalar(0), scalar(0.4), scalar(0))));
+    body->setType(DYNAMIC);
+
+    // A large fraction of the light velocity , the boost is far from the identity
+    body->setLinearVelocity(Vector3(0.6, 0.3, -0.2) * LIGHT_MAX_VELOCITY_C);
+    world.updateFixedTime(scalar(1.0 / 60.0));
+
+    const LorentzContraction motion = body->getRelativityMotion();
+    if (motion.isIdentityBoost())
+    {
+        printf("the body is not boosted\n");
+        return 1;
+    }
+
+    // Full local-to-world transform of the box
+    const Matrix3x3 worldMatrix = motion.getLorentzMatrix() * body->getTransform().getBasis() *
+                                  proxy->getLocalToBodyTransform().getBasis();
+    const Vector3 worldPosition = motion.getLorentzMatrix() * (body->getTransform().getBasis() *
+                                  proxy->getLocalToBodyTransform().getPosition()) + body->getTransform().getPosition();
+
+    scalar maxError = 0;
+    for (uint i = 0; i < NB_DIRECTIONS; ++i)
+    {
+        const Vector3 direction(randomScalar(-1, 1), randomScalar(-1, 1), randomScalar(-1, 1));
+        if (direction.lengthSquare() < scalar(1e-6)) continue;
+
+        // Furthest corner of the boosted box in the direction
+        scalar maxProjection = SCALAR_SMALLEST;
+        for (uint c = 0; c < 8; ++c)
+        {
+            const Vector3 corner((c & 1) ? extent.x : -extent.x,
+                                 (c & 2) ? extent.y : -extent.y,
+                                 (c & 4) ? extent.z : -extent.z);
+            maxProjection = Max(maxProjection, direction.dot(worldMatrix * corner + worldPosition));
+        }
+
+        const Vector3 support = proxy->supportWorldTransformed(direction);
+        const scalar  error   = Abs(direction.dot(support) - maxProjection) / direction.length();
+        maxError = Max(maxError, error);
+    }
+
+    printf("support of the boosted box : max error %g\n", double(maxError));
+    return (maxError <= TOLERANCE) ? 0 : 1;
+}
@@ -141,6 +141,9 @@ bool UnitSceneDemo::initPhysics()
 
 
 
+    // The hulls of the meshes are cooked on all the cores , the bodies find them in the cache
+    UltimatePhysicsBody::cookConvexHulls( mMeshes );
+
     for( int i =0 ; i < 15; ++i )
     {
 
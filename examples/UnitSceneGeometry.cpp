@@ -73,6 +73,20 @@ void UnitSceneGeometry::initGeometry()
     mMeshes.push_back(model0);
 
 
+    const int NbSize = 140;
+    for( int i = 0; i < NbSize; i++ )
+    {
+        Mesh *model1 = new MeshBox( Vector3(5,4,5) );
+        model1->translateWorld( Vector3::Y * 5.0 * i + Vector3::X * 2.0 * sin(i) );
+        model1->setColorToAllVertices(Color(1,0,0,1));
+        mMeshes.push_back(model1);
+    }
+
+
+    // The hulls of the meshes are cooked on all the cores , the bodies find them in the cache
+    UltimatePhysicsBody::cookConvexHulls( mMeshes );
+
+
     UltimatePhysicsBody *body0 = world->createRigidBody( model0->getTransformMatrix() );
 
     model0->setToIdentity();
@@ -81,17 +95,12 @@ void UnitSceneGeometry::initGeometry()
 
 
 
-
-    const int NbSize = 140;
     UltimatePhysicsBody *bodies[NbSize];
     for( int i = 0; i < NbSize; i++ )
     {
 
         //************************************************//
-        Mesh *model1 = new MeshBox( Vector3(5,4,5) );
-        model1->translateWorld( Vector3::Y * 5.0 * i + Vector3::X * 2.0 * sin(i) );
-        model1->setColorToAllVertices(Color(1,0,0,1));
-        mMeshes.push_back(model1);
+        Mesh *model1 = mMeshes[i + 1];
 
         UltimatePhysicsBody *body1 = world->createRigidBody( model1->getTransformMatrix() );
         model1->setToIdentity();
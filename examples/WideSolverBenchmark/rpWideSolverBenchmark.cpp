@@ -0,0 +1,102 @@
+/*
+ * rpWideSolverBenchmark.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: wera
+ */
+
+/**********************************************
+ *  Benchmark of the batched contact solver (WIDE_CONTACTS) against
+ *  the sequential impulse solver on a pyramid of boxes :
+ *
+ *    g++ -std=c++11 -O2 -pthread rpWideSolverBenchmark.cpp \
+ *        $(find ../../engine/physics-engine -name '*.cpp') -o wide
+ *    ./wide [number of rows] [number of steps]
+ *
+ *  It prints the time of a step and the height of the top box for
+ *  each solver. The pyramid must stand with both of them , the
+ *  program returns 1 if the heights differ by more than 5 cm.
+ **********************************************/
+
+#include "../../engine/physics-engine/realphysics.h"
+#include "../Benchmark/rpBenchmark.h"
+
+#include <cstdlib>
+
+using namespace real_physics;
+
+
+namespace
+{
+
+    const scalar TIME_STEP = scalar(1.0 / 60.0);
+    const scalar TOLERANCE = scalar(0.05);
+
+    struct rpPyramidResult
+    {
+        double milliseconds;
+        scalar topHeight;
+    };
+
+
+    /// Simulate a pyramid of "nbRows" rows of unit boxes with the contact solver
+    rpPyramidResult simulate(ContactSolverType type, uint nbRows, uint nbSteps)
+    {
+        rpDynamicsWorld world(Vector3(0, -10, 0));
+        world.setContactSolverType(type);
+
+        rpRigidPhysicsBody* ground = world.createRigidBody(Transform(Vector3(0, -3, 0), Quaternion::identity()));
+        ground->addCollisionShape(new rpBoxShape(Vector3(100, 3, 100)), 10);
+        ground->setType(STATIC);
+
+        std::vector<rpRigidPhysicsBody*> boxes;
+        for (uint row = 0; row < nbRows; ++row)
+        {
+            for (uint i = 0; i < nbRows - row; ++i)
+            {
+                const Vector3 position(-scalar(nbRows - row) * scalar(0.55) + scalar(i) * scalar(1.1) + scalar(0.55),
+                                       scalar(0.5) + scalar(row), 0);
+                rpRigidPhysicsBody* box = world.createRigidBody(Transform(position, Quaternion::identity()));
+                box->addCollisionShape(new rpBoxShape(Vector3(0.5, 0.5, 0.5)), 1);
+                box->setType(DYNAMIC);
+                boxes.push_back(box);
+            }
+        }
+
+        rpBenchmarkTimer timer;
+        for (uint step = 0; step < nbSteps; ++step)
+        {
+            world.updateFixedTime(TIME_STEP);
+        }
+
+        rpPyramidResult result;
+        result.milliseconds = timer.elapsedMilliseconds() / nbSteps;
+        result.topHeight    = 0;
+        for (uint i = 0; i < boxes.size(); ++i)
+        {
+            result.topHeight = Max(result.topHeight, boxes[i]->getTransform().getPosition().y);
+        }
+
+        return result;
+    }
+
+}
+
+
+int main(int argc, char** argv)
+{
+    const uint nbRows  = (argc > 1) ? uint(atoi(argv[1])) : 20;
+    const uint nbSteps = (argc > 2) ? uint(atoi(argv[2])) : 120;
+
+    printf("pyramid of %u boxes , %u steps\n", nbRows * (nbRows + 1) / 2, nbSteps);
+
+    const rpPyramidResult sequential = simulate(SEQUENTIAL_IMPULSE_CONTACTS, nbRows, nbSteps);
+    rpBenchmarkPrint("sequential impulse , step", sequential.milliseconds, "ms");
+    rpBenchmarkPrint("sequential impulse , top height", sequential.topHeight, "m");
+
+    const rpPyramidResult wide = simulate(WIDE_CONTACTS, nbRows, nbSteps);
+    rpBenchmarkPrint("wide , step", wide.milliseconds, "ms");
+    rpBenchmarkPrint("wide , top height", wide.topHeight, "m");
+
+    return (Abs(sequential.topHeight - wide.topHeight) <= TOLERANCE) ? 0 : 1;
+}